@@ -0,0 +1,48 @@
+#include <benchmark/benchmark.h>
+
+#include <string>
+
+#include "include/Simd.h"
+
+// Entry point for math_bench. Same as benchmark_main, plus build and SIMD
+// metadata in the report context so JSON results from different machines or
+// configurations can be told apart by bench/compare.py.
+
+#ifndef AURELION_BENCH_COMPILER
+#define AURELION_BENCH_COMPILER "unknown"
+#endif
+#ifndef AURELION_BENCH_BUILD_TYPE
+#define AURELION_BENCH_BUILD_TYPE "unknown"
+#endif
+#ifndef AURELION_BENCH_CXX_FLAGS
+#define AURELION_BENCH_CXX_FLAGS ""
+#endif
+
+namespace {
+
+void addBuildContext() {
+    using math::simd::Backend;
+    benchmark::AddCustomContext("compiler", AURELION_BENCH_COMPILER);
+    benchmark::AddCustomContext("build_type", AURELION_BENCH_BUILD_TYPE);
+    benchmark::AddCustomContext("cxx_flags", AURELION_BENCH_CXX_FLAGS);
+    benchmark::AddCustomContext("simd_backend", math::simd::backendName(math::simd::activeBackend()));
+
+    std::string supported;
+    for (Backend b : {Backend::Scalar, Backend::Sse, Backend::Avx}) {
+        if (!math::simd::isSupported(b)) continue;
+        if (!supported.empty()) supported += ",";
+        supported += math::simd::backendName(b);
+    }
+    benchmark::AddCustomContext("simd_supported", supported);
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    benchmark::Initialize(&argc, argv);
+    if (benchmark::ReportUnrecognizedArguments(argc, argv)) return 1;
+    addBuildContext();
+    benchmark::RunSpecifiedBenchmarks();
+    benchmark::Shutdown();
+    return 0;
+}
@@ -0,0 +1,75 @@
+#include "LegacyVector3.h"
+
+#include <cmath>
+
+namespace bench {
+
+    LegacyVector3::LegacyVector3() : x(0.0f), y(0.0f), z(0.0f) {}
+
+    LegacyVector3::LegacyVector3(float x, float y, float z) : x(x), y(y), z(z) {}
+
+    LegacyVector3::LegacyVector3(const LegacyVector3 &other) : x(other.x), y(other.y), z(other.z) {}
+
+    LegacyVector3& LegacyVector3::operator=(const LegacyVector3& other) {
+        if (this != &other) {
+            x = other.x;
+            y = other.y;
+            z = other.z;
+        }
+        return *this;
+    }
+
+    LegacyVector3 LegacyVector3::operator+(const LegacyVector3& rhs) const {
+        return {x + rhs.x, y + rhs.y, z + rhs.z};
+    }
+
+    LegacyVector3 LegacyVector3::operator-(const LegacyVector3& rhs) const {
+        return {x - rhs.x, y - rhs.y, z - rhs.z};
+    }
+
+    LegacyVector3 LegacyVector3::operator*(float scalar) const {
+        return {x * scalar, y * scalar, z * scalar};
+    }
+
+    LegacyVector3 LegacyVector3::operator/(float scalar) const {
+        return {x / scalar, y / scalar, z / scalar};
+    }
+
+    LegacyVector3& LegacyVector3::operator+=(const LegacyVector3& rhs) {
+        x += rhs.x; y += rhs.y; z += rhs.z;
+        return *this;
+    }
+
+    LegacyVector3& LegacyVector3::operator*=(float scalar) {
+        x *= scalar; y *= scalar; z *= scalar;
+        return *this;
+    }
+
+    LegacyVector3& LegacyVector3::operator/=(float scalar) {
+        x /= scalar; y /= scalar; z /= scalar;
+        return *this;
+    }
+
+    float LegacyVector3::length() const {
+        return std::sqrt(x*x + y*y + z*z);
+    }
+
+    LegacyVector3 LegacyVector3::normalized() const {
+        float len = length();
+        if (len == 0) return {0,0,0};
+        return *this / len;
+    }
+
+    float LegacyVector3::dot(const LegacyVector3& rhs) const {
+        return x*rhs.x + y*rhs.y + z*rhs.z;
+    }
+
+    LegacyVector3 LegacyVector3::cross(const LegacyVector3& rhs) const {
+        return {
+            y*rhs.z - z*rhs.y,
+            z*rhs.x - x*rhs.z,
+            x*rhs.y - y*rhs.x
+        };
+    }
+
+} // namespace bench
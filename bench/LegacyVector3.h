@@ -0,0 +1,40 @@
+#pragma once
+
+namespace bench {
+
+/**
+ * @class LegacyVector3
+ * @brief Frozen copy of the pre-header-only math::Vector3.
+ *
+ * Every operation is defined out of line in LegacyVector3.cpp and the copy
+ * constructor/assignment are user-provided, exactly like the original class.
+ * It exists only so the benchmarks can measure the per-op cost of the old
+ * layout against the inline math::Vector3. Do not use it anywhere else.
+ */
+class LegacyVector3 {
+public:
+    float x;
+    float y;
+    float z;
+
+    LegacyVector3();
+    LegacyVector3(float x, float y, float z);
+    LegacyVector3(const LegacyVector3& other);
+    LegacyVector3& operator=(const LegacyVector3& other);
+
+    LegacyVector3 operator+(const LegacyVector3& rhs) const;
+    LegacyVector3 operator-(const LegacyVector3& rhs) const;
+    LegacyVector3 operator*(float scalar) const;
+    LegacyVector3 operator/(float scalar) const;
+
+    LegacyVector3& operator+=(const LegacyVector3& rhs);
+    LegacyVector3& operator*=(float scalar);
+    LegacyVector3& operator/=(float scalar);
+
+    float length() const;
+    LegacyVector3 normalized() const;
+    float dot(const LegacyVector3& rhs) const;
+    LegacyVector3 cross(const LegacyVector3& rhs) const;
+};
+
+} // namespace bench
@@ -0,0 +1,97 @@
+#include <benchmark/benchmark.h>
+
+#include <vector>
+
+#include "include/Affine3.h"
+
+// Building model matrices from T * R * S: full mat4 products against Affine3
+// and against the tagged fast paths.
+
+namespace {
+
+constexpr std::size_t COUNT = 1024;
+
+struct Pose {
+    math::Translation3 t;
+    math::Rotation3 r;
+    math::Scale3 s;
+};
+
+std::vector<Pose> makePoses() {
+    std::vector<Pose> poses(COUNT);
+    for (std::size_t i = 0; i < COUNT; ++i) {
+        const float f = static_cast<float>(i);
+        poses[i].t = {{f, 2.0f * f, -f}};
+        poses[i].r = math::Rotation3::axisAngle({0.0f, 1.0f, 0.0f}, f * 0.01f);
+        poses[i].s = {{1.0f + f * 0.001f, 1.0f, 1.0f}};
+    }
+    return poses;
+}
+
+void BM_ComposeMat4(benchmark::State& state) {
+    const auto poses = makePoses();
+    std::vector<mat4> out(COUNT);
+    for (auto _ : state) {
+        for (std::size_t i = 0; i < COUNT; ++i)
+            out[i] = poses[i].t.toMat4() * poses[i].r.toMat4() * poses[i].s.toMat4();
+        benchmark::DoNotOptimize(out.data());
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * COUNT));
+}
+
+void BM_ComposeAffine(benchmark::State& state) {
+    const auto poses = makePoses();
+    std::vector<math::Affine3> out(COUNT);
+    for (auto _ : state) {
+        for (std::size_t i = 0; i < COUNT; ++i)
+            out[i] = poses[i].t.toAffine() * poses[i].r.toAffine() * poses[i].s.toAffine();
+        benchmark::DoNotOptimize(out.data());
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * COUNT));
+}
+
+void BM_ComposeTagged(benchmark::State& state) {
+    const auto poses = makePoses();
+    std::vector<math::Affine3> out(COUNT);
+    for (auto _ : state) {
+        for (std::size_t i = 0; i < COUNT; ++i)
+            out[i] = poses[i].t * poses[i].r * poses[i].s;
+        benchmark::DoNotOptimize(out.data());
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * COUNT));
+}
+
+void BM_HierarchyMat4(benchmark::State& state) {
+    const auto poses = makePoses();
+    std::vector<mat4> local(COUNT);
+    for (std::size_t i = 0; i < COUNT; ++i) local[i] = (poses[i].t * poses[i].r).toMat4();
+    for (auto _ : state) {
+        mat4 world;
+        for (std::size_t i = 0; i < COUNT; ++i) world = world * local[i];
+        benchmark::DoNotOptimize(world);
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * COUNT));
+}
+
+void BM_HierarchyAffine(benchmark::State& state) {
+    const auto poses = makePoses();
+    std::vector<math::Affine3> local(COUNT);
+    for (std::size_t i = 0; i < COUNT; ++i) local[i] = poses[i].t * poses[i].r;
+    for (auto _ : state) {
+        math::Affine3 world;
+        for (std::size_t i = 0; i < COUNT; ++i) world = world * local[i];
+        benchmark::DoNotOptimize(world);
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * COUNT));
+}
+
+} // namespace
+
+BENCHMARK(BM_ComposeMat4);
+BENCHMARK(BM_ComposeAffine);
+BENCHMARK(BM_ComposeTagged);
+BENCHMARK(BM_HierarchyMat4);
+BENCHMARK(BM_HierarchyAffine);
@@ -0,0 +1,76 @@
+#include <benchmark/benchmark.h>
+
+#include <cmath>
+#include <random>
+#include <vector>
+
+#include "include/DynamicAabbTree.h"
+#include "include/SweepAndPrune.h"
+
+// Broadphase over N boxes scattered in a cube sized for ~constant density,
+// each moving a little every frame (arg 0 = box count). One iteration is one
+// frame: move, update the structure, produce the pair list.
+
+namespace {
+
+struct Scene {
+    std::vector<physics::Aabb> boxes;
+    std::vector<math::Vector3> velocity;
+
+    explicit Scene(std::size_t n) {
+        std::mt19937 rng(42);
+        const float extent = 2.0f * std::cbrt(static_cast<float>(n));
+        std::uniform_real_distribution<float> pos(-extent, extent), vel(-0.05f, 0.05f);
+        for (std::size_t i = 0; i < n; ++i) {
+            boxes.push_back(physics::Aabb::fromCenterHalfExtents({pos(rng), pos(rng), pos(rng)}, {0.5f, 0.5f, 0.5f}));
+            velocity.emplace_back(vel(rng), vel(rng), vel(rng));
+        }
+    }
+
+    void move(float sign) {
+        for (std::size_t i = 0; i < boxes.size(); ++i) {
+            const math::Vector3 d = velocity[i] * sign;
+            boxes[i] = {boxes[i].min + d, boxes[i].max + d};
+        }
+    }
+};
+
+void BM_SweepAndPrune(benchmark::State& state) {
+    Scene scene(static_cast<std::size_t>(state.range(0)));
+    physics::SweepAndPrune sap;
+    std::vector<physics::BroadphasePair> pairs;
+    sap.update(scene.boxes, pairs);
+    int frame = 0;
+    for (auto _ : state) {
+        scene.move((frame++ / 50) % 2 ? -1.0f : 1.0f); // oscillate to stay in the cube
+        sap.update(scene.boxes, pairs);
+        benchmark::DoNotOptimize(pairs.data());
+    }
+    state.counters["pairs"] = static_cast<double>(pairs.size());
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * state.range(0));
+}
+
+void BM_DynamicAabbTree(benchmark::State& state) {
+    Scene scene(static_cast<std::size_t>(state.range(0)));
+    physics::DynamicAabbTree tree(0.1f);
+    std::vector<std::int32_t> proxies;
+    for (std::uint32_t i = 0; i < scene.boxes.size(); ++i) proxies.push_back(tree.createProxy(scene.boxes[i], i));
+    std::vector<physics::BroadphasePair> pairs;
+    int frame = 0;
+    for (auto _ : state) {
+        const float sign = (frame++ / 50) % 2 ? -1.0f : 1.0f;
+        scene.move(sign);
+        for (std::size_t i = 0; i < proxies.size(); ++i) {
+            tree.moveProxy(proxies[i], scene.boxes[i], scene.velocity[i] * sign);
+        }
+        tree.findPairs(pairs);
+        benchmark::DoNotOptimize(pairs.data());
+    }
+    state.counters["pairs"] = static_cast<double>(pairs.size());
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * state.range(0));
+}
+
+} // namespace
+
+BENCHMARK(BM_SweepAndPrune)->Arg(1 << 10)->Arg(10000)->Arg(100000)->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_DynamicAabbTree)->Arg(1 << 10)->Arg(10000)->Arg(100000)->Unit(benchmark::kMicrosecond);
@@ -0,0 +1,83 @@
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "include/Components.h"
+#include "include/Ecs.h"
+#include "include/JobSystem.h"
+
+// EcsIntegrate: position += velocity * dt over N entities (arg 0) that also
+// carry a Renderable, through a chunked query (arg 1 = 1) or through
+// heap-allocated objects reached via a shuffled pointer list (arg 1 = 0),
+// the object-by-object layout the ECS replaces.
+// EcsStructuralChange: add and remove a component on 10k entities through
+// a CommandBuffer, per iteration.
+
+namespace {
+
+struct Velocity {
+    math::Vector3 value;
+};
+
+// Typical object-model node: the fields a system touches mixed with ones it does not
+struct SceneObject {
+    scene::Transform transform;
+    math::Vector3 velocity;
+    scene::Renderable renderable;
+    std::string name;
+    std::vector<SceneObject*> children;
+};
+
+void BM_EcsIntegrate(benchmark::State& state) {
+    const auto n = static_cast<std::size_t>(state.range(0));
+    const bool chunked = state.range(1) != 0;
+    const float dt = 1.0f / 60.0f;
+    scene::Registry registry;
+    std::vector<std::unique_ptr<SceneObject>> objects;
+    std::vector<SceneObject*> order;
+    for (std::size_t i = 0; i < n; ++i) {
+        const math::Vector3 velocity{static_cast<float>(i % 13), 1.0f, -1.0f};
+        if (chunked) {
+            registry.create(scene::Transform{}, Velocity{velocity}, scene::Renderable{});
+        } else {
+            objects.push_back(std::make_unique<SceneObject>());
+            objects.back()->velocity = velocity;
+            order.push_back(objects.back().get());
+        }
+    }
+    std::shuffle(order.begin(), order.end(), std::mt19937(7));
+    auto query = registry.query<scene::Transform, const Velocity>();
+    for (auto _ : state) {
+        if (chunked) {
+            query.forEach([&](scene::Transform& t, const Velocity& v) { t.position += v.value * dt; });
+        } else {
+            for (SceneObject* object : order) object->transform.position += object->velocity * dt;
+        }
+        benchmark::ClobberMemory();
+    }
+    state.SetLabel(chunked ? "ecs" : "objects");
+    state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(n));
+}
+BENCHMARK(BM_EcsIntegrate)->ArgsProduct({{100000, 1000000}, {0, 1}})->Unit(benchmark::kMicrosecond);
+
+void BM_EcsStructuralChange(benchmark::State& state) {
+    struct Tag {};
+    scene::Registry registry;
+    std::vector<scene::Entity> entities;
+    for (int i = 0; i < 10000; ++i) entities.push_back(registry.create(scene::Transform{}, Velocity{}));
+    scene::CommandBuffer commands;
+    for (auto _ : state) {
+        for (const scene::Entity e : entities) commands.add(e, Tag{});
+        registry.apply(commands);
+        for (const scene::Entity e : entities) commands.remove<Tag>(e);
+        registry.apply(commands);
+    }
+    state.SetItemsProcessed(state.iterations() * 20000);
+}
+BENCHMARK(BM_EcsStructuralChange)->Unit(benchmark::kMicrosecond);
+
+} // namespace
@@ -0,0 +1,50 @@
+#include <benchmark/benchmark.h>
+
+#include <vector>
+
+#include "include/JobSystem.h"
+#include "include/World.h"
+
+// Job system overhead and scaling (arg = thread count; results only scale as
+// far as the machine has cores).
+
+namespace {
+
+// Cost of one parallelFor over a trivial body: scheduling overhead only
+void BM_ParallelForOverhead(benchmark::State& state) {
+    core::JobSystem jobs(static_cast<unsigned>(state.range(0)));
+    std::vector<float> data(1 << 16, 1.0f);
+    for (auto _ : state) {
+        jobs.parallelFor(0, data.size(), 4096, [&](std::size_t begin, std::size_t end) {
+            for (std::size_t i = begin; i < end; ++i) data[i] *= 1.0001f;
+        });
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * static_cast<int64_t>(data.size()));
+}
+
+// Full world step over 1M bodies
+void BM_WorldStepThreads(benchmark::State& state) {
+    core::JobSystem jobs(static_cast<unsigned>(state.range(0)));
+    physics::World world;
+    const std::size_t n = 1 << 20;
+    world.bodies().reserve(n);
+    for (std::size_t i = 0; i < n; ++i) {
+        const float f = static_cast<float>(i);
+        physics::BodyDesc d;
+        d.position = {f, 0.0f, -f};
+        d.angularVelocity = {0.1f, 0.2f, 0.3f};
+        world.bodies().add(d);
+    }
+    world.setJobSystem(&jobs);
+    for (auto _ : state) {
+        world.step();
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * static_cast<int64_t>(n));
+}
+
+} // namespace
+
+BENCHMARK(BM_ParallelForOverhead)->Arg(1)->Arg(2)->Arg(4)->Unit(benchmark::kMicrosecond)->UseRealTime();
+BENCHMARK(BM_WorldStepThreads)->Arg(1)->Arg(2)->Arg(4)->Arg(8)->Unit(benchmark::kMillisecond)->UseRealTime();
@@ -0,0 +1,56 @@
+#include <benchmark/benchmark.h>
+
+#include <vector>
+
+#include "include/MatrixInverse.h"
+#include "include/Simd.h"
+
+// Per-object inverses: general (per backend, arg 0) against rigid.
+
+namespace {
+
+constexpr std::size_t COUNT = 1024;
+
+std::vector<mat4> makeMatrices() {
+    std::vector<mat4> in(COUNT);
+    for (std::size_t i = 0; i < COUNT; ++i) {
+        const float f = static_cast<float>(i) * 0.01f;
+        in[i] = (math::Translation3{{f, -f, 2.0f * f}} * math::Rotation3::axisAngle({0.0f, 1.0f, 0.0f}, f)).toMat4();
+    }
+    return in;
+}
+
+void BM_InverseGeneral(benchmark::State& state) {
+    const auto backend = static_cast<math::simd::Backend>(state.range(0));
+    const auto previous = math::simd::activeBackend();
+    if (!math::simd::setBackend(backend)) {
+        state.SkipWithError("backend not supported on this CPU");
+        return;
+    }
+    state.SetLabel(math::simd::backendName(backend));
+    const auto in = makeMatrices();
+    std::vector<mat4> out(COUNT);
+    for (auto _ : state) {
+        math::inverse(in, out);
+        benchmark::DoNotOptimize(out.data());
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * COUNT));
+    math::simd::setBackend(previous);
+}
+
+void BM_InverseRigid(benchmark::State& state) {
+    const auto in = makeMatrices();
+    std::vector<mat4> out(COUNT);
+    for (auto _ : state) {
+        math::inverseRigid(in, out);
+        benchmark::DoNotOptimize(out.data());
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * COUNT));
+}
+
+} // namespace
+
+BENCHMARK(BM_InverseGeneral)->DenseRange(0, 1);
+BENCHMARK(BM_InverseRigid);
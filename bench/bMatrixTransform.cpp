@@ -0,0 +1,57 @@
+#include <benchmark/benchmark.h>
+
+#include <vector>
+
+#include "include/MatrixTransform.h"
+
+// Per-object model matrices: translate * rotate * scale as two mat4 products
+// against the fused composeTRS builder.
+
+namespace {
+
+constexpr std::size_t COUNT = 1024;
+
+struct Poses {
+    std::vector<math::Vector3> positions;
+    std::vector<math::Quaternion> rotations;
+    std::vector<math::Vector3> factors;
+};
+
+Poses makePoses() {
+    Poses p;
+    for (std::size_t i = 0; i < COUNT; ++i) {
+        const float f = static_cast<float>(i);
+        p.positions.emplace_back(f, 2.0f * f, -f);
+        p.rotations.push_back(math::Quaternion::axisAngle({0.0f, 1.0f, 0.0f}, f * 0.01f));
+        p.factors.emplace_back(1.0f + f * 0.001f, 1.0f, 1.0f);
+    }
+    return p;
+}
+
+void BM_ModelMatrixProduct(benchmark::State& state) {
+    const auto p = makePoses();
+    std::vector<mat4> out(COUNT);
+    for (auto _ : state) {
+        for (std::size_t i = 0; i < COUNT; ++i)
+            out[i] = math::translate(p.positions[i]) * math::rotate(p.rotations[i]) * math::scale(p.factors[i]);
+        benchmark::DoNotOptimize(out.data());
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * COUNT));
+}
+
+void BM_ModelMatrixComposeTRS(benchmark::State& state) {
+    const auto p = makePoses();
+    std::vector<mat4> out(COUNT);
+    for (auto _ : state) {
+        math::composeTRS(p.positions, p.rotations, p.factors, out);
+        benchmark::DoNotOptimize(out.data());
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * COUNT));
+}
+
+} // namespace
+
+BENCHMARK(BM_ModelMatrixProduct);
+BENCHMARK(BM_ModelMatrixComposeTRS);
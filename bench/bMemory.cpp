@@ -0,0 +1,62 @@
+#include <benchmark/benchmark.h>
+
+#include <list>
+#include <memory>
+#include <memory_resource>
+#include <vector>
+
+#include "include/FrameArena.h"
+#include "include/Pool.h"
+
+// FrameScratch: a frame's worth of short-lived scratch arrays (arg 0 arrays
+// of 64..1024 floats), from new/delete (arg 1 = 0) or a FrameArena reset
+// every frame (arg 1 = 1).
+// NodeChurn: a 1024-node std::list filled and cleared, with the default
+// allocator (arg 0 = 0) or nodes from a PoolResource (arg 0 = 1).
+
+namespace {
+
+void BM_FrameScratch(benchmark::State& state) {
+    const auto arrays = static_cast<std::size_t>(state.range(0));
+    const bool arena = state.range(1) != 0;
+    core::memory::FrameArena frame;
+    std::vector<std::unique_ptr<float[]>> owned;
+    for (auto _ : state) {
+        for (std::size_t i = 0; i < arrays; ++i) {
+            const std::size_t count = 64 + (i * 37) % 960;
+            float* data;
+            if (arena) {
+                data = frame.allocateArray<float>(count).data();
+            } else {
+                data = owned.emplace_back(std::make_unique_for_overwrite<float[]>(count)).get();
+            }
+            data[0] = 1.0f;
+            benchmark::DoNotOptimize(data);
+        }
+        if (arena) {
+            frame.reset();
+        } else {
+            owned.clear();
+        }
+    }
+    state.SetLabel(arena ? "arena" : "new");
+    state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(arrays));
+}
+BENCHMARK(BM_FrameScratch)->ArgsProduct({{256, 4096}, {0, 1}})->Unit(benchmark::kMicrosecond);
+
+void BM_NodeChurn(benchmark::State& state) {
+    const bool pooled = state.range(0) != 0;
+    core::memory::PoolResource nodes(64, 1024);
+    std::pmr::memory_resource* resource = pooled ? &nodes : std::pmr::new_delete_resource();
+    std::pmr::list<int> list(resource);
+    for (auto _ : state) {
+        for (int i = 0; i < 1024; ++i) list.push_back(i);
+        benchmark::DoNotOptimize(list.back());
+        list.clear();
+    }
+    state.SetLabel(pooled ? "pool" : "new");
+    state.SetItemsProcessed(state.iterations() * 1024);
+}
+BENCHMARK(BM_NodeChurn)->Arg(0)->Arg(1)->Unit(benchmark::kMicrosecond);
+
+} // namespace
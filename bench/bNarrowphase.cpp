@@ -0,0 +1,90 @@
+#include <benchmark/benchmark.h>
+
+#include <random>
+#include <vector>
+
+#include "include/Contacts.h"
+#include "include/Narrowphase.h"
+
+// Narrowphase cost per pair type, and the contact cache over a pile of
+// resting bodies (arg = body count; pairs are neighbours in a grid).
+
+namespace {
+
+std::vector<physics::Pose> randomPoses(std::size_t n, float spread) {
+    std::mt19937 rng(7);
+    std::uniform_real_distribution<float> pos(-spread, spread), angle(-3.0f, 3.0f);
+    std::vector<physics::Pose> poses;
+    for (std::size_t i = 0; i < n; ++i) {
+        const math::Vector3 axis = math::Vector3(pos(rng), pos(rng), pos(rng) + 2.0f * spread).normalized();
+        poses.push_back({{pos(rng), pos(rng), pos(rng)}, math::Rotation3::axisAngle(axis, angle(rng))});
+    }
+    return poses;
+}
+
+// Collides shape a at poses[i] against shape b at poses[i + 1]; spread keeps most pairs touching
+void collidePairs(benchmark::State& state, const physics::Shape& a, const physics::Shape& b) {
+    const std::vector<physics::Pose> poses = randomPoses(1024, 0.6f);
+    physics::CollisionResult result;
+    std::size_t i = 0;
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(physics::collide(a, poses[i], b, poses[i + 1], 0.02f, result));
+        benchmark::DoNotOptimize(result);
+        i = (i + 1) & 1022;
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()));
+}
+
+void BM_CollideSpheres(benchmark::State& state) {
+    collidePairs(state, physics::Shape::sphere(0.5f), physics::Shape::sphere(0.5f));
+}
+
+void BM_CollideCapsules(benchmark::State& state) {
+    collidePairs(state, physics::Shape::capsule(0.5f, 0.25f), physics::Shape::capsule(0.5f, 0.25f));
+}
+
+void BM_CollideBoxes(benchmark::State& state) {
+    collidePairs(state, physics::Shape::box({0.5f, 0.5f, 0.5f}), physics::Shape::box({0.5f, 0.5f, 0.5f}));
+}
+
+// Same cube as a hull: the GJK/EPA path, for comparison with the SAT test
+void BM_CollideHulls(benchmark::State& state) {
+    static const physics::ConvexHull cube = [] {
+        physics::ConvexHull hull;
+        for (int i = 0; i < 8; ++i) hull.vertices.emplace_back(i & 1 ? 0.5f : -0.5f, i & 2 ? 0.5f : -0.5f, i & 4 ? 0.5f : -0.5f);
+        return hull;
+    }();
+    collidePairs(state, physics::Shape::convexHull(cube), physics::Shape::convexHull(cube));
+}
+
+void BM_ContactCacheUpdate(benchmark::State& state) {
+    const auto n = static_cast<std::uint32_t>(state.range(0));
+    const std::uint32_t side = 32;
+    physics::RigidBodies bodies;
+    std::vector<physics::BroadphasePair> pairs;
+    for (std::uint32_t i = 0; i < n; ++i) {
+        physics::BodyDesc d;
+        d.position = {static_cast<float>(i % side) * 0.99f, static_cast<float>(i / side) * 0.99f, 0.0f};
+        d.shape = physics::Shape::box({0.5f, 0.5f, 0.5f});
+        bodies.add(d);
+        if (i % side != 0) pairs.push_back({i - 1, i});
+        if (i >= side) pairs.push_back({i - side, i});
+    }
+    physics::sortAndDeduplicate(pairs);
+    physics::ContactCache cache;
+    cache.update(bodies, pairs);
+    for (auto _ : state) {
+        cache.update(bodies, pairs);
+        benchmark::DoNotOptimize(cache.manifolds().data());
+    }
+    state.counters["manifolds"] = static_cast<double>(cache.manifolds().size());
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * static_cast<int64_t>(pairs.size()));
+}
+
+} // namespace
+
+BENCHMARK(BM_CollideSpheres);
+BENCHMARK(BM_CollideCapsules);
+BENCHMARK(BM_CollideBoxes);
+BENCHMARK(BM_CollideHulls);
+BENCHMARK(BM_ContactCacheUpdate)->Arg(1 << 10)->Arg(1 << 14)->Unit(benchmark::kMicrosecond);
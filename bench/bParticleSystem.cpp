@@ -0,0 +1,64 @@
+#include <benchmark/benchmark.h>
+
+#include "include/JobSystem.h"
+#include "include/ParticleSystem.h"
+#include "include/Simd.h"
+
+// ParticleUpdate: one update of N long-lived particles (arg 0: 1M, 10M) per
+// backend (arg 1); no deaths, so this is the integrate/lifetime kernel alone.
+// ParticleChurn: 1M particles in steady state, about 1/90 of them dying and
+// being re-emitted every 60 Hz update, serial (arg 0 = 0) or on a job system.
+
+namespace {
+
+void fill(physics::ParticleSystem& particles, std::size_t n, float seconds) {
+    particles.reserve(n);
+    for (std::size_t i = 0; i < n; ++i) {
+        const float f = static_cast<float>(i % 1024);
+        particles.emit({f, 0.0f, -f}, {1.0f, 5.0f, 0.5f}, seconds * (1.0f + 0.001f * f));
+    }
+}
+
+void BM_ParticleUpdate(benchmark::State& state) {
+    const auto backend = static_cast<math::simd::Backend>(state.range(1));
+    const auto previous = math::simd::activeBackend();
+    if (!math::simd::setBackend(backend)) {
+        state.SkipWithError("backend not supported on this CPU");
+        return;
+    }
+    state.SetLabel(math::simd::backendName(backend));
+    physics::ParticleSettings settings;
+    settings.drag = 0.1f;
+    physics::ParticleSystem particles(settings);
+    fill(particles, static_cast<std::size_t>(state.range(0)), 1.0e6f);
+    for (auto _ : state) {
+        particles.update(1.0f / 60.0f);
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * state.range(0));
+    math::simd::setBackend(previous);
+}
+
+void BM_ParticleChurn(benchmark::State& state) {
+    constexpr std::size_t COUNT = 1 << 20;
+    core::JobSystem jobs;
+    physics::ParticleSystem particles;
+    particles.reserve(COUNT + COUNT / 8);
+    physics::EmitterDesc e;
+    e.extents = {10.0f, 0.0f, 10.0f};
+    e.minLifetime = 1.0f;
+    e.maxLifetime = 2.0f;
+    e.rate = static_cast<float>(COUNT) / 1.5f; // mean lifetime 1.5 s
+    particles.addEmitter(e);
+    while (particles.size() < COUNT) particles.update(1.0f / 60.0f);
+    for (auto _ : state) {
+        particles.update(1.0f / 60.0f, state.range(0) ? &jobs : nullptr);
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * particles.size()));
+}
+
+} // namespace
+
+BENCHMARK(BM_ParticleUpdate)->ArgsProduct({{1 << 20, 10'000'000}, {0, 1}})->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_ParticleChurn)->Arg(0)->Arg(1)->Unit(benchmark::kMicrosecond);
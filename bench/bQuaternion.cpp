@@ -0,0 +1,100 @@
+#include <benchmark/benchmark.h>
+
+#include <vector>
+
+#include "include/Quaternion.h"
+#include "include/Simd.h"
+#include "include/TransformBatch.h"
+
+// Rotating point sets by a quaternion against a matrix, and batched
+// interpolation per backend (arg 0).
+
+namespace {
+
+std::vector<math::Vector3> makeVectors(std::size_t n) {
+    std::vector<math::Vector3> v(n);
+    for (std::size_t i = 0; i < n; ++i) {
+        const float f = static_cast<float>(i);
+        v[i] = {f, 1.0f - f, 0.5f * f};
+    }
+    return v;
+}
+
+std::vector<math::Quaternion> makeRotations(std::size_t n, float phase) {
+    std::vector<math::Quaternion> q(n);
+    for (std::size_t i = 0; i < n; ++i)
+        q[i] = math::Quaternion::axisAngle(math::Vector3(1.0f, 2.0f, 3.0f).normalized(), phase + 0.001f * static_cast<float>(i));
+    return q;
+}
+
+const math::Quaternion ROTATION = math::Quaternion::axisAngle(math::Vector3(0.0f, 0.6f, 0.8f), 0.7f);
+
+void BM_RotateMatrix(benchmark::State& state) {
+    const auto n = static_cast<std::size_t>(state.range(0));
+    const auto in = makeVectors(n);
+    std::vector<math::Vector3> out(n);
+    const mat4 m = ROTATION.toMat4();
+    for (auto _ : state) {
+        math::transformDirections(m, in, out);
+        benchmark::DoNotOptimize(out.data());
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * state.range(0));
+}
+
+void BM_RotateQuaternion(benchmark::State& state) {
+    const auto n = static_cast<std::size_t>(state.range(0));
+    const auto in = makeVectors(n);
+    std::vector<math::Vector3> out(n);
+    for (auto _ : state) {
+        math::rotate(ROTATION, in, out);
+        benchmark::DoNotOptimize(out.data());
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * state.range(0));
+}
+
+void BM_RotateQuaternionSoA(benchmark::State& state) {
+    const auto n = static_cast<std::size_t>(state.range(0));
+    math::Vector3SoA in, out;
+    for (const auto& v : makeVectors(n)) in.pushBack(v);
+    for (auto _ : state) {
+        math::rotate(ROTATION, in, out);
+        benchmark::DoNotOptimize(out.x());
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * state.range(0));
+}
+
+template <bool SLERP>
+void BM_InterpolateBatch(benchmark::State& state) {
+    const auto backend = static_cast<math::simd::Backend>(state.range(0));
+    const auto previous = math::simd::activeBackend();
+    if (!math::simd::setBackend(backend)) {
+        state.SkipWithError("backend not supported on this CPU");
+        return;
+    }
+    state.SetLabel(math::simd::backendName(backend));
+    constexpr std::size_t COUNT = 4096;
+    const auto a = makeRotations(COUNT, 0.0f);
+    const auto b = makeRotations(COUNT, 1.5f);
+    std::vector<math::Quaternion> out(COUNT);
+    for (auto _ : state) {
+        if constexpr (SLERP)
+            math::slerp(a, b, 0.3f, out);
+        else
+            math::nlerp(a, b, 0.3f, out);
+        benchmark::DoNotOptimize(out.data());
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * COUNT));
+    math::simd::setBackend(previous);
+}
+
+} // namespace
+
+BENCHMARK(BM_RotateMatrix)->Arg(1 << 16);
+BENCHMARK(BM_RotateQuaternion)->Arg(1 << 16);
+BENCHMARK(BM_RotateQuaternionSoA)->Arg(1 << 16);
+BENCHMARK(BM_InterpolateBatch<false>)->Name("BM_NlerpBatch")->DenseRange(0, 1);
+BENCHMARK(BM_InterpolateBatch<true>)->Name("BM_SlerpBatch")->DenseRange(0, 1);
@@ -0,0 +1,52 @@
+#include <benchmark/benchmark.h>
+
+#include "include/Mat4.h"
+#include "include/Simd.h"
+
+// mat4 kernels under each SIMD backend; arg 0 is the math::simd::Backend.
+
+namespace {
+
+void BM_Mat4Mul(benchmark::State& state) {
+    const auto backend = static_cast<math::simd::Backend>(state.range(0));
+    const auto previous = math::simd::activeBackend();
+    if (!math::simd::setBackend(backend)) {
+        state.SkipWithError("backend not supported on this CPU");
+        return;
+    }
+    state.SetLabel(math::simd::backendName(backend));
+    mat4 a(1.5f), b(0.5f);
+    a.m[0][3] = 2.0f;
+    b.m[2][1] = -1.0f;
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(a);
+        mat4 c = a * b;
+        benchmark::DoNotOptimize(c);
+    }
+    state.SetItemsProcessed(state.iterations());
+    math::simd::setBackend(previous);
+}
+
+void BM_Mat4MulVec4(benchmark::State& state) {
+    const auto backend = static_cast<math::simd::Backend>(state.range(0));
+    const auto previous = math::simd::activeBackend();
+    if (!math::simd::setBackend(backend)) {
+        state.SkipWithError("backend not supported on this CPU");
+        return;
+    }
+    state.SetLabel(math::simd::backendName(backend));
+    mat4 a(2.0f);
+    math::Vector4 v(1.0f, 2.0f, 3.0f, 1.0f);
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(v);
+        math::Vector4 r = a * v;
+        benchmark::DoNotOptimize(r);
+    }
+    state.SetItemsProcessed(state.iterations());
+    math::simd::setBackend(previous);
+}
+
+} // namespace
+
+BENCHMARK(BM_Mat4Mul)->DenseRange(0, 2);
+BENCHMARK(BM_Mat4MulVec4)->DenseRange(0, 2);
@@ -0,0 +1,62 @@
+#include <benchmark/benchmark.h>
+
+#include "include/Simd.h"
+#include "include/Solver.h"
+#include "include/World.h"
+
+// Contact solver on a settled pile of boxes (arg 0 = boxes per side; four
+// layers). One iteration is one solve with the default 8 iterations; the
+// scalar variant shows what the 4-lane batches buy.
+
+namespace {
+
+void buildPile(physics::World& world, int side) {
+    physics::BodyDesc ground;
+    ground.position = {0.0f, -1.0f, 0.0f};
+    ground.mass = 0.0f;
+    ground.shape = physics::Shape::box({1000.0f, 1.0f, 1000.0f});
+    world.bodies().add(ground);
+    for (int layer = 0; layer < 4; ++layer) {
+        for (int i = 0; i < side * side; ++i) {
+            physics::BodyDesc d;
+            d.position = {static_cast<float>(i % side), 0.5f + static_cast<float>(layer), static_cast<float>(i / side)};
+            d.inertia = physics::boxInertia(1.0f, {0.5f, 0.5f, 0.5f});
+            d.shape = physics::Shape::box({0.5f, 0.5f, 0.5f});
+            world.bodies().add(d);
+        }
+    }
+    for (int i = 0; i < 10; ++i) world.step();
+}
+
+void solvePile(benchmark::State& state, math::simd::Backend backend) {
+    const math::simd::Backend original = math::simd::activeBackend();
+    if (!math::simd::setBackend(backend)) {
+        state.SkipWithError("backend not supported");
+        return;
+    }
+    physics::World world;
+    buildPile(world, static_cast<int>(state.range(0)));
+    physics::ConstraintSolver solver;
+    for (auto _ : state) {
+        solver.solve(world.bodies(), world.contacts().manifolds(), world.joints(), world.fixedStep());
+        benchmark::ClobberMemory();
+    }
+    math::simd::setBackend(original);
+    state.counters["manifolds"] = static_cast<double>(world.contacts().manifolds().size());
+    state.counters["colors"] = static_cast<double>(solver.colorCount());
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) *
+                            static_cast<int64_t>(world.contacts().manifolds().size()));
+}
+
+void BM_SolverPile(benchmark::State& state) {
+    solvePile(state, math::simd::activeBackend());
+}
+
+void BM_SolverPileScalar(benchmark::State& state) {
+    solvePile(state, math::simd::Backend::Scalar);
+}
+
+} // namespace
+
+BENCHMARK(BM_SolverPile)->Arg(16)->Arg(32)->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_SolverPileScalar)->Arg(16)->Arg(32)->Unit(benchmark::kMicrosecond);
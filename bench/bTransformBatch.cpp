@@ -0,0 +1,60 @@
+#include <benchmark/benchmark.h>
+
+#include <vector>
+
+#include "include/TransformBatch.h"
+
+// Vertex pre-transform: per-point loop against the AoS and SoA batch kernels.
+
+namespace {
+
+mat4 makeMatrix() {
+    mat4 m(1.0f);
+    m.m[0][1] = 0.5f;
+    m.m[1][2] = -0.25f;
+    m.m[0][3] = 3.0f;
+    m.m[2][3] = -1.0f;
+    return m;
+}
+
+void BM_TransformPointLoop(benchmark::State& state) {
+    const auto count = static_cast<std::size_t>(state.range(0));
+    const mat4 m = makeMatrix();
+    std::vector<math::Vector3> in(count, {1.0f, 2.0f, 3.0f}), out(count);
+    for (auto _ : state) {
+        for (std::size_t i = 0; i < count; ++i) out[i] = math::transformPoint(m, in[i]);
+        benchmark::DoNotOptimize(out.data());
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * count));
+}
+
+void BM_TransformPointsAoS(benchmark::State& state) {
+    const auto count = static_cast<std::size_t>(state.range(0));
+    const mat4 m = makeMatrix();
+    std::vector<math::Vector3> in(count, {1.0f, 2.0f, 3.0f}), out(count);
+    for (auto _ : state) {
+        math::transformPoints(m, in, out);
+        benchmark::DoNotOptimize(out.data());
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * count));
+}
+
+void BM_TransformPointsSoA(benchmark::State& state) {
+    const auto count = static_cast<std::size_t>(state.range(0));
+    const mat4 m = makeMatrix();
+    math::Vector3SoA in(count), out(count);
+    for (auto _ : state) {
+        math::transformPoints(m, in, out);
+        benchmark::DoNotOptimize(out.x());
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * count));
+}
+
+} // namespace
+
+BENCHMARK(BM_TransformPointLoop)->Arg(1 << 10)->Arg(1 << 16);
+BENCHMARK(BM_TransformPointsAoS)->Arg(1 << 10)->Arg(1 << 16);
+BENCHMARK(BM_TransformPointsSoA)->Arg(1 << 10)->Arg(1 << 16);
@@ -0,0 +1,65 @@
+#include <benchmark/benchmark.h>
+
+#include <vector>
+
+#include "include/JobSystem.h"
+#include "include/Simd.h"
+#include "include/TransformHierarchy.h"
+
+// HierarchyUpdate: update() of a 100k-node scene (1000 roots, four levels of
+// 5-10 children) after changing the local transform of a fraction of the
+// nodes (arg 0, per mille: 0, 10, 1000) per backend (arg 1). At 10 per mille
+// the dirty flags skip most of the scene; 1000 is a full recompute.
+
+namespace {
+
+scene::Transform pose(float x) {
+    scene::Transform t;
+    t.position = {x, 0.5f, -x};
+    t.rotation = math::Quaternion::axisAngle({0.0f, 1.0f, 0.0f}, 0.01f * x);
+    return t;
+}
+
+std::vector<std::uint32_t> buildScene(scene::TransformHierarchy& h) {
+    std::vector<std::uint32_t> nodes;
+    std::vector<std::uint32_t> level;
+    for (int i = 0; i < 1000; ++i) level.push_back(h.add(pose(static_cast<float>(i))));
+    nodes = level;
+    const int fanout[] = {5, 4, 2, 2};
+    for (const int children : fanout) {
+        std::vector<std::uint32_t> next;
+        for (const std::uint32_t parent : level) {
+            for (int c = 0; c < children; ++c) next.push_back(h.add(pose(static_cast<float>(c)), parent));
+        }
+        nodes.insert(nodes.end(), next.begin(), next.end());
+        level = std::move(next);
+    }
+    return nodes;
+}
+
+void BM_HierarchyUpdate(benchmark::State& state) {
+    const auto backend = static_cast<math::simd::Backend>(state.range(1));
+    const auto previous = math::simd::activeBackend();
+    if (!math::simd::setBackend(backend)) {
+        state.SkipWithError("backend not supported on this CPU");
+        return;
+    }
+    state.SetLabel(math::simd::backendName(backend));
+    scene::TransformHierarchy h;
+    const std::vector<std::uint32_t> nodes = buildScene(h);
+    h.update();
+    const auto perMille = static_cast<std::size_t>(state.range(0));
+    const std::size_t stride = perMille == 0 ? 0 : 1000 / perMille;
+    float t = 0.0f;
+    for (auto _ : state) {
+        t += 1.0f;
+        const scene::Transform moved = pose(t);
+        for (std::size_t i = 0; stride != 0 && i < nodes.size(); i += stride) h.setLocal(nodes[i], moved);
+        h.update();
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(nodes.size()));
+    math::simd::setBackend(previous);
+}
+BENCHMARK(BM_HierarchyUpdate)->ArgsProduct({{0, 10, 1000}, {0, 1}})->Unit(benchmark::kMicrosecond);
+
+} // namespace
@@ -0,0 +1,55 @@
+#include <benchmark/benchmark.h>
+
+#include <vector>
+
+#include "include/Vector3SoA.h"
+
+// p += v * dt over N bodies: AoS loop of Vector3 against the SoA bulk kernel.
+
+namespace {
+
+void BM_AxpyAoS(benchmark::State& state) {
+    const auto count = static_cast<std::size_t>(state.range(0));
+    std::vector<math::Vector3> p(count, {1.0f, 2.0f, 3.0f}), v(count, {0.1f, 0.2f, 0.3f});
+    const float dt = 1.0f / 60.0f;
+    for (auto _ : state) {
+        for (std::size_t i = 0; i < count; ++i) p[i] += v[i] * dt;
+        benchmark::DoNotOptimize(p.data());
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * count));
+}
+
+void BM_AxpySoA(benchmark::State& state) {
+    const auto count = static_cast<std::size_t>(state.range(0));
+    math::Vector3SoA p(count), v(count);
+    for (std::size_t i = 0; i < count; ++i) {
+        p.set(i, {1.0f, 2.0f, 3.0f});
+        v.set(i, {0.1f, 0.2f, 0.3f});
+    }
+    const float dt = 1.0f / 60.0f;
+    for (auto _ : state) {
+        math::axpy(dt, v, p);
+        benchmark::DoNotOptimize(p.x());
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * count));
+}
+
+void BM_NormalizeSoA(benchmark::State& state) {
+    const auto count = static_cast<std::size_t>(state.range(0));
+    math::Vector3SoA v(count);
+    for (std::size_t i = 0; i < count; ++i) v.set(i, {1.0f + i * 0.001f, 2.0f, 3.0f});
+    for (auto _ : state) {
+        math::normalize(v);
+        benchmark::DoNotOptimize(v.x());
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * count));
+}
+
+} // namespace
+
+BENCHMARK(BM_AxpyAoS)->Arg(1 << 12)->Arg(1 << 20);
+BENCHMARK(BM_AxpySoA)->Arg(1 << 12)->Arg(1 << 20);
+BENCHMARK(BM_NormalizeSoA)->Arg(1 << 12)->Arg(1 << 20);
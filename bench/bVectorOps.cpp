@@ -0,0 +1,123 @@
+#include <benchmark/benchmark.h>
+
+#include <type_traits>
+#include <vector>
+
+#include "LegacyVector3.h"
+#include "include/Vector2.h"
+#include "include/Vector3.h"
+#include "include/Vector4.h"
+
+// Per-op cost of the inline, trivially copyable math::Vector3 against the
+// out-of-line LegacyVector3 (a frozen copy of the old Vector3.cpp build).
+// Each benchmark runs the same kernel over an array so the numbers reflect
+// what integration loops actually see, reported as items (elements) per second.
+// Vector2 and Vector4 run the dimension-independent kernels for coverage.
+
+namespace {
+
+constexpr std::size_t COUNT = 4096;
+
+template <typename V>
+V makeVector(float f) {
+    if constexpr (std::is_same_v<V, math::Vector2>)
+        return V(f, f * 0.5f + 1.0f);
+    else if constexpr (std::is_same_v<V, math::Vector4>)
+        return V(f, f * 0.5f + 1.0f, 2.0f - f, 1.0f);
+    else
+        return V(f, f * 0.5f + 1.0f, 2.0f - f);
+}
+
+template <typename V>
+std::vector<V> makeArray(float seed) {
+    std::vector<V> out;
+    out.reserve(COUNT);
+    for (std::size_t i = 0; i < COUNT; ++i)
+        out.push_back(makeVector<V>(static_cast<float>(i) * 0.001f + seed));
+    return out;
+}
+
+template <typename V>
+void BM_Add(benchmark::State& state) {
+    auto a = makeArray<V>(0.1f);
+    auto b = makeArray<V>(0.7f);
+    std::vector<V> out(COUNT);
+    for (auto _ : state) {
+        for (std::size_t i = 0; i < COUNT; ++i) out[i] = a[i] + b[i];
+        benchmark::DoNotOptimize(out.data());
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * COUNT));
+}
+
+template <typename V>
+void BM_Axpy(benchmark::State& state) {
+    auto p = makeArray<V>(0.1f);
+    auto v = makeArray<V>(0.7f);
+    const float dt = 1.0f / 60.0f;
+    for (auto _ : state) {
+        for (std::size_t i = 0; i < COUNT; ++i) p[i] += v[i] * dt;
+        benchmark::DoNotOptimize(p.data());
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * COUNT));
+}
+
+template <typename V>
+void BM_Dot(benchmark::State& state) {
+    auto a = makeArray<V>(0.1f);
+    auto b = makeArray<V>(0.7f);
+    for (auto _ : state) {
+        float sum = 0.0f;
+        for (std::size_t i = 0; i < COUNT; ++i) sum += a[i].dot(b[i]);
+        benchmark::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * COUNT));
+}
+
+template <typename V>
+void BM_Cross(benchmark::State& state) {
+    auto a = makeArray<V>(0.1f);
+    auto b = makeArray<V>(0.7f);
+    std::vector<V> out(COUNT);
+    for (auto _ : state) {
+        for (std::size_t i = 0; i < COUNT; ++i) out[i] = a[i].cross(b[i]);
+        benchmark::DoNotOptimize(out.data());
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * COUNT));
+}
+
+template <typename V>
+void BM_Normalized(benchmark::State& state) {
+    auto a = makeArray<V>(0.1f);
+    std::vector<V> out(COUNT);
+    for (auto _ : state) {
+        for (std::size_t i = 0; i < COUNT; ++i) out[i] = a[i].normalized();
+        benchmark::DoNotOptimize(out.data());
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * COUNT));
+}
+
+} // namespace
+
+BENCHMARK_TEMPLATE(BM_Add, math::Vector3);
+BENCHMARK_TEMPLATE(BM_Add, bench::LegacyVector3);
+BENCHMARK_TEMPLATE(BM_Axpy, math::Vector3);
+BENCHMARK_TEMPLATE(BM_Axpy, bench::LegacyVector3);
+BENCHMARK_TEMPLATE(BM_Dot, math::Vector3);
+BENCHMARK_TEMPLATE(BM_Dot, bench::LegacyVector3);
+BENCHMARK_TEMPLATE(BM_Cross, math::Vector3);
+BENCHMARK_TEMPLATE(BM_Cross, bench::LegacyVector3);
+BENCHMARK_TEMPLATE(BM_Normalized, math::Vector3);
+BENCHMARK_TEMPLATE(BM_Normalized, bench::LegacyVector3);
+
+BENCHMARK_TEMPLATE(BM_Add, math::Vector2);
+BENCHMARK_TEMPLATE(BM_Add, math::Vector4);
+BENCHMARK_TEMPLATE(BM_Axpy, math::Vector2);
+BENCHMARK_TEMPLATE(BM_Axpy, math::Vector4);
+BENCHMARK_TEMPLATE(BM_Dot, math::Vector2);
+BENCHMARK_TEMPLATE(BM_Dot, math::Vector4);
+BENCHMARK_TEMPLATE(BM_Normalized, math::Vector2);
+BENCHMARK_TEMPLATE(BM_Normalized, math::Vector4);
@@ -0,0 +1,92 @@
+#!/usr/bin/env python3
+"""Compare two math_bench JSON result files and flag regressions.
+
+Usage:
+    python3 bench/compare.py baseline.json candidate.json [--threshold 5] [--metric cpu_time]
+
+Benchmarks are matched by name. When a file holds repetitions, the median
+aggregate is used (run math_bench with --benchmark_repetitions=N). A
+benchmark regresses when its time grows by more than --threshold percent.
+The exit status is 1 if anything regressed, so the script can gate CI.
+"""
+
+import argparse
+import json
+import sys
+
+CONTEXT_KEYS = ("host_name", "num_cpus", "mhz_per_cpu", "compiler", "build_type", "cxx_flags", "simd_backend")
+
+
+def load(path):
+    with open(path, encoding="utf-8") as f:
+        data = json.load(f)
+    runs = {}
+    for b in data.get("benchmarks", []):
+        if b.get("error_occurred"):
+            continue
+        run_type = b.get("run_type", "iteration")
+        if run_type == "aggregate":
+            if b.get("aggregate_name") != "median":
+                continue
+            name = b.get("run_name", b["name"])
+        else:
+            name = b["name"]
+            # Individual repetitions only count when no median exists
+            if name in runs and runs[name][0] == "aggregate":
+                continue
+        runs[name] = (run_type, b)
+    return data.get("context", {}), {name: b for name, (_, b) in runs.items()}
+
+
+def to_ns(bench, metric):
+    scale = {"ns": 1.0, "us": 1e3, "ms": 1e6, "s": 1e9}[bench.get("time_unit", "ns")]
+    return bench[metric] * scale
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("baseline")
+    parser.add_argument("candidate")
+    parser.add_argument("--threshold", type=float, default=5.0, help="regression threshold in percent (default 5)")
+    parser.add_argument("--metric", choices=("cpu_time", "real_time"), default="cpu_time")
+    args = parser.parse_args()
+
+    base_ctx, base = load(args.baseline)
+    cand_ctx, cand = load(args.candidate)
+
+    for key in CONTEXT_KEYS:
+        if base_ctx.get(key) != cand_ctx.get(key):
+            print(f"warning: {key} differs: {base_ctx.get(key)!r} vs {cand_ctx.get(key)!r}", file=sys.stderr)
+
+    names = [n for n in base if n in cand]
+    if not names:
+        print("no benchmarks in common", file=sys.stderr)
+        return 2
+
+    width = max(len(n) for n in names)
+    print(f"{'benchmark':<{width}}  {'baseline':>12}  {'candidate':>12}  {'change':>8}")
+    regressions = []
+    for name in names:
+        old = to_ns(base[name], args.metric)
+        new = to_ns(cand[name], args.metric)
+        change = (new - old) / old * 100.0 if old > 0 else 0.0
+        flag = ""
+        if change > args.threshold:
+            flag = "  REGRESSION"
+            regressions.append(name)
+        elif change < -args.threshold:
+            flag = "  improved"
+        print(f"{name:<{width}}  {old:>10.1f}ns  {new:>10.1f}ns  {change:>+7.1f}%{flag}")
+
+    for name in sorted(set(base) ^ set(cand)):
+        where = "baseline" if name in base else "candidate"
+        print(f"note: {name} only in {where}", file=sys.stderr)
+
+    if regressions:
+        print(f"\n{len(regressions)} regression(s) above {args.threshold}%", file=sys.stderr)
+        return 1
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,89 @@
+#include "include/FrameArena.h"
+
+#include <algorithm>
+#include <cassert>
+#include <cstdint>
+
+namespace core::memory {
+
+namespace {
+
+constexpr std::size_t HEADER_ALIGNMENT = alignof(std::max_align_t);
+
+constexpr std::size_t roundUp(std::size_t value, std::size_t alignment) noexcept {
+    return (value + alignment - 1) & ~(alignment - 1);
+}
+
+} // namespace
+
+FrameArena::FrameArena(std::size_t blockSize, std::pmr::memory_resource* upstream)
+    : upstream(upstream), blockSize(std::max<std::size_t>(blockSize, 256)) {
+    assert(upstream != nullptr);
+}
+
+FrameArena::~FrameArena() {
+    releaseBlocks();
+}
+
+std::byte* FrameArena::blockBegin() const noexcept {
+    if (blocks == nullptr) return nullptr;
+    return reinterpret_cast<std::byte*>(blocks) + roundUp(sizeof(Block), HEADER_ALIGNMENT);
+}
+
+void FrameArena::addBlock(std::size_t minimumBytes) {
+    // Grow geometrically so a frame needs O(log n) blocks
+    const std::size_t size = std::max({minimumBytes, blockSize, blocks ? blocks->size * 2 : 0});
+    const std::size_t header = roundUp(sizeof(Block), HEADER_ALIGNMENT);
+    void* memory = upstream->allocate(header + size, HEADER_ALIGNMENT);
+    if (blocks != nullptr) usedBefore += static_cast<std::size_t>(cursor - blockBegin());
+    blocks = ::new (memory) Block{blocks, size};
+    cursor = blockBegin();
+    limit = cursor + size;
+    heldBytes += size;
+    ++current.upstreamAllocations;
+}
+
+void FrameArena::releaseBlocks() noexcept {
+    const std::size_t header = roundUp(sizeof(Block), HEADER_ALIGNMENT);
+    while (blocks != nullptr) {
+        Block* next = blocks->next;
+        upstream->deallocate(blocks, header + blocks->size, HEADER_ALIGNMENT);
+        blocks = next;
+    }
+    cursor = limit = nullptr;
+    usedBefore = 0;
+    heldBytes = 0;
+}
+
+void* FrameArena::allocate(std::size_t bytes, std::size_t alignment) {
+    assert(alignment != 0 && (alignment & (alignment - 1)) == 0);
+    bytes = std::max<std::size_t>(bytes, 1);
+    auto address = reinterpret_cast<std::uintptr_t>(cursor);
+    std::size_t padding = roundUp(address, alignment) - address;
+    if (cursor == nullptr || padding + bytes > static_cast<std::size_t>(limit - cursor)) {
+        addBlock(bytes + (alignment > HEADER_ALIGNMENT ? alignment : 0));
+        address = reinterpret_cast<std::uintptr_t>(cursor);
+        padding = roundUp(address, alignment) - address;
+    }
+    std::byte* result = cursor + padding;
+    cursor = result + bytes;
+    current.bytes += bytes;
+    ++current.allocations;
+    current.peakBytes = std::max(current.peakBytes, used());
+    return result;
+}
+
+void FrameArena::reset() {
+    if (blocks != nullptr && blocks->next != nullptr) {
+        // Coalesce: next frame fits in one block, counted in the frame that needed it
+        const std::size_t total = heldBytes;
+        releaseBlocks();
+        addBlock(total);
+    }
+    last = current;
+    current = {};
+    cursor = blockBegin();
+    usedBefore = 0;
+}
+
+} // namespace core::memory
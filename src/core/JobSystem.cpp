@@ -0,0 +1,253 @@
+#include "include/JobSystem.h"
+
+#include <algorithm>
+#include <cassert>
+
+namespace core {
+
+namespace {
+
+// Pool membership of the current thread; a thread belongs to at most one pool.
+thread_local const JobSystem* tlsSystem = nullptr;
+thread_local unsigned tlsIndex = 0;
+
+// Shared state of one parallelFor call; helpers pull chunk indices from next.
+struct ForState {
+    std::atomic<std::size_t> next{0};
+    std::size_t begin;
+    std::size_t end;
+    std::size_t grain;
+    std::size_t chunks;
+    void* body;
+    void (*invoke)(void*, std::size_t, std::size_t);
+
+    void runChunks() {
+        for (std::size_t k = next.fetch_add(1, std::memory_order_relaxed); k < chunks;
+             k = next.fetch_add(1, std::memory_order_relaxed)) {
+            const std::size_t chunkBegin = begin + k * grain;
+            invoke(body, chunkBegin, std::min(chunkBegin + grain, end));
+        }
+    }
+};
+
+struct ForJob : Job {
+    ForState* state = nullptr;
+};
+
+} // namespace
+
+// --- WorkStealingDeque ---
+
+bool JobSystem::WorkStealingDeque::push(Job* job) noexcept {
+    const std::int64_t b = bottom.load(std::memory_order_relaxed);
+    const std::int64_t t = top.load(std::memory_order_acquire);
+    if (b - t >= CAPACITY) return false;
+    buffer[b & (CAPACITY - 1)].store(job, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+    bottom.store(b + 1, std::memory_order_relaxed);
+    return true;
+}
+
+Job* JobSystem::WorkStealingDeque::pop() noexcept {
+    const std::int64_t b = bottom.load(std::memory_order_relaxed) - 1;
+    bottom.store(b, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    std::int64_t t = top.load(std::memory_order_relaxed);
+    if (t > b) {
+        bottom.store(b + 1, std::memory_order_relaxed);
+        return nullptr;
+    }
+    Job* job = buffer[b & (CAPACITY - 1)].load(std::memory_order_relaxed);
+    if (t == b) {
+        // Last item: race against thieves for it
+        if (!top.compare_exchange_strong(t, t + 1, std::memory_order_seq_cst, std::memory_order_relaxed)) {
+            job = nullptr;
+        }
+        bottom.store(b + 1, std::memory_order_relaxed);
+    }
+    return job;
+}
+
+Job* JobSystem::WorkStealingDeque::steal() noexcept {
+    std::int64_t t = top.load(std::memory_order_acquire);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    const std::int64_t b = bottom.load(std::memory_order_acquire);
+    if (t >= b) return nullptr;
+    Job* job = buffer[t & (CAPACITY - 1)].load(std::memory_order_relaxed);
+    if (!top.compare_exchange_strong(t, t + 1, std::memory_order_seq_cst, std::memory_order_relaxed)) {
+        return nullptr; // lost the race to the owner or another thief
+    }
+    return job;
+}
+
+// --- JobSystem ---
+
+JobSystem::JobSystem(unsigned threadCount) {
+    const unsigned count = threadCount == 0 ? hardwareThreads() : threadCount;
+    queues.reserve(count);
+    for (unsigned i = 0; i < count; ++i) queues.push_back(std::make_unique<WorkStealingDeque>());
+
+    // The constructing thread owns deque 0 unless it already serves another pool
+    if (tlsSystem == nullptr) {
+        tlsSystem = this;
+        tlsIndex = 0;
+    }
+
+    workers.reserve(count - 1);
+    for (unsigned i = 1; i < count; ++i) workers.emplace_back([this, i] { workerLoop(i); });
+}
+
+JobSystem::~JobSystem() {
+    {
+        std::lock_guard lock(sleepMutex);
+        stopping.store(true);
+    }
+    wake.notify_all();
+    for (std::thread& t : workers) t.join();
+    if (tlsSystem == this) tlsSystem = nullptr;
+}
+
+unsigned JobSystem::hardwareThreads() noexcept {
+    return std::max(1u, std::thread::hardware_concurrency());
+}
+
+int JobSystem::currentThreadIndex() const noexcept {
+    return tlsSystem == this ? static_cast<int>(tlsIndex) : -1;
+}
+
+void JobSystem::run(Job& job) noexcept {
+    // Read the counter first: a finished job may be destroyed by its owner
+    JobCounter* counter = job.counter;
+    job.execute(job);
+    counter->pending.fetch_sub(1, std::memory_order_acq_rel);
+}
+
+void JobSystem::submit(Job& job, JobCounter& counter) {
+    assert(job.execute != nullptr);
+    job.counter = &counter;
+    counter.pending.fetch_add(1, std::memory_order_relaxed);
+
+    if (tlsSystem == this) {
+        if (!queues[tlsIndex]->push(&job)) {
+            run(job); // deque full: the submitter runs it
+            return;
+        }
+    } else {
+        std::lock_guard lock(sharedMutex);
+        sharedQueue.push_back(&job);
+        sharedNonEmpty.store(true, std::memory_order_release);
+    }
+    notifyWork();
+}
+
+void JobSystem::notifyWork() {
+    // Pairs with the sleeper check in workerLoop: either the worker sees the
+    // new epoch, or we see it registered as a sleeper and wake it.
+    workEpoch.fetch_add(1, std::memory_order_seq_cst);
+    if (sleepers.load(std::memory_order_seq_cst) > 0) {
+        { std::lock_guard lock(sleepMutex); }
+        wake.notify_one();
+    }
+}
+
+Job* JobSystem::findJob(unsigned index) {
+    const bool member = tlsSystem == this;
+    if (member) {
+        if (Job* job = queues[index]->pop()) return job;
+    }
+    if (sharedNonEmpty.load(std::memory_order_acquire)) {
+        std::lock_guard lock(sharedMutex);
+        if (!sharedQueue.empty()) {
+            Job* job = sharedQueue.front();
+            sharedQueue.pop_front();
+            sharedNonEmpty.store(!sharedQueue.empty(), std::memory_order_release);
+            return job;
+        }
+    }
+    // Steal round-robin starting after our own deque
+    const unsigned count = threadCount();
+    for (unsigned k = 1; k <= count; ++k) {
+        const unsigned victim = (index + k) % count;
+        if (member && victim == index) continue;
+        if (Job* job = queues[victim]->steal()) return job;
+    }
+    return nullptr;
+}
+
+void JobSystem::workerLoop(unsigned index) {
+    tlsSystem = this;
+    tlsIndex = index;
+
+    constexpr int SPINS_BEFORE_SLEEP = 64;
+    int idleSpins = 0;
+    while (!stopping.load(std::memory_order_acquire)) {
+        const std::uint64_t epoch = workEpoch.load(std::memory_order_seq_cst);
+        if (Job* job = findJob(index)) {
+            run(*job);
+            idleSpins = 0;
+            continue;
+        }
+        if (++idleSpins < SPINS_BEFORE_SLEEP) {
+            std::this_thread::yield();
+            continue;
+        }
+
+        std::unique_lock lock(sleepMutex);
+        sleepers.fetch_add(1, std::memory_order_seq_cst);
+        wake.wait(lock, [&] {
+            return stopping.load(std::memory_order_relaxed) ||
+                   workEpoch.load(std::memory_order_seq_cst) != epoch;
+        });
+        sleepers.fetch_sub(1, std::memory_order_relaxed);
+        idleSpins = 0;
+    }
+}
+
+void JobSystem::wait(JobCounter& counter) {
+    const int self = currentThreadIndex();
+    const unsigned index = self < 0 ? 0 : static_cast<unsigned>(self);
+    while (!counter.done()) {
+        if (Job* job = findJob(index)) {
+            run(*job);
+        } else {
+            std::this_thread::yield();
+        }
+    }
+}
+
+void JobSystem::parallelForChunks(std::size_t begin, std::size_t end, std::size_t grain, void* body,
+                                  ChunkInvoke invoke) {
+    if (begin >= end) return;
+    grain = std::max<std::size_t>(grain, 1);
+
+    ForState state;
+    state.begin = begin;
+    state.end = end;
+    state.grain = grain;
+    state.chunks = (end - begin + grain - 1) / grain;
+    state.body = body;
+    state.invoke = invoke;
+
+    // One helper per other thread at most; the caller works too
+    const std::size_t helpers = std::min<std::size_t>(state.chunks - 1, threadCount() - 1);
+    constexpr std::size_t INLINE_HELPERS = 64;
+    ForJob inlineJobs[INLINE_HELPERS];
+    std::unique_ptr<ForJob[]> heapJobs;
+    ForJob* jobs = inlineJobs;
+    if (helpers > INLINE_HELPERS) {
+        heapJobs = std::make_unique<ForJob[]>(helpers);
+        jobs = heapJobs.get();
+    }
+
+    if (helpers > 0) splitLoopCount.fetch_add(1, std::memory_order_relaxed);
+    JobCounter counter;
+    for (std::size_t i = 0; i < helpers; ++i) {
+        jobs[i].execute = [](Job& self) { static_cast<ForJob&>(self).state->runChunks(); };
+        jobs[i].state = &state;
+        submit(jobs[i], counter);
+    }
+    state.runChunks();
+    wait(counter);
+}
+
+} // namespace core
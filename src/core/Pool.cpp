@@ -0,0 +1,69 @@
+#include "include/Pool.h"
+
+#include <algorithm>
+#include <cassert>
+
+namespace core::memory {
+
+namespace {
+
+constexpr std::size_t roundUp(std::size_t value, std::size_t alignment) noexcept {
+    return (value + alignment - 1) & ~(alignment - 1);
+}
+
+} // namespace
+
+BlockPool::BlockPool(std::size_t blockSize, std::size_t blockAlignment, std::size_t blocksPerChunk,
+                     std::pmr::memory_resource* upstream)
+    : upstream(upstream),
+      alignment(std::max(blockAlignment, alignof(FreeBlock))),
+      blocksPerChunk(std::max<std::size_t>(blocksPerChunk, 1)) {
+    assert(upstream != nullptr && (blockAlignment & (blockAlignment - 1)) == 0);
+    // Every block must hold a free-list link and keep its successor aligned
+    stride = roundUp(std::max(blockSize, sizeof(FreeBlock)), alignment);
+    headerBytes = roundUp(sizeof(Chunk), alignment);
+}
+
+BlockPool::~BlockPool() {
+    while (chunks != nullptr) {
+        Chunk* next = chunks->next;
+        upstream->deallocate(chunks, headerBytes + stride * blocksPerChunk, alignment);
+        chunks = next;
+    }
+}
+
+void BlockPool::addChunk() {
+    void* memory = upstream->allocate(headerBytes + stride * blocksPerChunk, alignment);
+    chunks = ::new (memory) Chunk{chunks};
+    // Thread the new blocks onto the free list so the first one comes out first
+    std::byte* first = static_cast<std::byte*>(memory) + headerBytes;
+    for (std::size_t i = blocksPerChunk; i-- > 0;) {
+        freeList = ::new (first + i * stride) FreeBlock{freeList};
+    }
+    capacityBlocks += blocksPerChunk;
+    ++counters.upstreamAllocations;
+}
+
+void* BlockPool::allocate() {
+    if (freeList == nullptr) addChunk();
+    FreeBlock* block = freeList;
+    freeList = block->next;
+    ++liveBlocks;
+    counters.bytes += stride;
+    ++counters.allocations;
+    counters.peakBytes = std::max(counters.peakBytes, liveBlocks * stride);
+    return block;
+}
+
+void BlockPool::deallocate(void* block) noexcept {
+    assert(block != nullptr && liveBlocks > 0);
+    freeList = ::new (block) FreeBlock{freeList};
+    --liveBlocks;
+}
+
+void BlockPool::resetStats() noexcept {
+    counters = {};
+    counters.peakBytes = liveBlocks * stride;
+}
+
+} // namespace core::memory
@@ -0,0 +1,598 @@
+#include "include/Snapshot.h"
+
+#include <algorithm>
+#include <bit>
+#include <cassert>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <memory>
+#include <utility>
+
+#include "include/JobSystem.h"
+
+#ifdef _WIN32
+#define NOMINMAX
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace core {
+
+namespace {
+
+constexpr char MAGIC[8] = {'A', 'U', 'R', 'S', 'N', 'A', 'P', '\0'};
+constexpr std::uint32_t BYTE_ORDER_MARK = 0x01020304u;
+constexpr std::size_t CHUNKS_PER_JOB = 16;
+
+constexpr std::uint64_t alignUp(std::uint64_t value, std::uint64_t alignment) noexcept {
+    return (value + alignment - 1) / alignment * alignment;
+}
+
+// xxHash64-style: four independent multiply-rotate lanes over 32 byte
+// blocks, then an avalanche. size is a multiple of 32.
+constexpr std::uint64_t PRIME1 = 0x9E3779B185EBCA87ull;
+constexpr std::uint64_t PRIME2 = 0xC2B2AE3D27D4EB4Full;
+
+std::uint64_t hashBytes(const std::byte* data, std::size_t size) noexcept {
+    std::uint64_t lane[4] = {PRIME1 + PRIME2, PRIME2, 0, 0 - PRIME1};
+    for (std::size_t i = 0; i < size; i += 32) {
+        for (int l = 0; l < 4; ++l) {
+            std::uint64_t word;
+            std::memcpy(&word, data + i + 8 * l, 8);
+            lane[l] = std::rotl(lane[l] + word * PRIME2, 31) * PRIME1;
+        }
+    }
+    std::uint64_t h = std::rotl(lane[0], 1) + std::rotl(lane[1], 7) + std::rotl(lane[2], 12) + std::rotl(lane[3], 18);
+    h ^= size;
+    h ^= h >> 33;
+    h *= PRIME2;
+    h ^= h >> 29;
+    h *= PRIME1;
+    return h ^ (h >> 32);
+}
+
+std::size_t tablesEnd(const SnapshotHeader& h) noexcept {
+    return sizeof(SnapshotHeader) + h.arrayCount * sizeof(SnapshotArrayRecord) + h.chunkCount * sizeof(std::uint64_t);
+}
+
+template <typename Range>
+void runRange(JobSystem* jobs, std::size_t count, std::size_t grain, Range&& range) {
+    if (jobs != nullptr && count > grain) {
+        jobs->parallelFor(0, count, grain, range);
+    } else {
+        range(0, count);
+    }
+}
+
+struct FreeAligned {
+    void operator()(std::byte* p) const noexcept { ::operator delete[](p, std::align_val_t{SNAPSHOT_DATA_ALIGNMENT}); }
+};
+using ChunkBuffer = std::unique_ptr<std::byte[], FreeAligned>;
+
+ChunkBuffer chunkBuffer(std::size_t size) {
+    return ChunkBuffer(static_cast<std::byte*>(::operator new[](size, std::align_val_t{SNAPSHOT_DATA_ALIGNMENT})));
+}
+
+bool write(std::ostream& out, const void* data, std::size_t size) {
+    out.write(static_cast<const char*>(data), static_cast<std::streamsize>(size));
+    return static_cast<bool>(out);
+}
+
+bool read(std::istream& in, void* data, std::size_t size) {
+    in.read(static_cast<char*>(data), static_cast<std::streamsize>(size));
+    return static_cast<bool>(in);
+}
+
+// Forces the file's contents to the disk
+bool syncFile(const std::string& path) {
+#ifdef _WIN32
+    const HANDLE file = CreateFileA(path.c_str(), GENERIC_WRITE, FILE_SHARE_READ | FILE_SHARE_WRITE, nullptr,
+                                    OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (file == INVALID_HANDLE_VALUE) return false;
+    const bool ok = FlushFileBuffers(file) != 0;
+    CloseHandle(file);
+    return ok;
+#else
+    const int fd = ::open(path.c_str(), O_RDWR);
+    if (fd < 0) return false;
+    const bool ok = ::fsync(fd) == 0;
+    ::close(fd);
+    return ok;
+#endif
+}
+
+// Forces the directory entries of path's directory (a create or rename) to
+// the disk; NTFS journals those itself
+bool syncDirectory(const std::string& path) {
+#ifdef _WIN32
+    (void)path;
+    return true;
+#else
+    const std::filesystem::path parent = std::filesystem::path(path).parent_path();
+    const int fd = ::open(parent.empty() ? "." : parent.c_str(), O_RDONLY | O_DIRECTORY);
+    if (fd < 0) return false;
+    const bool ok = ::fsync(fd) == 0;
+    ::close(fd);
+    return ok;
+#endif
+}
+
+constexpr char JOURNAL_MAGIC[8] = {'A', 'U', 'R', 'J', 'R', 'N', 'L', '\0'};
+
+// A staged incremental save, path + ".journal": this header, then the new
+// tables, the indices of the changed chunks and their hashes in the base
+// snapshot (metaSize bytes, zero padded to a multiple of 32), then the
+// changed chunks
+struct JournalHeader {
+    char magic[8];
+    std::uint64_t baseGeneration; // of the snapshot it was staged against
+    std::uint64_t layoutHash;
+    std::uint64_t chunkCount;     // chunks in the journal
+    std::uint64_t metaSize;
+    std::uint64_t metaHash;
+    std::uint64_t reserved[2];
+};
+static_assert(sizeof(JournalHeader) == 64);
+
+std::string journalPath(const std::string& path) {
+    return path + ".journal";
+}
+
+struct StagedJournal {
+    JournalHeader journal;
+    std::vector<std::byte> meta;
+    SnapshotHeader header; // the new one, from meta
+};
+
+// Reads the header and tables of a journal, leaving in at its first chunk.
+// False if the journal is incomplete: a crash (or a writer still streaming
+// it) before it was synced
+bool readJournal(std::ifstream& in, const std::string& journalFile, StagedJournal& staged) {
+    std::error_code error;
+    const std::uintmax_t journalSize = std::filesystem::file_size(journalFile, error);
+    JournalHeader& journal = staged.journal;
+    if (error || !read(in, &journal, sizeof(journal)) ||
+        std::memcmp(journal.magic, JOURNAL_MAGIC, sizeof(JOURNAL_MAGIC)) != 0 || journal.chunkCount == 0 ||
+        journal.metaSize % 32 != 0 || journal.metaSize < sizeof(SnapshotHeader) ||
+        journal.metaSize > journalSize - sizeof(journal)) {
+        return false;
+    }
+    staged.meta.resize(journal.metaSize);
+    if (!read(in, staged.meta.data(), staged.meta.size()) ||
+        hashBytes(staged.meta.data(), staged.meta.size()) != journal.metaHash) {
+        return false;
+    }
+    const SnapshotHeader& header = staged.header;
+    std::memcpy(&staged.header, staged.meta.data(), sizeof(header));
+    return header.chunkSize != 0 && header.chunkSize % 32 == 0 && header.chunkCount != 0 &&
+           tablesEnd(header) + 2 * journal.chunkCount * sizeof(std::uint64_t) <= staged.meta.size() &&
+           sizeof(journal) + staged.meta.size() + journal.chunkCount * header.chunkSize == journalSize;
+}
+
+} // namespace
+
+// --- SnapshotWriter ---
+
+SnapshotWriter::SnapshotWriter(std::size_t chunkSize) : chunkSize(chunkSize) {
+    assert(chunkSize > 0 && chunkSize % SNAPSHOT_DATA_ALIGNMENT == 0);
+}
+
+void SnapshotWriter::add(std::string_view name, SnapshotType type, std::size_t count, const void* data) {
+    assert(snapshotPlanes(type) == 1 && "use addPlanes() for Vector3 arrays");
+    assert(name.size() < sizeof(SnapshotArrayRecord::name));
+    Array a{};
+    std::memcpy(a.record.name, name.data(), name.size());
+    a.record.type = type;
+    a.record.planes = 1;
+    a.record.count = count;
+    a.planes[0] = static_cast<const std::byte*>(data);
+    arrays.push_back(a);
+}
+
+void SnapshotWriter::addPlanes(std::string_view name, std::size_t count, const float* x, const float* y,
+                               const float* z) {
+    assert(name.size() < sizeof(SnapshotArrayRecord::name));
+    Array a{};
+    std::memcpy(a.record.name, name.data(), name.size());
+    a.record.type = SnapshotType::Vector3;
+    a.record.planes = 3;
+    a.record.count = count;
+    a.planes[0] = reinterpret_cast<const std::byte*>(x);
+    a.planes[1] = reinterpret_cast<const std::byte*>(y);
+    a.planes[2] = reinterpret_cast<const std::byte*>(z);
+    arrays.push_back(a);
+}
+
+SnapshotWriter::Layout SnapshotWriter::layout() const {
+    Layout l;
+    l.records.reserve(arrays.size());
+    std::uint64_t offset = 0;
+    for (const Array& a : arrays) {
+        SnapshotArrayRecord r = a.record;
+        const std::uint64_t planeBytes = r.count * snapshotElementSize(r.type);
+        r.offset = offset;
+        r.planeStride = alignUp(planeBytes, SNAPSHOT_PLANE_ALIGNMENT);
+        for (std::uint32_t p = 0; p < r.planes; ++p) {
+            if (planeBytes > 0) l.segments.push_back({offset, planeBytes, a.planes[p]});
+            offset += r.planeStride;
+        }
+        l.records.push_back(r);
+    }
+
+    SnapshotHeader& h = l.header;
+    std::memcpy(h.magic, MAGIC, sizeof(MAGIC));
+    h.version = SNAPSHOT_VERSION;
+    h.byteOrder = BYTE_ORDER_MARK;
+    h.arrayCount = static_cast<std::uint32_t>(l.records.size());
+    h.chunkSize = static_cast<std::uint32_t>(chunkSize);
+    h.chunkCount = (offset + chunkSize - 1) / chunkSize;
+    h.dataSize = h.chunkCount * chunkSize;
+    h.dataOffset = alignUp(tablesEnd(h), SNAPSHOT_DATA_ALIGNMENT);
+    h.generation = 1;
+
+    // Records are zero-initialised (padding and name tails included), so hashing their bytes is stable
+    std::vector<std::byte> described(alignUp(l.records.size() * sizeof(SnapshotArrayRecord) + 8, 32));
+    std::memcpy(described.data(), l.records.data(), l.records.size() * sizeof(SnapshotArrayRecord));
+    std::memcpy(described.data() + l.records.size() * sizeof(SnapshotArrayRecord), &h.chunkSize, sizeof(h.chunkSize));
+    h.layoutHash = hashBytes(described.data(), described.size());
+    return l;
+}
+
+// The chunk's bytes: straight from the array when one plane covers it, else
+// gathered into scratch with zeros in the gaps.
+const std::byte* SnapshotWriter::chunk(const Layout& l, std::size_t index, std::byte* scratch) const {
+    const std::uint64_t begin = index * chunkSize;
+    const std::uint64_t end = begin + chunkSize;
+    auto it = std::lower_bound(l.segments.begin(), l.segments.end(), begin,
+                               [](const Segment& s, std::uint64_t at) { return s.offset + s.size <= at; });
+    if (it != l.segments.end() && it->offset <= begin && it->offset + it->size >= end) {
+        return it->data + (begin - it->offset);
+    }
+    std::memset(scratch, 0, chunkSize);
+    for (; it != l.segments.end() && it->offset < end; ++it) {
+        const std::uint64_t from = std::max(begin, it->offset);
+        const std::uint64_t to = std::min(end, it->offset + it->size);
+        std::memcpy(scratch + (from - begin), it->data + (from - it->offset), to - from);
+    }
+    return scratch;
+}
+
+std::vector<std::uint64_t> SnapshotWriter::hashChunks(const Layout& l, JobSystem* jobs) const {
+    std::vector<std::uint64_t> hashes(l.header.chunkCount);
+    const unsigned slots = jobs != nullptr ? jobs->threadCount() + 1 : 1; // + 1 for foreign threads
+    std::vector<ChunkBuffer> scratch;
+    for (unsigned i = 0; i < slots; ++i) scratch.push_back(chunkBuffer(chunkSize));
+    runRange(jobs, hashes.size(), CHUNKS_PER_JOB, [&](std::size_t first, std::size_t last) {
+        const int thread = jobs != nullptr ? jobs->currentThreadIndex() : 0;
+        std::byte* buffer = scratch[thread < 0 ? slots - 1 : static_cast<unsigned>(thread)].get();
+        for (std::size_t i = first; i < last; ++i) hashes[i] = hashBytes(chunk(l, i, buffer), chunkSize);
+    });
+    return hashes;
+}
+
+bool SnapshotWriter::save(const std::string& path, JobSystem* jobs) {
+    if (!commitIncremental(path)) return false; // a staged save lands before the file is replaced
+    stats = {};
+    const Layout l = layout();
+    const std::vector<std::uint64_t> hashes = hashChunks(l, jobs);
+    const std::string temporary = path + ".tmp";
+    {
+        std::ofstream out(temporary, std::ios::binary | std::ios::trunc);
+        if (!out) return false;
+        const std::vector<char> padding(l.header.dataOffset - tablesEnd(l.header), 0);
+        bool ok = write(out, &l.header, sizeof(l.header)) &&
+                  write(out, l.records.data(), l.records.size() * sizeof(SnapshotArrayRecord)) &&
+                  write(out, hashes.data(), hashes.size() * sizeof(std::uint64_t)) &&
+                  write(out, padding.data(), padding.size());
+        const ChunkBuffer scratch = chunkBuffer(chunkSize);
+        for (std::size_t i = 0; ok && i < hashes.size(); ++i) ok = write(out, chunk(l, i, scratch.get()), chunkSize);
+        out.close();
+        if (!ok || !out || !syncFile(temporary)) {
+            std::filesystem::remove(temporary);
+            return false;
+        }
+    }
+    std::error_code error;
+    std::filesystem::rename(temporary, path, error);
+    if (error || !syncDirectory(path)) return false;
+    stats.chunks = stats.chunksWritten = hashes.size();
+    stats.bytesWritten = l.header.dataOffset + l.header.dataSize;
+    return true;
+}
+
+bool SnapshotWriter::saveIncremental(const std::string& path, JobSystem* jobs) {
+    return stageIncremental(path, jobs) && commitIncremental(path);
+}
+
+bool SnapshotWriter::stageIncremental(const std::string& path, JobSystem* jobs) {
+    if (!commitIncremental(path)) return false; // an earlier staged save lands first
+
+    const Layout l = layout();
+    SnapshotHeader old{};
+    std::vector<std::uint64_t> stored;
+    {
+        std::ifstream file(path, std::ios::binary);
+        const bool compatible = file && read(file, &old, sizeof(old)) &&
+                                std::memcmp(old.magic, MAGIC, sizeof(MAGIC)) == 0 &&
+                                old.version == SNAPSHOT_VERSION && old.byteOrder == BYTE_ORDER_MARK &&
+                                old.layoutHash == l.header.layoutHash && old.chunkCount == l.header.chunkCount &&
+                                old.chunkSize == l.header.chunkSize;
+        if (compatible) {
+            stored.resize(old.chunkCount);
+            file.seekg(static_cast<std::streamoff>(sizeof(SnapshotHeader) +
+                                                   old.arrayCount * sizeof(SnapshotArrayRecord)));
+        }
+        if (!compatible || !read(file, stored.data(), stored.size() * sizeof(std::uint64_t))) {
+            file.close();
+            return save(path, jobs);
+        }
+    }
+
+    stats = {};
+    stats.incremental = true;
+    stats.chunks = stored.size();
+    const std::vector<std::uint64_t> hashes = hashChunks(l, jobs);
+    std::vector<std::uint64_t> changed;
+    for (std::size_t i = 0; i < hashes.size(); ++i) {
+        if (hashes[i] != stored[i]) changed.push_back(i);
+    }
+    if (changed.empty()) return true; // the file already holds the arrays
+
+    SnapshotHeader header = l.header;
+    header.generation = old.generation + 1;
+    const std::size_t tables = tablesEnd(header);
+    std::vector<std::uint64_t> base(changed.size());
+    for (std::size_t k = 0; k < changed.size(); ++k) base[k] = stored[changed[k]];
+    std::vector<std::byte> meta(alignUp(tables + 2 * changed.size() * sizeof(std::uint64_t), 32));
+    std::byte* cursor = meta.data();
+    const auto append = [&](const void* data, std::size_t size) {
+        std::memcpy(cursor, data, size);
+        cursor += size;
+    };
+    append(&header, sizeof(header));
+    append(l.records.data(), l.records.size() * sizeof(SnapshotArrayRecord));
+    append(hashes.data(), hashes.size() * sizeof(std::uint64_t));
+    append(changed.data(), changed.size() * sizeof(std::uint64_t));
+    append(base.data(), base.size() * sizeof(std::uint64_t));
+
+    JournalHeader journal{};
+    std::memcpy(journal.magic, JOURNAL_MAGIC, sizeof(JOURNAL_MAGIC));
+    journal.baseGeneration = old.generation;
+    journal.layoutHash = header.layoutHash;
+    journal.chunkCount = changed.size();
+    journal.metaSize = meta.size();
+    journal.metaHash = hashBytes(meta.data(), meta.size());
+
+    const std::string journalFile = journalPath(path);
+    {
+        std::ofstream out(journalFile, std::ios::binary | std::ios::trunc);
+        bool ok = out && write(out, &journal, sizeof(journal)) && write(out, meta.data(), meta.size());
+        const ChunkBuffer scratch = chunkBuffer(chunkSize);
+        for (std::size_t k = 0; ok && k < changed.size(); ++k) {
+            ok = write(out, chunk(l, changed[k], scratch.get()), chunkSize);
+        }
+        out.close();
+        // Durable before the snapshot is touched, or it must not be applied at all
+        if (!ok || !out || !syncFile(journalFile) || !syncDirectory(journalFile)) {
+            std::filesystem::remove(journalFile);
+            return false;
+        }
+    }
+    stats.chunksWritten = changed.size();
+    stats.bytesWritten = sizeof(journal) + meta.size() + 2 * changed.size() * chunkSize + tables;
+    return true;
+}
+
+bool SnapshotWriter::commitIncremental(const std::string& path) {
+    const std::string journalFile = journalPath(path);
+    std::ifstream in(journalFile, std::ios::binary);
+    if (!in) return true; // nothing staged
+    const auto discard = [&] {
+        in.close();
+        std::error_code error;
+        std::filesystem::remove(journalFile, error);
+        return true;
+    };
+
+    // A journal cut short by a crash was never applied: the snapshot is still whole
+    StagedJournal pending;
+    if (!readJournal(in, journalFile, pending)) return discard();
+    const JournalHeader& journal = pending.journal;
+    const std::vector<std::byte>& meta = pending.meta;
+    const SnapshotHeader& header = pending.header;
+    const std::size_t tables = tablesEnd(header);
+    std::vector<std::uint64_t> hashes(header.chunkCount), changed(journal.chunkCount), base(journal.chunkCount);
+    std::memcpy(hashes.data(), meta.data() + tables - hashes.size() * sizeof(std::uint64_t),
+                hashes.size() * sizeof(std::uint64_t));
+    std::memcpy(changed.data(), meta.data() + tables, changed.size() * sizeof(std::uint64_t));
+    std::memcpy(base.data(), meta.data() + tables + changed.size() * sizeof(std::uint64_t),
+                base.size() * sizeof(std::uint64_t));
+
+    // Only onto the snapshot it was staged against: every stored hash is the
+    // new one, or for a changed chunk the base one (tables partly written)
+    std::fstream file(path, std::ios::binary | std::ios::in | std::ios::out);
+    SnapshotHeader current{};
+    std::vector<std::uint64_t> stored(header.chunkCount);
+    bool staged = file && read(file, &current, sizeof(current)) && current.layoutHash == journal.layoutHash &&
+                  current.arrayCount == header.arrayCount && current.chunkCount == header.chunkCount &&
+                  (current.generation == journal.baseGeneration || current.generation == header.generation);
+    file.seekg(static_cast<std::streamoff>(sizeof(SnapshotHeader) + header.arrayCount * sizeof(SnapshotArrayRecord)));
+    staged = staged && read(file, stored.data(), stored.size() * sizeof(std::uint64_t));
+    for (std::size_t k = 0; staged && k < changed.size(); ++k) {
+        staged = changed[k] < stored.size();
+        if (staged && stored[changed[k]] == base[k]) stored[changed[k]] = hashes[changed[k]];
+    }
+    if (!staged || stored != hashes) {
+        file.close();
+        return discard();
+    }
+
+    // Every chunk must be intact before the first one is written
+    const ChunkBuffer buffer = chunkBuffer(header.chunkSize);
+    for (const std::uint64_t index : changed) {
+        if (!read(in, buffer.get(), header.chunkSize) ||
+            hashBytes(buffer.get(), header.chunkSize) != hashes[index]) {
+            file.close();
+            return discard();
+        }
+    }
+
+    // Chunks, then the tables that describe them. A crash anywhere here
+    // leaves the journal, and applying it again gives the same file
+    in.seekg(static_cast<std::streamoff>(sizeof(journal) + meta.size()));
+    bool ok = true;
+    for (std::size_t k = 0; ok && k < changed.size(); ++k) {
+        file.seekp(static_cast<std::streamoff>(header.dataOffset + changed[k] * header.chunkSize));
+        ok = read(in, buffer.get(), header.chunkSize) && write(file, buffer.get(), header.chunkSize);
+    }
+    file.seekp(0);
+    ok = ok && write(file, meta.data(), tables);
+    file.close();
+    if (!ok || !file || !syncFile(path)) return false;
+    return discard();
+}
+
+// --- SnapshotView ---
+
+SnapshotView::~SnapshotView() {
+    close();
+}
+
+SnapshotView::SnapshotView(SnapshotView&& other) noexcept
+    : base(std::exchange(other.base, nullptr)), size(std::exchange(other.size, 0)),
+      mapping(std::exchange(other.mapping, nullptr)) {}
+
+SnapshotView& SnapshotView::operator=(SnapshotView&& other) noexcept {
+    if (this != &other) {
+        close();
+        base = std::exchange(other.base, nullptr);
+        size = std::exchange(other.size, 0);
+        mapping = std::exchange(other.mapping, nullptr);
+    }
+    return *this;
+}
+
+bool SnapshotView::open(const std::string& path, std::string& error) {
+    close();
+    {
+        // Mid-commit the file may hold some of the new chunks; only the
+        // writer side (commitIncremental) may finish that
+        std::ifstream journal(journalPath(path), std::ios::binary);
+        StagedJournal pending;
+        if (journal && readJournal(journal, journalPath(path), pending)) {
+            error = path + ": an incremental save is staged; SnapshotWriter::commitIncremental() completes it";
+            return false;
+        }
+    }
+#ifdef _WIN32
+    const HANDLE file = CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING,
+                                    FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (file == INVALID_HANDLE_VALUE) {
+        error = "cannot open " + path;
+        return false;
+    }
+    LARGE_INTEGER fileSize{};
+    GetFileSizeEx(file, &fileSize);
+    const HANDLE view = fileSize.QuadPart > 0 ? CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr) : nullptr;
+    CloseHandle(file);
+    const void* data = view != nullptr ? MapViewOfFile(view, FILE_MAP_READ, 0, 0, 0) : nullptr;
+    if (data == nullptr) {
+        if (view != nullptr) CloseHandle(view);
+        error = "cannot map " + path;
+        return false;
+    }
+    mapping = view;
+    size = static_cast<std::size_t>(fileSize.QuadPart);
+#else
+    const int fd = ::open(path.c_str(), O_RDONLY);
+    if (fd < 0) {
+        error = "cannot open " + path;
+        return false;
+    }
+    struct stat info{};
+    const bool sized = ::fstat(fd, &info) == 0 && info.st_size > 0;
+    void* data = sized ? ::mmap(nullptr, static_cast<std::size_t>(info.st_size), PROT_READ, MAP_SHARED, fd, 0) : MAP_FAILED;
+    ::close(fd);
+    if (data == MAP_FAILED) {
+        error = "cannot map " + path;
+        return false;
+    }
+    size = static_cast<std::size_t>(info.st_size);
+#endif
+    base = static_cast<const std::byte*>(data);
+
+    const auto reject = [&](const char* why) {
+        close();
+        error = path + ": " + why;
+        return false;
+    };
+    if (size < sizeof(SnapshotHeader)) return reject("too small for a snapshot header");
+    const SnapshotHeader& h = header();
+    if (std::memcmp(h.magic, MAGIC, sizeof(MAGIC)) != 0) return reject("not a snapshot");
+    if (h.byteOrder != BYTE_ORDER_MARK) return reject("written with the other byte order");
+    if (h.version != SNAPSHOT_VERSION) return reject("unsupported snapshot version");
+    if (h.chunkSize == 0 || h.dataSize != h.chunkCount * h.chunkSize || h.dataOffset < tablesEnd(h) ||
+        h.dataOffset % SNAPSHOT_DATA_ALIGNMENT != 0 || h.dataOffset + h.dataSize > size) {
+        return reject("truncated or inconsistent header");
+    }
+    for (const SnapshotArrayRecord& r : records()) {
+        const std::uint64_t planeBytes = r.count * snapshotElementSize(r.type);
+        if (r.planes != snapshotPlanes(r.type) || r.name[sizeof(r.name) - 1] != '\0' ||
+            r.offset % SNAPSHOT_PLANE_ALIGNMENT != 0 || r.planeStride < planeBytes ||
+            r.offset + r.planeStride * r.planes > h.dataSize) {
+            return reject("array record out of bounds");
+        }
+    }
+    return true;
+}
+
+void SnapshotView::close() noexcept {
+    if (base == nullptr) return;
+#ifdef _WIN32
+    UnmapViewOfFile(base);
+    CloseHandle(static_cast<HANDLE>(mapping));
+#else
+    ::munmap(const_cast<std::byte*>(base), size);
+#endif
+    base = nullptr;
+    size = 0;
+    mapping = nullptr;
+}
+
+std::span<const SnapshotArrayRecord> SnapshotView::records() const noexcept {
+    if (base == nullptr) return {};
+    return {reinterpret_cast<const SnapshotArrayRecord*>(base + sizeof(SnapshotHeader)), header().arrayCount};
+}
+
+const SnapshotArrayRecord* SnapshotView::find(std::string_view name) const noexcept {
+    for (const SnapshotArrayRecord& r : records()) {
+        if (std::string_view(r.name) == name) return &r;
+    }
+    return nullptr;
+}
+
+std::span<const std::byte> SnapshotView::bytes(std::string_view name, std::uint32_t plane) const noexcept {
+    const SnapshotArrayRecord* r = find(name);
+    if (r == nullptr || plane >= r->planes) return {};
+    const std::byte* data = base + header().dataOffset + r->offset + plane * r->planeStride;
+    return {data, r->count * snapshotElementSize(r->type)};
+}
+
+bool SnapshotView::verify() const noexcept {
+    if (base == nullptr) return false;
+    const SnapshotHeader& h = header();
+    const std::byte* stored = base + sizeof(SnapshotHeader) + h.arrayCount * sizeof(SnapshotArrayRecord);
+    for (std::uint64_t i = 0; i < h.chunkCount; ++i) {
+        std::uint64_t expected;
+        std::memcpy(&expected, stored + i * sizeof(expected), sizeof(expected));
+        if (hashBytes(base + h.dataOffset + i * h.chunkSize, h.chunkSize) != expected) return false;
+    }
+    return true;
+}
+
+} // namespace core
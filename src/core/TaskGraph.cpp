@@ -0,0 +1,69 @@
+#include "include/TaskGraph.h"
+
+#include <cassert>
+
+namespace core {
+
+TaskGraph::TaskId TaskGraph::add(std::function<void()> task) {
+    auto node = std::make_unique<Node>();
+    node->execute = &TaskGraph::executeNode;
+    node->graph = this;
+    node->task = std::move(task);
+    nodes.push_back(std::move(node));
+    return static_cast<TaskId>(nodes.size() - 1);
+}
+
+void TaskGraph::precede(TaskId before, TaskId after) {
+    assert(before < nodes.size() && after < nodes.size() && before != after);
+    nodes[before]->successors.push_back(after);
+    ++nodes[after]->predecessors;
+}
+
+void TaskGraph::executeNode(Job& job) {
+    Node& node = static_cast<Node&>(job);
+    if (node.task) node.task();
+
+    // Release successors; the last finishing predecessor submits. Submitting
+    // before our own counter decrement keeps the graph's counter above zero.
+    TaskGraph& graph = *node.graph;
+    for (TaskId id : node.successors) {
+        Node& next = *graph.nodes[id];
+        if (next.remaining.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+            graph.active->submit(next, graph.counter);
+        }
+    }
+}
+
+void TaskGraph::run(JobSystem& jobs) {
+    assert(isAcyclic() && "TaskGraph contains a cycle");
+    assert(counter.done() && "TaskGraph::run is not reentrant");
+    active = &jobs;
+    for (auto& node : nodes) node->remaining.store(node->predecessors, std::memory_order_relaxed);
+    for (auto& node : nodes) {
+        if (node->predecessors == 0) jobs.submit(*node, counter);
+    }
+    jobs.wait(counter);
+    active = nullptr;
+}
+
+bool TaskGraph::isAcyclic() const {
+    // Kahn's algorithm: every node must become ready
+    std::vector<std::int32_t> inDegree(nodes.size());
+    std::vector<TaskId> ready;
+    for (TaskId i = 0; i < nodes.size(); ++i) {
+        inDegree[i] = nodes[i]->predecessors;
+        if (inDegree[i] == 0) ready.push_back(i);
+    }
+    std::size_t visited = 0;
+    while (!ready.empty()) {
+        const TaskId id = ready.back();
+        ready.pop_back();
+        ++visited;
+        for (TaskId next : nodes[id]->successors) {
+            if (--inDegree[next] == 0) ready.push_back(next);
+        }
+    }
+    return visited == nodes.size();
+}
+
+} // namespace core
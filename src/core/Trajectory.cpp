@@ -0,0 +1,452 @@
+#include "include/Trajectory.h"
+
+#include <algorithm>
+#include <bit>
+#include <cassert>
+#include <cstring>
+
+namespace core {
+
+namespace {
+
+constexpr char MAGIC[8] = {'A', 'U', 'R', 'T', 'R', 'A', 'J', '\0'};
+constexpr char END_MAGIC[8] = {'A', 'U', 'R', 'T', 'E', 'N', 'D', '\0'};
+constexpr char CHUNK_TAG[4] = {'T', 'C', 'H', 'K'};
+constexpr std::uint32_t BYTE_ORDER_MARK = 0x01020304u;
+
+// Largest float below 2^31, so quantized values always fit an int32
+constexpr float QUANTIZED_LIMIT = 2147483520.0f;
+
+struct FileHeader {
+    char magic[8];
+    std::uint32_t version;
+    std::uint32_t byteOrder;
+    std::uint32_t channelCount;
+    std::uint32_t framesPerChunk;
+    std::uint64_t reserved;
+};
+
+struct ChannelRecord {
+    char name[48];
+    std::uint64_t count;
+    std::uint32_t components;
+    float precision;
+};
+
+// Followed by frames step numbers, then the payload
+struct ChunkHeader {
+    char tag[4];
+    std::uint32_t frames;
+    std::uint64_t payloadBytes;
+};
+
+// Last bytes of a closed file; the index holds (offset, first frame, frames) per chunk
+struct Footer {
+    std::uint64_t indexOffset;
+    std::uint64_t chunkCount;
+    std::uint64_t frameCount;
+    char magic[8];
+};
+
+static_assert(sizeof(FileHeader) == 32 && sizeof(ChannelRecord) == 64 && sizeof(ChunkHeader) == 16 &&
+              sizeof(Footer) == 32);
+
+std::int32_t quantize(float value, float scale) noexcept {
+    float s = value * scale;
+    if (!(s > -QUANTIZED_LIMIT)) s = -QUANTIZED_LIMIT; // also NaN
+    if (s > QUANTIZED_LIMIT) s = QUANTIZED_LIMIT;
+    return static_cast<std::int32_t>(s >= 0.0f ? s + 0.5f : s - 0.5f);
+}
+
+float dequantize(std::int32_t value, float precision) noexcept {
+    return static_cast<float>(static_cast<double>(value) * precision);
+}
+
+std::uint32_t zigzag(std::int32_t delta) noexcept {
+    return (static_cast<std::uint32_t>(delta) << 1) ^ static_cast<std::uint32_t>(delta >> 31);
+}
+
+std::int32_t unzigzag(std::uint32_t value) noexcept {
+    return static_cast<std::int32_t>((value >> 1) ^ (0u - (value & 1u)));
+}
+
+// One block: a width byte, then TRAJECTORY_BLOCK values of that many bits (8 * width bytes)
+void pack(const std::uint32_t* values, std::vector<std::byte>& out) {
+    std::uint32_t any = 0;
+    for (std::size_t i = 0; i < TRAJECTORY_BLOCK; ++i) any |= values[i];
+    const auto width = static_cast<unsigned>(std::bit_width(any));
+    const std::size_t at = out.size();
+    out.resize(at + 1 + 8 * width);
+    std::byte* dst = out.data() + at;
+    *dst++ = static_cast<std::byte>(width);
+    if (width == 0) return;
+    std::uint64_t bits = 0;
+    unsigned filled = 0;
+    for (std::size_t i = 0; i < TRAJECTORY_BLOCK; ++i) {
+        bits |= static_cast<std::uint64_t>(values[i]) << filled;
+        filled += width;
+        if (filled >= 32) {
+            const auto word = static_cast<std::uint32_t>(bits);
+            std::memcpy(dst, &word, 4);
+            dst += 4;
+            bits >>= 32;
+            filled -= 32;
+        }
+    }
+}
+
+// Returns the end of the block, nullptr if it runs past end
+const std::byte* unpack(const std::byte* src, const std::byte* end, std::uint32_t* values) {
+    if (src == end) return nullptr;
+    const auto width = static_cast<unsigned>(*src++);
+    if (width > 32 || static_cast<std::size_t>(end - src) < 8 * width) return nullptr;
+    if (width == 0) {
+        std::fill_n(values, TRAJECTORY_BLOCK, 0u);
+        return src;
+    }
+    const std::uint32_t mask = width == 32 ? ~0u : (1u << width) - 1;
+    std::uint64_t bits = 0;
+    unsigned filled = 0;
+    for (std::size_t i = 0; i < TRAJECTORY_BLOCK; ++i) {
+        if (filled < width) {
+            std::uint32_t word;
+            std::memcpy(&word, src, 4);
+            src += 4;
+            bits |= static_cast<std::uint64_t>(word) << filled;
+            filled += 32;
+        }
+        values[i] = static_cast<std::uint32_t>(bits) & mask;
+        bits >>= width;
+        filled -= width;
+    }
+    return src;
+}
+
+std::size_t paddedToBlock(std::size_t count) noexcept {
+    return (count + TRAJECTORY_BLOCK - 1) / TRAJECTORY_BLOCK * TRAJECTORY_BLOCK;
+}
+
+template <typename T>
+bool read(std::istream& in, T* data, std::size_t count = 1) {
+    in.read(reinterpret_cast<char*>(data), static_cast<std::streamsize>(count * sizeof(T)));
+    return static_cast<bool>(in);
+}
+
+} // namespace
+
+// --- TrajectoryWriter ---
+
+TrajectoryWriter::~TrajectoryWriter() {
+    if (isOpen()) close();
+}
+
+void TrajectoryWriter::addChannel(const TrajectoryChannel& channel, std::initializer_list<const float*> data) {
+    assert(!isOpen() && "channels are fixed while recording");
+    assert(channel.components == data.size() && channel.components >= 1 && channel.components <= 4);
+    assert(channel.precision > 0.0f && channel.name.size() < sizeof(ChannelRecord::name));
+    channels.push_back(channel);
+    for (const float* plane : data) {
+        planes.push_back({plane, frameValues, channel.count, 1.0f / channel.precision});
+        frameValues += channel.count;
+    }
+}
+
+bool TrajectoryWriter::open(const std::string& path, const TrajectorySettings& trajectorySettings) {
+    if (isOpen()) return false;
+    settings = trajectorySettings;
+    assert(settings.queueFrames > 0 && settings.framesPerChunk > 0);
+    file.open(path, std::ios::binary | std::ios::trunc);
+    if (!file) return false;
+
+    FileHeader header{};
+    std::memcpy(header.magic, MAGIC, sizeof(MAGIC));
+    header.version = TRAJECTORY_VERSION;
+    header.byteOrder = BYTE_ORDER_MARK;
+    header.channelCount = static_cast<std::uint32_t>(channels.size());
+    header.framesPerChunk = settings.framesPerChunk;
+    file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    for (const TrajectoryChannel& c : channels) {
+        ChannelRecord record{};
+        std::memcpy(record.name, c.name.data(), c.name.size());
+        record.count = c.count;
+        record.components = c.components;
+        record.precision = c.precision;
+        file.write(reinterpret_cast<const char*>(&record), sizeof(record));
+    }
+    failed = !file;
+
+    slots.assign(settings.queueFrames * frameValues, 0.0f);
+    slotSteps.assign(settings.queueFrames, 0);
+    freeSlots = std::make_unique<SpscQueue<std::uint32_t>>(settings.queueFrames);
+    filledSlots = std::make_unique<SpscQueue<std::uint32_t>>(settings.queueFrames);
+    for (std::uint32_t i = 0; i < settings.queueFrames; ++i) freeSlots->push(i);
+
+    std::size_t largestPlane = 0;
+    for (const Plane& p : planes) largestPlane = std::max(largestPlane, p.count);
+    previous.assign(frameValues, 0);
+    residuals.assign(paddedToBlock(largestPlane), 0);
+    payload.clear();
+    chunkSteps.clear();
+    chunkIndex.clear();
+    closing.store(false, std::memory_order_relaxed);
+    recorded = dropped = written = 0;
+    fileBytes = sizeof(FileHeader) + channels.size() * sizeof(ChannelRecord);
+    writer = std::thread([this] { run(); });
+    return true;
+}
+
+bool TrajectoryWriter::record(std::uint64_t step) {
+    if (!isOpen()) return false;
+    std::uint32_t slot;
+    if (!freeSlots->pop(slot)) {
+        dropped.fetch_add(1, std::memory_order_relaxed);
+        return false;
+    }
+    float* frame = slots.data() + slot * frameValues;
+    for (const Plane& p : planes) std::memcpy(frame + p.offset, p.data, p.count * sizeof(float));
+    slotSteps[slot] = step;
+    filledSlots->push(slot); // never full: it has room for every slot
+    recorded.fetch_add(1, std::memory_order_relaxed);
+    pending.fetch_add(1, std::memory_order_release);
+    pending.notify_one();
+    return true;
+}
+
+void TrajectoryWriter::run() {
+    for (;;) {
+        const std::uint32_t seen = pending.load(std::memory_order_acquire);
+        const bool last = closing.load(std::memory_order_acquire); // pushes before close() are visible below
+        std::uint32_t slot;
+        while (filledSlots->pop(slot)) {
+            encode(slot);
+            freeSlots->push(slot);
+        }
+        if (last) break;
+        pending.wait(seen, std::memory_order_acquire);
+    }
+    if (!chunkSteps.empty()) writeChunk();
+}
+
+void TrajectoryWriter::encode(std::size_t slot) {
+    const float* frame = slots.data() + slot * frameValues;
+    if (chunkSteps.empty()) std::fill(previous.begin(), previous.end(), 0); // key frame
+    chunkSteps.push_back(slotSteps[slot]);
+
+    for (const Plane& p : planes) {
+        const float* values = frame + p.offset;
+        std::int32_t* last = previous.data() + p.offset;
+        for (std::size_t i = 0; i < p.count; ++i) {
+            const std::int32_t q = quantize(values[i], p.scale);
+            residuals[i] = zigzag(static_cast<std::int32_t>(static_cast<std::uint32_t>(q) - static_cast<std::uint32_t>(last[i])));
+            last[i] = q;
+        }
+        const std::size_t padded = paddedToBlock(p.count);
+        std::fill(residuals.begin() + static_cast<std::ptrdiff_t>(p.count), residuals.begin() + static_cast<std::ptrdiff_t>(padded), 0u);
+        for (std::size_t block = 0; block < padded; block += TRAJECTORY_BLOCK) pack(residuals.data() + block, payload);
+    }
+
+    written.fetch_add(1, std::memory_order_relaxed);
+    if (chunkSteps.size() == settings.framesPerChunk) writeChunk();
+}
+
+void TrajectoryWriter::writeChunk() {
+    ChunkHeader header{};
+    std::memcpy(header.tag, CHUNK_TAG, sizeof(CHUNK_TAG));
+    header.frames = static_cast<std::uint32_t>(chunkSteps.size());
+    header.payloadBytes = payload.size();
+
+    const std::uint64_t offset = fileBytes.load(std::memory_order_relaxed);
+    chunkIndex.push_back(offset);
+    chunkIndex.push_back(written.load(std::memory_order_relaxed) - chunkSteps.size());
+    chunkIndex.push_back(chunkSteps.size());
+
+    file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    file.write(reinterpret_cast<const char*>(chunkSteps.data()), static_cast<std::streamsize>(chunkSteps.size() * 8));
+    file.write(reinterpret_cast<const char*>(payload.data()), static_cast<std::streamsize>(payload.size()));
+    failed = failed || !file;
+    fileBytes.store(offset + sizeof(header) + chunkSteps.size() * 8 + payload.size(), std::memory_order_relaxed);
+    chunkSteps.clear();
+    payload.clear();
+}
+
+bool TrajectoryWriter::close() {
+    if (!isOpen()) return false;
+    closing.store(true, std::memory_order_release);
+    pending.fetch_add(1, std::memory_order_release);
+    pending.notify_one();
+    writer.join();
+
+    Footer footer{};
+    footer.indexOffset = fileBytes.load(std::memory_order_relaxed);
+    footer.chunkCount = chunkIndex.size() / 3;
+    footer.frameCount = written.load(std::memory_order_relaxed);
+    std::memcpy(footer.magic, END_MAGIC, sizeof(END_MAGIC));
+    file.write(reinterpret_cast<const char*>(chunkIndex.data()), static_cast<std::streamsize>(chunkIndex.size() * 8));
+    file.write(reinterpret_cast<const char*>(&footer), sizeof(footer));
+    fileBytes.fetch_add(chunkIndex.size() * 8 + sizeof(footer), std::memory_order_relaxed);
+    file.close();
+    return !failed && !file.fail();
+}
+
+TrajectoryStats TrajectoryWriter::stats() const noexcept {
+    TrajectoryStats s;
+    s.framesRecorded = recorded.load(std::memory_order_relaxed);
+    s.framesDropped = dropped.load(std::memory_order_relaxed);
+    s.framesWritten = written.load(std::memory_order_relaxed);
+    s.rawBytes = s.framesWritten * frameValues * sizeof(float);
+    s.bytesWritten = fileBytes.load(std::memory_order_relaxed);
+    return s;
+}
+
+// --- TrajectoryReader ---
+
+bool TrajectoryReader::open(const std::string& path, std::string& error) {
+    *this = TrajectoryReader();
+    file.open(path, std::ios::binary);
+    if (!file) {
+        error = "cannot open " + path;
+        return false;
+    }
+    const auto reject = [&](const char* why) {
+        file.close();
+        error = path + ": " + why;
+        return false;
+    };
+
+    FileHeader header{};
+    if (!read(file, &header) || std::memcmp(header.magic, MAGIC, sizeof(MAGIC)) != 0) return reject("not a trajectory");
+    if (header.byteOrder != BYTE_ORDER_MARK) return reject("written with the other byte order");
+    if (header.version != TRAJECTORY_VERSION) return reject("unsupported trajectory version");
+
+    std::size_t frameValues = 0;
+    for (std::uint32_t i = 0; i < header.channelCount; ++i) {
+        ChannelRecord record{};
+        if (!read(file, &record) || record.name[sizeof(record.name) - 1] != '\0' || record.components < 1 ||
+            record.components > 4 || !(record.precision > 0.0f)) {
+            return reject("bad channel table");
+        }
+        channelList.push_back({record.name, static_cast<std::size_t>(record.count), record.components, record.precision});
+        channelOffsets.push_back(frameValues);
+        frameValues += record.count * record.components;
+    }
+    const std::uint64_t chunksBegin = sizeof(FileHeader) + header.channelCount * sizeof(ChannelRecord);
+
+    file.seekg(0, std::ios::end);
+    const auto fileSize = static_cast<std::uint64_t>(file.tellg());
+    Footer footer{};
+    bool indexed = false;
+    if (fileSize >= chunksBegin + sizeof(Footer)) {
+        file.seekg(static_cast<std::streamoff>(fileSize - sizeof(Footer)));
+        indexed = read(file, &footer) && std::memcmp(footer.magic, END_MAGIC, sizeof(END_MAGIC)) == 0 &&
+                  footer.indexOffset + footer.chunkCount * 24 + sizeof(Footer) == fileSize;
+    }
+    if (indexed) {
+        std::vector<std::uint64_t> index(footer.chunkCount * 3);
+        file.seekg(static_cast<std::streamoff>(footer.indexOffset));
+        if (!read(file, index.data(), index.size())) return reject("truncated chunk index");
+        for (std::size_t i = 0; i < index.size(); i += 3) {
+            chunks.push_back({index[i], index[i + 1], static_cast<std::uint32_t>(index[i + 2])});
+        }
+        frames = footer.frameCount;
+    } else {
+        // Never closed: walk the chunk headers up to the last complete chunk
+        std::uint64_t offset = chunksBegin;
+        ChunkHeader chunkHeader{};
+        while (offset + sizeof(ChunkHeader) <= fileSize) {
+            file.seekg(static_cast<std::streamoff>(offset));
+            if (!read(file, &chunkHeader) || std::memcmp(chunkHeader.tag, CHUNK_TAG, sizeof(CHUNK_TAG)) != 0) break;
+            const std::uint64_t end = offset + sizeof(ChunkHeader) + chunkHeader.frames * 8ull + chunkHeader.payloadBytes;
+            if (end > fileSize) break;
+            chunks.push_back({offset, frames, chunkHeader.frames});
+            frames += chunkHeader.frames;
+            offset = end;
+        }
+        file.clear();
+    }
+
+    quantized.assign(frameValues, 0);
+    decoded.assign(frameValues, 0.0f);
+    return true;
+}
+
+int TrajectoryReader::findChannel(std::string_view name) const noexcept {
+    for (std::size_t i = 0; i < channelList.size(); ++i) {
+        if (channelList[i].name == name) return static_cast<int>(i);
+    }
+    return -1;
+}
+
+bool TrajectoryReader::loadChunk(std::size_t index) {
+    const Chunk& c = chunks[index];
+    ChunkHeader header{};
+    file.clear();
+    file.seekg(static_cast<std::streamoff>(c.offset));
+    if (!read(file, &header) || std::memcmp(header.tag, CHUNK_TAG, sizeof(CHUNK_TAG)) != 0 || header.frames != c.frames) {
+        return false;
+    }
+    steps.resize(header.frames);
+    payload.resize(header.payloadBytes);
+    if (!read(file, steps.data(), steps.size()) || !read(file, payload.data(), payload.size())) return false;
+    std::fill(quantized.begin(), quantized.end(), 0);
+    cursor = 0;
+    loaded = index;
+    return true;
+}
+
+bool TrajectoryReader::decodeFrame() {
+    std::uint32_t block[TRAJECTORY_BLOCK];
+    const std::byte* src = payload.data() + cursor;
+    const std::byte* end = payload.data() + payload.size();
+    for (std::size_t c = 0; c < channelList.size(); ++c) {
+        const TrajectoryChannel& channel = channelList[c];
+        for (std::uint32_t k = 0; k < channel.components; ++k) {
+            const std::size_t base = channelOffsets[c] + k * channel.count;
+            for (std::size_t first = 0; first < channel.count; first += TRAJECTORY_BLOCK) {
+                src = unpack(src, end, block);
+                if (src == nullptr) return false;
+                const std::size_t n = std::min(TRAJECTORY_BLOCK, channel.count - first);
+                for (std::size_t i = 0; i < n; ++i) {
+                    std::int32_t& q = quantized[base + first + i];
+                    q = static_cast<std::int32_t>(static_cast<std::uint32_t>(q) + static_cast<std::uint32_t>(unzigzag(block[i])));
+                    decoded[base + first + i] = dequantize(q, channel.precision);
+                }
+            }
+        }
+    }
+    cursor = static_cast<std::size_t>(src - payload.data());
+    return true;
+}
+
+bool TrajectoryReader::seek(std::size_t frame) {
+    if (frame >= frames) return false;
+    const auto it = std::upper_bound(chunks.begin(), chunks.end(), frame,
+                                     [](std::size_t f, const Chunk& c) { return f < c.firstFrame; });
+    const auto index = static_cast<std::size_t>(it - chunks.begin()) - 1;
+    if (!loadChunk(index)) return false;
+    for (std::size_t f = chunks[index].firstFrame; f < frame; ++f) {
+        if (!decodeFrame()) return false;
+    }
+    nextFrame = frame;
+    return true;
+}
+
+bool TrajectoryReader::next() {
+    if (nextFrame >= frames) return false;
+    if (loaded >= chunks.size() || nextFrame >= chunks[loaded].firstFrame + chunks[loaded].frames) {
+        const std::size_t index = loaded >= chunks.size() ? 0 : loaded + 1;
+        if (index >= chunks.size() || !loadChunk(index)) return false;
+    }
+    if (!decodeFrame()) return false;
+    currentStep = steps[nextFrame - chunks[loaded].firstFrame];
+    ++nextFrame;
+    return true;
+}
+
+std::span<const float> TrajectoryReader::values(int channel, std::uint32_t component) const noexcept {
+    if (channel < 0 || static_cast<std::size_t>(channel) >= channelList.size()) return {};
+    const TrajectoryChannel& c = channelList[static_cast<std::size_t>(channel)];
+    if (component >= c.components) return {};
+    return {decoded.data() + channelOffsets[static_cast<std::size_t>(channel)] + component * c.count, c.count};
+}
+
+} // namespace core
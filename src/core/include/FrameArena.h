@@ -0,0 +1,142 @@
+#pragma once
+
+#include <cstddef>
+#include <memory_resource>
+#include <new>
+#include <span>
+#include <type_traits>
+#include <utility>
+
+/**
+ * @file FrameArena.h
+ * @brief Linear allocator for data that lives until the end of a frame or step.
+ */
+
+namespace core::memory {
+
+/**
+ * @brief Allocation counters for one frame (or since the last resetStats()).
+ */
+struct MemoryStats {
+    std::size_t bytes = 0;               /**< Bytes requested. */
+    std::size_t allocations = 0;         /**< Calls that returned memory. */
+    std::size_t upstreamAllocations = 0; /**< Blocks taken from the upstream resource. */
+    std::size_t peakBytes = 0;           /**< Most bytes in use at once. */
+};
+
+/**
+ * @class FrameArena
+ * @brief Bump allocator reset once per frame; individual frees are no-ops.
+ *
+ * Allocation is a pointer bump inside the current block; when a block is
+ * full a new one (at least blockSize, doubling) is taken from the upstream
+ * resource. reset() makes all memory reusable at once. If a frame needed
+ * more than one block, reset() replaces them with a single block of the
+ * combined size, so a steady workload stops touching the upstream resource
+ * after its first frame.
+ *
+ * Nothing allocated in the arena is destroyed: create() accepts only
+ * trivially destructible types. An arena is not thread safe; give each
+ * thread its own.
+ *
+ * Example usage:
+ * @code
+ * core::memory::FrameArena arena;
+ * std::span<std::uint32_t> visible = arena.allocateArray<std::uint32_t>(count);
+ * std::pmr::vector<Pair> pairs(arena.resource());
+ * ...
+ * arena.reset(); // end of frame
+ * @endcode
+ */
+class FrameArena {
+public:
+    explicit FrameArena(std::size_t blockSize = DEFAULT_BLOCK_SIZE,
+                        std::pmr::memory_resource* upstream = std::pmr::get_default_resource());
+    ~FrameArena();
+
+    FrameArena(const FrameArena&) = delete;
+    FrameArena& operator=(const FrameArena&) = delete;
+
+    /**
+     * @brief Returns bytes of uninitialized memory aligned to alignment (a power of two).
+     *
+     * Never returns nullptr; throws std::bad_alloc if upstream does.
+     */
+    void* allocate(std::size_t bytes, std::size_t alignment = alignof(std::max_align_t));
+
+    /** @brief Constructs a T in the arena; it is never destroyed. */
+    template <typename T, typename... Args>
+    T* create(Args&&... args) {
+        static_assert(std::is_trivially_destructible_v<T>, "arena objects are never destroyed");
+        return ::new (allocate(sizeof(T), alignof(T))) T(std::forward<Args>(args)...);
+    }
+
+    /** @brief count default-initialized Ts (uninitialized for trivial types). */
+    template <typename T>
+    std::span<T> allocateArray(std::size_t count) {
+        static_assert(std::is_trivially_destructible_v<T>, "arena objects are never destroyed");
+        T* items = static_cast<T*>(allocate(count * sizeof(T), alignof(T)));
+        for (std::size_t i = 0; i < count; ++i) ::new (items + i) T;
+        return {items, count};
+    }
+
+    /**
+     * @brief Ends the frame: all memory becomes free, stats move to lastFrameStats().
+     *
+     * Every pointer handed out since the previous reset() is invalid afterwards.
+     * A frame that needed several blocks ends by trading them for one of
+     * their total size; that allocation counts in the ending frame's stats.
+     */
+    void reset();
+
+    /** @brief Bytes in use in the current frame (including alignment padding). */
+    std::size_t used() const noexcept { return usedBefore + (cursor - blockBegin()); }
+
+    /** @brief Total size of the blocks currently held. */
+    std::size_t capacity() const noexcept { return heldBytes; }
+
+    const MemoryStats& frameStats() const noexcept { return current; }
+    const MemoryStats& lastFrameStats() const noexcept { return last; }
+
+    /** @brief std::pmr adapter over this arena (deallocate is a no-op). */
+    std::pmr::memory_resource* resource() noexcept { return &adapter; }
+
+    static constexpr std::size_t DEFAULT_BLOCK_SIZE = 64 * 1024;
+
+private:
+    struct Block {
+        Block* next;
+        std::size_t size; // usable bytes after the header
+    };
+
+    class Resource final : public std::pmr::memory_resource {
+    public:
+        explicit Resource(FrameArena& owner) noexcept : arena(owner) {}
+
+    private:
+        void* do_allocate(std::size_t bytes, std::size_t alignment) override {
+            return arena.allocate(bytes, alignment);
+        }
+        void do_deallocate(void*, std::size_t, std::size_t) override {}
+        bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override { return this == &other; }
+
+        FrameArena& arena;
+    };
+
+    std::byte* blockBegin() const noexcept;
+    void addBlock(std::size_t minimumBytes);
+    void releaseBlocks() noexcept;
+
+    std::pmr::memory_resource* upstream;
+    std::size_t blockSize;
+    Block* blocks = nullptr;  // most recent first; the head is the current block
+    std::byte* cursor = nullptr;
+    std::byte* limit = nullptr;
+    std::size_t usedBefore = 0;  // bytes used in earlier blocks this frame
+    std::size_t heldBytes = 0;
+    MemoryStats current;
+    MemoryStats last;
+    Resource adapter{*this};
+};
+
+} // namespace core::memory
@@ -0,0 +1,179 @@
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+/**
+ * @file JobSystem.h
+ * @brief Thread pool with work-stealing deques, parallelFor and job counters.
+ */
+
+namespace core {
+
+class JobSystem;
+
+/**
+ * @brief Number of submitted jobs that have not finished yet.
+ *
+ * Submitting a job increments it and finishing one decrements it; a thread
+ * calls JobSystem::wait() on it to join a batch of jobs. A counter must
+ * outlive every job submitted against it.
+ */
+class JobCounter {
+public:
+    bool done() const noexcept { return pending.load(std::memory_order_acquire) == 0; }
+
+private:
+    friend class JobSystem;
+    std::atomic<std::int32_t> pending{0};
+};
+
+/**
+ * @brief Unit of work; derive from it and set execute.
+ *
+ * Jobs are intrusive so submitting never allocates: the owner keeps the job
+ * alive until its counter is done. execute must not throw.
+ */
+struct Job {
+    void (*execute)(Job& self) = nullptr;
+    JobCounter* counter = nullptr; /**< Set by JobSystem::submit(). */
+};
+
+/**
+ * @class JobSystem
+ * @brief Fixed pool of worker threads that share work by stealing.
+ *
+ * Every worker owns a Chase-Lev deque: it pushes and pops its own jobs at the
+ * bottom (LIFO, cache-warm), while idle workers steal from the top of other
+ * deques (FIFO, oldest and usually largest work first). Threads outside the
+ * pool submit through a shared, locked queue. The thread that constructs the
+ * system owns deque 0 and counts towards threadCount(); it does work while
+ * it waits, so a JobSystem of one thread runs everything inline. (A thread
+ * can own a deque in only one pool; it is a foreign thread to any other.)
+ *
+ * wait() never blocks idle: the waiting thread executes pending jobs until
+ * its counter is done, so jobs may themselves submit and wait (nested
+ * parallelFor is fine).
+ *
+ * Example usage:
+ * @code
+ * core::JobSystem jobs;                       // one thread per hardware thread
+ * jobs.parallelFor(0, n, 1024, [&](std::size_t begin, std::size_t end) {
+ *     for (std::size_t i = begin; i < end; ++i) out[i] = f(in[i]);
+ * });
+ * @endcode
+ */
+class JobSystem {
+public:
+    /**
+     * @param threadCount Threads including the calling one; 0 picks one per
+     *        hardware thread.
+     */
+    explicit JobSystem(unsigned threadCount = 0);
+    ~JobSystem();
+
+    JobSystem(const JobSystem&) = delete;
+    JobSystem& operator=(const JobSystem&) = delete;
+
+    unsigned threadCount() const noexcept { return static_cast<unsigned>(queues.size()); }
+
+    /**
+     * @brief Queues job; it runs on some thread of the pool.
+     *
+     * The job and counter must stay alive until the counter is done.
+     */
+    void submit(Job& job, JobCounter& counter);
+
+    /**
+     * @brief Runs pending jobs until counter is done.
+     */
+    void wait(JobCounter& counter);
+
+    /**
+     * @brief Calls body(chunkBegin, chunkEnd) for consecutive grain-sized chunks of [begin, end).
+     *
+     * Chunk boundaries depend only on the range and grain, never on the
+     * thread count or scheduling, so a body that writes disjoint outputs per
+     * chunk gives identical results on any number of threads. Chunks are
+     * handed out dynamically, which balances uneven work. Returns once every
+     * chunk has run.
+     */
+    template <typename Body>
+    void parallelFor(std::size_t begin, std::size_t end, std::size_t grain, Body&& body) {
+        using B = std::remove_reference_t<Body>;
+        parallelForChunks(begin, end, grain, const_cast<void*>(static_cast<const void*>(&body)),
+                          [](void* b, std::size_t chunkBegin, std::size_t chunkEnd) {
+                              (*static_cast<B*>(b))(chunkBegin, chunkEnd);
+                          });
+    }
+
+    /**
+     * @brief Index of the calling thread in this pool, or -1 for foreign threads.
+     *
+     * Useful for per-thread scratch buffers sized by threadCount().
+     */
+    int currentThreadIndex() const noexcept;
+
+    /**
+     * @brief parallelFor calls so far that handed chunks to other threads.
+     *
+     * Calls with a single chunk, or on a pool of one thread, run inline and
+     * are not counted. Lets callers and tests check that work was split.
+     */
+    std::uint64_t splitLoops() const noexcept { return splitLoopCount.load(std::memory_order_relaxed); }
+
+    /** @brief Threads the hardware runs concurrently (at least 1). */
+    static unsigned hardwareThreads() noexcept;
+
+private:
+    /**
+     * Chase-Lev deque (Le et al., "Correct and Efficient Work-Stealing for
+     * Weak Memory Models", 2013) with fixed capacity. The owner pushes and
+     * pops at the bottom, thieves take from the top.
+     */
+    class WorkStealingDeque {
+    public:
+        static constexpr std::int64_t CAPACITY = 4096;
+
+        bool push(Job* job) noexcept;
+        Job* pop() noexcept;
+        Job* steal() noexcept;
+
+    private:
+        alignas(64) std::atomic<std::int64_t> top{0};
+        alignas(64) std::atomic<std::int64_t> bottom{0};
+        alignas(64) std::atomic<Job*> buffer[CAPACITY] = {};
+    };
+
+    using ChunkInvoke = void (*)(void* body, std::size_t chunkBegin, std::size_t chunkEnd);
+    void parallelForChunks(std::size_t begin, std::size_t end, std::size_t grain, void* body, ChunkInvoke invoke);
+
+    void workerLoop(unsigned index);
+    Job* findJob(unsigned index);
+    static void run(Job& job) noexcept;
+    void notifyWork();
+
+    std::vector<std::unique_ptr<WorkStealingDeque>> queues;
+    std::vector<std::thread> workers;
+
+    std::mutex sharedMutex; // guards sharedQueue
+    std::deque<Job*> sharedQueue;
+    std::atomic<bool> sharedNonEmpty{false};
+
+    std::mutex sleepMutex;
+    std::condition_variable wake;
+    std::atomic<std::uint64_t> workEpoch{0}; // bumped on every submit
+    std::atomic<int> sleepers{0};
+    std::atomic<bool> stopping{false};
+    std::atomic<std::uint64_t> splitLoopCount{0};
+};
+
+} // namespace core
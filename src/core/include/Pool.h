@@ -0,0 +1,174 @@
+#pragma once
+
+#include <cstddef>
+#include <memory_resource>
+#include <new>
+#include <utility>
+
+#include "FrameArena.h"
+
+/**
+ * @file Pool.h
+ * @brief Fixed-size block pools with O(1) free lists, typed and as a std::pmr resource.
+ */
+
+namespace core::memory {
+
+/**
+ * @class BlockPool
+ * @brief Hands out blocks of one size from chunks; freed blocks go on a free list.
+ *
+ * Chunks of blocksPerChunk blocks are taken from the upstream resource on
+ * demand and kept until the pool is destroyed, so a pool that has reached
+ * its working-set size allocates nothing more and never fragments. Freed
+ * blocks are reused last-in first-out, which keeps recently touched memory
+ * hot. Not thread safe.
+ */
+class BlockPool {
+public:
+    /**
+     * @param blockSize Bytes per block (rounded up to hold a free-list link).
+     * @param blockAlignment Alignment of every block (a power of two).
+     */
+    explicit BlockPool(std::size_t blockSize, std::size_t blockAlignment = alignof(std::max_align_t),
+                       std::size_t blocksPerChunk = 256,
+                       std::pmr::memory_resource* upstream = std::pmr::get_default_resource());
+    ~BlockPool();
+
+    BlockPool(const BlockPool&) = delete;
+    BlockPool& operator=(const BlockPool&) = delete;
+
+    /** @brief One block in O(1); throws std::bad_alloc if upstream does. */
+    void* allocate();
+
+    /** @brief Returns a block from this pool in O(1). */
+    void deallocate(void* block) noexcept;
+
+    std::size_t blockSize() const noexcept { return stride; }
+    std::size_t blockAlignment() const noexcept { return alignment; }
+
+    /** @brief Blocks currently handed out. */
+    std::size_t live() const noexcept { return liveBlocks; }
+
+    /** @brief Blocks held (live plus free). */
+    std::size_t capacity() const noexcept { return capacityBlocks; }
+
+    /** @brief Counters since construction or the last resetStats() (peakBytes: live blocks). */
+    const MemoryStats& stats() const noexcept { return counters; }
+
+    /** @brief Starts a new counting period, e.g. at the start of a frame. */
+    void resetStats() noexcept;
+
+private:
+    struct FreeBlock {
+        FreeBlock* next;
+    };
+    struct Chunk {
+        Chunk* next;
+    };
+
+    void addChunk();
+
+    std::pmr::memory_resource* upstream;
+    std::size_t stride;
+    std::size_t alignment;
+    std::size_t blocksPerChunk;
+    std::size_t headerBytes;  // chunk header, rounded up to the block alignment
+    Chunk* chunks = nullptr;
+    FreeBlock* freeList = nullptr;
+    std::size_t liveBlocks = 0;
+    std::size_t capacityBlocks = 0;
+    MemoryStats counters;
+};
+
+/**
+ * @class ObjectPool
+ * @brief BlockPool for one type: create() constructs, destroy() destructs and recycles.
+ *
+ * Objects still alive when the pool is destroyed are not destructed.
+ *
+ * Example usage:
+ * @code
+ * core::memory::ObjectPool<Contact> contacts;
+ * Contact* c = contacts.create(a, b);
+ * contacts.destroy(c);
+ * @endcode
+ */
+template <typename T>
+class ObjectPool {
+public:
+    explicit ObjectPool(std::size_t objectsPerChunk = 256,
+                        std::pmr::memory_resource* upstream = std::pmr::get_default_resource())
+        : blocks(sizeof(T), alignof(T), objectsPerChunk, upstream) {}
+
+    template <typename... Args>
+    T* create(Args&&... args) {
+        void* memory = blocks.allocate();
+        try {
+            return ::new (memory) T(std::forward<Args>(args)...);
+        } catch (...) {
+            blocks.deallocate(memory);
+            throw;
+        }
+    }
+
+    void destroy(T* object) noexcept {
+        if (object == nullptr) return;
+        object->~T();
+        blocks.deallocate(object);
+    }
+
+    std::size_t live() const noexcept { return blocks.live(); }
+    std::size_t capacity() const noexcept { return blocks.capacity(); }
+    const MemoryStats& stats() const noexcept { return blocks.stats(); }
+    void resetStats() noexcept { blocks.resetStats(); }
+
+private:
+    BlockPool blocks;
+};
+
+/**
+ * @class PoolResource
+ * @brief std::pmr adapter: requests that fit a block come from a BlockPool, larger ones from upstream.
+ *
+ * Suits node-based containers (std::pmr::list, map, unordered_map), whose
+ * nodes all have one size.
+ *
+ * Example usage:
+ * @code
+ * core::memory::PoolResource nodes(sizeof(std::pair<const int, float>) + 32);
+ * std::pmr::map<int, float> lookup(&nodes);
+ * @endcode
+ */
+class PoolResource final : public std::pmr::memory_resource {
+public:
+    explicit PoolResource(std::size_t blockSize, std::size_t blocksPerChunk = 256,
+                          std::pmr::memory_resource* upstream = std::pmr::get_default_resource())
+        : pool(blockSize, alignof(std::max_align_t), blocksPerChunk, upstream), fallback(upstream) {}
+
+    BlockPool& blocks() noexcept { return pool; }
+
+private:
+    bool fits(std::size_t bytes, std::size_t align) const noexcept {
+        return bytes <= pool.blockSize() && align <= pool.blockAlignment();
+    }
+
+    void* do_allocate(std::size_t bytes, std::size_t align) override {
+        return fits(bytes, align) ? pool.allocate() : fallback->allocate(bytes, align);
+    }
+
+    void do_deallocate(void* p, std::size_t bytes, std::size_t align) override {
+        if (fits(bytes, align)) {
+            pool.deallocate(p);
+        } else {
+            fallback->deallocate(p, bytes, align);
+        }
+    }
+
+    bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override { return this == &other; }
+
+    BlockPool pool;
+    std::pmr::memory_resource* fallback;
+};
+
+} // namespace core::memory
@@ -0,0 +1,307 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+
+/**
+ * @file Snapshot.h
+ * @brief Binary checkpoints of SoA arrays that are used in place through a memory map.
+ *
+ * File layout (little or big endian as written; readers reject the other):
+ *
+ * | part          | contents                                                  |
+ * |---------------|-----------------------------------------------------------|
+ * | header        | SnapshotHeader, 64 bytes                                  |
+ * | array records | SnapshotArrayRecord per array                             |
+ * | chunk hashes  | one 64-bit hash per data chunk                            |
+ * | data          | from SnapshotHeader::dataOffset (page aligned), chunkSize |
+ * |               | multiple; every plane starts on a 64 byte boundary        |
+ *
+ * An array has one plane (scalars, mat4) or three (the x, y and z streams of
+ * a Vector3SoA), so opening a snapshot is a map plus a header check and every
+ * array can be read, or handed to SIMD kernels, straight from the mapping.
+ */
+
+namespace core {
+
+class JobSystem;
+
+/** @brief Format version written by SnapshotWriter; readers reject any other. */
+constexpr std::uint32_t SNAPSHOT_VERSION = 1;
+
+/** @brief Alignment of the data region in the file (and so in the mapping). */
+constexpr std::size_t SNAPSHOT_DATA_ALIGNMENT = 4096;
+
+/** @brief Alignment of every plane inside the data region. */
+constexpr std::size_t SNAPSHOT_PLANE_ALIGNMENT = 64;
+
+/** @brief Element type of a snapshot array. */
+enum class SnapshotType : std::uint32_t {
+    Bytes,
+    Float32,
+    Float64,
+    Int32,
+    UInt32,
+    UInt64,
+    Vector3, /**< Three float planes: x, y, z. */
+    Mat4,    /**< 16 floats per element, row-major like mat4. */
+};
+
+/** @brief Bytes per element of one plane of type. */
+constexpr std::size_t snapshotElementSize(SnapshotType type) noexcept {
+    switch (type) {
+    case SnapshotType::Bytes: return 1;
+    case SnapshotType::Float64:
+    case SnapshotType::UInt64: return 8;
+    case SnapshotType::Mat4: return 64;
+    default: return 4;
+    }
+}
+
+/** @brief Planes of an array of type. */
+constexpr std::uint32_t snapshotPlanes(SnapshotType type) noexcept {
+    return type == SnapshotType::Vector3 ? 3 : 1;
+}
+
+struct SnapshotHeader {
+    char magic[8];              /**< "AURSNAP" plus a NUL. */
+    std::uint32_t version;      /**< SNAPSHOT_VERSION. */
+    std::uint32_t byteOrder;    /**< 0x01020304 in the writer's byte order. */
+    std::uint32_t arrayCount;
+    std::uint32_t chunkSize;    /**< Bytes per hashed chunk of the data region. */
+    std::uint64_t chunkCount;
+    std::uint64_t dataOffset;   /**< File offset of the data region. */
+    std::uint64_t dataSize;     /**< chunkCount * chunkSize. */
+    std::uint64_t generation;   /**< 1 after a full save, +1 per incremental save. */
+    std::uint64_t layoutHash;   /**< Hash of the records and chunk size. */
+};
+static_assert(sizeof(SnapshotHeader) == 64);
+
+struct SnapshotArrayRecord {
+    char name[48];              /**< NUL terminated. */
+    SnapshotType type;
+    std::uint32_t planes;
+    std::uint64_t count;        /**< Elements per plane. */
+    std::uint64_t offset;       /**< Of the first plane, from the start of the data region. */
+    std::uint64_t planeStride;  /**< Bytes from one plane to the next. */
+};
+static_assert(sizeof(SnapshotArrayRecord) == 80);
+
+/** @brief What the last SnapshotWriter save did. */
+struct SnapshotSaveStats {
+    bool incremental = false;        /**< False if it was (or fell back to) a full save. */
+    std::size_t chunks = 0;
+    std::size_t chunksWritten = 0;
+    std::size_t bytesWritten = 0;    /**< Including header and tables; incremental chunks count twice (journal, snapshot). */
+};
+
+/**
+ * @class SnapshotWriter
+ * @brief Collects pointers to live arrays and saves them as a snapshot file.
+ *
+ * Arrays are registered once and read when a save runs, so the same writer
+ * checkpoints a running simulation again and again. save() writes a new file
+ * next to the target, syncs it and renames it over it, so a reader never
+ * sees a torn file. saveIncremental() rewrites only the chunks whose hash
+ * changed since the file was written, in place, so arrays stay contiguous
+ * for SnapshotView. To survive a crash it journals first: the changed chunks
+ * and the new tables go to path + ".journal", which is synced before the
+ * snapshot is touched, and removed once the snapshot is synced. A crash
+ * before the journal is complete leaves the old snapshot; one after it is
+ * replayed by the next commitIncremental(), save(), saveIncremental() or
+ * stageIncremental() of the path. Until then SnapshotView::open() refuses
+ * the file, which may hold part of the new chunks. A save that finds every
+ * chunk unchanged writes nothing.
+ *
+ * Example usage:
+ * @code
+ * core::SnapshotWriter writer;
+ * writer.addVector3("position", bodies.position);
+ * writer.add("inverseMass", SnapshotType::Float32, bodies.size(), bodies.inverseMass.data());
+ * writer.save("state.snap");
+ * // ... step ...
+ * writer.saveIncremental("state.snap"); // writes the chunks that moved
+ * @endcode
+ */
+class SnapshotWriter {
+public:
+    /** @brief Default bytes per chunk: large enough that a multi-GB save is a few thousand writes. */
+    static constexpr std::size_t DEFAULT_CHUNK_SIZE = 256 * 1024;
+
+    /**
+     * @param chunkSize Granularity of incremental saves; a multiple of SNAPSHOT_DATA_ALIGNMENT.
+     */
+    explicit SnapshotWriter(std::size_t chunkSize = DEFAULT_CHUNK_SIZE);
+
+    /**
+     * @brief Registers a single-plane array; data must hold count elements whenever a save runs.
+     *
+     * Names are unique and shorter than 48 characters.
+     */
+    void add(std::string_view name, SnapshotType type, std::size_t count, const void* data);
+
+    /**
+     * @brief Registers a three-plane Vector3 array from its x, y and z streams.
+     */
+    void addPlanes(std::string_view name, std::size_t count, const float* x, const float* y, const float* z);
+
+    /**
+     * @brief Registers a Vector3SoA (or anything with size() and x()/y()/z() float streams).
+     */
+    template <typename SoA>
+    void addVector3(std::string_view name, const SoA& v) {
+        addPlanes(name, v.size(), v.x(), v.y(), v.z());
+    }
+
+    /** @brief Forgets every array. */
+    void clear() noexcept { arrays.clear(); }
+
+    /**
+     * @brief Writes every array to path, replacing the file atomically.
+     *
+     * Commits an incremental save staged for path first.
+     *
+     * @return False if the file or the staged save cannot be written.
+     */
+    bool save(const std::string& path, JobSystem* jobs = nullptr);
+
+    /**
+     * @brief Rewrites the chunks of path that differ from the arrays; stageIncremental() then commitIncremental().
+     *
+     * Falls back to save() when path is missing or was written with another
+     * layout (arrays, counts or chunk size). Chunks are compared by 64-bit
+     * hash, so the arrays are read once and the file's data not at all.
+     * Hashing runs on jobs when given.
+     */
+    bool saveIncremental(const std::string& path, JobSystem* jobs = nullptr);
+
+    /**
+     * @brief Writes and syncs the journal of an incremental save; path itself is not modified.
+     *
+     * Commits a journal already staged for path first. Falls back to save()
+     * like saveIncremental().
+     */
+    bool stageIncremental(const std::string& path, JobSystem* jobs = nullptr);
+
+    /**
+     * @brief Applies the journal staged for path, syncs path and removes the journal.
+     *
+     * Also the recovery step after a crash between staging and committing.
+     * True if there is nothing to apply. A journal that is incomplete, or was
+     * staged against a different file, is removed without touching path.
+     * False (journal kept) if path cannot be written.
+     */
+    static bool commitIncremental(const std::string& path);
+
+    const SnapshotSaveStats& lastSave() const noexcept { return stats; }
+
+private:
+    struct Array {
+        SnapshotArrayRecord record;
+        const std::byte* planes[3];
+    };
+
+    struct Segment {
+        std::uint64_t offset; // in the data region
+        std::uint64_t size;
+        const std::byte* data;
+    };
+
+    struct Layout {
+        SnapshotHeader header;
+        std::vector<SnapshotArrayRecord> records;
+        std::vector<Segment> segments;
+    };
+
+    Layout layout() const;
+    std::vector<std::uint64_t> hashChunks(const Layout& l, JobSystem* jobs) const;
+    const std::byte* chunk(const Layout& l, std::size_t index, std::byte* scratch) const;
+
+    std::size_t chunkSize;
+    std::vector<Array> arrays;
+    SnapshotSaveStats stats;
+};
+
+/**
+ * @class SnapshotView
+ * @brief Read-only memory map of a snapshot; arrays are spans into the mapping.
+ *
+ * Opening checks the header and that every record lies inside the file, but
+ * reads no data, so it costs the same for a kilobyte and for gigabytes; pages
+ * are loaded as the arrays are touched. Spans stay valid until the view is
+ * closed or destroyed. Do not saveIncremental() into a file that a view you
+ * still read from has mapped: the rewrite is visible through the mapping.
+ * Opening never writes: it fails while a complete journal is staged for the
+ * file, until SnapshotWriter::commitIncremental() applies it.
+ *
+ * Example usage:
+ * @code
+ * core::SnapshotView view;
+ * std::string error;
+ * if (!view.open("state.snap", error)) return fail(error);
+ * std::span<const float> x = view.array<float>("position", 0);
+ * std::span<const mat4> world = view.array<mat4>("worldMatrix");
+ * @endcode
+ */
+class SnapshotView {
+public:
+    SnapshotView() noexcept = default;
+    ~SnapshotView();
+
+    SnapshotView(SnapshotView&& other) noexcept;
+    SnapshotView& operator=(SnapshotView&& other) noexcept;
+    SnapshotView(const SnapshotView&) = delete;
+    SnapshotView& operator=(const SnapshotView&) = delete;
+
+    /**
+     * @brief Maps path; false with error if it cannot be mapped or is not a valid snapshot.
+     */
+    bool open(const std::string& path, std::string& error);
+
+    /** @brief Unmaps the file; spans handed out are invalidated. */
+    void close() noexcept;
+
+    bool isOpen() const noexcept { return base != nullptr; }
+
+    const SnapshotHeader& header() const noexcept { return *reinterpret_cast<const SnapshotHeader*>(base); }
+
+    std::span<const SnapshotArrayRecord> records() const noexcept;
+
+    /** @brief Record of the named array, nullptr if there is none. */
+    const SnapshotArrayRecord* find(std::string_view name) const noexcept;
+
+    /** @brief Raw bytes of one plane of the named array; empty if absent. */
+    std::span<const std::byte> bytes(std::string_view name, std::uint32_t plane = 0) const noexcept;
+
+    /**
+     * @brief One plane of the named array as T, in place.
+     *
+     * Empty if the array is absent, the plane out of range or sizeof(T)
+     * differs from the element size.
+     */
+    template <typename T>
+    std::span<const T> array(std::string_view name, std::uint32_t plane = 0) const noexcept {
+        static_assert(std::is_trivially_copyable_v<T>);
+        const SnapshotArrayRecord* r = find(name);
+        if (r == nullptr || snapshotElementSize(r->type) != sizeof(T)) return {};
+        const std::span<const std::byte> b = bytes(name, plane);
+        return {reinterpret_cast<const T*>(b.data()), b.size() / sizeof(T)};
+    }
+
+    /**
+     * @brief Rehashes every chunk and compares with the stored hashes; reads the whole file.
+     */
+    bool verify() const noexcept;
+
+private:
+    const std::byte* base = nullptr;
+    std::size_t size = 0;
+    void* mapping = nullptr; // platform handle besides the pointer, if any
+};
+
+} // namespace core
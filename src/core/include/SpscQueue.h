@@ -0,0 +1,92 @@
+#pragma once
+
+#include <atomic>
+#include <bit>
+#include <cstddef>
+#include <memory>
+#include <type_traits>
+
+/**
+ * @file SpscQueue.h
+ * @brief Bounded lock-free queue between exactly one producer and one consumer thread.
+ */
+
+namespace core {
+
+/**
+ * @class SpscQueue
+ * @brief Fixed-capacity ring buffer; push and pop never block and never allocate.
+ *
+ * The producer owns tail and the consumer owns head; each only reads the
+ * other's index (acquire) to see how much room or data there is, so the
+ * only shared writes are the two indices, kept on separate cache lines.
+ * Both sides cache the last index they saw of the other, which keeps a
+ * steady stream of pushes and pops from bouncing a cache line per call.
+ *
+ * Example usage:
+ * @code
+ * core::SpscQueue<std::uint32_t> queue(64);
+ * // producer thread                 // consumer thread
+ * if (!queue.push(slot)) dropped++;  std::uint32_t slot;
+ *                                    while (queue.pop(slot)) consume(slot);
+ * @endcode
+ */
+template <typename T>
+class SpscQueue {
+    static_assert(std::is_trivially_copyable_v<T>, "elements are copied in and out of the ring");
+
+public:
+    /**
+     * @param capacity Elements the queue holds at once; rounded up to a power of two.
+     */
+    explicit SpscQueue(std::size_t capacity)
+        : mask(std::bit_ceil(capacity < 2 ? std::size_t{2} : capacity) - 1),
+          items(std::make_unique<T[]>(mask + 1)) {}
+
+    SpscQueue(const SpscQueue&) = delete;
+    SpscQueue& operator=(const SpscQueue&) = delete;
+
+    std::size_t capacity() const noexcept { return mask + 1; }
+
+    /** @brief Producer only; false if the queue is full. */
+    bool push(const T& value) noexcept {
+        const std::size_t t = tail.load(std::memory_order_relaxed);
+        if (t - headCache > mask) {
+            headCache = head.load(std::memory_order_acquire);
+            if (t - headCache > mask) return false;
+        }
+        items[t & mask] = value;
+        tail.store(t + 1, std::memory_order_release);
+        return true;
+    }
+
+    /** @brief Consumer only; false if the queue is empty. */
+    bool pop(T& value) noexcept {
+        const std::size_t h = head.load(std::memory_order_relaxed);
+        if (h == tailCache) {
+            tailCache = tail.load(std::memory_order_acquire);
+            if (h == tailCache) return false;
+        }
+        value = items[h & mask];
+        head.store(h + 1, std::memory_order_release);
+        return true;
+    }
+
+    /** @brief Elements queued; exact only when called from a side whose peer is idle. */
+    std::size_t size() const noexcept {
+        return tail.load(std::memory_order_acquire) - head.load(std::memory_order_acquire);
+    }
+
+private:
+    static constexpr std::size_t CACHE_LINE = 64;
+
+    const std::size_t mask;
+    const std::unique_ptr<T[]> items;
+
+    alignas(CACHE_LINE) std::atomic<std::size_t> tail{0}; // next slot to fill; written by the producer
+    std::size_t headCache = 0;                             // producer's last view of head
+    alignas(CACHE_LINE) std::atomic<std::size_t> head{0};  // next slot to read; written by the consumer
+    std::size_t tailCache = 0;                             // consumer's last view of tail
+};
+
+} // namespace core
@@ -0,0 +1,72 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <vector>
+
+#include "JobSystem.h"
+
+/**
+ * @file TaskGraph.h
+ * @brief Reusable graph of dependent tasks executed on a JobSystem.
+ */
+
+namespace core {
+
+/**
+ * @class TaskGraph
+ * @brief Directed acyclic graph of tasks; a task starts once all its predecessors finished.
+ *
+ * Build the graph once and run() it as often as needed (e.g. every frame);
+ * running allocates nothing. Independent branches run concurrently, and a
+ * task may use parallelFor internally for data parallelism.
+ *
+ * Example usage:
+ * @code
+ * core::TaskGraph graph;
+ * auto a = graph.add([&] { broadphase(); });
+ * auto b = graph.add([&] { updateParticles(); });
+ * auto c = graph.add([&] { narrowphase(); });
+ * graph.precede(a, c);              // b runs alongside a and c
+ * graph.run(jobs);
+ * @endcode
+ */
+class TaskGraph {
+public:
+    using TaskId = std::uint32_t;
+
+    /** @brief Adds a task and returns its id. */
+    TaskId add(std::function<void()> task);
+
+    /** @brief Makes after wait for before. */
+    void precede(TaskId before, TaskId after);
+
+    /**
+     * @brief Runs every task once, respecting dependencies; returns when all finished.
+     *
+     * The graph must be acyclic (checked by an assertion).
+     */
+    void run(JobSystem& jobs);
+
+    std::size_t size() const noexcept { return nodes.size(); }
+
+private:
+    struct Node : Job {
+        TaskGraph* graph = nullptr;
+        std::function<void()> task;
+        std::vector<TaskId> successors;
+        std::int32_t predecessors = 0;
+        std::atomic<std::int32_t> remaining{0};
+    };
+
+    static void executeNode(Job& job);
+    bool isAcyclic() const;
+
+    std::vector<std::unique_ptr<Node>> nodes; // stable addresses for submitted jobs
+    JobSystem* active = nullptr;
+    JobCounter counter;
+};
+
+} // namespace core
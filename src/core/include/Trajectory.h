@@ -0,0 +1,246 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <fstream>
+#include <initializer_list>
+#include <memory>
+#include <span>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+#include "SpscQueue.h"
+
+/**
+ * @file Trajectory.h
+ * @brief Per-step recording of float arrays, quantized and compressed on a background thread.
+ *
+ * Every value is quantized to a multiple of its channel's precision, the
+ * integers are delta-encoded against the previous frame and zigzagged, and
+ * each block of TRAJECTORY_BLOCK residuals is bit-packed at the width of its
+ * largest one. Bodies at rest cost one byte per block, moving ones a few
+ * bits per value. Frames are grouped into chunks that start from zero (a key
+ * frame), so a reader can seek to any chunk; an index of the chunks closes
+ * the file.
+ */
+
+namespace core {
+
+/** @brief Format version written by TrajectoryWriter; readers reject any other. */
+constexpr std::uint32_t TRAJECTORY_VERSION = 1;
+
+/** @brief Values bit-packed together at one width. */
+constexpr std::size_t TRAJECTORY_BLOCK = 64;
+
+/** @brief A recorded array: count elements of components float planes. */
+struct TrajectoryChannel {
+    std::string name;
+    std::size_t count = 0;
+    std::uint32_t components = 1; /**< 1 to 4 planes, e.g. 3 for positions, 4 for quaternions. */
+    float precision = 1e-4f;      /**< Quantization step; decoded values are within precision / 2. */
+};
+
+struct TrajectorySettings {
+    std::size_t queueFrames = 16;       /**< Frames that may wait for the writer thread before record() drops. */
+    std::uint32_t framesPerChunk = 64;  /**< Frames between key frames (the seek granularity). */
+};
+
+/** @brief Counters of a TrajectoryWriter; readable from any thread while recording. */
+struct TrajectoryStats {
+    std::uint64_t framesRecorded = 0; /**< Accepted by record(). */
+    std::uint64_t framesDropped = 0;  /**< Refused because the queue was full. */
+    std::uint64_t framesWritten = 0;  /**< Encoded by the writer thread. */
+    std::uint64_t rawBytes = 0;       /**< Float bytes of the written frames. */
+    std::uint64_t bytesWritten = 0;   /**< File bytes so far. */
+};
+
+/**
+ * @class TrajectoryWriter
+ * @brief Streams frames of registered float arrays to a compressed file from a background thread.
+ *
+ * record() copies the registered arrays into a free frame slot and hands it
+ * to the writer thread through a lock-free queue; quantizing, encoding and
+ * file output all happen on that thread, so the simulation never waits on
+ * the disk. If the writer falls queueFrames behind, record() drops the frame
+ * (counted in stats) instead of blocking. Frames carry the caller's step
+ * number, so gaps are visible to readers.
+ *
+ * Example usage:
+ * @code
+ * core::TrajectoryWriter trajectory;
+ * trajectory.addVector3("position", bodies.position, 1e-4f);
+ * trajectory.addChannel({"orientation", bodies.size(), 4, 1e-5f},
+ *                       {bodies.qx.data(), bodies.qy.data(), bodies.qz.data(), bodies.qw.data()});
+ * trajectory.open("run.traj");
+ * for (std::uint64_t step = 0; running; ++step) {
+ *     world.step();
+ *     trajectory.record(step);
+ * }
+ * trajectory.close();
+ * @endcode
+ */
+class TrajectoryWriter {
+public:
+    TrajectoryWriter() = default;
+    ~TrajectoryWriter();
+
+    TrajectoryWriter(const TrajectoryWriter&) = delete;
+    TrajectoryWriter& operator=(const TrajectoryWriter&) = delete;
+
+    /**
+     * @brief Registers channel.components planes of channel.count floats; call before open().
+     *
+     * The planes are read by every record() and must stay valid until close().
+     */
+    void addChannel(const TrajectoryChannel& channel, std::initializer_list<const float*> planes);
+
+    /**
+     * @brief Registers a Vector3SoA (or anything with size() and x()/y()/z() float streams).
+     */
+    template <typename SoA>
+    void addVector3(std::string_view name, const SoA& v, float precision) {
+        addChannel({std::string(name), v.size(), 3, precision}, {v.x(), v.y(), v.z()});
+    }
+
+    /**
+     * @brief Creates path, writes the channel table and starts the writer thread.
+     *
+     * @return False if the file cannot be created or a recording is already open.
+     */
+    bool open(const std::string& path, const TrajectorySettings& settings = {});
+
+    /**
+     * @brief Queues the current contents of every channel as the frame of step; never blocks.
+     *
+     * @return False if the frame was dropped because the writer thread is behind.
+     */
+    bool record(std::uint64_t step);
+
+    /**
+     * @brief Waits for queued frames, writes the chunk index and closes the file.
+     *
+     * @return False if any write failed.
+     */
+    bool close();
+
+    bool isOpen() const noexcept { return writer.joinable(); }
+
+    TrajectoryStats stats() const noexcept;
+
+private:
+    struct Plane {
+        const float* data;
+        std::size_t offset; // in a frame slot
+        std::size_t count;
+        float scale;        // 1 / precision
+    };
+
+    void run();
+    void encode(std::size_t slot);
+    void writeChunk();
+
+    std::vector<TrajectoryChannel> channels;
+    std::vector<Plane> planes;
+    std::size_t frameValues = 0; // floats per frame
+
+    TrajectorySettings settings;
+    std::ofstream file;
+    std::thread writer;
+
+    // Frame slots cycle free -> filled (record) -> free (writer thread)
+    std::vector<float> slots;
+    std::vector<std::uint64_t> slotSteps;
+    std::unique_ptr<SpscQueue<std::uint32_t>> freeSlots, filledSlots;
+    std::atomic<std::uint32_t> pending{0}; // bumped per push; the writer thread sleeps on it
+    std::atomic<bool> closing{false};
+
+    // Writer thread state
+    std::vector<std::int32_t> previous;
+    std::vector<std::uint32_t> residuals;
+    std::vector<std::byte> payload;
+    std::vector<std::uint64_t> chunkSteps;
+    std::vector<std::uint64_t> chunkIndex; // file offset, first frame and frames per chunk
+    bool failed = false;
+
+    std::atomic<std::uint64_t> recorded{0}, dropped{0}, written{0}, fileBytes{0};
+};
+
+/**
+ * @class TrajectoryReader
+ * @brief Decodes a trajectory file frame by frame, with seeking to any frame.
+ *
+ * Decoding a frame is an unpack, an add and a multiply per value, with no
+ * allocation once the first chunk is loaded. seek() jumps to the chunk
+ * holding the frame through the index and decodes only the frames of that
+ * chunk before it.
+ * Files whose writer never closed them (no index) are read up to the last
+ * complete chunk.
+ *
+ * Example usage:
+ * @code
+ * core::TrajectoryReader reader;
+ * std::string error;
+ * if (!reader.open("run.traj", error)) return fail(error);
+ * const int position = reader.findChannel("position");
+ * while (reader.next()) plot(reader.step(), reader.values(position, 1)); // heights
+ * @endcode
+ */
+class TrajectoryReader {
+public:
+    /**
+     * @brief Reads the channel table and chunk index; false with error if path is not a trajectory.
+     */
+    bool open(const std::string& path, std::string& error);
+
+    const std::vector<TrajectoryChannel>& channels() const noexcept { return channelList; }
+
+    /** @brief Index of the named channel, -1 if there is none. */
+    int findChannel(std::string_view name) const noexcept;
+
+    std::size_t frameCount() const noexcept { return frames; }
+
+    /** @brief Makes frame the one the next call to next() decodes; false if out of range. */
+    bool seek(std::size_t frame);
+
+    /** @brief Decodes the next frame; false at the end or on a read error. */
+    bool next();
+
+    /** @brief Step number of the current frame. */
+    std::uint64_t step() const noexcept { return currentStep; }
+
+    /** @brief Index of the current frame. */
+    std::size_t frame() const noexcept { return nextFrame - 1; }
+
+    /** @brief One component plane of a channel in the current frame. */
+    std::span<const float> values(int channel, std::uint32_t component = 0) const noexcept;
+
+private:
+    struct Chunk {
+        std::uint64_t offset;
+        std::uint64_t firstFrame;
+        std::uint32_t frames;
+    };
+
+    bool loadChunk(std::size_t index);
+    bool decodeFrame();
+
+    std::ifstream file;
+    std::vector<TrajectoryChannel> channelList;
+    std::vector<std::size_t> channelOffsets; // first value of each channel in a frame
+    std::vector<Chunk> chunks;
+    std::size_t frames = 0;
+
+    std::size_t loaded = SIZE_MAX;      // chunk in payload
+    std::size_t nextFrame = 0;
+    std::vector<std::uint64_t> steps;   // of the loaded chunk
+    std::vector<std::byte> payload;     // of the loaded chunk
+    std::size_t cursor = 0;             // into payload
+    std::vector<std::int32_t> quantized; // running values
+    std::vector<float> decoded;
+    std::uint64_t currentStep = 0;
+};
+
+} // namespace core
@@ -1,5 +1,212 @@
-#include <iostream>
+// Headless runner: loads a scene description, steps it for a number of frames
+// at its fixed dt and reports per-phase timings and throughput.
+//
+//   AURELION [scene-file] [--frames N] [--threads T] [--seed S] [--dt seconds]
+//            [--broadphase auto|sap|tree] [--trajectory file [--precision metres]]
+//
+// Without a scene file a built-in stack of spheres is used. --threads 1 runs
+// on the calling thread, 0 uses every hardware thread. The printed state hash
+// covers every body's position, orientation and velocities; runs with the
+// same scene, seed and thread count print the same hash, whichever
+// --broadphase finds the pairs (auto by default). --trajectory records
+// every body's position and orientation after each step (outside the timed
+// region) through a core::TrajectoryWriter.
 
-int main() {
-    std::cout << "Hello World!\n";
-}
\ No newline at end of file
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "include/JobSystem.h"
+#include "include/SceneFile.h"
+#include "include/Trajectory.h"
+#include "include/World.h"
+
+namespace {
+
+constexpr std::string_view DEFAULT_SCENE = R"(
+seed 1
+dt 0.0166667
+static box 40 1 40 at 0 -1 0
+grid sphere 0.5 mass 1 count 16 8 16 spacing 1.05 at -7.875 0.6 -7.875 jitter 0.02
+)";
+
+struct Options {
+    std::string scenePath;
+    int frames = 600;
+    unsigned threads = 1;
+    bool overrideSeed = false;
+    std::uint32_t seed = 0;
+    float fixedStep = 0.0f; // 0 keeps the scene's
+    physics::BroadphaseKind broadphase = physics::BroadphaseKind::Automatic;
+    std::string trajectoryPath;
+    float precision = 1e-4f;
+};
+
+constexpr float ORIENTATION_PRECISION = 1e-5f; // quaternion components
+
+bool parseOptions(int argc, char** argv, Options& options) {
+    for (int i = 1; i < argc; ++i) {
+        const std::string_view arg = argv[i];
+        const bool hasValue = i + 1 < argc;
+        if (arg == "--frames" && hasValue) {
+            options.frames = std::atoi(argv[++i]);
+        } else if (arg == "--threads" && hasValue) {
+            options.threads = static_cast<unsigned>(std::strtoul(argv[++i], nullptr, 10));
+        } else if (arg == "--seed" && hasValue) {
+            options.overrideSeed = true;
+            options.seed = static_cast<std::uint32_t>(std::strtoul(argv[++i], nullptr, 10));
+        } else if (arg == "--dt" && hasValue) {
+            options.fixedStep = std::strtof(argv[++i], nullptr);
+        } else if (arg == "--broadphase" && hasValue) {
+            const std::string_view kind = argv[++i];
+            if (kind == "sap") {
+                options.broadphase = physics::BroadphaseKind::SweepAndPrune;
+            } else if (kind == "tree") {
+                options.broadphase = physics::BroadphaseKind::DynamicAabbTree;
+            } else if (kind != "auto") {
+                return false;
+            }
+        } else if (arg == "--trajectory" && hasValue) {
+            options.trajectoryPath = argv[++i];
+        } else if (arg == "--precision" && hasValue) {
+            options.precision = std::strtof(argv[++i], nullptr);
+        } else if (!arg.starts_with("--") && options.scenePath.empty()) {
+            options.scenePath = arg;
+        } else {
+            return false;
+        }
+    }
+    return options.frames > 0 && options.fixedStep >= 0.0f && options.precision > 0.0f;
+}
+
+// FNV-1a over the raw bytes of the state streams.
+std::uint64_t hashState(const physics::RigidBodies& bodies) {
+    std::uint64_t hash = 14695981039346656037ull;
+    const auto mix = [&](const float* data) {
+        const auto* bytes = reinterpret_cast<const unsigned char*>(data);
+        for (std::size_t i = 0; i < bodies.size() * sizeof(float); ++i) {
+            hash = (hash ^ bytes[i]) * 1099511628211ull;
+        }
+    };
+    for (const math::Vector3SoA* v : {&bodies.position, &bodies.linearVelocity, &bodies.angularVelocity}) {
+        mix(v->x());
+        mix(v->y());
+        mix(v->z());
+    }
+    for (const math::AlignedArray<float>* q : {&bodies.qx, &bodies.qy, &bodies.qz, &bodies.qw}) mix(q->data());
+    return hash;
+}
+
+// Sorts samples in place.
+void printRow(const char* name, std::vector<double>& samples) {
+    std::sort(samples.begin(), samples.end());
+    const std::size_t n = samples.size();
+    const double p99 = samples[std::min(n - 1, (n * 99 + 99) / 100 - 1)]; // nearest rank
+    std::printf("  %-22s %10.3f %10.3f %10.3f\n", name, samples.front() * 1e3, samples[n / 2] * 1e3, p99 * 1e3);
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    Options options;
+    if (!parseOptions(argc, argv, options)) {
+        std::fprintf(stderr,
+                     "usage: %s [scene-file] [--frames N] [--threads T] [--seed S] [--dt seconds]\n"
+                     "       [--broadphase auto|sap|tree] [--trajectory file [--precision metres]]\n",
+                     argv[0]);
+        return 2;
+    }
+
+    scene::SceneDescription description;
+    std::string error;
+    const bool loaded = options.scenePath.empty() ? scene::parseScene(DEFAULT_SCENE, description, error)
+                                                  : scene::loadScene(options.scenePath, description, error);
+    if (!loaded) {
+        std::fprintf(stderr, "%s\n", error.c_str());
+        return 1;
+    }
+    if (options.overrideSeed) description.seed = options.seed;
+    if (options.fixedStep > 0.0f) description.fixedStep = options.fixedStep;
+
+    physics::WorldSettings settings = description.worldSettings();
+    settings.broadphase = options.broadphase;
+    physics::World world(settings);
+    scene::populate(description, world);
+
+    std::unique_ptr<core::JobSystem> jobs;
+    if (options.threads != 1) {
+        jobs = std::make_unique<core::JobSystem>(options.threads);
+        world.setJobSystem(jobs.get());
+    }
+
+    core::TrajectoryWriter trajectory;
+    if (!options.trajectoryPath.empty()) {
+        const physics::RigidBodies& bodies = world.bodies();
+        trajectory.addVector3("position", bodies.position, options.precision);
+        trajectory.addChannel({"orientation", bodies.size(), 4, ORIENTATION_PRECISION},
+                              {bodies.qx.data(), bodies.qy.data(), bodies.qz.data(), bodies.qw.data()});
+        if (!trajectory.open(options.trajectoryPath)) {
+            std::fprintf(stderr, "cannot create %s\n", options.trajectoryPath.c_str());
+            return 1;
+        }
+    }
+
+    const auto frames = static_cast<std::size_t>(options.frames);
+    std::vector<double> bounds(frames), broadphase(frames), narrowphase(frames), integrateVelocities(frames),
+        solve(frames), integratePositions(frames), step(frames);
+    using Clock = std::chrono::steady_clock;
+    for (std::size_t i = 0; i < frames; ++i) {
+        const Clock::time_point start = Clock::now();
+        world.step();
+        step[i] = std::chrono::duration<double>(Clock::now() - start).count();
+        const physics::StepProfile& profile = world.lastStepProfile();
+        bounds[i] = profile.bounds;
+        broadphase[i] = profile.broadphase;
+        narrowphase[i] = profile.narrowphase;
+        integrateVelocities[i] = profile.integrateVelocities;
+        solve[i] = profile.solve;
+        integratePositions[i] = profile.integratePositions;
+        trajectory.record(i);
+    }
+    if (trajectory.isOpen() && !trajectory.close()) {
+        std::fprintf(stderr, "writing %s failed\n", options.trajectoryPath.c_str());
+        return 1;
+    }
+
+    double seconds = 0.0;
+    for (const double s : step) seconds += s;
+    const std::size_t bodyCount = world.bodies().size();
+
+    std::printf("scene    %s\n", options.scenePath.empty() ? "(built-in)" : options.scenePath.c_str());
+    std::printf("bodies   %zu\n", bodyCount);
+    std::printf("frames   %zu x %g s\n", frames, static_cast<double>(description.fixedStep));
+    std::printf("threads  %u\n", jobs ? jobs->threadCount() : 1u);
+    std::printf("pairs    %s\n", world.activeBroadphase() == physics::BroadphaseKind::SweepAndPrune ? "sweep and prune"
+                                                                                                : "AABB tree");
+    std::printf("seed     %u\n\n", description.seed);
+    std::printf("  %-22s %10s %10s %10s\n", "phase (ms)", "min", "median", "p99");
+    printRow("bounds", bounds);
+    printRow("broadphase", broadphase);
+    printRow("narrowphase", narrowphase);
+    printRow("integrate velocities", integrateVelocities);
+    printRow("solve", solve);
+    printRow("integrate positions", integratePositions);
+    printRow("step", step);
+    std::printf("\nthroughput  %.0f body-steps/s (%.3f s stepping)\n",
+                static_cast<double>(bodyCount * frames) / seconds, seconds);
+    std::printf("state hash  %016llx\n", static_cast<unsigned long long>(hashState(world.bodies())));
+    if (!options.trajectoryPath.empty()) {
+        const core::TrajectoryStats stats = trajectory.stats();
+        std::printf("trajectory  %s: %llu frames (%llu dropped), %.1f MB for %.1f MB of floats\n",
+                    options.trajectoryPath.c_str(), static_cast<unsigned long long>(stats.framesWritten),
+                    static_cast<unsigned long long>(stats.framesDropped), static_cast<double>(stats.bytesWritten) / 1e6,
+                    static_cast<double>(stats.rawBytes) / 1e6);
+    }
+    return 0;
+}
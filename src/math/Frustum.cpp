@@ -0,0 +1,286 @@
+#include "include/Frustum.h"
+
+#include <algorithm>
+#include <bit>
+#include <cassert>
+#include <cmath>
+
+#include "include/SimdPack.h"
+
+namespace math {
+
+namespace {
+
+// Objects tested per step: one AVX register
+constexpr std::size_t GROUP = 8;
+
+// For each 8-bit visibility mask, the set lanes in ascending order (the rest padded with zeros)
+struct CompactTable {
+    alignas(16) std::uint32_t lanes[256][GROUP];
+};
+
+constexpr CompactTable COMPACT = [] {
+    CompactTable table{};
+    for (unsigned mask = 0; mask < 256; ++mask) {
+        unsigned n = 0;
+        for (unsigned lane = 0; lane < GROUP; ++lane) {
+            if ((mask >> lane) & 1) table.lanes[mask][n++] = lane;
+        }
+    }
+    return table;
+}();
+
+// Writes all eight table slots unconditionally and advances by the visible count only;
+// stays inside the caller's buffer because n never exceeds the objects tested before this group
+inline std::size_t append(std::uint32_t* visible, std::size_t n, std::size_t base, unsigned mask) noexcept {
+    const std::uint32_t* lanes = COMPACT.lanes[mask];
+#if AURELION_SIMD_SSE
+    const __m128i offset = _mm_set1_epi32(static_cast<int>(base));
+    const auto* from = reinterpret_cast<const __m128i*>(lanes);
+    auto* to = reinterpret_cast<__m128i*>(visible + n);
+    _mm_storeu_si128(to, _mm_add_epi32(_mm_load_si128(from), offset));
+    _mm_storeu_si128(to + 1, _mm_add_epi32(_mm_load_si128(from + 1), offset));
+#else
+    for (std::size_t k = 0; k < GROUP; ++k) visible[n + k] = static_cast<std::uint32_t>(base) + lanes[k];
+#endif
+    return n + static_cast<std::size_t>(std::popcount(mask));
+}
+
+// Smallest over the planes of (signed distance + radius); negative means outside. Every kernel
+// below evaluates exactly this expression in this order.
+float sphereSlack(const Frustum& f, const Vector3& c, float r) noexcept {
+    float slack = f.planes[0].distance(c) + r;
+    for (std::size_t p = 1; p < 6; ++p) slack = std::min(slack, f.planes[p].distance(c) + r);
+    return slack;
+}
+
+float boxRadius(const Plane& plane, const Vector3& e) noexcept {
+    return std::abs(plane.normal.x) * e.x + std::abs(plane.normal.y) * e.y + std::abs(plane.normal.z) * e.z;
+}
+
+float boxSlack(const Frustum& f, const Vector3& c, const Vector3& e) noexcept {
+    float slack = f.planes[0].distance(c) + boxRadius(f.planes[0], e);
+    for (std::size_t p = 1; p < 6; ++p) slack = std::min(slack, f.planes[p].distance(c) + boxRadius(f.planes[p], e));
+    return slack;
+}
+
+// Plane coefficients broadcast once per call, with absolute normals for the box test
+template <typename P>
+struct PlaneRegs {
+    typename P::Reg nx[6], ny[6], nz[6], d[6], ax[6], ay[6], az[6];
+
+    explicit PlaneRegs(const Frustum& f) noexcept {
+        for (std::size_t p = 0; p < 6; ++p) {
+            const Plane& plane = f.planes[p];
+            nx[p] = P::set1(plane.normal.x);
+            ny[p] = P::set1(plane.normal.y);
+            nz[p] = P::set1(plane.normal.z);
+            d[p] = P::set1(plane.d);
+            ax[p] = P::set1(std::abs(plane.normal.x));
+            ay[p] = P::set1(std::abs(plane.normal.y));
+            az[p] = P::set1(std::abs(plane.normal.z));
+        }
+    }
+
+    typename P::Reg distance(std::size_t p, typename P::Reg x, typename P::Reg y, typename P::Reg z) const noexcept {
+        return P::add(P::add(P::add(P::mul(nx[p], x), P::mul(ny[p], y)), P::mul(nz[p], z)), d[p]);
+    }
+
+    typename P::Reg radius(std::size_t p, typename P::Reg x, typename P::Reg y, typename P::Reg z) const noexcept {
+        return P::add(P::add(P::mul(ax[p], x), P::mul(ay[p], y)), P::mul(az[p], z));
+    }
+};
+
+template <typename P>
+std::size_t cullSpheresPacked(const Frustum& f, const BoundingSpheres& s, std::size_t first, std::size_t last,
+                              std::uint32_t* visible) noexcept {
+    const PlaneRegs<P> planes(f);
+    const auto zero = P::set1(0.0f);
+    std::size_t n = 0;
+    for (std::size_t i = first; i + GROUP <= last; i += GROUP) {
+        unsigned outside = 0;
+        for (std::size_t k = 0; k < GROUP; k += P::WIDTH) {
+            const auto x = P::load(s.center.x() + i + k);
+            const auto y = P::load(s.center.y() + i + k);
+            const auto z = P::load(s.center.z() + i + k);
+            const auto r = P::load(s.radius.data() + i + k);
+            auto slack = P::add(planes.distance(0, x, y, z), r);
+            for (std::size_t p = 1; p < 6; ++p) slack = P::min(slack, P::add(planes.distance(p, x, y, z), r));
+            outside |= static_cast<unsigned>(P::moveMask(P::lessThan(slack, zero))) << k;
+        }
+        n = append(visible, n, i, ~outside & 0xFF);
+    }
+    return n;
+}
+
+template <typename P>
+std::size_t cullBoxesPacked(const Frustum& f, const BoundingBoxes& b, std::size_t first, std::size_t last,
+                            std::uint32_t* visible) noexcept {
+    const PlaneRegs<P> planes(f);
+    const auto zero = P::set1(0.0f);
+    std::size_t n = 0;
+    for (std::size_t i = first; i + GROUP <= last; i += GROUP) {
+        unsigned outside = 0;
+        for (std::size_t k = 0; k < GROUP; k += P::WIDTH) {
+            const auto x = P::load(b.center.x() + i + k);
+            const auto y = P::load(b.center.y() + i + k);
+            const auto z = P::load(b.center.z() + i + k);
+            const auto ex = P::load(b.extent.x() + i + k);
+            const auto ey = P::load(b.extent.y() + i + k);
+            const auto ez = P::load(b.extent.z() + i + k);
+            auto slack = P::add(planes.distance(0, x, y, z), planes.radius(0, ex, ey, ez));
+            for (std::size_t p = 1; p < 6; ++p) {
+                slack = P::min(slack, P::add(planes.distance(p, x, y, z), planes.radius(p, ex, ey, ez)));
+            }
+            outside |= static_cast<unsigned>(P::moveMask(P::lessThan(slack, zero))) << k;
+        }
+        n = append(visible, n, i, ~outside & 0xFF);
+    }
+    return n;
+}
+
+#if AURELION_SIMD_SSE
+
+// --- AVX kernels: the same expressions on one 8-lane register per group ---
+
+struct PlanesAvx {
+    __m256 nx[6], ny[6], nz[6], d[6], ax[6], ay[6], az[6];
+};
+
+AURELION_TARGET_AVX PlanesAvx broadcastAvx(const Frustum& f) noexcept {
+    PlanesAvx r;
+    for (std::size_t p = 0; p < 6; ++p) {
+        const Plane& plane = f.planes[p];
+        r.nx[p] = _mm256_set1_ps(plane.normal.x);
+        r.ny[p] = _mm256_set1_ps(plane.normal.y);
+        r.nz[p] = _mm256_set1_ps(plane.normal.z);
+        r.d[p] = _mm256_set1_ps(plane.d);
+        r.ax[p] = _mm256_set1_ps(std::abs(plane.normal.x));
+        r.ay[p] = _mm256_set1_ps(std::abs(plane.normal.y));
+        r.az[p] = _mm256_set1_ps(std::abs(plane.normal.z));
+    }
+    return r;
+}
+
+AURELION_TARGET_AVX std::size_t cullSpheresAvx(const Frustum& f, const BoundingSpheres& s, std::size_t first,
+                                               std::size_t last, std::uint32_t* visible) noexcept {
+    const PlanesAvx planes = broadcastAvx(f);
+    std::size_t n = 0;
+    for (std::size_t i = first; i + GROUP <= last; i += GROUP) {
+        const __m256 x = _mm256_loadu_ps(s.center.x() + i);
+        const __m256 y = _mm256_loadu_ps(s.center.y() + i);
+        const __m256 z = _mm256_loadu_ps(s.center.z() + i);
+        const __m256 r = _mm256_loadu_ps(s.radius.data() + i);
+        __m256 slack{};
+        for (std::size_t p = 0; p < 6; ++p) {
+            __m256 dist = _mm256_add_ps(_mm256_mul_ps(planes.nx[p], x), _mm256_mul_ps(planes.ny[p], y));
+            dist = _mm256_add_ps(_mm256_add_ps(dist, _mm256_mul_ps(planes.nz[p], z)), planes.d[p]);
+            const __m256 planeSlack = _mm256_add_ps(dist, r);
+            slack = p == 0 ? planeSlack : _mm256_min_ps(slack, planeSlack);
+        }
+        const auto outside = static_cast<unsigned>(_mm256_movemask_ps(_mm256_cmp_ps(slack, _mm256_setzero_ps(), _CMP_LT_OQ)));
+        n = append(visible, n, i, ~outside & 0xFF);
+    }
+    return n;
+}
+
+AURELION_TARGET_AVX std::size_t cullBoxesAvx(const Frustum& f, const BoundingBoxes& b, std::size_t first,
+                                             std::size_t last, std::uint32_t* visible) noexcept {
+    const PlanesAvx planes = broadcastAvx(f);
+    std::size_t n = 0;
+    for (std::size_t i = first; i + GROUP <= last; i += GROUP) {
+        const __m256 x = _mm256_loadu_ps(b.center.x() + i);
+        const __m256 y = _mm256_loadu_ps(b.center.y() + i);
+        const __m256 z = _mm256_loadu_ps(b.center.z() + i);
+        const __m256 ex = _mm256_loadu_ps(b.extent.x() + i);
+        const __m256 ey = _mm256_loadu_ps(b.extent.y() + i);
+        const __m256 ez = _mm256_loadu_ps(b.extent.z() + i);
+        __m256 slack{};
+        for (std::size_t p = 0; p < 6; ++p) {
+            __m256 dist = _mm256_add_ps(_mm256_mul_ps(planes.nx[p], x), _mm256_mul_ps(planes.ny[p], y));
+            dist = _mm256_add_ps(_mm256_add_ps(dist, _mm256_mul_ps(planes.nz[p], z)), planes.d[p]);
+            __m256 radius = _mm256_add_ps(_mm256_mul_ps(planes.ax[p], ex), _mm256_mul_ps(planes.ay[p], ey));
+            radius = _mm256_add_ps(radius, _mm256_mul_ps(planes.az[p], ez));
+            const __m256 planeSlack = _mm256_add_ps(dist, radius);
+            slack = p == 0 ? planeSlack : _mm256_min_ps(slack, planeSlack);
+        }
+        const auto outside = static_cast<unsigned>(_mm256_movemask_ps(_mm256_cmp_ps(slack, _mm256_setzero_ps(), _CMP_LT_OQ)));
+        n = append(visible, n, i, ~outside & 0xFF);
+    }
+    return n;
+}
+
+#endif // AURELION_SIMD_SSE
+
+} // namespace
+
+bool Frustum::intersectsSphere(const Vector3& center, float radius) const noexcept {
+    return !(sphereSlack(*this, center, radius) < 0.0f);
+}
+
+bool Frustum::intersectsBox(const Vector3& center, const Vector3& extent) const noexcept {
+    return !(boxSlack(*this, center, extent) < 0.0f);
+}
+
+Frustum extractFrustum(const mat4& viewProjection, ClipDepth depth) noexcept {
+    const auto& m = viewProjection.m;
+    // Clip-space inequality row3 . p + sign * rowK . p >= 0, as a plane in the source space
+    const auto combine = [&](int row, float sign) {
+        Plane plane;
+        plane.normal = {m[3][0] + sign * m[row][0], m[3][1] + sign * m[row][1], m[3][2] + sign * m[row][2]};
+        plane.d = m[3][3] + sign * m[row][3];
+        return plane;
+    };
+    Frustum f;
+    f.planes = {combine(0, 1.0f), combine(0, -1.0f), combine(1, 1.0f), combine(1, -1.0f), combine(2, 1.0f),
+                combine(2, -1.0f)};
+    if (depth == ClipDepth::ZeroToOne) {
+        // z >= 0 alone, without the w term
+        f.planes[4] = {{m[2][0], m[2][1], m[2][2]}, m[2][3]};
+    }
+    for (Plane& plane : f.planes) {
+        const float length = plane.normal.length();
+        // A plane at infinity has no direction: leave it, its positive d keeps everything inside
+        if (length > 0.0f) {
+            plane.normal /= length;
+            plane.d /= length;
+        }
+    }
+    return f;
+}
+
+std::size_t cullSpheres(const Frustum& frustum, const BoundingSpheres& spheres, std::size_t first, std::size_t last,
+                        std::uint32_t* visible) noexcept {
+    assert(first <= last && last <= spheres.size());
+    std::size_t n;
+    switch (simd::activeBackend()) {
+#if AURELION_SIMD_SSE
+        case simd::Backend::Avx: n = cullSpheresAvx(frustum, spheres, first, last, visible); break;
+        case simd::Backend::Sse: n = cullSpheresPacked<simd::PackSse>(frustum, spheres, first, last, visible); break;
+#endif
+        default: n = cullSpheresPacked<simd::PackScalar>(frustum, spheres, first, last, visible); break;
+    }
+    for (std::size_t i = last - (last - first) % GROUP; i < last; ++i) {
+        if (frustum.intersectsSphere(spheres.center.get(i), spheres.radius[i])) visible[n++] = static_cast<std::uint32_t>(i);
+    }
+    return n;
+}
+
+std::size_t cullBoxes(const Frustum& frustum, const BoundingBoxes& boxes, std::size_t first, std::size_t last,
+                      std::uint32_t* visible) noexcept {
+    assert(first <= last && last <= boxes.size());
+    std::size_t n;
+    switch (simd::activeBackend()) {
+#if AURELION_SIMD_SSE
+        case simd::Backend::Avx: n = cullBoxesAvx(frustum, boxes, first, last, visible); break;
+        case simd::Backend::Sse: n = cullBoxesPacked<simd::PackSse>(frustum, boxes, first, last, visible); break;
+#endif
+        default: n = cullBoxesPacked<simd::PackScalar>(frustum, boxes, first, last, visible); break;
+    }
+    for (std::size_t i = last - (last - first) % GROUP; i < last; ++i) {
+        if (frustum.intersectsBox(boxes.center.get(i), boxes.extent.get(i))) visible[n++] = static_cast<std::uint32_t>(i);
+    }
+    return n;
+}
+
+} // namespace math
@@ -1,42 +1,18 @@
 #include "include/Mat4.h"
-
-// Default constructor initializes to identity matrix
-mat4::mat4()
-{
-    for (int i = 0; i < 4; ++i)
-    {
-        for (int j = 0; j < 4; ++j)
-        {
-            m[i][j] = (i == j) ? 1.0f : 0.0f;
-        }
-    }
-}
-
-// Parameterized constructor initializes to a diagonal matrix with given value
-mat4::mat4(float d)
-{
-    for (int i = 0; i < 4; ++i)
-    {
-        for (int j = 0; j < 4; ++j)
-        {
-            m[i][j] = (i == j) ? d : 0.0f;
-        }
-    }
-}
+#include "include/Simd.h"
 
 // Matrix multiplication
 mat4 mat4::operator*(const mat4 &other) const
 {
     mat4 result(0.0f);
-    for (int i = 0; i < 4; ++i)
-    {
-        for (int j = 0; j < 4; ++j)
-        {
-            for (int k = 0; k < 4; ++k)
-            {
-                result.m[i][j] += m[i][k] * other.m[k][j];
-            }
-        }
-    }
+    math::simd::mat4Mul(&m[0][0], &other.m[0][0], &result.m[0][0]);
     return result;
-}
\ No newline at end of file
+}
+
+// Matrix-vector multiplication
+math::Vector4 mat4::operator*(const math::Vector4 &v) const
+{
+    math::Vector4 result;
+    math::simd::mat4MulVec4(&m[0][0], &v.x, &result.x);
+    return result;
+}
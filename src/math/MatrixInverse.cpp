@@ -0,0 +1,196 @@
+#include "include/MatrixInverse.h"
+
+#include <cassert>
+
+#include "include/Simd.h"
+
+namespace math {
+
+namespace {
+
+// The general inverse is written once against a 4-lane "quad" type and
+// instantiated for SSE and for plain floats. Both quads perform the same
+// per-lane operations, so the two backends agree bit for bit.
+//
+// shuffle<X, Y, Z, W>(a, b) yields (a[X], a[Y], b[Z], b[W]) and
+// swizzle<X, Y, Z, W>(a) yields (a[X], a[Y], a[Z], a[W]).
+
+struct QuadScalar {
+    struct Reg { float v[4]; };
+
+    static Reg load(const float* p) noexcept { return {{p[0], p[1], p[2], p[3]}}; }
+    static void store(float* p, Reg a) noexcept { for (int i = 0; i < 4; ++i) p[i] = a.v[i]; }
+    static Reg set(float x, float y, float z, float w) noexcept { return {{x, y, z, w}}; }
+
+    static Reg add(Reg a, Reg b) noexcept { return {{a.v[0] + b.v[0], a.v[1] + b.v[1], a.v[2] + b.v[2], a.v[3] + b.v[3]}}; }
+    static Reg sub(Reg a, Reg b) noexcept { return {{a.v[0] - b.v[0], a.v[1] - b.v[1], a.v[2] - b.v[2], a.v[3] - b.v[3]}}; }
+    static Reg mul(Reg a, Reg b) noexcept { return {{a.v[0] * b.v[0], a.v[1] * b.v[1], a.v[2] * b.v[2], a.v[3] * b.v[3]}}; }
+    static Reg div(Reg a, Reg b) noexcept { return {{a.v[0] / b.v[0], a.v[1] / b.v[1], a.v[2] / b.v[2], a.v[3] / b.v[3]}}; }
+
+    template <int X, int Y, int Z, int W>
+    static Reg shuffle(Reg a, Reg b) noexcept { return {{a.v[X], a.v[Y], b.v[Z], b.v[W]}}; }
+
+    template <int X, int Y, int Z, int W>
+    static Reg swizzle(Reg a) noexcept { return {{a.v[X], a.v[Y], a.v[Z], a.v[W]}}; }
+
+    static float first(Reg a) noexcept { return a.v[0]; }
+};
+
+#if AURELION_SIMD_SSE
+
+struct QuadSse {
+    using Reg = __m128;
+
+    static Reg load(const float* p) noexcept { return _mm_loadu_ps(p); }
+    static void store(float* p, Reg a) noexcept { _mm_storeu_ps(p, a); }
+    static Reg set(float x, float y, float z, float w) noexcept { return _mm_setr_ps(x, y, z, w); }
+
+    static Reg add(Reg a, Reg b) noexcept { return _mm_add_ps(a, b); }
+    static Reg sub(Reg a, Reg b) noexcept { return _mm_sub_ps(a, b); }
+    static Reg mul(Reg a, Reg b) noexcept { return _mm_mul_ps(a, b); }
+    static Reg div(Reg a, Reg b) noexcept { return _mm_div_ps(a, b); }
+
+    template <int X, int Y, int Z, int W>
+    static Reg shuffle(Reg a, Reg b) noexcept { return _mm_shuffle_ps(a, b, _MM_SHUFFLE(W, Z, Y, X)); }
+
+    template <int X, int Y, int Z, int W>
+    static Reg swizzle(Reg a) noexcept { return _mm_shuffle_ps(a, a, _MM_SHUFFLE(W, Z, Y, X)); }
+
+    static float first(Reg a) noexcept { return _mm_cvtss_f32(a); }
+};
+
+#endif // AURELION_SIMD_SSE
+
+// 2x2 blocks are stored row-major in one quad: (m00, m01, m10, m11)
+
+// A * B
+template <typename Q>
+typename Q::Reg mat2Mul(typename Q::Reg a, typename Q::Reg b) noexcept {
+    return Q::add(Q::mul(a, Q::template swizzle<0, 3, 0, 3>(b)),
+                  Q::mul(Q::template swizzle<1, 0, 3, 2>(a), Q::template swizzle<2, 1, 2, 1>(b)));
+}
+
+// adj(A) * B
+template <typename Q>
+typename Q::Reg mat2AdjMul(typename Q::Reg a, typename Q::Reg b) noexcept {
+    return Q::sub(Q::mul(Q::template swizzle<3, 3, 0, 0>(a), b),
+                  Q::mul(Q::template swizzle<1, 1, 2, 2>(a), Q::template swizzle<2, 3, 0, 1>(b)));
+}
+
+// A * adj(B)
+template <typename Q>
+typename Q::Reg mat2MulAdj(typename Q::Reg a, typename Q::Reg b) noexcept {
+    return Q::sub(Q::mul(a, Q::template swizzle<3, 0, 3, 0>(b)),
+                  Q::mul(Q::template swizzle<1, 0, 3, 2>(a), Q::template swizzle<2, 1, 2, 1>(b)));
+}
+
+// Sum of all lanes as (l0 + l1) + (l2 + l3), broadcast to every lane
+template <typename Q>
+typename Q::Reg horizontalSum(typename Q::Reg a) noexcept {
+    const auto pairs = Q::add(a, Q::template swizzle<1, 0, 3, 2>(a));
+    return Q::add(pairs, Q::template swizzle<2, 3, 0, 1>(pairs));
+}
+
+// Block inverse of M = [A B; C D] with 2x2 blocks. Writes inverse and/or
+// determinant (either pointer may be null).
+template <typename Q>
+void invert(const mat4& m, mat4* out, float* outDet) noexcept {
+    using R = typename Q::Reg;
+    const R r0 = Q::load(m.m[0]), r1 = Q::load(m.m[1]), r2 = Q::load(m.m[2]), r3 = Q::load(m.m[3]);
+
+    const R a = Q::template shuffle<0, 1, 0, 1>(r0, r1);
+    const R b = Q::template shuffle<2, 3, 2, 3>(r0, r1);
+    const R c = Q::template shuffle<0, 1, 0, 1>(r2, r3);
+    const R d = Q::template shuffle<2, 3, 2, 3>(r2, r3);
+
+    // (|A|, |B|, |C|, |D|)
+    const R detSub = Q::sub(
+        Q::mul(Q::template shuffle<0, 2, 0, 2>(r0, r2), Q::template shuffle<1, 3, 1, 3>(r1, r3)),
+        Q::mul(Q::template shuffle<1, 3, 1, 3>(r0, r2), Q::template shuffle<0, 2, 0, 2>(r1, r3)));
+    const R detA = Q::template swizzle<0, 0, 0, 0>(detSub);
+    const R detB = Q::template swizzle<1, 1, 1, 1>(detSub);
+    const R detC = Q::template swizzle<2, 2, 2, 2>(detSub);
+    const R detD = Q::template swizzle<3, 3, 3, 3>(detSub);
+
+    const R dAdjC = mat2AdjMul<Q>(d, c);
+    const R aAdjB = mat2AdjMul<Q>(a, b);
+
+    // |M| = |A||D| + |B||C| - tr((A#B)(D#C))
+    R detM = Q::add(Q::mul(detA, detD), Q::mul(detB, detC));
+    detM = Q::sub(detM, horizontalSum<Q>(Q::mul(aAdjB, Q::template swizzle<0, 2, 1, 3>(dAdjC))));
+    if (outDet) *outDet = Q::first(detM);
+    if (!out) return;
+
+    // Adjugates of the blocks of M^-1 * |M|
+    R x = Q::sub(Q::mul(detD, a), mat2Mul<Q>(b, dAdjC));
+    R w = Q::sub(Q::mul(detA, d), mat2Mul<Q>(c, aAdjB));
+    R y = Q::sub(Q::mul(detB, c), mat2MulAdj<Q>(d, aAdjB));
+    R z = Q::sub(Q::mul(detC, b), mat2MulAdj<Q>(a, dAdjC));
+
+    const R invDetSigned = Q::div(Q::set(1.0f, -1.0f, -1.0f, 1.0f), detM);
+    x = Q::mul(x, invDetSigned);
+    y = Q::mul(y, invDetSigned);
+    z = Q::mul(z, invDetSigned);
+    w = Q::mul(w, invDetSigned);
+
+    // Undo the adjugate and interleave the blocks back into rows
+    Q::store(out->m[0], Q::template shuffle<3, 1, 3, 1>(x, y));
+    Q::store(out->m[1], Q::template shuffle<2, 0, 2, 0>(x, y));
+    Q::store(out->m[2], Q::template shuffle<3, 1, 3, 1>(z, w));
+    Q::store(out->m[3], Q::template shuffle<2, 0, 2, 0>(z, w));
+}
+
+void invertDispatched(const mat4& m, mat4* out, float* outDet) noexcept {
+#if AURELION_SIMD_SSE
+    if (simd::activeBackend() != simd::Backend::Scalar) {
+        invert<QuadSse>(m, out, outDet);
+        return;
+    }
+#endif
+    invert<QuadScalar>(m, out, outDet);
+}
+
+} // namespace
+
+float determinant(const mat4& m) noexcept {
+    float det = 0.0f;
+    invertDispatched(m, nullptr, &det);
+    return det;
+}
+
+mat4 inverse(const mat4& m) noexcept {
+    mat4 r;
+    invertDispatched(m, &r, nullptr);
+    return r;
+}
+
+mat4 inverseTranspose(const mat4& m) noexcept {
+    return transpose(inverse(m));
+}
+
+mat4 inverseRigid(const mat4& m) noexcept {
+    mat4 r;
+    for (int i = 0; i < 3; ++i) {
+        for (int j = 0; j < 3; ++j) r.m[i][j] = m.m[j][i];
+        r.m[i][3] = -(m.m[0][i] * m.m[0][3] + m.m[1][i] * m.m[1][3] + m.m[2][i] * m.m[2][3]);
+    }
+    return r;
+}
+
+void inverse(std::span<const mat4> in, std::span<mat4> out) noexcept {
+    assert(out.size() >= in.size());
+#if AURELION_SIMD_SSE
+    if (simd::activeBackend() != simd::Backend::Scalar) {
+        for (std::size_t i = 0; i < in.size(); ++i) invert<QuadSse>(in[i], &out[i], nullptr);
+        return;
+    }
+#endif
+    for (std::size_t i = 0; i < in.size(); ++i) invert<QuadScalar>(in[i], &out[i], nullptr);
+}
+
+void inverseRigid(std::span<const mat4> in, std::span<mat4> out) noexcept {
+    assert(out.size() >= in.size());
+    for (std::size_t i = 0; i < in.size(); ++i) out[i] = inverseRigid(in[i]);
+}
+
+} // namespace math
@@ -0,0 +1,90 @@
+#include "include/MatrixTransform.h"
+
+#include <cassert>
+#include <cmath>
+
+namespace math {
+
+namespace {
+
+// Shared x/y scale and perspective row; callers fill in the depth terms.
+mat4 perspectiveBase(float fovRadians, float aspect) noexcept {
+    assert(aspect > 0.0f);
+    const float f = 1.0f / std::tan(fovRadians * 0.5f);
+    mat4 r(0.0f);
+    r.m[0][0] = f / aspect;
+    r.m[1][1] = f;
+    r.m[3][2] = -1.0f;
+    return r;
+}
+
+} // namespace
+
+mat4 perspective(float fovRadians, float aspect, float zNear, float zFar) noexcept {
+    assert(zNear > 0.0f && zFar > zNear);
+    mat4 r = perspectiveBase(fovRadians, aspect);
+    r.m[2][2] = (zFar + zNear) / (zNear - zFar);
+    r.m[2][3] = 2.0f * zFar * zNear / (zNear - zFar);
+    return r;
+}
+
+mat4 perspectiveInfinite(float fovRadians, float aspect, float zNear) noexcept {
+    assert(zNear > 0.0f);
+    mat4 r = perspectiveBase(fovRadians, aspect);
+    r.m[2][2] = -1.0f;
+    r.m[2][3] = -2.0f * zNear;
+    return r;
+}
+
+mat4 perspectiveReversedZ(float fovRadians, float aspect, float zNear, float zFar) noexcept {
+    assert(zNear > 0.0f && zFar > zNear);
+    mat4 r = perspectiveBase(fovRadians, aspect);
+    r.m[2][2] = zNear / (zFar - zNear);
+    r.m[2][3] = zFar * zNear / (zFar - zNear);
+    return r;
+}
+
+mat4 perspectiveInfiniteReversedZ(float fovRadians, float aspect, float zNear) noexcept {
+    assert(zNear > 0.0f);
+    mat4 r = perspectiveBase(fovRadians, aspect);
+    r.m[2][2] = 0.0f;
+    r.m[2][3] = zNear;
+    return r;
+}
+
+mat4 ortho(float left, float right, float bottom, float top, float zNear, float zFar) noexcept {
+    assert(right != left && top != bottom && zFar != zNear);
+    mat4 r;
+    r.m[0][0] = 2.0f / (right - left);
+    r.m[1][1] = 2.0f / (top - bottom);
+    r.m[2][2] = -2.0f / (zFar - zNear);
+    r.m[0][3] = -(right + left) / (right - left);
+    r.m[1][3] = -(top + bottom) / (top - bottom);
+    r.m[2][3] = -(zFar + zNear) / (zFar - zNear);
+    return r;
+}
+
+mat4 lookAt(const Vector3& eye, const Vector3& center, const Vector3& up) noexcept {
+    const Vector3 f = (center - eye).normalized();
+    const Vector3 s = f.cross(up).normalized();
+    const Vector3 u = s.cross(f);
+    mat4 r;
+    r.m[0][0] = s.x;  r.m[0][1] = s.y;  r.m[0][2] = s.z;
+    r.m[1][0] = u.x;  r.m[1][1] = u.y;  r.m[1][2] = u.z;
+    r.m[2][0] = -f.x; r.m[2][1] = -f.y; r.m[2][2] = -f.z;
+    r.m[0][3] = -s.dot(eye);
+    r.m[1][3] = -u.dot(eye);
+    r.m[2][3] = f.dot(eye);
+    return r;
+}
+
+void composeTRS(std::span<const Vector3> positions, std::span<const Quaternion> rotations,
+                std::span<const Vector3> factors, std::span<mat4> out) noexcept {
+    assert(rotations.size() == positions.size() && factors.size() == positions.size());
+    assert(out.size() >= positions.size());
+    // Plain loop over the inline builder; the compiler vectorizes it across objects
+    for (std::size_t i = 0; i < positions.size(); ++i)
+        out[i] = composeTRS(positions[i], rotations[i], factors[i]);
+}
+
+} // namespace math
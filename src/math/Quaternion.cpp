@@ -0,0 +1,181 @@
+#include "include/Quaternion.h"
+
+#include <cassert>
+
+#include "include/SimdPack.h"
+
+namespace math {
+
+static_assert(sizeof(Vector3) == 3 * sizeof(float), "batch kernels treat Vector3 arrays as packed floats");
+
+namespace {
+
+// Interpolation is written once against a pack type (see SimdPack.h). The
+// single-quaternion functions run the PackScalar instantiation on one lane,
+// so they match the batch kernels bit for bit.
+
+template <typename P>
+struct QuatLanes {
+    typename P::Reg x, y, z, w;
+};
+
+template <typename P>
+typename P::Reg dot4(const QuatLanes<P>& a, const QuatLanes<P>& b) noexcept {
+    return P::add(P::add(P::add(P::mul(a.x, b.x), P::mul(a.y, b.y)), P::mul(a.z, b.z)), P::mul(a.w, b.w));
+}
+
+// a * ca + b * cb per component
+template <typename P>
+QuatLanes<P> blend(const QuatLanes<P>& a, typename P::Reg ca, const QuatLanes<P>& b, typename P::Reg cb) noexcept {
+    return {P::add(P::mul(a.x, ca), P::mul(b.x, cb)), P::add(P::mul(a.y, ca), P::mul(b.y, cb)),
+            P::add(P::mul(a.z, ca), P::mul(b.z, cb)), P::add(P::mul(a.w, ca), P::mul(b.w, cb))};
+}
+
+// Flips b onto a's hemisphere so interpolation takes the shorter arc.
+// Returns the (non-negative) cosine between a and the flipped b.
+template <typename P>
+typename P::Reg alignHemisphere(const QuatLanes<P>& a, QuatLanes<P>& b) noexcept {
+    const auto d = dot4<P>(a, b);
+    const auto sign = P::copySign(P::set1(1.0f), d);
+    b = {P::mul(b.x, sign), P::mul(b.y, sign), P::mul(b.z, sign), P::mul(b.w, sign)};
+    return P::mul(d, sign);
+}
+
+// acos(d) for d in [0, 1]: sqrt(1 - d) * p(d), |error| < 2e-8
+// (Abramowitz & Stegun 4.4.45).
+template <typename P>
+typename P::Reg acosUnit(typename P::Reg d) noexcept {
+    auto p = P::set1(-0.0012624911f);
+    p = P::add(P::mul(p, d), P::set1(0.0066700901f));
+    p = P::add(P::mul(p, d), P::set1(-0.0170881256f));
+    p = P::add(P::mul(p, d), P::set1(0.0308918810f));
+    p = P::add(P::mul(p, d), P::set1(-0.0501743046f));
+    p = P::add(P::mul(p, d), P::set1(0.0889789874f));
+    p = P::add(P::mul(p, d), P::set1(-0.2145988016f));
+    p = P::add(P::mul(p, d), P::set1(1.5707963050f));
+    return P::mul(P::sqrt(P::sub(P::set1(1.0f), d)), p);
+}
+
+// sin(a) / a for a in [0, pi/2] as a Taylor polynomial in a^2, |error| < 4e-8.
+// Never divides by a, so a = 0 is exact.
+template <typename P>
+typename P::Reg sinc(typename P::Reg a) noexcept {
+    const auto a2 = P::mul(a, a);
+    auto p = P::set1(-1.0f / 39916800.0f);
+    p = P::add(P::mul(p, a2), P::set1(1.0f / 362880.0f));
+    p = P::add(P::mul(p, a2), P::set1(-1.0f / 5040.0f));
+    p = P::add(P::mul(p, a2), P::set1(1.0f / 120.0f));
+    p = P::add(P::mul(p, a2), P::set1(-1.0f / 6.0f));
+    return P::add(P::mul(p, a2), P::set1(1.0f));
+}
+
+template <typename P>
+QuatLanes<P> nlerpLanes(const QuatLanes<P>& a, QuatLanes<P> b, float t) noexcept {
+    alignHemisphere<P>(a, b);
+    const QuatLanes<P> r = blend<P>(a, P::set1(1.0f - t), b, P::set1(t));
+    const auto invLen = P::div(P::set1(1.0f), P::sqrt(dot4<P>(r, r)));
+    return {P::mul(r.x, invLen), P::mul(r.y, invLen), P::mul(r.z, invLen), P::mul(r.w, invLen)};
+}
+
+// sin((1 - t) theta) / sin(theta) and sin(t theta) / sin(theta), written as
+// (1 - t) sinc((1 - t) theta) / sinc(theta) so theta -> 0 degrades to lerp.
+template <typename P>
+QuatLanes<P> slerpLanes(const QuatLanes<P>& a, QuatLanes<P> b, float t) noexcept {
+    const auto cosTheta = P::min(alignHemisphere<P>(a, b), P::set1(1.0f));
+    const auto theta = acosUnit<P>(cosTheta);
+    const auto invSinc = P::div(P::set1(1.0f), sinc<P>(theta));
+    const auto t0 = P::set1(1.0f - t), t1 = P::set1(t);
+    const auto ca = P::mul(P::mul(t0, sinc<P>(P::mul(t0, theta))), invSinc);
+    const auto cb = P::mul(P::mul(t1, sinc<P>(P::mul(t1, theta))), invSinc);
+    return blend<P>(a, ca, b, cb);
+}
+
+enum class Interpolation { Nlerp, Slerp };
+
+template <Interpolation MODE, typename P>
+QuatLanes<P> interpolate(const QuatLanes<P>& a, const QuatLanes<P>& b, float t) noexcept {
+    if constexpr (MODE == Interpolation::Nlerp)
+        return nlerpLanes<P>(a, b, t);
+    else
+        return slerpLanes<P>(a, b, t);
+}
+
+template <Interpolation MODE>
+Quaternion interpolateOne(const Quaternion& a, const Quaternion& b, float t) noexcept {
+    using P = simd::PackScalar;
+    const QuatLanes<P> r = interpolate<MODE, P>({a.x, a.y, a.z, a.w}, {b.x, b.y, b.z, b.w}, t);
+    return {r.x, r.y, r.z, r.w};
+}
+
+template <Interpolation MODE>
+void interpolateBatch(std::span<const Quaternion> a, std::span<const Quaternion> b, float t,
+                      std::span<Quaternion> out) noexcept {
+    assert(b.size() == a.size() && out.size() >= a.size());
+    if (a.empty()) return;
+    const float* pa = &a.data()->x;
+    const float* pb = &b.data()->x;
+    float* po = &out.data()->x;
+    simd::forEachPack(a.size(), [&]<typename P>(std::size_t begin, std::size_t end) {
+        for (std::size_t i = begin; i < end; i += P::WIDTH) {
+            QuatLanes<P> qa, qb;
+            P::loadXyzw(pa + 4 * i, qa.x, qa.y, qa.z, qa.w);
+            P::loadXyzw(pb + 4 * i, qb.x, qb.y, qb.z, qb.w);
+            const QuatLanes<P> r = interpolate<MODE, P>(qa, qb, t);
+            P::storeXyzw(po + 4 * i, r.x, r.y, r.z, r.w);
+        }
+    });
+}
+
+} // namespace
+
+// Both batches convert q to a matrix once and then pay 9 multiplies per
+// vector. The cross products of the 15-multiply form need lane permutes that
+// defeat auto-vectorization of Vector3 arrays, and a one-off conversion is
+// cheaper per vector anyway once the batch has more than a handful of entries.
+
+void rotate(const Quaternion& q, std::span<const Vector3> in, std::span<Vector3> out) noexcept {
+    assert(out.size() >= in.size());
+    const Rotation3 r = q.toRotation3();
+    // Scalar body over the whole range; the compiler vectorizes it (see TransformBatch.cpp)
+    for (std::size_t i = 0; i < in.size(); ++i) out[i] = rotate(r, in[i]);
+}
+
+void rotate(const Quaternion& q, const Vector3SoA& in, Vector3SoA& out) {
+    out.resize(in.size());
+    const Rotation3 rot = q.toRotation3();
+    const float* ix = in.x(); const float* iy = in.y(); const float* iz = in.z();
+    float* ox = out.x(); float* oy = out.y(); float* oz = out.z();
+    simd::forEachPack(in.size(), [&]<typename P>(std::size_t begin, std::size_t end) {
+        typename P::Reg e[3][3];
+        for (int i = 0; i < 3; ++i)
+            for (int j = 0; j < 3; ++j)
+                e[i][j] = P::set1(rot.m[i][j]);
+        for (std::size_t i = begin; i < end; i += P::WIDTH) {
+            const auto x = P::load(ix + i), y = P::load(iy + i), z = P::load(iz + i);
+            typename P::Reg row[3];
+            for (int r = 0; r < 3; ++r)
+                row[r] = P::add(P::add(P::mul(e[r][0], x), P::mul(e[r][1], y)), P::mul(e[r][2], z));
+            P::store(ox + i, row[0]);
+            P::store(oy + i, row[1]);
+            P::store(oz + i, row[2]);
+        }
+    });
+}
+
+Quaternion nlerp(const Quaternion& a, const Quaternion& b, float t) noexcept {
+    return interpolateOne<Interpolation::Nlerp>(a, b, t);
+}
+
+Quaternion slerp(const Quaternion& a, const Quaternion& b, float t) noexcept {
+    return interpolateOne<Interpolation::Slerp>(a, b, t);
+}
+
+void nlerp(std::span<const Quaternion> a, std::span<const Quaternion> b, float t, std::span<Quaternion> out) noexcept {
+    interpolateBatch<Interpolation::Nlerp>(a, b, t, out);
+}
+
+void slerp(std::span<const Quaternion> a, std::span<const Quaternion> b, float t, std::span<Quaternion> out) noexcept {
+    interpolateBatch<Interpolation::Slerp>(a, b, t, out);
+}
+
+} // namespace math
@@ -0,0 +1,187 @@
+#include "include/Simd.h"
+
+#include <atomic>
+
+#if AURELION_SIMD_SSE && defined(_MSC_VER)
+#include <intrin.h>
+#endif
+
+namespace math::simd {
+
+namespace {
+
+// --- Scalar kernels (reference order for every backend) ---
+
+void mat4MulScalar(const float* a, const float* b, float* out) noexcept {
+    for (int i = 0; i < 4; ++i) {
+        for (int j = 0; j < 4; ++j) {
+            float sum = a[i * 4 + 0] * b[0 * 4 + j];
+            sum += a[i * 4 + 1] * b[1 * 4 + j];
+            sum += a[i * 4 + 2] * b[2 * 4 + j];
+            sum += a[i * 4 + 3] * b[3 * 4 + j];
+            out[i * 4 + j] = sum;
+        }
+    }
+}
+
+void mat4MulVec4Scalar(const float* m, const float* v, float* out) noexcept {
+    for (int i = 0; i < 4; ++i) {
+        float sum = m[i * 4 + 0] * v[0];
+        sum += m[i * 4 + 1] * v[1];
+        sum += m[i * 4 + 2] * v[2];
+        sum += m[i * 4 + 3] * v[3];
+        out[i] = sum;
+    }
+}
+
+#if AURELION_SIMD_SSE
+
+// --- SSE kernels ---
+
+void mat4MulSse(const float* a, const float* b, float* out) noexcept {
+    const __m128 b0 = _mm_loadu_ps(b + 0);
+    const __m128 b1 = _mm_loadu_ps(b + 4);
+    const __m128 b2 = _mm_loadu_ps(b + 8);
+    const __m128 b3 = _mm_loadu_ps(b + 12);
+    for (int i = 0; i < 4; ++i) {
+        const __m128 row = _mm_loadu_ps(a + i * 4);
+        __m128 r = _mm_mul_ps(_mm_shuffle_ps(row, row, _MM_SHUFFLE(0, 0, 0, 0)), b0);
+        r = _mm_add_ps(r, _mm_mul_ps(_mm_shuffle_ps(row, row, _MM_SHUFFLE(1, 1, 1, 1)), b1));
+        r = _mm_add_ps(r, _mm_mul_ps(_mm_shuffle_ps(row, row, _MM_SHUFFLE(2, 2, 2, 2)), b2));
+        r = _mm_add_ps(r, _mm_mul_ps(_mm_shuffle_ps(row, row, _MM_SHUFFLE(3, 3, 3, 3)), b3));
+        _mm_storeu_ps(out + i * 4, r);
+    }
+}
+
+void mat4MulVec4Sse(const float* m, const float* v, float* out) noexcept {
+    // Transpose rows into columns so the result is a sum of scaled columns,
+    // which keeps the scalar accumulation order per lane.
+    __m128 c0 = _mm_loadu_ps(m + 0);
+    __m128 c1 = _mm_loadu_ps(m + 4);
+    __m128 c2 = _mm_loadu_ps(m + 8);
+    __m128 c3 = _mm_loadu_ps(m + 12);
+    _MM_TRANSPOSE4_PS(c0, c1, c2, c3);
+    __m128 r = _mm_mul_ps(c0, _mm_set1_ps(v[0]));
+    r = _mm_add_ps(r, _mm_mul_ps(c1, _mm_set1_ps(v[1])));
+    r = _mm_add_ps(r, _mm_mul_ps(c2, _mm_set1_ps(v[2])));
+    r = _mm_add_ps(r, _mm_mul_ps(c3, _mm_set1_ps(v[3])));
+    _mm_storeu_ps(out, r);
+}
+
+// --- AVX kernels ---
+
+AURELION_TARGET_AVX void mat4MulAvx(const float* a, const float* b, float* out) noexcept {
+    // Two result rows per iteration; every B row is duplicated in both halves.
+    const __m256 b0 = _mm256_broadcast_ps(reinterpret_cast<const __m128*>(b + 0));
+    const __m256 b1 = _mm256_broadcast_ps(reinterpret_cast<const __m128*>(b + 4));
+    const __m256 b2 = _mm256_broadcast_ps(reinterpret_cast<const __m128*>(b + 8));
+    const __m256 b3 = _mm256_broadcast_ps(reinterpret_cast<const __m128*>(b + 12));
+    for (int i = 0; i < 4; i += 2) {
+        const __m256 rows = _mm256_loadu_ps(a + i * 4);
+        __m256 r = _mm256_mul_ps(_mm256_permute_ps(rows, _MM_SHUFFLE(0, 0, 0, 0)), b0);
+        r = _mm256_add_ps(r, _mm256_mul_ps(_mm256_permute_ps(rows, _MM_SHUFFLE(1, 1, 1, 1)), b1));
+        r = _mm256_add_ps(r, _mm256_mul_ps(_mm256_permute_ps(rows, _MM_SHUFFLE(2, 2, 2, 2)), b2));
+        r = _mm256_add_ps(r, _mm256_mul_ps(_mm256_permute_ps(rows, _MM_SHUFFLE(3, 3, 3, 3)), b3));
+        _mm256_storeu_ps(out + i * 4, r);
+    }
+}
+
+bool cpuHasAvx() noexcept {
+#if defined(_MSC_VER)
+    int info[4];
+    __cpuid(info, 1);
+    const bool osxsave = (info[2] & (1 << 27)) != 0;
+    const bool avx = (info[2] & (1 << 28)) != 0;
+    // The OS must also save the YMM state on context switches
+    return osxsave && avx && (_xgetbv(0) & 0x6) == 0x6;
+#elif defined(__GNUC__) || defined(__clang__)
+    return __builtin_cpu_supports("avx");
+#else
+    return false;
+#endif
+}
+
+#endif // AURELION_SIMD_SSE
+
+struct Kernels {
+    Backend backend;
+    void (*mat4Mul)(const float*, const float*, float*) noexcept;
+    void (*mat4MulVec4)(const float*, const float*, float*) noexcept;
+};
+
+constexpr Kernels SCALAR_KERNELS{Backend::Scalar, mat4MulScalar, mat4MulVec4Scalar};
+#if AURELION_SIMD_SSE
+constexpr Kernels SSE_KERNELS{Backend::Sse, mat4MulSse, mat4MulVec4Sse};
+// mat4 x Vector4 is too small to profit from 256-bit lanes
+constexpr Kernels AVX_KERNELS{Backend::Avx, mat4MulAvx, mat4MulVec4Sse};
+#endif
+
+const Kernels* kernelsFor(Backend backend) noexcept {
+    switch (backend) {
+#if AURELION_SIMD_SSE
+        case Backend::Avx: return &AVX_KERNELS;
+        case Backend::Sse: return &SSE_KERNELS;
+#endif
+        default: return &SCALAR_KERNELS;
+    }
+}
+
+Backend detectBackend() noexcept {
+    if (isSupported(Backend::Avx)) return Backend::Avx;
+    if (isSupported(Backend::Sse)) return Backend::Sse;
+    return Backend::Scalar;
+}
+
+std::atomic<const Kernels*>& activeKernels() noexcept {
+    static std::atomic<const Kernels*> active{kernelsFor(detectBackend())};
+    return active;
+}
+
+const Kernels& kernels() noexcept {
+    return *activeKernels().load(std::memory_order_relaxed);
+}
+
+} // namespace
+
+bool isSupported(Backend backend) noexcept {
+    switch (backend) {
+        case Backend::Scalar: return true;
+#if AURELION_SIMD_SSE
+        case Backend::Sse: return true;
+        case Backend::Avx: {
+            static const bool hasAvx = cpuHasAvx();
+            return hasAvx;
+        }
+#endif
+        default: return false;
+    }
+}
+
+Backend activeBackend() noexcept {
+    return kernels().backend;
+}
+
+bool setBackend(Backend backend) noexcept {
+    if (!isSupported(backend)) return false;
+    activeKernels().store(kernelsFor(backend), std::memory_order_relaxed);
+    return true;
+}
+
+const char* backendName(Backend backend) noexcept {
+    switch (backend) {
+        case Backend::Scalar: return "scalar";
+        case Backend::Sse: return "sse";
+        case Backend::Avx: return "avx";
+    }
+    return "unknown";
+}
+
+void mat4Mul(const float* a, const float* b, float* out) noexcept {
+    kernels().mat4Mul(a, b, out);
+}
+
+void mat4MulVec4(const float* m, const float* v, float* out) noexcept {
+    kernels().mat4MulVec4(m, v, out);
+}
+
+} // namespace math::simd
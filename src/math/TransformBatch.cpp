@@ -0,0 +1,131 @@
+#include "include/TransformBatch.h"
+
+#include <cassert>
+
+#include "include/SimdPack.h"
+
+namespace math {
+
+static_assert(sizeof(Vector3) == 3 * sizeof(float), "batch kernels treat Vector3 arrays as packed floats");
+
+namespace {
+
+// Matrix elements broadcast once per call into pack registers.
+template <typename P>
+struct MatrixRegs {
+    typename P::Reg e[4][4];
+
+    explicit MatrixRegs(const mat4& m) noexcept {
+        for (int i = 0; i < 4; ++i)
+            for (int j = 0; j < 4; ++j)
+                e[i][j] = P::set1(m.m[i][j]);
+    }
+
+    // Row r dotted with (x, y, z), in the same order as transformPoint
+    typename P::Reg row3(int r, typename P::Reg x, typename P::Reg y, typename P::Reg z) const noexcept {
+        return P::add(P::add(P::mul(e[r][0], x), P::mul(e[r][1], y)), P::mul(e[r][2], z));
+    }
+};
+
+enum class Mode { Point, Direction, Projective };
+
+template <Mode MODE, typename P>
+void transformXyz(const mat4& m, const float* in, float* out, std::size_t begin, std::size_t end) noexcept {
+    const MatrixRegs<P> r(m);
+    for (std::size_t i = begin; i < end; i += P::WIDTH) {
+        typename P::Reg x, y, z;
+        P::loadXyz(in + 3 * i, x, y, z);
+        auto ox = r.row3(0, x, y, z);
+        auto oy = r.row3(1, x, y, z);
+        auto oz = r.row3(2, x, y, z);
+        if constexpr (MODE != Mode::Direction) {
+            ox = P::add(ox, r.e[0][3]);
+            oy = P::add(oy, r.e[1][3]);
+            oz = P::add(oz, r.e[2][3]);
+        }
+        if constexpr (MODE == Mode::Projective) {
+            const auto w = P::add(r.row3(3, x, y, z), r.e[3][3]);
+            ox = P::div(ox, w);
+            oy = P::div(oy, w);
+            oz = P::div(oz, w);
+        }
+        P::storeXyz(out + 3 * i, ox, oy, oz);
+    }
+}
+
+// Vector3 arrays run the scalar body over the whole range; it auto-vectorizes
+// at least as well as an explicit SSE deinterleave (see bTransformBatch).
+template <Mode MODE>
+void transformAoS(const mat4& m, std::span<const Vector3> in, std::span<Vector3> out) noexcept {
+    assert(out.size() >= in.size());
+    if (in.empty()) return;
+    const float* src = &in.data()->x;
+    float* dst = &out.data()->x;
+    transformXyz<MODE, simd::PackScalar>(m, src, dst, 0, in.size());
+}
+
+template <Mode MODE>
+void transformSoA(const mat4& m, const Vector3SoA& in, Vector3SoA& out) {
+    out.resize(in.size());
+    const float* ix = in.x(); const float* iy = in.y(); const float* iz = in.z();
+    float* ox = out.x(); float* oy = out.y(); float* oz = out.z();
+    simd::forEachPack(in.size(), [&]<typename P>(std::size_t begin, std::size_t end) {
+        const MatrixRegs<P> r(m);
+        for (std::size_t i = begin; i < end; i += P::WIDTH) {
+            const auto x = P::load(ix + i), y = P::load(iy + i), z = P::load(iz + i);
+            auto rx = r.row3(0, x, y, z);
+            auto ry = r.row3(1, x, y, z);
+            auto rz = r.row3(2, x, y, z);
+            if constexpr (MODE == Mode::Point) {
+                rx = P::add(rx, r.e[0][3]);
+                ry = P::add(ry, r.e[1][3]);
+                rz = P::add(rz, r.e[2][3]);
+            }
+            P::store(ox + i, rx);
+            P::store(oy + i, ry);
+            P::store(oz + i, rz);
+        }
+    });
+}
+
+} // namespace
+
+void transformPoints(const mat4& m, std::span<const Vector3> in, std::span<Vector3> out) noexcept {
+    transformAoS<Mode::Point>(m, in, out);
+}
+
+void transformDirections(const mat4& m, std::span<const Vector3> in, std::span<Vector3> out) noexcept {
+    transformAoS<Mode::Direction>(m, in, out);
+}
+
+void transformPointsProjective(const mat4& m, std::span<const Vector3> in, std::span<Vector3> out) noexcept {
+    transformAoS<Mode::Projective>(m, in, out);
+}
+
+void transformVectors(const mat4& m, std::span<const Vector4> in, std::span<Vector4> out) noexcept {
+    assert(out.size() >= in.size());
+    if (in.empty()) return;
+    const float* src = &in.data()->x;
+    float* dst = &out.data()->x;
+    simd::forEachPack(in.size(), [&]<typename P>(std::size_t begin, std::size_t end) {
+        const MatrixRegs<P> r(m);
+        for (std::size_t i = begin; i < end; i += P::WIDTH) {
+            typename P::Reg x, y, z, w;
+            P::loadXyzw(src + 4 * i, x, y, z, w);
+            typename P::Reg o[4];
+            for (int row = 0; row < 4; ++row)
+                o[row] = P::add(r.row3(row, x, y, z), P::mul(r.e[row][3], w));
+            P::storeXyzw(dst + 4 * i, o[0], o[1], o[2], o[3]);
+        }
+    });
+}
+
+void transformPoints(const mat4& m, const Vector3SoA& in, Vector3SoA& out) {
+    transformSoA<Mode::Point>(m, in, out);
+}
+
+void transformDirections(const mat4& m, const Vector3SoA& in, Vector3SoA& out) {
+    transformSoA<Mode::Direction>(m, in, out);
+}
+
+} // namespace math
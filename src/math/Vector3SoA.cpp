@@ -0,0 +1,205 @@
+#include "include/Vector3SoA.h"
+
+#include <algorithm>
+#include <cassert>
+#include <cstring>
+#include <limits>
+#include <new>
+#include <utility>
+
+#include "include/SimdPack.h"
+
+namespace math {
+
+namespace {
+
+constexpr std::size_t FLOATS_PER_LINE = Vector3SoA::ALIGNMENT / sizeof(float);
+
+std::size_t roundUpToLine(std::size_t n) {
+    return (n + FLOATS_PER_LINE - 1) / FLOATS_PER_LINE * FLOATS_PER_LINE;
+}
+
+} // namespace
+
+// --- Storage ---
+
+void Vector3SoA::AlignedDelete::operator()(float* p) const noexcept {
+    ::operator delete[](p, std::align_val_t{ALIGNMENT});
+}
+
+Vector3SoA::Vector3SoA(std::size_t count) {
+    resize(count);
+}
+
+Vector3SoA::Vector3SoA(const Vector3SoA& other) {
+    *this = other;
+}
+
+Vector3SoA& Vector3SoA::operator=(const Vector3SoA& other) {
+    if (this == &other) return *this;
+    count = 0;
+    reserve(other.count);
+    count = other.count;
+    if (count == 0) return *this;
+    std::memcpy(xs, other.xs, count * sizeof(float));
+    std::memcpy(ys, other.ys, count * sizeof(float));
+    std::memcpy(zs, other.zs, count * sizeof(float));
+    return *this;
+}
+
+Vector3SoA::Vector3SoA(Vector3SoA&& other) noexcept {
+    *this = std::move(other);
+}
+
+Vector3SoA& Vector3SoA::operator=(Vector3SoA&& other) noexcept {
+    if (this == &other) return *this;
+    storage = std::move(other.storage);
+    xs = std::exchange(other.xs, nullptr);
+    ys = std::exchange(other.ys, nullptr);
+    zs = std::exchange(other.zs, nullptr);
+    count = std::exchange(other.count, 0);
+    cap = std::exchange(other.cap, 0);
+    return *this;
+}
+
+void Vector3SoA::reallocate(std::size_t newCapacity) {
+    newCapacity = roundUpToLine(newCapacity);
+    float* block = static_cast<float*>(
+        ::operator new[](3 * newCapacity * sizeof(float), std::align_val_t{ALIGNMENT}));
+    std::unique_ptr<float[], AlignedDelete> fresh(block);
+    float* nx = block;
+    float* ny = block + newCapacity;
+    float* nz = block + 2 * newCapacity;
+    if (count > 0) {
+        std::memcpy(nx, xs, count * sizeof(float));
+        std::memcpy(ny, ys, count * sizeof(float));
+        std::memcpy(nz, zs, count * sizeof(float));
+    }
+    storage = std::move(fresh);
+    xs = nx;
+    ys = ny;
+    zs = nz;
+    cap = newCapacity;
+}
+
+void Vector3SoA::reserve(std::size_t newCapacity) {
+    if (newCapacity <= cap) return;
+    reallocate(newCapacity);
+}
+
+void Vector3SoA::resize(std::size_t newSize) {
+    reserve(newSize);
+    if (newSize > count) {
+        const std::size_t added = newSize - count;
+        std::fill_n(xs + count, added, 0.0f);
+        std::fill_n(ys + count, added, 0.0f);
+        std::fill_n(zs + count, added, 0.0f);
+    }
+    count = newSize;
+}
+
+void Vector3SoA::pushBack(const Vector3& v) {
+    if (count == cap) reserve(std::max<std::size_t>(FLOATS_PER_LINE, cap * 2));
+    set(count++, v);
+}
+
+void Vector3SoA::swapRemove(std::size_t index) noexcept {
+    assert(index < count);
+    --count;
+    xs[index] = xs[count];
+    ys[index] = ys[count];
+    zs[index] = zs[count];
+}
+
+// --- Bulk kernels ---
+
+void axpy(float a, const Vector3SoA& x, Vector3SoA& y) noexcept {
+    assert(x.size() == y.size());
+    const float* xx = x.x(); const float* xy = x.y(); const float* xz = x.z();
+    float* yx = y.x(); float* yy = y.y(); float* yz = y.z();
+    simd::forEachPack(y.size(), [&]<typename P>(std::size_t begin, std::size_t end) {
+        const auto scale = P::set1(a);
+        for (std::size_t i = begin; i < end; i += P::WIDTH) {
+            P::store(yx + i, P::add(P::load(yx + i), P::mul(P::load(xx + i), scale)));
+            P::store(yy + i, P::add(P::load(yy + i), P::mul(P::load(xy + i), scale)));
+            P::store(yz + i, P::add(P::load(yz + i), P::mul(P::load(xz + i), scale)));
+        }
+    });
+}
+
+void dot(const Vector3SoA& a, const Vector3SoA& b, std::span<float> out) noexcept {
+    assert(a.size() == b.size() && out.size() >= a.size());
+    float* o = out.data();
+    simd::forEachPack(a.size(), [&]<typename P>(std::size_t begin, std::size_t end) {
+        for (std::size_t i = begin; i < end; i += P::WIDTH) {
+            auto d = P::mul(P::load(a.x() + i), P::load(b.x() + i));
+            d = P::add(d, P::mul(P::load(a.y() + i), P::load(b.y() + i)));
+            d = P::add(d, P::mul(P::load(a.z() + i), P::load(b.z() + i)));
+            P::store(o + i, d);
+        }
+    });
+}
+
+void cross(const Vector3SoA& a, const Vector3SoA& b, Vector3SoA& out) {
+    assert(a.size() == b.size());
+    assert(&out != &a && &out != &b);
+    out.resize(a.size());
+    simd::forEachPack(a.size(), [&]<typename P>(std::size_t begin, std::size_t end) {
+        for (std::size_t i = begin; i < end; i += P::WIDTH) {
+            const auto ax = P::load(a.x() + i), ay = P::load(a.y() + i), az = P::load(a.z() + i);
+            const auto bx = P::load(b.x() + i), by = P::load(b.y() + i), bz = P::load(b.z() + i);
+            P::store(out.x() + i, P::sub(P::mul(ay, bz), P::mul(az, by)));
+            P::store(out.y() + i, P::sub(P::mul(az, bx), P::mul(ax, bz)));
+            P::store(out.z() + i, P::sub(P::mul(ax, by), P::mul(ay, bx)));
+        }
+    });
+}
+
+void length(const Vector3SoA& v, std::span<float> out) noexcept {
+    assert(out.size() >= v.size());
+    float* o = out.data();
+    simd::forEachPack(v.size(), [&]<typename P>(std::size_t begin, std::size_t end) {
+        for (std::size_t i = begin; i < end; i += P::WIDTH) {
+            const auto x = P::load(v.x() + i), y = P::load(v.y() + i), z = P::load(v.z() + i);
+            P::store(o + i, P::sqrt(P::add(P::add(P::mul(x, x), P::mul(y, y)), P::mul(z, z))));
+        }
+    });
+}
+
+void normalize(Vector3SoA& v) noexcept {
+    float* vx = v.x(); float* vy = v.y(); float* vz = v.z();
+    simd::forEachPack(v.size(), [&]<typename P>(std::size_t begin, std::size_t end) {
+        for (std::size_t i = begin; i < end; i += P::WIDTH) {
+            const auto x = P::load(vx + i), y = P::load(vy + i), z = P::load(vz + i);
+            const auto len = P::sqrt(P::add(P::add(P::mul(x, x), P::mul(y, y)), P::mul(z, z)));
+            // Zero-length lanes keep their (zero) value, like Vector3::normalize
+            P::store(vx + i, P::selectNonZero(len, P::div(x, len), x));
+            P::store(vy + i, P::selectNonZero(len, P::div(y, len), y));
+            P::store(vz + i, P::selectNonZero(len, P::div(z, len), z));
+        }
+    });
+}
+
+void minMax(const Vector3SoA& v, Vector3& outMin, Vector3& outMax) noexcept {
+    constexpr float INF = std::numeric_limits<float>::infinity();
+    outMin = {INF, INF, INF};
+    outMax = {-INF, -INF, -INF};
+    simd::forEachPack(v.size(), [&]<typename P>(std::size_t begin, std::size_t end) {
+        if (begin == end) return;
+        auto lox = P::set1(INF), loy = P::set1(INF), loz = P::set1(INF);
+        auto hix = P::set1(-INF), hiy = P::set1(-INF), hiz = P::set1(-INF);
+        for (std::size_t i = begin; i < end; i += P::WIDTH) {
+            const auto x = P::load(v.x() + i), y = P::load(v.y() + i), z = P::load(v.z() + i);
+            lox = P::min(x, lox); loy = P::min(y, loy); loz = P::min(z, loz);
+            hix = P::max(x, hix); hiy = P::max(y, hiy); hiz = P::max(z, hiz);
+        }
+        outMin.x = std::min(outMin.x, P::reduceMin(lox));
+        outMin.y = std::min(outMin.y, P::reduceMin(loy));
+        outMin.z = std::min(outMin.z, P::reduceMin(loz));
+        outMax.x = std::max(outMax.x, P::reduceMax(hix));
+        outMax.y = std::max(outMax.y, P::reduceMax(hiy));
+        outMax.z = std::max(outMax.z, P::reduceMax(hiz));
+    });
+}
+
+} // namespace math
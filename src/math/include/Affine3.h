@@ -0,0 +1,324 @@
+#pragma once
+
+#include <cmath>
+
+#include "Mat4.h"
+#include "Vector3.h"
+
+/**
+ * @file Affine3.h
+ * @brief Affine transforms without the constant last row, plus typed fast paths.
+ *
+ * Model and view matrices are affine: their last row is always (0, 0, 0, 1),
+ * so a full mat4 product spends 28 of its 64 multiplies on known zeros and
+ * ones. Affine3 stores only the top 3x4 block and composes in 36 multiplies.
+ *
+ * Translation3, Rotation3 and Scale3 are "tagged" transforms. Composing two
+ * of them picks a dedicated overload at compile time, e.g. Translation3 *
+ * Translation3 is three adds and Rotation3 * Scale3 only scales columns.
+ * Any mix yields the cheapest representation that can hold the result.
+ *
+ * All types use the mat4 conventions: row-major, column vectors, translation
+ * in column 3.
+ *
+ * Example usage:
+ * @code
+ * math::Affine3 model = math::Translation3{pos} * math::Rotation3::axisAngle(up, yaw) * math::Scale3{size};
+ * mat4 mvp = viewProjection * model.toMat4();
+ * @endcode
+ */
+
+namespace math {
+
+/**
+ * @brief General affine transform stored as the top three rows of a mat4.
+ */
+struct Affine3 {
+    float m[3][4];
+
+    /** @brief Identity transform. */
+    constexpr Affine3() noexcept
+        : m{{1.0f, 0.0f, 0.0f, 0.0f}, {0.0f, 1.0f, 0.0f, 0.0f}, {0.0f, 0.0f, 1.0f, 0.0f}} {}
+
+    /**
+     * @brief Takes the top 3x4 block of a matrix; the last row is assumed to be (0, 0, 0, 1).
+     */
+    static Affine3 fromMat4(const mat4& src) noexcept {
+        Affine3 a;
+        for (int i = 0; i < 3; ++i)
+            for (int j = 0; j < 4; ++j)
+                a.m[i][j] = src.m[i][j];
+        return a;
+    }
+
+    /** @brief Expands to a full mat4 with last row (0, 0, 0, 1). */
+    mat4 toMat4() const noexcept {
+        mat4 r;
+        for (int i = 0; i < 3; ++i)
+            for (int j = 0; j < 4; ++j)
+                r.m[i][j] = m[i][j];
+        return r;
+    }
+
+    constexpr Affine3 toAffine() const noexcept { return *this; }
+};
+
+/**
+ * @brief Pure translation.
+ */
+struct Translation3 {
+    Vector3 offset;
+
+    constexpr Affine3 toAffine() const noexcept {
+        Affine3 a;
+        a.m[0][3] = offset.x;
+        a.m[1][3] = offset.y;
+        a.m[2][3] = offset.z;
+        return a;
+    }
+
+    mat4 toMat4() const noexcept { return toAffine().toMat4(); }
+};
+
+/**
+ * @brief Axis-aligned (possibly non-uniform) scale.
+ */
+struct Scale3 {
+    Vector3 factors{1.0f, 1.0f, 1.0f};
+
+    constexpr Affine3 toAffine() const noexcept {
+        Affine3 a;
+        a.m[0][0] = factors.x;
+        a.m[1][1] = factors.y;
+        a.m[2][2] = factors.z;
+        return a;
+    }
+
+    mat4 toMat4() const noexcept { return toAffine().toMat4(); }
+};
+
+/**
+ * @brief Pure rotation stored as an orthonormal 3x3 matrix.
+ */
+struct Rotation3 {
+    float m[3][3];
+
+    /** @brief Identity rotation. */
+    constexpr Rotation3() noexcept
+        : m{{1.0f, 0.0f, 0.0f}, {0.0f, 1.0f, 0.0f}, {0.0f, 0.0f, 1.0f}} {}
+
+    /**
+     * @brief Right-handed rotation about a unit axis (Rodrigues' formula).
+     *
+     * @param axis Rotation axis; must be normalized.
+     * @param radians Angle in radians, counter-clockwise looking down the axis.
+     */
+    static Rotation3 axisAngle(const Vector3& axis, float radians) noexcept {
+        const float c = std::cos(radians);
+        const float s = std::sin(radians);
+        const float t = 1.0f - c;
+        Rotation3 r;
+        r.m[0][0] = t * axis.x * axis.x + c;
+        r.m[0][1] = t * axis.x * axis.y - s * axis.z;
+        r.m[0][2] = t * axis.x * axis.z + s * axis.y;
+        r.m[1][0] = t * axis.x * axis.y + s * axis.z;
+        r.m[1][1] = t * axis.y * axis.y + c;
+        r.m[1][2] = t * axis.y * axis.z - s * axis.x;
+        r.m[2][0] = t * axis.x * axis.z - s * axis.y;
+        r.m[2][1] = t * axis.y * axis.z + s * axis.x;
+        r.m[2][2] = t * axis.z * axis.z + c;
+        return r;
+    }
+
+    constexpr Affine3 toAffine() const noexcept {
+        Affine3 a;
+        for (int i = 0; i < 3; ++i)
+            for (int j = 0; j < 3; ++j)
+                a.m[i][j] = m[i][j];
+        return a;
+    }
+
+    mat4 toMat4() const noexcept { return toAffine().toMat4(); }
+};
+
+// --- Applying transforms ---
+
+/** @brief a * (p, 1). */
+constexpr Vector3 transformPoint(const Affine3& a, const Vector3& p) noexcept {
+    return {
+        a.m[0][0] * p.x + a.m[0][1] * p.y + a.m[0][2] * p.z + a.m[0][3],
+        a.m[1][0] * p.x + a.m[1][1] * p.y + a.m[1][2] * p.z + a.m[1][3],
+        a.m[2][0] * p.x + a.m[2][1] * p.y + a.m[2][2] * p.z + a.m[2][3],
+    };
+}
+
+/** @brief a * (d, 0). */
+constexpr Vector3 transformDirection(const Affine3& a, const Vector3& d) noexcept {
+    return {
+        a.m[0][0] * d.x + a.m[0][1] * d.y + a.m[0][2] * d.z,
+        a.m[1][0] * d.x + a.m[1][1] * d.y + a.m[1][2] * d.z,
+        a.m[2][0] * d.x + a.m[2][1] * d.y + a.m[2][2] * d.z,
+    };
+}
+
+/** @brief r * v. */
+constexpr Vector3 rotate(const Rotation3& r, const Vector3& v) noexcept {
+    return {
+        r.m[0][0] * v.x + r.m[0][1] * v.y + r.m[0][2] * v.z,
+        r.m[1][0] * v.x + r.m[1][1] * v.y + r.m[1][2] * v.z,
+        r.m[2][0] * v.x + r.m[2][1] * v.y + r.m[2][2] * v.z,
+    };
+}
+
+// --- Composition: same kind ---
+
+/** @brief 27 multiplies, 9 multiply-adds for the translation column. */
+constexpr Affine3 operator*(const Affine3& a, const Affine3& b) noexcept {
+    Affine3 r;
+    for (int i = 0; i < 3; ++i) {
+        for (int j = 0; j < 3; ++j)
+            r.m[i][j] = a.m[i][0] * b.m[0][j] + a.m[i][1] * b.m[1][j] + a.m[i][2] * b.m[2][j];
+        r.m[i][3] = a.m[i][0] * b.m[0][3] + a.m[i][1] * b.m[1][3] + a.m[i][2] * b.m[2][3] + a.m[i][3];
+    }
+    return r;
+}
+
+constexpr Translation3 operator*(const Translation3& a, const Translation3& b) noexcept {
+    return {a.offset + b.offset};
+}
+
+constexpr Scale3 operator*(const Scale3& a, const Scale3& b) noexcept {
+    return {{a.factors.x * b.factors.x, a.factors.y * b.factors.y, a.factors.z * b.factors.z}};
+}
+
+constexpr Rotation3 operator*(const Rotation3& a, const Rotation3& b) noexcept {
+    Rotation3 r;
+    for (int i = 0; i < 3; ++i)
+        for (int j = 0; j < 3; ++j)
+            r.m[i][j] = a.m[i][0] * b.m[0][j] + a.m[i][1] * b.m[1][j] + a.m[i][2] * b.m[2][j];
+    return r;
+}
+
+// --- Composition: mixed tags ---
+
+/** @brief [R | t]: no arithmetic at all. */
+constexpr Affine3 operator*(const Translation3& t, const Rotation3& r) noexcept {
+    Affine3 a = r.toAffine();
+    a.m[0][3] = t.offset.x;
+    a.m[1][3] = t.offset.y;
+    a.m[2][3] = t.offset.z;
+    return a;
+}
+
+/** @brief [R | R t]. */
+constexpr Affine3 operator*(const Rotation3& r, const Translation3& t) noexcept {
+    return Translation3{rotate(r, t.offset)} * r;
+}
+
+/** @brief [diag(s) | t]. */
+constexpr Affine3 operator*(const Translation3& t, const Scale3& s) noexcept {
+    Affine3 a = s.toAffine();
+    a.m[0][3] = t.offset.x;
+    a.m[1][3] = t.offset.y;
+    a.m[2][3] = t.offset.z;
+    return a;
+}
+
+/** @brief [diag(s) | s * t]. */
+constexpr Affine3 operator*(const Scale3& s, const Translation3& t) noexcept {
+    Affine3 a = s.toAffine();
+    a.m[0][3] = s.factors.x * t.offset.x;
+    a.m[1][3] = s.factors.y * t.offset.y;
+    a.m[2][3] = s.factors.z * t.offset.z;
+    return a;
+}
+
+/** @brief Scales the columns of R. */
+constexpr Affine3 operator*(const Rotation3& r, const Scale3& s) noexcept {
+    Affine3 a;
+    for (int i = 0; i < 3; ++i) {
+        a.m[i][0] = r.m[i][0] * s.factors.x;
+        a.m[i][1] = r.m[i][1] * s.factors.y;
+        a.m[i][2] = r.m[i][2] * s.factors.z;
+    }
+    return a;
+}
+
+/** @brief Scales the rows of R. */
+constexpr Affine3 operator*(const Scale3& s, const Rotation3& r) noexcept {
+    const float f[3] = {s.factors.x, s.factors.y, s.factors.z};
+    Affine3 a;
+    for (int i = 0; i < 3; ++i)
+        for (int j = 0; j < 3; ++j)
+            a.m[i][j] = f[i] * r.m[i][j];
+    return a;
+}
+
+// --- Composition: general affine with a tag ---
+
+/** @brief Adds t to the translation column. */
+constexpr Affine3 operator*(const Translation3& t, const Affine3& b) noexcept {
+    Affine3 a = b;
+    a.m[0][3] += t.offset.x;
+    a.m[1][3] += t.offset.y;
+    a.m[2][3] += t.offset.z;
+    return a;
+}
+
+/** @brief Translation column becomes a * (t, 1). */
+constexpr Affine3 operator*(const Affine3& a, const Translation3& t) noexcept {
+    Affine3 r = a;
+    const Vector3 moved = transformPoint(a, t.offset);
+    r.m[0][3] = moved.x;
+    r.m[1][3] = moved.y;
+    r.m[2][3] = moved.z;
+    return r;
+}
+
+/** @brief Scales every row (including translation). */
+constexpr Affine3 operator*(const Scale3& s, const Affine3& b) noexcept {
+    const float f[3] = {s.factors.x, s.factors.y, s.factors.z};
+    Affine3 a;
+    for (int i = 0; i < 3; ++i)
+        for (int j = 0; j < 4; ++j)
+            a.m[i][j] = f[i] * b.m[i][j];
+    return a;
+}
+
+/** @brief Scales the three linear columns; translation is unchanged. */
+constexpr Affine3 operator*(const Affine3& a, const Scale3& s) noexcept {
+    Affine3 r = a;
+    for (int i = 0; i < 3; ++i) {
+        r.m[i][0] *= s.factors.x;
+        r.m[i][1] *= s.factors.y;
+        r.m[i][2] *= s.factors.z;
+    }
+    return r;
+}
+
+/** @brief R times every column, translation included. */
+constexpr Affine3 operator*(const Rotation3& r, const Affine3& b) noexcept {
+    Affine3 a;
+    for (int i = 0; i < 3; ++i)
+        for (int j = 0; j < 4; ++j)
+            a.m[i][j] = r.m[i][0] * b.m[0][j] + r.m[i][1] * b.m[1][j] + r.m[i][2] * b.m[2][j];
+    return a;
+}
+
+/** @brief Linear block times R; translation is unchanged. */
+constexpr Affine3 operator*(const Affine3& a, const Rotation3& r) noexcept {
+    Affine3 out = a;
+    for (int i = 0; i < 3; ++i)
+        for (int j = 0; j < 3; ++j)
+            out.m[i][j] = a.m[i][0] * r.m[0][j] + a.m[i][1] * r.m[1][j] + a.m[i][2] * r.m[2][j];
+    return out;
+}
+
+// --- Mixing with mat4 ---
+
+/** @brief Full matrix times affine; keeps the projective row of m. */
+inline mat4 operator*(const mat4& m, const Affine3& a) noexcept {
+    return m * a.toMat4();
+}
+
+} // namespace math
@@ -0,0 +1,177 @@
+#pragma once
+
+#include <cassert>
+#include <cstddef>
+#include <cstring>
+#include <memory>
+#include <new>
+#include <span>
+#include <type_traits>
+#include <utility>
+
+namespace math {
+
+/**
+ * @class AlignedArray
+ * @brief Growable array of trivially copyable elements on cache-line boundaries.
+ *
+ * The single-stream counterpart of Vector3SoA, used for the scalar streams of
+ * SoA containers (masses, lifetimes, quaternion components, ...). The buffer
+ * starts on a 64-byte boundary and its capacity is padded to a whole cache
+ * line, so SIMD kernels may read up to the padded end without faulting.
+ *
+ * Elements are copied with memcpy and never constructed or destroyed, which
+ * is why T must be trivially copyable.
+ *
+ * Example usage:
+ * @code
+ * math::AlignedArray<float> inverseMass;
+ * inverseMass.pushBack(1.0f / 80.0f);
+ * math::simd::forEachPack(inverseMass.size(), ...);
+ * @endcode
+ */
+template <typename T>
+class AlignedArray {
+    static_assert(std::is_trivially_copyable_v<T>, "AlignedArray copies elements with memcpy");
+
+public:
+    static constexpr std::size_t ALIGNMENT = 64; /**< Byte alignment of the buffer. */
+
+    // --- Constructors ---
+
+    /**
+     * @brief Creates an empty array without allocating.
+     */
+    AlignedArray() noexcept = default;
+
+    /**
+     * @brief Creates an array of count copies of value.
+     */
+    explicit AlignedArray(std::size_t count, const T& value = T{}) { resize(count, value); }
+
+    AlignedArray(const AlignedArray& other) { *this = other; }
+
+    AlignedArray& operator=(const AlignedArray& other) {
+        if (this == &other) return *this;
+        count = 0;
+        reserve(other.count);
+        count = other.count;
+        if (count > 0) std::memcpy(items, other.items, count * sizeof(T));
+        return *this;
+    }
+
+    AlignedArray(AlignedArray&& other) noexcept { *this = std::move(other); }
+
+    AlignedArray& operator=(AlignedArray&& other) noexcept {
+        if (this == &other) return *this;
+        storage = std::move(other.storage);
+        items = std::exchange(other.items, nullptr);
+        count = std::exchange(other.count, 0);
+        cap = std::exchange(other.cap, 0);
+        return *this;
+    }
+
+    ~AlignedArray() = default;
+
+    // --- Size and capacity ---
+
+    std::size_t size() const noexcept { return count; }
+    std::size_t capacity() const noexcept { return cap; }
+    bool empty() const noexcept { return count == 0; }
+
+    /**
+     * @brief Grows the capacity to at least newCapacity elements.
+     *
+     * Invalidates pointers into the array if a reallocation happens.
+     */
+    void reserve(std::size_t newCapacity) {
+        if (newCapacity > cap) reallocate(newCapacity);
+    }
+
+    /**
+     * @brief Resizes the array; new elements are copies of value.
+     */
+    void resize(std::size_t newSize, const T& value = T{}) {
+        reserve(newSize);
+        for (std::size_t i = count; i < newSize; ++i) items[i] = value;
+        count = newSize;
+    }
+
+    /**
+     * @brief Resizes the array; new elements are left uninitialized for a kernel to fill.
+     */
+    void resizeForOverwrite(std::size_t newSize) {
+        reserve(newSize);
+        count = newSize;
+    }
+
+    /**
+     * @brief Removes all elements; keeps the allocation.
+     */
+    void clear() noexcept { count = 0; }
+
+    // --- Element access ---
+
+    /**
+     * @brief Appends an element, growing geometrically when full.
+     */
+    void pushBack(const T& value) {
+        if (count == cap) {
+            // value may live inside the buffer about to be replaced
+            const T copy = value;
+            reallocate(cap == 0 ? PER_LINE : cap * 2);
+            items[count++] = copy;
+            return;
+        }
+        items[count++] = value;
+    }
+
+    /**
+     * @brief Removes an element in O(1) by moving the last element into its slot.
+     *
+     * @note Element order is not preserved.
+     */
+    void swapRemove(std::size_t index) noexcept {
+        assert(index < count);
+        items[index] = items[count - 1];
+        --count;
+    }
+
+    T& operator[](std::size_t index) noexcept { return items[index]; }
+    const T& operator[](std::size_t index) const noexcept { return items[index]; }
+
+    T* data() noexcept { return items; }
+    const T* data() const noexcept { return items; }
+
+    T* begin() noexcept { return items; }
+    T* end() noexcept { return items + count; }
+    const T* begin() const noexcept { return items; }
+    const T* end() const noexcept { return items + count; }
+
+    operator std::span<T>() noexcept { return {items, count}; }
+    operator std::span<const T>() const noexcept { return {items, count}; }
+
+private:
+    struct AlignedDelete {
+        void operator()(T* p) const noexcept { ::operator delete[](p, std::align_val_t{ALIGNMENT}); }
+    };
+
+    static constexpr std::size_t PER_LINE = ALIGNMENT / sizeof(T) > 0 ? ALIGNMENT / sizeof(T) : 1;
+
+    void reallocate(std::size_t newCapacity) {
+        newCapacity = (newCapacity + PER_LINE - 1) / PER_LINE * PER_LINE;
+        T* block = static_cast<T*>(::operator new[](newCapacity * sizeof(T), std::align_val_t{ALIGNMENT}));
+        std::unique_ptr<T[], AlignedDelete> fresh(block);
+        if (count > 0) std::memcpy(block, items, count * sizeof(T));
+        storage = std::move(fresh);
+        items = block;
+        cap = newCapacity;
+    }
+
+    std::unique_ptr<T[], AlignedDelete> storage;
+    T* items = nullptr;
+    std::size_t count = 0;
+    std::size_t cap = 0;
+};
+
+} // namespace math
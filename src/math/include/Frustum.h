@@ -0,0 +1,113 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+#include "AlignedArray.h"
+#include "Mat4.h"
+#include "Vector3.h"
+#include "Vector3SoA.h"
+
+/**
+ * @file Frustum.h
+ * @brief View frustum planes extracted from a view-projection matrix, and batched culling of bounds.
+ */
+
+namespace math {
+
+/**
+ * @brief Plane normal . p + d = 0; points with a non-negative distance are inside.
+ */
+struct Plane {
+    Vector3 normal;
+    float d = 0.0f;
+
+    float distance(const Vector3& p) const noexcept { return normal.x * p.x + normal.y * p.y + normal.z * p.z + d; }
+};
+
+/**
+ * @brief Clip-space depth range a projection maps the view volume to.
+ */
+enum class ClipDepth {
+    MinusOneToOne, /**< OpenGL: perspective(), ortho() and their infinite variants. */
+    ZeroToOne      /**< The reversed-Z projections (near at 1, far at 0). */
+};
+
+/**
+ * @brief Six inward-facing planes: left, right, bottom, top, then the two depth planes.
+ *
+ * For the standard projections the depth planes are near then far; the
+ * reversed-Z ones swap them. A plane at infinity (the far plane of the
+ * infinite projections) has a zero normal and a positive d, so everything is
+ * inside it.
+ */
+struct Frustum {
+    std::array<Plane, 6> planes;
+
+    /** @brief Whether the sphere is at least partly inside (conservative near the corners). */
+    bool intersectsSphere(const Vector3& center, float radius) const noexcept;
+
+    /** @brief Whether the box given by center and half extents is at least partly inside (conservative). */
+    bool intersectsBox(const Vector3& center, const Vector3& extent) const noexcept;
+};
+
+/**
+ * @brief Planes of the volume viewProjection maps to clip space, normalized so distances are in world units.
+ *
+ * Works for any projection * view (* model) product; with a model matrix
+ * included the planes come out in that model's space.
+ */
+Frustum extractFrustum(const mat4& viewProjection, ClipDepth depth = ClipDepth::MinusOneToOne) noexcept;
+
+/**
+ * @brief Bounding spheres as SoA streams.
+ */
+struct BoundingSpheres {
+    Vector3SoA center;
+    AlignedArray<float> radius;
+
+    std::size_t size() const noexcept { return radius.size(); }
+
+    void pushBack(const Vector3& c, float r) {
+        center.pushBack(c);
+        radius.pushBack(r);
+    }
+};
+
+/**
+ * @brief Axis-aligned boxes as SoA streams of centers and half extents.
+ */
+struct BoundingBoxes {
+    Vector3SoA center;
+    Vector3SoA extent;
+
+    std::size_t size() const noexcept { return center.size(); }
+
+    void pushBack(const Vector3& c, const Vector3& halfExtent) {
+        center.pushBack(c);
+        extent.pushBack(halfExtent);
+    }
+};
+
+/**
+ * @brief Writes the indices in [first, last) of spheres that intersect frustum to visible, in ascending order.
+ *
+ * Tests eight spheres per step (one AVX register, two SSE registers or
+ * eight scalar lanes) against all six planes and appends the survivors with
+ * a table-driven compaction, without a branch per sphere. Agrees with
+ * Frustum::intersectsSphere() on every backend.
+ *
+ * @param visible Room for last - first indices (all of it may be written).
+ * @return Number of indices written.
+ */
+std::size_t cullSpheres(const Frustum& frustum, const BoundingSpheres& spheres, std::size_t first, std::size_t last,
+                        std::uint32_t* visible) noexcept;
+
+/**
+ * @brief cullSpheres() for boxes; agrees with Frustum::intersectsBox().
+ */
+std::size_t cullBoxes(const Frustum& frustum, const BoundingBoxes& boxes, std::size_t first, std::size_t last,
+                      std::uint32_t* visible) noexcept;
+
+} // namespace math
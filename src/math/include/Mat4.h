@@ -1,11 +1,16 @@
 #pragma once
 
+#include "Vector4.h"
+
 /**
  * @file Mat4.h
  * @brief Definition of a 4x4 matrix structure.
  * This structure is commonly used in 3D graphics for transformations.
  * It includes constructors and basic operations.
  *
+ * Storage is row-major (m[row][column]) and vectors are columns, so a point
+ * is transformed as M * v and translation lives in m[0..2][3].
+ *
  * @param m A 4x4 array representing the matrix elements.
  */
 struct mat4
@@ -14,10 +19,13 @@ struct mat4
     float m[4][4];
 
     // default constructor initializes to identity matrix
-    mat4();
+    constexpr mat4() noexcept : mat4(1.0f) {}
     // parameterized constructor initializes to a diagonal matrix with given value
-    explicit mat4(float d);
+    constexpr explicit mat4(float d) noexcept
+        : m{{d, 0.0f, 0.0f, 0.0f}, {0.0f, d, 0.0f, 0.0f}, {0.0f, 0.0f, d, 0.0f}, {0.0f, 0.0f, 0.0f, d}} {}
 
-    // multiplication operator for matrix multiplication
+    // multiplication operator for matrix multiplication (SIMD dispatched)
     mat4 operator*(const mat4& other) const;
+    // transforms a column vector (SIMD dispatched)
+    math::Vector4 operator*(const math::Vector4& v) const;
 };
@@ -0,0 +1,155 @@
+#pragma once
+
+#include <span>
+
+#include "Affine3.h"
+#include "Mat4.h"
+
+/**
+ * @file MatrixInverse.h
+ * @brief Inverses of mat4, Affine3 and the tagged transforms.
+ *
+ * All functions are branch-free: they never test the determinant. Inverting
+ * a singular matrix yields non-finite elements instead of an error, so check
+ * determinant() first if the input may be degenerate.
+ *
+ * Pick the cheapest inverse that matches what you know about the matrix:
+ *  - inverseRigid: rotation + translation only (camera/view, rigid bodies).
+ *  - inverse(Affine3): any affine matrix (scale/shear allowed).
+ *  - inverse(mat4): anything, including projections.
+ */
+
+namespace math {
+
+// --- General 4x4 ---
+
+/**
+ * @brief Determinant of a 4x4 matrix.
+ */
+float determinant(const mat4& m) noexcept;
+
+/**
+ * @brief General 4x4 inverse (2x2 block cofactor method, SSE dispatched).
+ *
+ * The SSE and scalar backends run the same arithmetic and agree bit for bit.
+ */
+mat4 inverse(const mat4& m) noexcept;
+
+/**
+ * @brief Transpose of the inverse; use it to transform normals by a non-rigid matrix.
+ */
+mat4 inverseTranspose(const mat4& m) noexcept;
+
+/**
+ * @brief Inverse of a rotation + translation matrix: [R^T | -R^T t].
+ *
+ * @note Only valid if the upper 3x3 block is orthonormal and the last row is (0, 0, 0, 1).
+ */
+mat4 inverseRigid(const mat4& m) noexcept;
+
+/**
+ * @brief out[i] = inverse(in[i]). out.size() must be >= in.size().
+ */
+void inverse(std::span<const mat4> in, std::span<mat4> out) noexcept;
+
+/**
+ * @brief out[i] = inverseRigid(in[i]). out.size() must be >= in.size().
+ */
+void inverseRigid(std::span<const mat4> in, std::span<mat4> out) noexcept;
+
+// --- mat4 helpers ---
+
+/**
+ * @brief Returns the transpose of m.
+ */
+inline mat4 transpose(const mat4& m) noexcept {
+    mat4 r;
+    for (int i = 0; i < 4; ++i)
+        for (int j = 0; j < 4; ++j)
+            r.m[i][j] = m.m[j][i];
+    return r;
+}
+
+// --- Affine ---
+
+/**
+ * @brief Inverse of a general affine transform: [A^-1 | -A^-1 t].
+ */
+constexpr Affine3 inverse(const Affine3& a) noexcept {
+    // Rows of A^-1 are the cross products of A's columns divided by det(A)
+    const Vector3 c0(a.m[0][0], a.m[1][0], a.m[2][0]);
+    const Vector3 c1(a.m[0][1], a.m[1][1], a.m[2][1]);
+    const Vector3 c2(a.m[0][2], a.m[1][2], a.m[2][2]);
+    const Vector3 r0 = c1.cross(c2);
+    const Vector3 r1 = c2.cross(c0);
+    const Vector3 r2 = c0.cross(c1);
+    const float invDet = 1.0f / c0.dot(r0);
+    const Vector3 rows[3] = {r0 * invDet, r1 * invDet, r2 * invDet};
+    const Vector3 t(a.m[0][3], a.m[1][3], a.m[2][3]);
+    Affine3 r;
+    for (int i = 0; i < 3; ++i) {
+        r.m[i][0] = rows[i].x;
+        r.m[i][1] = rows[i].y;
+        r.m[i][2] = rows[i].z;
+        r.m[i][3] = -rows[i].dot(t);
+    }
+    return r;
+}
+
+/**
+ * @brief Inverse of a rotation + translation transform: [R^T | -R^T t].
+ */
+constexpr Affine3 inverseRigid(const Affine3& a) noexcept {
+    Affine3 r;
+    for (int i = 0; i < 3; ++i) {
+        for (int j = 0; j < 3; ++j) r.m[i][j] = a.m[j][i];
+        r.m[i][3] = -(a.m[0][i] * a.m[0][3] + a.m[1][i] * a.m[1][3] + a.m[2][i] * a.m[2][3]);
+    }
+    return r;
+}
+
+/**
+ * @brief Normal matrix: (A^-1)^T of the linear part, with zero translation.
+ *
+ * Transform normals with transformDirection() and renormalize.
+ */
+constexpr Affine3 inverseTranspose(const Affine3& a) noexcept {
+    // (A^-1)^T has the cofactor vectors as columns
+    const Vector3 c0(a.m[0][0], a.m[1][0], a.m[2][0]);
+    const Vector3 c1(a.m[0][1], a.m[1][1], a.m[2][1]);
+    const Vector3 c2(a.m[0][2], a.m[1][2], a.m[2][2]);
+    const Vector3 r0 = c1.cross(c2);
+    const Vector3 r1 = c2.cross(c0);
+    const Vector3 r2 = c0.cross(c1);
+    const float invDet = 1.0f / c0.dot(r0);
+    const Vector3 cols[3] = {r0 * invDet, r1 * invDet, r2 * invDet};
+    Affine3 r;
+    for (int i = 0; i < 3; ++i) {
+        r.m[0][i] = cols[i].x;
+        r.m[1][i] = cols[i].y;
+        r.m[2][i] = cols[i].z;
+        r.m[i][3] = 0.0f;
+    }
+    return r;
+}
+
+// --- Tagged transforms ---
+
+constexpr Translation3 inverse(const Translation3& t) noexcept {
+    return {t.offset * -1.0f};
+}
+
+/** @brief Transpose; exact for orthonormal rotations. */
+constexpr Rotation3 inverse(const Rotation3& r) noexcept {
+    Rotation3 out;
+    for (int i = 0; i < 3; ++i)
+        for (int j = 0; j < 3; ++j)
+            out.m[i][j] = r.m[j][i];
+    return out;
+}
+
+constexpr Scale3 inverse(const Scale3& s) noexcept {
+    return {{1.0f / s.factors.x, 1.0f / s.factors.y, 1.0f / s.factors.z}};
+}
+
+} // namespace math
@@ -1,6 +1,10 @@
 #pragma once
 
+#include <span>
+
+#include "Affine3.h"
 #include "Mat4.h"
+#include "Quaternion.h"
 #include "Vector3.h"
 
 /**
@@ -10,26 +14,140 @@
  * These functions return pre-filled mat4s for common 3D operations like
  * perspective projection and camera orientation. Basically, they do the math
  * so you don’t have to cry over frustum diagrams.
+ *
+ * Conventions: right-handed, Y up, the camera looks down -Z in view space.
+ * The standard projections map depth to the OpenGL range [-1, 1]. The
+ * reversed-Z variants map near to 1 and far to 0 in a [0, 1] range (pair them
+ * with a [0, 1] clip-depth mode and a GREATER depth test); spreading float
+ * precision this way keeps distant geometry from z-fighting.
  */
 
- /**
+namespace math {
+
+// --- Projection ---
+
+/**
  * Creates a perspective projection matrix.
- * 
- * @param fovRadians Field of view in radians.
+ *
+ * @param fovRadians Vertical field of view in radians.
  * @param aspect Aspect ratio (width / height).
- * @param near Near clipping plane.
- * @param far Far clipping plane.
+ * @param zNear Distance to the near clipping plane (> 0).
+ * @param zFar Distance to the far clipping plane (> zNear).
  * @return A mat4 representing the perspective projection.
  */
-mat4 perspective(float fovRadians, float aspect, float near, float far);
+mat4 perspective(float fovRadians, float aspect, float zNear, float zFar) noexcept;
+
+/**
+ * @brief perspective() without a far plane: depth approaches 1 at infinity.
+ */
+mat4 perspectiveInfinite(float fovRadians, float aspect, float zNear) noexcept;
+
+/**
+ * @brief Reversed-Z perspective: depth 1 at zNear, 0 at zFar.
+ */
+mat4 perspectiveReversedZ(float fovRadians, float aspect, float zNear, float zFar) noexcept;
+
+/**
+ * @brief Reversed-Z perspective without a far plane: depth 1 at zNear, 0 at infinity.
+ *
+ * The usual choice for large scenes; depth precision no longer depends on a far distance.
+ */
+mat4 perspectiveInfiniteReversedZ(float fovRadians, float aspect, float zNear) noexcept;
+
+/**
+ * @brief Orthographic projection of the box [left, right] x [bottom, top] x [-zNear, -zFar].
+ */
+mat4 ortho(float left, float right, float bottom, float top, float zNear, float zFar) noexcept;
+
+// --- View ---
 
 /**
  * Creates a view matrix using the camera's position and orientation.
  * 
  * @param eye Position of the camera.
  * @param center Point the camera is looking at.
- * @param up Up direction (usually vec3(0, 1, 0)).
+ * @param up Up direction (usually Vector3(0, 1, 0)); must not be parallel to center - eye.
  * @return A mat4 representing the view transformation.
  */
-mat4 lookAt(const vec3& eye, const vec3& center, const vec3& up);
+mat4 lookAt(const Vector3& eye, const Vector3& center, const Vector3& up) noexcept;
+
+// --- Model builders ---
+
+/**
+ * @brief Translation by offset.
+ */
+constexpr mat4 translate(const Vector3& offset) noexcept {
+    mat4 r;
+    r.m[0][3] = offset.x;
+    r.m[1][3] = offset.y;
+    r.m[2][3] = offset.z;
+    return r;
+}
+
+/**
+ * @brief Axis-aligned scale.
+ */
+constexpr mat4 scale(const Vector3& factors) noexcept {
+    mat4 r;
+    r.m[0][0] = factors.x;
+    r.m[1][1] = factors.y;
+    r.m[2][2] = factors.z;
+    return r;
+}
+
+/**
+ * @brief Rotation by a unit quaternion.
+ */
+constexpr mat4 rotate(const Quaternion& q) noexcept {
+    const Rotation3 rot = q.toRotation3();
+    mat4 r;
+    for (int i = 0; i < 3; ++i)
+        for (int j = 0; j < 3; ++j)
+            r.m[i][j] = rot.m[i][j];
+    return r;
+}
+
+/**
+ * @brief Right-handed rotation about a unit axis.
+ */
+inline mat4 rotate(const Vector3& axis, float radians) noexcept {
+    return rotate(Quaternion::axisAngle(axis, radians));
+}
+
+/**
+ * @brief translate(position) * rotate(rotation) * scale(factors), built directly.
+ *
+ * Writes the rotation with its columns already scaled, so it costs one
+ * quaternion-to-matrix conversion and nine multiplies instead of two mat4
+ * products.
+ */
+constexpr mat4 composeTRS(const Vector3& position, const Quaternion& rotation, const Vector3& factors) noexcept {
+    const Rotation3 rot = rotation.toRotation3();
+    mat4 r;
+    for (int i = 0; i < 3; ++i) {
+        r.m[i][0] = rot.m[i][0] * factors.x;
+        r.m[i][1] = rot.m[i][1] * factors.y;
+        r.m[i][2] = rot.m[i][2] * factors.z;
+    }
+    r.m[0][3] = position.x;
+    r.m[1][3] = position.y;
+    r.m[2][3] = position.z;
+    return r;
+}
+
+/**
+ * @brief Affine3 form of composeTRS(), for callers that keep model matrices affine.
+ */
+constexpr Affine3 composeAffineTRS(const Vector3& position, const Quaternion& rotation, const Vector3& factors) noexcept {
+    return Translation3{position} * rotation.toRotation3() * Scale3{factors};
+}
+
+/**
+ * @brief out[i] = composeTRS(positions[i], rotations[i], factors[i]).
+ *
+ * All inputs must have the same size and out.size() must be >= that size.
+ */
+void composeTRS(std::span<const Vector3> positions, std::span<const Quaternion> rotations,
+                std::span<const Vector3> factors, std::span<mat4> out) noexcept;
 
+} // namespace math
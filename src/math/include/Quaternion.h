@@ -0,0 +1,221 @@
+#pragma once
+
+#include <cmath>
+#include <span>
+#include <type_traits>
+
+#include "Affine3.h"
+#include "Mat4.h"
+#include "Vector3.h"
+#include "Vector3SoA.h"
+
+/**
+ * @file Quaternion.h
+ * @brief Unit quaternion rotations.
+ *
+ * Components are stored as (x, y, z, w) with w the scalar part, matching the
+ * Vector4 layout so arrays of quaternions can be handed to the batch kernels.
+ * Rotations follow the right-handed convention used by Rotation3::axisAngle,
+ * and q1 * q2 applies q2 first, like matrix products.
+ *
+ * rotate(q, v) costs 15 multiplies and never builds a matrix, and a stored
+ * orientation is 16 bytes instead of a 36-byte Rotation3, so per-object
+ * rotations should be kept as quaternions. The batch overloads that apply one
+ * quaternion to many vectors convert it to a matrix once up front instead.
+ *
+ * Example usage:
+ * @code
+ * math::Quaternion q = math::Quaternion::axisAngle({0.0f, 1.0f, 0.0f}, math::HalfPi);
+ * math::Vector3 v = math::rotate(q, {1.0f, 0.0f, 0.0f}); // (0, 0, -1)
+ * math::Quaternion halfway = math::slerp(math::Quaternion{}, q, 0.5f);
+ * @endcode
+ */
+
+namespace math {
+
+/**
+ * @brief Rotation quaternion q = w + xi + yj + zk.
+ */
+struct Quaternion {
+    float x; /**< i component. */
+    float y; /**< j component. */
+    float z; /**< k component. */
+    float w; /**< Scalar part. */
+
+    /** @brief Identity rotation (0, 0, 0, 1). */
+    constexpr Quaternion() noexcept : x(0.0f), y(0.0f), z(0.0f), w(1.0f) {}
+
+    constexpr Quaternion(float x, float y, float z, float w) noexcept : x(x), y(y), z(z), w(w) {}
+
+    /**
+     * @brief Right-handed rotation about a unit axis.
+     *
+     * @param axis Rotation axis; must be normalized.
+     * @param radians Angle in radians, counter-clockwise looking down the axis.
+     */
+    static Quaternion axisAngle(const Vector3& axis, float radians) noexcept {
+        const float s = std::sin(radians * 0.5f);
+        return {axis.x * s, axis.y * s, axis.z * s, std::cos(radians * 0.5f)};
+    }
+
+    /**
+     * @brief Rotation held in an orthonormal matrix (Shepperd's method).
+     *
+     * Picks the largest of w, x, y, z to divide by, so the result stays
+     * accurate for every angle. The returned quaternion has w >= 0 unless
+     * another component is the pivot.
+     */
+    static Quaternion fromRotation3(const Rotation3& r) noexcept {
+        const float trace = r.m[0][0] + r.m[1][1] + r.m[2][2];
+        if (trace > 0.0f) {
+            const float s = 0.5f / std::sqrt(trace + 1.0f);
+            return {(r.m[2][1] - r.m[1][2]) * s, (r.m[0][2] - r.m[2][0]) * s, (r.m[1][0] - r.m[0][1]) * s, 0.25f / s};
+        }
+        if (r.m[0][0] > r.m[1][1] && r.m[0][0] > r.m[2][2]) {
+            const float s = 0.5f / std::sqrt(1.0f + r.m[0][0] - r.m[1][1] - r.m[2][2]);
+            return {0.25f / s, (r.m[0][1] + r.m[1][0]) * s, (r.m[0][2] + r.m[2][0]) * s, (r.m[2][1] - r.m[1][2]) * s};
+        }
+        if (r.m[1][1] > r.m[2][2]) {
+            const float s = 0.5f / std::sqrt(1.0f + r.m[1][1] - r.m[0][0] - r.m[2][2]);
+            return {(r.m[0][1] + r.m[1][0]) * s, 0.25f / s, (r.m[1][2] + r.m[2][1]) * s, (r.m[0][2] - r.m[2][0]) * s};
+        }
+        const float s = 0.5f / std::sqrt(1.0f + r.m[2][2] - r.m[0][0] - r.m[1][1]);
+        return {(r.m[0][2] + r.m[2][0]) * s, (r.m[1][2] + r.m[2][1]) * s, 0.25f / s, (r.m[1][0] - r.m[0][1]) * s};
+    }
+
+    /**
+     * @brief Rotation part of a matrix whose upper 3x3 block is orthonormal.
+     */
+    static Quaternion fromMat4(const mat4& m) noexcept {
+        Rotation3 r;
+        for (int i = 0; i < 3; ++i)
+            for (int j = 0; j < 3; ++j)
+                r.m[i][j] = m.m[i][j];
+        return fromRotation3(r);
+    }
+
+    /**
+     * @brief Equivalent rotation matrix. The quaternion must be normalized.
+     */
+    constexpr Rotation3 toRotation3() const noexcept {
+        const float xx = x * x, yy = y * y, zz = z * z;
+        const float xy = x * y, xz = x * z, yz = y * z;
+        const float wx = w * x, wy = w * y, wz = w * z;
+        Rotation3 r;
+        r.m[0][0] = 1.0f - 2.0f * (yy + zz);
+        r.m[0][1] = 2.0f * (xy - wz);
+        r.m[0][2] = 2.0f * (xz + wy);
+        r.m[1][0] = 2.0f * (xy + wz);
+        r.m[1][1] = 1.0f - 2.0f * (xx + zz);
+        r.m[1][2] = 2.0f * (yz - wx);
+        r.m[2][0] = 2.0f * (xz - wy);
+        r.m[2][1] = 2.0f * (yz + wx);
+        r.m[2][2] = 1.0f - 2.0f * (xx + yy);
+        return r;
+    }
+
+    /** @brief Rotation matrix with zero translation. The quaternion must be normalized. */
+    mat4 toMat4() const noexcept { return toRotation3().toMat4(); }
+
+    // --- Algebra ---
+
+    /** @brief Hamilton product: rotates by rhs, then by *this. */
+    constexpr Quaternion operator*(const Quaternion& rhs) const noexcept {
+        return {
+            w * rhs.x + x * rhs.w + y * rhs.z - z * rhs.y,
+            w * rhs.y - x * rhs.z + y * rhs.w + z * rhs.x,
+            w * rhs.z + x * rhs.y - y * rhs.x + z * rhs.w,
+            w * rhs.w - x * rhs.x - y * rhs.y - z * rhs.z,
+        };
+    }
+
+    /** @brief Four-component dot product; |dot| is the cosine of half the angle between rotations. */
+    constexpr float dot(const Quaternion& rhs) const noexcept {
+        return x * rhs.x + y * rhs.y + z * rhs.z + w * rhs.w;
+    }
+
+    constexpr float lengthSquared() const noexcept { return dot(*this); }
+
+    float length() const noexcept { return std::sqrt(lengthSquared()); }
+
+    /**
+     * @brief Returns a unit-length copy.
+     *
+     * @note The zero quaternion produces NaN components.
+     */
+    Quaternion normalized() const noexcept {
+        const float len = length();
+        return {x / len, y / len, z / len, w / len};
+    }
+
+    /** @brief Normalizes in place. */
+    void normalize() noexcept { *this = normalized(); }
+
+    /** @brief (-x, -y, -z, w); the inverse rotation for unit quaternions. */
+    constexpr Quaternion conjugate() const noexcept { return {-x, -y, -z, w}; }
+
+    /** @brief Inverse of any non-zero quaternion. Prefer conjugate() for unit ones. */
+    constexpr Quaternion inverse() const noexcept {
+        const float inv = 1.0f / lengthSquared();
+        return {-x * inv, -y * inv, -z * inv, w * inv};
+    }
+};
+
+static_assert(std::is_trivially_copyable_v<Quaternion>, "Quaternion must stay trivially copyable");
+static_assert(sizeof(Quaternion) == 4 * sizeof(float), "Quaternion must stay tightly packed");
+
+// --- Rotating vectors ---
+
+/**
+ * @brief q * v * q^-1 for a unit quaternion, without building a matrix.
+ *
+ * Uses v + w t + u x t with t = 2 u x v (u the vector part).
+ */
+constexpr Vector3 rotate(const Quaternion& q, const Vector3& v) noexcept {
+    const Vector3 u(q.x, q.y, q.z);
+    const Vector3 t = (u + u).cross(v);
+    return v + t * q.w + u.cross(t);
+}
+
+/**
+ * @brief out[i] = rotate(q.toRotation3(), in[i]). out.size() must be >= in.size().
+ *
+ * Converts q once, so results can differ from rotate(q, v) in the last bit.
+ */
+void rotate(const Quaternion& q, std::span<const Vector3> in, std::span<Vector3> out) noexcept;
+
+/**
+ * @brief SoA rotate; out is resized to in.size() and may be in itself.
+ */
+void rotate(const Quaternion& q, const Vector3SoA& in, Vector3SoA& out);
+
+// --- Interpolation ---
+
+/**
+ * @brief Normalized linear interpolation along the shorter arc.
+ *
+ * Cheaper than slerp and close to it for small angles; the angular speed is
+ * not constant across t.
+ */
+Quaternion nlerp(const Quaternion& a, const Quaternion& b, float t) noexcept;
+
+/**
+ * @brief Spherical linear interpolation along the shorter arc.
+ *
+ * Evaluated with polynomial acos/sin approximations (about 1e-6 from the
+ * exact result) so the batch overload can run it in SIMD lanes. Identical
+ * inputs and t = 0 or 1 need no special casing.
+ */
+Quaternion slerp(const Quaternion& a, const Quaternion& b, float t) noexcept;
+
+/**
+ * @brief out[i] = nlerp(a[i], b[i], t). Sizes must match; out.size() must be >= a.size().
+ */
+void nlerp(std::span<const Quaternion> a, std::span<const Quaternion> b, float t, std::span<Quaternion> out) noexcept;
+
+/**
+ * @brief out[i] = slerp(a[i], b[i], t). Sizes must match; out.size() must be >= a.size().
+ */
+void slerp(std::span<const Quaternion> a, std::span<const Quaternion> b, float t, std::span<Quaternion> out) noexcept;
+
+} // namespace math
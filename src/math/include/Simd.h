@@ -0,0 +1,132 @@
+#pragma once
+
+/**
+ * @file Simd.h
+ * @brief SIMD backend for the math library.
+ *
+ * Two layers live here:
+ *  - Compile-time inline helpers on 128-bit registers (SSE2 is part of the
+ *    x86-64 baseline, so no runtime check is needed for them).
+ *  - Runtime-dispatched kernels for the heavier operations (mat4 x mat4,
+ *    mat4 x Vector4). The best backend the CPU supports is picked once on
+ *    first use; a scalar implementation is always available.
+ *
+ * Every SIMD kernel performs the same float operations in the same order as
+ * its scalar counterpart and never uses FMA, so all backends produce
+ * bit-identical results. Keep it that way when adding kernels.
+ *
+ * Define AURELION_MATH_SCALAR (CMake: AURELION_MATH_SIMD=OFF) to compile the
+ * scalar paths only.
+ */
+
+#if !defined(AURELION_MATH_SCALAR) && (defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2))
+#define AURELION_SIMD_SSE 1
+#include <immintrin.h>
+#else
+#define AURELION_SIMD_SSE 0
+#endif
+
+// Marks a function as compiled for AVX without enabling AVX for the whole
+// translation unit (which would leak AVX code into shared inline functions).
+#if AURELION_SIMD_SSE && (defined(__GNUC__) || defined(__clang__))
+#define AURELION_TARGET_AVX __attribute__((target("avx")))
+#else
+#define AURELION_TARGET_AVX
+#endif
+
+namespace math::simd {
+
+/**
+ * @brief Kernel implementations selectable at runtime.
+ */
+enum class Backend {
+    Scalar, /**< Portable scalar code, always available. */
+    Sse,    /**< 128-bit SSE2 kernels. */
+    Avx     /**< 256-bit AVX kernels. */
+};
+
+/**
+ * @brief Returns whether the running CPU (and this build) can execute a backend.
+ */
+bool isSupported(Backend backend) noexcept;
+
+/**
+ * @brief Returns the backend currently used by the dispatched kernels.
+ *
+ * Defaults to the widest supported backend.
+ */
+Backend activeBackend() noexcept;
+
+/**
+ * @brief Overrides the dispatched backend.
+ *
+ * Intended for tests and benchmarks that compare backends.
+ *
+ * @param backend The backend to use.
+ * @return false (and no change) if the backend is not supported.
+ */
+bool setBackend(Backend backend) noexcept;
+
+/**
+ * @brief Human-readable backend name ("scalar", "sse", "avx").
+ */
+const char* backendName(Backend backend) noexcept;
+
+/**
+ * @brief out = a * b for row-major 4x4 matrices.
+ *
+ * @param a Left matrix, 16 floats.
+ * @param b Right matrix, 16 floats.
+ * @param out Result, 16 floats. Must not alias a or b.
+ */
+void mat4Mul(const float* a, const float* b, float* out) noexcept;
+
+/**
+ * @brief out = m * v for a row-major 4x4 matrix and a column vector.
+ *
+ * @param m Matrix, 16 floats.
+ * @param v Vector, 4 floats.
+ * @param out Result, 4 floats. Must not alias v.
+ */
+void mat4MulVec4(const float* m, const float* v, float* out) noexcept;
+
+// --- Inline 128-bit helpers ---
+
+/**
+ * @brief Four-component dot product in the library's canonical order.
+ *
+ * The sum is reduced pairwise as (x + z) + (y + w); the scalar Vector4::dot
+ * uses the same order so both paths agree bit for bit.
+ */
+inline float dot4Scalar(const float* a, const float* b) noexcept {
+    return (a[0] * b[0] + a[2] * b[2]) + (a[1] * b[1] + a[3] * b[3]);
+}
+
+#if AURELION_SIMD_SSE
+
+/**
+ * @brief Dot product of two registers, same reduction order as dot4Scalar.
+ */
+inline float dot4(__m128 a, __m128 b) noexcept {
+    __m128 p = _mm_mul_ps(a, b);
+    __m128 s = _mm_add_ps(p, _mm_movehl_ps(p, p));          // (x+z, y+w, ...)
+    s = _mm_add_ss(s, _mm_shuffle_ps(s, s, _MM_SHUFFLE(1, 1, 1, 1)));
+    return _mm_cvtss_f32(s);
+}
+
+/**
+ * @brief Cross product of the xyz lanes of two registers; w of the result is 0.
+ *
+ * Lane-for-lane identical to Vector3::cross.
+ */
+inline __m128 cross3(__m128 a, __m128 b) noexcept {
+    __m128 aYzx = _mm_shuffle_ps(a, a, _MM_SHUFFLE(3, 0, 2, 1));
+    __m128 aZxy = _mm_shuffle_ps(a, a, _MM_SHUFFLE(3, 1, 0, 2));
+    __m128 bYzx = _mm_shuffle_ps(b, b, _MM_SHUFFLE(3, 0, 2, 1));
+    __m128 bZxy = _mm_shuffle_ps(b, b, _MM_SHUFFLE(3, 1, 0, 2));
+    return _mm_sub_ps(_mm_mul_ps(aYzx, bZxy), _mm_mul_ps(aZxy, bYzx));
+}
+
+#endif // AURELION_SIMD_SSE
+
+} // namespace math::simd
@@ -0,0 +1,196 @@
+#pragma once
+
+#include <bit>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+
+#include "Simd.h"
+
+/**
+ * @file SimdPack.h
+ * @brief Lane-generic register wrappers for writing bulk kernels once.
+ *
+ * A bulk kernel is written as a template over a pack type and instantiated
+ * for PackSse (4 lanes) and PackScalar (1 lane). Both packs perform the same
+ * IEEE operation per lane, so the scalar instantiation doubles as the tail
+ * loop and as the bit-identical fallback for Backend::Scalar.
+ *
+ * Loads and stores are unaligned; on current CPUs they cost the same as
+ * aligned ones when the address happens to be aligned.
+ */
+
+namespace math::simd {
+
+/**
+ * @brief One float per "register". Reference semantics for every pack.
+ */
+struct PackScalar {
+    using Reg = float;
+    static constexpr std::size_t WIDTH = 1;
+
+    static Reg load(const float* p) noexcept { return *p; }
+    static void store(float* p, Reg v) noexcept { *p = v; }
+    static Reg set1(float f) noexcept { return f; }
+    static Reg zero() noexcept { return 0.0f; }
+
+    static Reg add(Reg a, Reg b) noexcept { return a + b; }
+    static Reg sub(Reg a, Reg b) noexcept { return a - b; }
+    static Reg mul(Reg a, Reg b) noexcept { return a * b; }
+    static Reg div(Reg a, Reg b) noexcept { return a / b; }
+    static Reg sqrt(Reg a) noexcept { return std::sqrt(a); }
+    // Same operand rules as minps/maxps: the second operand wins on NaN or ties
+    static Reg min(Reg a, Reg b) noexcept { return a < b ? a : b; }
+    static Reg max(Reg a, Reg b) noexcept { return a > b ? a : b; }
+    /** @brief |magnitude| with the sign bit of sign. */
+    static Reg copySign(Reg magnitude, Reg sign) noexcept { return std::copysign(magnitude, sign); }
+
+    /** @brief Per lane: mask != 0 ? a : b. */
+    static Reg selectNonZero(Reg mask, Reg a, Reg b) noexcept { return mask != 0.0f ? a : b; }
+
+    // Masks have every bit of a lane set (a NaN) or none, as cmpltps produces
+    static Reg lessThan(Reg a, Reg b) noexcept { return a < b ? std::bit_cast<float>(~0u) : 0.0f; }
+    static Reg maskAnd(Reg a, Reg b) noexcept {
+        return std::bit_cast<float>(std::bit_cast<std::uint32_t>(a) & std::bit_cast<std::uint32_t>(b));
+    }
+    /** @brief Bit k set if lane k of the mask is. */
+    static int moveMask(Reg mask) noexcept { return static_cast<int>(std::bit_cast<std::uint32_t>(mask) >> 31); }
+
+    static float reduceMin(Reg a) noexcept { return a; }
+    static float reduceMax(Reg a) noexcept { return a; }
+
+    /** @brief Lane k = base[index[k]]. */
+    static Reg gather(const float* base, const std::uint32_t* index) noexcept { return base[index[0]]; }
+
+    /** @brief base[index[k]] = lane k; indices must be distinct. */
+    static void scatter(float* base, const std::uint32_t* index, Reg v) noexcept { base[index[0]] = v; }
+
+    // Stride-3 (Vector3 array) access exists only on the scalar pack: compilers
+    // SLP-vectorize a scalar xyz loop better than an explicit 4-record
+    // deinterleave, which is shuffle-port bound.
+
+    /** @brief Loads one interleaved xyz record. */
+    static void loadXyz(const float* p, Reg& x, Reg& y, Reg& z) noexcept {
+        x = p[0]; y = p[1]; z = p[2];
+    }
+
+    /** @brief Inverse of loadXyz. */
+    static void storeXyz(float* p, Reg x, Reg y, Reg z) noexcept {
+        p[0] = x; p[1] = y; p[2] = z;
+    }
+
+    /** @brief Loads WIDTH interleaved xyzw records (AoS, stride 4) as four lane registers. */
+    static void loadXyzw(const float* p, Reg& x, Reg& y, Reg& z, Reg& w) noexcept {
+        x = p[0]; y = p[1]; z = p[2]; w = p[3];
+    }
+
+    /** @brief Inverse of loadXyzw. */
+    static void storeXyzw(float* p, Reg x, Reg y, Reg z, Reg w) noexcept {
+        p[0] = x; p[1] = y; p[2] = z; p[3] = w;
+    }
+};
+
+#if AURELION_SIMD_SSE
+
+/**
+ * @brief Four floats in one SSE register.
+ */
+struct PackSse {
+    using Reg = __m128;
+    static constexpr std::size_t WIDTH = 4;
+
+    static Reg load(const float* p) noexcept { return _mm_loadu_ps(p); }
+    static void store(float* p, Reg v) noexcept { _mm_storeu_ps(p, v); }
+    static Reg set1(float f) noexcept { return _mm_set1_ps(f); }
+    static Reg zero() noexcept { return _mm_setzero_ps(); }
+
+    static Reg add(Reg a, Reg b) noexcept { return _mm_add_ps(a, b); }
+    static Reg sub(Reg a, Reg b) noexcept { return _mm_sub_ps(a, b); }
+    static Reg mul(Reg a, Reg b) noexcept { return _mm_mul_ps(a, b); }
+    static Reg div(Reg a, Reg b) noexcept { return _mm_div_ps(a, b); }
+    static Reg sqrt(Reg a) noexcept { return _mm_sqrt_ps(a); }
+    static Reg min(Reg a, Reg b) noexcept { return _mm_min_ps(a, b); }
+    static Reg max(Reg a, Reg b) noexcept { return _mm_max_ps(a, b); }
+    static Reg copySign(Reg magnitude, Reg sign) noexcept {
+        const Reg signBit = _mm_set1_ps(-0.0f);
+        return _mm_or_ps(_mm_andnot_ps(signBit, magnitude), _mm_and_ps(signBit, sign));
+    }
+
+    static Reg selectNonZero(Reg mask, Reg a, Reg b) noexcept {
+        const Reg nonZero = _mm_cmpneq_ps(mask, _mm_setzero_ps());
+        return _mm_or_ps(_mm_and_ps(nonZero, a), _mm_andnot_ps(nonZero, b));
+    }
+
+    static Reg lessThan(Reg a, Reg b) noexcept { return _mm_cmplt_ps(a, b); }
+    static Reg maskAnd(Reg a, Reg b) noexcept { return _mm_and_ps(a, b); }
+    static int moveMask(Reg mask) noexcept { return _mm_movemask_ps(mask); }
+
+    static float reduceMin(Reg a) noexcept {
+        a = _mm_min_ps(a, _mm_movehl_ps(a, a));
+        a = _mm_min_ss(a, _mm_shuffle_ps(a, a, _MM_SHUFFLE(1, 1, 1, 1)));
+        return _mm_cvtss_f32(a);
+    }
+
+    static float reduceMax(Reg a) noexcept {
+        a = _mm_max_ps(a, _mm_movehl_ps(a, a));
+        a = _mm_max_ss(a, _mm_shuffle_ps(a, a, _MM_SHUFFLE(1, 1, 1, 1)));
+        return _mm_cvtss_f32(a);
+    }
+
+    // Built from scalar loads: SSE has no gather, and going through a stack
+    // array instead would stall on store forwarding.
+    static Reg gather(const float* base, const std::uint32_t* index) noexcept {
+        return _mm_setr_ps(base[index[0]], base[index[1]], base[index[2]], base[index[3]]);
+    }
+
+    static void scatter(float* base, const std::uint32_t* index, Reg v) noexcept {
+        alignas(16) float lanes[4];
+        _mm_store_ps(lanes, v);
+        base[index[0]] = lanes[0];
+        base[index[1]] = lanes[1];
+        base[index[2]] = lanes[2];
+        base[index[3]] = lanes[3];
+    }
+
+    static void loadXyzw(const float* p, Reg& x, Reg& y, Reg& z, Reg& w) noexcept {
+        x = _mm_loadu_ps(p);
+        y = _mm_loadu_ps(p + 4);
+        z = _mm_loadu_ps(p + 8);
+        w = _mm_loadu_ps(p + 12);
+        _MM_TRANSPOSE4_PS(x, y, z, w);
+    }
+
+    static void storeXyzw(float* p, Reg x, Reg y, Reg z, Reg w) noexcept {
+        _MM_TRANSPOSE4_PS(x, y, z, w);
+        _mm_storeu_ps(p, x);
+        _mm_storeu_ps(p + 4, y);
+        _mm_storeu_ps(p + 8, z);
+        _mm_storeu_ps(p + 12, w);
+    }
+};
+
+#endif // AURELION_SIMD_SSE
+
+/**
+ * @brief Runs body.template operator()<Pack>(begin, end) over [0, count).
+ *
+ * The widest available pack covers the largest multiple of its width and
+ * PackScalar finishes the tail. With Backend::Scalar active everything runs
+ * on PackScalar.
+ *
+ * @param count Number of elements.
+ * @param body Callable with a template call operator taking (begin, end).
+ */
+template <typename Body>
+void forEachPack(std::size_t count, Body&& body) {
+    std::size_t done = 0;
+#if AURELION_SIMD_SSE
+    if (activeBackend() != Backend::Scalar) {
+        done = count - count % PackSse::WIDTH;
+        body.template operator()<PackSse>(std::size_t{0}, done);
+    }
+#endif
+    body.template operator()<PackScalar>(done, count);
+}
+
+} // namespace math::simd
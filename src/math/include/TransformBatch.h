@@ -0,0 +1,95 @@
+#pragma once
+
+#include <span>
+
+#include "Mat4.h"
+#include "Vector3.h"
+#include "Vector3SoA.h"
+#include "Vector4.h"
+
+/**
+ * @file TransformBatch.h
+ * @brief Applying a mat4 to single vectors and to whole arrays of them.
+ *
+ * Points are transformed with an implicit w = 1, directions with w = 0.
+ * The "Projective" variants also divide by the resulting w (use them after a
+ * projection matrix); the others assume an affine matrix and ignore row 3.
+ *
+ * Batch functions give the same bits as the single-vector functions. SoA and
+ * Vector4 batches are explicit SIMD kernels (see SimdPack.h); Vector3 arrays
+ * use a scalar body the compiler vectorizes. They keep no state, so large
+ * inputs can be split into disjoint sub-spans and processed concurrently.
+ * Input and output may be the same span, but must not partially overlap.
+ */
+
+namespace math {
+
+// --- Single vectors ---
+
+/**
+ * @brief m * (p, 1), dropping w.
+ */
+inline Vector3 transformPoint(const mat4& m, const Vector3& p) noexcept {
+    return {
+        m.m[0][0] * p.x + m.m[0][1] * p.y + m.m[0][2] * p.z + m.m[0][3],
+        m.m[1][0] * p.x + m.m[1][1] * p.y + m.m[1][2] * p.z + m.m[1][3],
+        m.m[2][0] * p.x + m.m[2][1] * p.y + m.m[2][2] * p.z + m.m[2][3],
+    };
+}
+
+/**
+ * @brief m * (d, 0), dropping w. Translation does not apply.
+ */
+inline Vector3 transformDirection(const mat4& m, const Vector3& d) noexcept {
+    return {
+        m.m[0][0] * d.x + m.m[0][1] * d.y + m.m[0][2] * d.z,
+        m.m[1][0] * d.x + m.m[1][1] * d.y + m.m[1][2] * d.z,
+        m.m[2][0] * d.x + m.m[2][1] * d.y + m.m[2][2] * d.z,
+    };
+}
+
+/**
+ * @brief m * (p, 1) followed by the perspective divide by w.
+ *
+ * @note Points on the camera plane (w == 0) produce inf/nan.
+ */
+inline Vector3 transformPointProjective(const mat4& m, const Vector3& p) noexcept {
+    const float w = m.m[3][0] * p.x + m.m[3][1] * p.y + m.m[3][2] * p.z + m.m[3][3];
+    return transformPoint(m, p) / w;
+}
+
+// --- Arrays (AoS) ---
+
+/**
+ * @brief out[i] = transformPoint(m, in[i]). out.size() must be >= in.size().
+ */
+void transformPoints(const mat4& m, std::span<const Vector3> in, std::span<Vector3> out) noexcept;
+
+/**
+ * @brief out[i] = transformDirection(m, in[i]). out.size() must be >= in.size().
+ */
+void transformDirections(const mat4& m, std::span<const Vector3> in, std::span<Vector3> out) noexcept;
+
+/**
+ * @brief out[i] = transformPointProjective(m, in[i]). out.size() must be >= in.size().
+ */
+void transformPointsProjective(const mat4& m, std::span<const Vector3> in, std::span<Vector3> out) noexcept;
+
+/**
+ * @brief out[i] = m * in[i] for homogeneous vectors. out.size() must be >= in.size().
+ */
+void transformVectors(const mat4& m, std::span<const Vector4> in, std::span<Vector4> out) noexcept;
+
+// --- Arrays (SoA) ---
+
+/**
+ * @brief SoA transformPoints; out is resized to in.size() and may be in itself.
+ */
+void transformPoints(const mat4& m, const Vector3SoA& in, Vector3SoA& out);
+
+/**
+ * @brief SoA transformDirections; out is resized to in.size() and may be in itself.
+ */
+void transformDirections(const mat4& m, const Vector3SoA& in, Vector3SoA& out);
+
+} // namespace math
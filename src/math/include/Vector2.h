@@ -2,9 +2,11 @@
 
 #include <cmath>
 #include <iostream>
+#include <type_traits>
 
 namespace math
 {
+    // Header-only and trivially copyable, like Vector3: all operations are inline.
     class Vector2
     {
     public:
@@ -12,32 +14,72 @@ namespace math
         float y;
 
         // --- Constructors ---
-        Vector2();
-        Vector2(float x, float y);
-        Vector2(const Vector2 &other);
+        constexpr Vector2() noexcept : x(0.0f), y(0.0f) {}
+        constexpr Vector2(float x, float y) noexcept : x(x), y(y) {}
 
         // --- Basic arithmetic operations ---
-        Vector2 operator+(const Vector2 &rhs) const;
-        Vector2 operator-(const Vector2 &rhs) const;
-        Vector2 operator*(float scalar) const;
-        Vector2 operator/(float scalar) const;
+        constexpr Vector2 operator+(const Vector2 &rhs) const noexcept { return {x + rhs.x, y + rhs.y}; }
+        constexpr Vector2 operator-(const Vector2 &rhs) const noexcept { return {x - rhs.x, y - rhs.y}; }
+        constexpr Vector2 operator*(float scalar) const noexcept { return {x * scalar, y * scalar}; }
+        constexpr Vector2 operator/(float scalar) const noexcept { return {x / scalar, y / scalar}; } // TODO: handle divide by zero
 
         // --- Compound assignment operators ---
-        Vector2 &operator+=(const Vector2 &rhs);
-        Vector2 &operator-=(const Vector2 &rhs);
-        Vector2 &operator*=(float scalar);
-        Vector2 &operator/=(float scalar);
+        constexpr Vector2 &operator+=(const Vector2 &rhs) noexcept
+        {
+            x += rhs.x; y += rhs.y;
+            return *this;
+        }
+
+        constexpr Vector2 &operator-=(const Vector2 &rhs) noexcept
+        {
+            x -= rhs.x; y -= rhs.y;
+            return *this;
+        }
+
+        constexpr Vector2 &operator*=(float scalar) noexcept
+        {
+            x *= scalar; y *= scalar;
+            return *this;
+        }
+
+        constexpr Vector2 &operator/=(float scalar) noexcept
+        {
+            x /= scalar; y /= scalar; // TODO: handle divide by zero
+            return *this;
+        }
 
         // --- Vector operations ---
-        float length() const;
-        float lengthSquared() const;
-        Vector2 normalized() const;
-        void normalize();
-        float dot(const Vector2 &rhs) const;
-        float cross(const Vector2 &rhs) const; // Note: In 2D, this returns a scalar representing the z-component of the 3D cross product.
+        float length() const noexcept { return std::sqrt(lengthSquared()); }
+        constexpr float lengthSquared() const noexcept { return x * x + y * y; }
+
+        Vector2 normalized() const noexcept
+        {
+            float len = length();
+            if (len == 0.0f) return {0.0f, 0.0f};
+            return {x / len, y / len};
+        }
+
+        void normalize() noexcept
+        {
+            float len = length();
+            if (len != 0.0f)
+            {
+                x /= len;
+                y /= len;
+            }
+        }
+
+        constexpr float dot(const Vector2 &rhs) const noexcept { return x * rhs.x + y * rhs.y; }
+        // Note: In 2D, this returns a scalar representing the z-component of the 3D cross product.
+        constexpr float cross(const Vector2 &rhs) const noexcept { return x * rhs.y - y * rhs.x; }
 
         // --- Debugging / Utility ---
-        friend std::ostream &operator<<(std::ostream &os, const Vector2 &v);
+        friend std::ostream &operator<<(std::ostream &os, const Vector2 &v)
+        {
+            return os << "(" << v.x << ", " << v.y << ")";
+        }
     };
 
-} // namespace math
\ No newline at end of file
+    static_assert(std::is_trivially_copyable_v<Vector2>, "Vector2 must stay trivially copyable");
+
+} // namespace math
@@ -2,6 +2,7 @@
 
 #include <cmath>
 #include <iostream>
+#include <type_traits>
 
 namespace math {
 
@@ -13,6 +14,10 @@ namespace math {
  * and utility functions. Designed to be self-contained and used throughout AURELION
  * for physics, rendering, and transformations.
  *
+ * The class is header-only and trivially copyable: every operation is inline
+ * (and constexpr where the standard allows), so hot loops never pay for an
+ * out-of-line call.
+ *
  * Example usage:
  * @code
  * math::Vector3 a(1.0f, 2.0f, 3.0f);
@@ -35,7 +40,7 @@ public:
      *
      * Initializes all components to zero (0, 0, 0).
      */
-    Vector3();
+    constexpr Vector3() noexcept : x(0.0f), y(0.0f), z(0.0f) {}
 
     /**
      * @brief Constructs a vector with specified components.
@@ -44,22 +49,10 @@ public:
      * @param y The y component.
      * @param z The z component.
      */
-    Vector3(float x, float y, float z);
+    constexpr Vector3(float x, float y, float z) noexcept : x(x), y(y), z(z) {}
 
-    /**
-     * @brief Copy constructor.
-     *
-     * @param other The vector to copy from.
-     */
-    Vector3(const Vector3& other);
-
-    /**
-     * @brief Assignment operator.
-     *
-     * @param other The vector to assign from.
-     * @return Reference to this vector.
-     */
-    Vector3& operator=(const Vector3& other);
+    // Copy/move construction and assignment are left implicit so that Vector3
+    // stays trivially copyable (memcpy-able, vectorizer friendly).
 
     // --- Basic arithmetic operations ---
 
@@ -69,7 +62,9 @@ public:
      * @param rhs The vector to add.
      * @return A new Vector3 representing the sum.
      */
-    Vector3 operator+(const Vector3& rhs) const;
+    constexpr Vector3 operator+(const Vector3& rhs) const noexcept {
+        return {x + rhs.x, y + rhs.y, z + rhs.z};
+    }
 
     /**
      * @brief Vector subtraction.
@@ -77,7 +72,9 @@ public:
      * @param rhs The vector to subtract.
      * @return A new Vector3 representing the difference.
      */
-    Vector3 operator-(const Vector3& rhs) const;
+    constexpr Vector3 operator-(const Vector3& rhs) const noexcept {
+        return {x - rhs.x, y - rhs.y, z - rhs.z};
+    }
 
     /**
      * @brief Scalar multiplication.
@@ -85,7 +82,9 @@ public:
      * @param scalar The scalar value to multiply by.
      * @return A new Vector3 scaled by the given scalar.
      */
-    Vector3 operator*(float scalar) const;
+    constexpr Vector3 operator*(float scalar) const noexcept {
+        return {x * scalar, y * scalar, z * scalar};
+    }
 
     /**
      * @brief Scalar division.
@@ -95,7 +94,9 @@ public:
      *
      * @note Behavior is undefined if scalar is zero.
      */
-    Vector3 operator/(float scalar) const;
+    constexpr Vector3 operator/(float scalar) const noexcept {
+        return {x / scalar, y / scalar, z / scalar};
+    }
 
     // --- Compound assignment operators ---
 
@@ -105,7 +106,10 @@ public:
      * @param rhs The vector to add.
      * @return Reference to this vector after addition.
      */
-    Vector3& operator+=(const Vector3& rhs);
+    constexpr Vector3& operator+=(const Vector3& rhs) noexcept {
+        x += rhs.x; y += rhs.y; z += rhs.z;
+        return *this;
+    }
 
     /**
      * @brief Compound subtraction assignment.
@@ -113,7 +117,10 @@ public:
      * @param rhs The vector to subtract.
      * @return Reference to this vector after subtraction.
      */
-    Vector3& operator-=(const Vector3& rhs);
+    constexpr Vector3& operator-=(const Vector3& rhs) noexcept {
+        x -= rhs.x; y -= rhs.y; z -= rhs.z;
+        return *this;
+    }
 
     /**
      * @brief Compound multiplication assignment (scalar).
@@ -121,7 +128,10 @@ public:
      * @param scalar The scalar to multiply by.
      * @return Reference to this vector after scaling.
      */
-    Vector3& operator*=(float scalar);
+    constexpr Vector3& operator*=(float scalar) noexcept {
+        x *= scalar; y *= scalar; z *= scalar;
+        return *this;
+    }
 
     /**
      * @brief Compound division assignment (scalar).
@@ -131,7 +141,10 @@ public:
      *
      * @note Behavior is undefined if scalar is zero.
      */
-    Vector3& operator/=(float scalar);
+    constexpr Vector3& operator/=(float scalar) noexcept {
+        x /= scalar; y /= scalar; z /= scalar;
+        return *this;
+    }
 
     // --- Vector operations ---
 
@@ -140,14 +153,18 @@ public:
      *
      * @return The Euclidean length of the vector.
      */
-    float length() const;
+    float length() const noexcept {
+        return std::sqrt(lengthSquared());
+    }
 
     /**
      * @brief Computes the squared length of the vector.
      *
      * @return The squared Euclidean length (avoids sqrt, useful for comparisons).
      */
-    float lengthSquared() const;
+    constexpr float lengthSquared() const noexcept {
+        return x*x + y*y + z*z;
+    }
 
     /**
      * @brief Returns a normalized (unit length) copy of the vector.
@@ -156,14 +173,22 @@ public:
      *
      * @note If the vector has zero length, returns (0,0,0).
      */
-    Vector3 normalized() const;
+    Vector3 normalized() const noexcept {
+        float len = length();
+        if (len == 0) return {0, 0, 0};
+        return *this / len;
+    }
 
     /**
      * @brief Normalizes this vector in-place to unit length.
      *
      * @note If the vector has zero length, it remains unchanged.
      */
-    void normalize();
+    void normalize() noexcept {
+        float len = length();
+        if (len == 0) return;
+        *this /= len;
+    }
 
     /**
      * @brief Computes the dot product with another vector.
@@ -174,7 +199,9 @@ public:
      * @note Measures similarity of direction; returns positive if same direction,
      * negative if opposite, zero if perpendicular.
      */
-    float dot(const Vector3& rhs) const;
+    constexpr float dot(const Vector3& rhs) const noexcept {
+        return x*rhs.x + y*rhs.y + z*rhs.z;
+    }
 
     /**
      * @brief Computes the cross product with another vector.
@@ -184,7 +211,13 @@ public:
      *
      * @note Follows right-hand rule.
      */
-    Vector3 cross(const Vector3& rhs) const;
+    constexpr Vector3 cross(const Vector3& rhs) const noexcept {
+        return {
+            y*rhs.z - z*rhs.y,
+            z*rhs.x - x*rhs.z,
+            x*rhs.y - y*rhs.x
+        };
+    }
 
     // --- Debugging / Utility ---
 
@@ -193,7 +226,11 @@ public:
      *
      * @note Useful for debugging purposes.
      */
-    void print() const;
+    void print() const {
+        std::cout << "(" << x << ", " << y << ", " << z << ")\n";
+    }
 };
 
+static_assert(std::is_trivially_copyable_v<Vector3>, "Vector3 must stay trivially copyable");
+
 } // namespace math
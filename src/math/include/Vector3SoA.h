@@ -0,0 +1,164 @@
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <span>
+
+#include "Vector3.h"
+
+namespace math {
+
+/**
+ * @class Vector3SoA
+ * @brief Structure-of-Arrays container of 3D vectors.
+ *
+ * Stores x[], y[] and z[] as three separate streams so bulk kernels can load
+ * four (or more) components of the same axis with one instruction, instead
+ * of shuffling 12-byte Vector3 records. Every stream starts on a 64-byte
+ * (cache line) boundary and its capacity is padded to a whole cache line.
+ *
+ * Elements are exchanged with the AoS world through get()/set()/pushBack().
+ *
+ * Example usage:
+ * @code
+ * math::Vector3SoA positions(count), velocities(count);
+ * // ... fill ...
+ * math::axpy(dt, velocities, positions); // positions += velocities * dt
+ * @endcode
+ */
+class Vector3SoA {
+public:
+    static constexpr std::size_t ALIGNMENT = 64; /**< Byte alignment of each stream. */
+
+    // --- Constructors ---
+
+    /**
+     * @brief Creates an empty container without allocating.
+     */
+    Vector3SoA() noexcept = default;
+
+    /**
+     * @brief Creates a container of count zero vectors.
+     *
+     * @param count Number of elements.
+     */
+    explicit Vector3SoA(std::size_t count);
+
+    Vector3SoA(const Vector3SoA& other);
+    Vector3SoA& operator=(const Vector3SoA& other);
+    Vector3SoA(Vector3SoA&& other) noexcept;
+    Vector3SoA& operator=(Vector3SoA&& other) noexcept;
+    ~Vector3SoA() = default;
+
+    // --- Size and capacity ---
+
+    std::size_t size() const noexcept { return count; }
+    std::size_t capacity() const noexcept { return cap; }
+    bool empty() const noexcept { return count == 0; }
+
+    /**
+     * @brief Grows the capacity to at least newCapacity elements.
+     *
+     * Invalidates stream pointers if a reallocation happens.
+     */
+    void reserve(std::size_t newCapacity);
+
+    /**
+     * @brief Resizes the container; new elements are zero vectors.
+     */
+    void resize(std::size_t newSize);
+
+    /**
+     * @brief Removes all elements; keeps the allocation.
+     */
+    void clear() noexcept { count = 0; }
+
+    // --- Element access ---
+
+    /**
+     * @brief Appends a vector, growing geometrically when full.
+     */
+    void pushBack(const Vector3& v);
+
+    /**
+     * @brief Removes an element in O(1) by moving the last element into its slot.
+     *
+     * @note Element order is not preserved.
+     */
+    void swapRemove(std::size_t index) noexcept;
+
+    Vector3 get(std::size_t index) const noexcept { return {xs[index], ys[index], zs[index]}; }
+
+    void set(std::size_t index, const Vector3& v) noexcept {
+        xs[index] = v.x;
+        ys[index] = v.y;
+        zs[index] = v.z;
+    }
+
+    // --- Streams ---
+
+    float* x() noexcept { return xs; }
+    float* y() noexcept { return ys; }
+    float* z() noexcept { return zs; }
+    const float* x() const noexcept { return xs; }
+    const float* y() const noexcept { return ys; }
+    const float* z() const noexcept { return zs; }
+
+private:
+    struct AlignedDelete {
+        void operator()(float* p) const noexcept;
+    };
+
+    void reallocate(std::size_t newCapacity);
+
+    std::unique_ptr<float[], AlignedDelete> storage;
+    float* xs = nullptr;
+    float* ys = nullptr;
+    float* zs = nullptr;
+    std::size_t count = 0;
+    std::size_t cap = 0;
+};
+
+// --- Bulk kernels ---
+// All kernels require equally sized inputs (checked with assert) and use the
+// SIMD backend selected in Simd.h; results match the per-element Vector3 code.
+
+/**
+ * @brief y[i] += a * x[i] for every element (e.g. p += v * dt).
+ */
+void axpy(float a, const Vector3SoA& x, Vector3SoA& y) noexcept;
+
+/**
+ * @brief out[i] = a[i].dot(b[i]).
+ *
+ * @param out Receives a.size() values.
+ */
+void dot(const Vector3SoA& a, const Vector3SoA& b, std::span<float> out) noexcept;
+
+/**
+ * @brief out[i] = a[i].cross(b[i]); out is resized to a.size().
+ */
+void cross(const Vector3SoA& a, const Vector3SoA& b, Vector3SoA& out);
+
+/**
+ * @brief out[i] = v[i].length().
+ *
+ * @param out Receives v.size() values.
+ */
+void length(const Vector3SoA& v, std::span<float> out) noexcept;
+
+/**
+ * @brief Normalizes every element in place; zero vectors stay zero.
+ */
+void normalize(Vector3SoA& v) noexcept;
+
+/**
+ * @brief Component-wise minimum and maximum over all elements.
+ *
+ * @param v The vectors to reduce.
+ * @param outMin Receives the per-axis minimum (+inf if v is empty).
+ * @param outMax Receives the per-axis maximum (-inf if v is empty).
+ */
+void minMax(const Vector3SoA& v, Vector3& outMin, Vector3& outMax) noexcept;
+
+} // namespace math
@@ -1,46 +1,161 @@
 #pragma once
 
+#include <cmath>
+#include <type_traits>
+
+#include "Simd.h"
+
 namespace math
 {
+    /**
+     * @class Vector4
+     * @brief Homogeneous 4D vector (x, y, z, w).
+     *
+     * Header-only and trivially copyable, like Vector3. Components are laid out
+     * x, y, z, w so a Vector4 maps directly onto one 128-bit register and onto
+     * a mat4 column. dot/length/normalize use SSE at runtime and the scalar
+     * code in constant evaluation; both give bit-identical results.
+     */
     class Vector4
     {
     public:
-        float wl; /**< The w component of the vector. */
-        float x;  /**< The x component of the vector. */
-        float y;  /**< The y component of the vector. */
-        float z;  /**< The z component of the vector. */
+        float x; /**< The x component of the vector. */
+        float y; /**< The y component of the vector. */
+        float z; /**< The z component of the vector. */
+        float w; /**< The w component of the vector. */
 
         // --- Constructors ---
-        Vector4();
-        Vector4(float wl, float x, float y, float z);
-        Vector4(const Vector4 &other);
+        constexpr Vector4() noexcept : x(0), y(0), z(0), w(0) {}
+        constexpr Vector4(float x, float y, float z, float w) noexcept : x(x), y(y), z(z), w(w) {}
 
         // --- Basic arithmetic operations ---
-        Vector4 operator=(const Vector4 &rhs) const;
-        Vector4 operator+(const Vector4 &rhs) const;
-        Vector4 operator-(const Vector4 &rhs) const;
-        Vector4 operator*(float scalar) const;
-        Vector4 operator/(float scalar) const;
+        constexpr Vector4 operator+(const Vector4 &rhs) const noexcept
+        {
+            return Vector4(x + rhs.x, y + rhs.y, z + rhs.z, w + rhs.w);
+        }
+
+        constexpr Vector4 operator-(const Vector4 &rhs) const noexcept
+        {
+            return Vector4(x - rhs.x, y - rhs.y, z - rhs.z, w - rhs.w);
+        }
+
+        constexpr Vector4 operator*(float scalar) const noexcept
+        {
+            return Vector4(x * scalar, y * scalar, z * scalar, w * scalar);
+        }
+
+        constexpr Vector4 operator/(float scalar) const noexcept
+        {
+            return Vector4(x / scalar, y / scalar, z / scalar, w / scalar);
+        }
 
         // --- Compound assignment operators ---
-        Vector4 &operator+=(const Vector4 &rhs);
-        Vector4 &operator-=(const Vector4 &rhs);
-        Vector4 &operator*=(float scalar);
-        Vector4 &operator/=(float scalar);
+        constexpr Vector4 &operator+=(const Vector4 &rhs) noexcept
+        {
+            x += rhs.x;
+            y += rhs.y;
+            z += rhs.z;
+            w += rhs.w;
+            return *this;
+        }
+
+        constexpr Vector4 &operator-=(const Vector4 &rhs) noexcept
+        {
+            x -= rhs.x;
+            y -= rhs.y;
+            z -= rhs.z;
+            w -= rhs.w;
+            return *this;
+        }
+
+        constexpr Vector4 &operator*=(float scalar) noexcept
+        {
+            x *= scalar;
+            y *= scalar;
+            z *= scalar;
+            w *= scalar;
+            return *this;
+        }
+
+        constexpr Vector4 &operator/=(float scalar) noexcept
+        {
+            x /= scalar;
+            y /= scalar;
+            z /= scalar;
+            w /= scalar;
+            return *this;
+        }
 
         // --- Vector operations ---
-        float length() const;
-        float lengthSquared() const;
-        Vector4 normalized() const;
+        float length() const noexcept
+        {
+            return std::sqrt(lengthSquared());
+        }
+
+        constexpr float lengthSquared() const noexcept
+        {
+            return dot(*this);
+        }
+
+        Vector4 normalized() const noexcept
+        {
+            float len = length();
+            if (len == 0)
+                return Vector4(0, 0, 0, 0);
+#if AURELION_SIMD_SSE
+            Vector4 result;
+            _mm_storeu_ps(&result.x, _mm_div_ps(_mm_loadu_ps(&x), _mm_set1_ps(len)));
+            return result;
+#else
+            return *this / len;
+#endif
+        }
+
+        void normalize() noexcept
+        {
+            *this = normalized();
+        }
 
         // --- Dot product ---
-        float dot(const Vector4 &other) const;
+        // Reduced pairwise as (x + z) + (y + w) to match the SSE kernel.
+        constexpr float dot(const Vector4 &other) const noexcept
+        {
+#if AURELION_SIMD_SSE
+            if !consteval
+            {
+                return simd::dot4(_mm_loadu_ps(&x), _mm_loadu_ps(&other.x));
+            }
+#endif
+            return (x * other.x + z * other.z) + (y * other.y + w * other.w);
+        }
+
         // --- Equality operators ---
-        bool operator==(const Vector4 &rhs) const;
-        bool operator!=(const Vector4 &rhs) const;
+        constexpr bool operator==(const Vector4 &rhs) const noexcept
+        {
+            return x == rhs.x && y == rhs.y && z == rhs.z && w == rhs.w;
+        }
+
+        constexpr bool operator!=(const Vector4 &rhs) const noexcept
+        {
+            return !(*this == rhs);
+        }
 
         // --- Utility ---
-        void set(float wl, float x, float y, float z);
-        void zero();
+        constexpr void set(float x_, float y_, float z_, float w_) noexcept
+        {
+            x = x_;
+            y = y_;
+            z = z_;
+            w = w_;
+        }
+
+        constexpr void zero() noexcept
+        {
+            x = y = z = w = 0;
+        }
     };
-}
\ No newline at end of file
+
+    static_assert(std::is_trivially_copyable_v<Vector4>, "Vector4 must stay trivially copyable");
+    static_assert(sizeof(Vector4) == 4 * sizeof(float), "Vector4 must map onto a 128-bit register");
+
+} // namespace math
@@ -0,0 +1,64 @@
+#include "include/BodySnapshot.h"
+
+#include <algorithm>
+#include <string>
+
+namespace physics {
+
+namespace {
+
+using core::SnapshotType;
+
+// Every saved stream, by suffix; Vector3 streams have three planes.
+struct Stream {
+    const char* suffix;
+    math::Vector3SoA RigidBodies::*vector;
+    math::AlignedArray<float> RigidBodies::*scalar;
+};
+
+constexpr Stream STREAMS[] = {
+    {".position", &RigidBodies::position, nullptr},
+    {".linearVelocity", &RigidBodies::linearVelocity, nullptr},
+    {".angularVelocity", &RigidBodies::angularVelocity, nullptr},
+    {".inverseInertia", &RigidBodies::inverseInertia, nullptr},
+    {".qx", nullptr, &RigidBodies::qx},
+    {".qy", nullptr, &RigidBodies::qy},
+    {".qz", nullptr, &RigidBodies::qz},
+    {".qw", nullptr, &RigidBodies::qw},
+    {".inverseMass", nullptr, &RigidBodies::inverseMass},
+};
+
+} // namespace
+
+void addToSnapshot(core::SnapshotWriter& writer, const RigidBodies& bodies, std::string_view prefix) {
+    for (const Stream& s : STREAMS) {
+        const std::string name = std::string(prefix) + s.suffix;
+        if (s.vector != nullptr) {
+            writer.addVector3(name, bodies.*s.vector);
+        } else {
+            writer.add(name, SnapshotType::Float32, bodies.size(), (bodies.*s.scalar).data());
+        }
+    }
+}
+
+bool restoreFromSnapshot(const core::SnapshotView& view, RigidBodies& bodies, std::string_view prefix) {
+    const std::size_t n = bodies.size();
+    for (const Stream& s : STREAMS) {
+        const core::SnapshotArrayRecord* r = view.find(std::string(prefix) + s.suffix);
+        const SnapshotType type = s.vector != nullptr ? SnapshotType::Vector3 : SnapshotType::Float32;
+        if (r == nullptr || r->type != type || r->count != n) return false;
+    }
+    for (const Stream& s : STREAMS) {
+        const std::string name = std::string(prefix) + s.suffix;
+        if (s.vector != nullptr) {
+            math::Vector3SoA& v = bodies.*s.vector;
+            float* planes[3] = {v.x(), v.y(), v.z()};
+            for (std::uint32_t p = 0; p < 3; ++p) std::ranges::copy(view.array<float>(name, p), planes[p]);
+        } else {
+            std::ranges::copy(view.array<float>(name), (bodies.*s.scalar).data());
+        }
+    }
+    return true;
+}
+
+} // namespace physics
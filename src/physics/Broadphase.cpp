@@ -0,0 +1,25 @@
+#include "include/Broadphase.h"
+
+#include <algorithm>
+
+namespace physics {
+
+namespace {
+
+template <typename Pairs>
+void sortAndDeduplicatePairs(Pairs& pairs) {
+    std::sort(pairs.begin(), pairs.end());
+    pairs.erase(std::unique(pairs.begin(), pairs.end()), pairs.end());
+}
+
+} // namespace
+
+void sortAndDeduplicate(std::vector<BroadphasePair>& pairs) {
+    sortAndDeduplicatePairs(pairs);
+}
+
+void sortAndDeduplicate(std::pmr::vector<BroadphasePair>& pairs) {
+    sortAndDeduplicatePairs(pairs);
+}
+
+} // namespace physics
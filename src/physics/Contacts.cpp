@@ -0,0 +1,221 @@
+#include "include/Contacts.h"
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+
+#include "include/FrameArena.h"
+#include "include/JobSystem.h"
+#include "include/Narrowphase.h"
+
+namespace physics {
+
+using math::Vector3;
+
+namespace {
+
+// Old impulses are only reused if the normal turned less than ~18 degrees
+constexpr float NORMAL_MATCH_COS = 0.95f;
+
+constexpr int MAX_CANDIDATES = CollisionResult::MAX_POINTS + ContactManifold::MAX_POINTS;
+
+struct Candidate {
+    ContactPoint point;
+    Vector3 world; // point on A, world space; used for matching and reduction
+};
+
+bool pairLess(const ContactManifold& m, const BroadphasePair& p) noexcept {
+    return m.bodyA != p.a ? m.bodyA < p.a : m.bodyB < p.b;
+}
+
+Pose bodyPose(const RigidBodies& bodies, std::size_t i) noexcept {
+    return {bodies.position.get(i), bodies.orientation(i).toRotation3()};
+}
+
+// Picks up to four candidates that keep the deepest point and span the most area
+int reduce(Candidate* c, int count, const Vector3& normal) noexcept {
+    if (count <= ContactManifold::MAX_POINTS) return count;
+    int chosen[4];
+
+    chosen[0] = 0;
+    for (int i = 1; i < count; ++i) {
+        if (c[i].point.separation < c[chosen[0]].point.separation) chosen[0] = i;
+    }
+    const Vector3 p0 = c[chosen[0]].world;
+
+    chosen[1] = chosen[0];
+    float best = -1.0f;
+    for (int i = 0; i < count; ++i) {
+        const float d = (c[i].world - p0).lengthSquared();
+        if (d > best) {
+            best = d;
+            chosen[1] = i;
+        }
+    }
+    const Vector3 p1 = c[chosen[1]].world;
+
+    chosen[2] = chosen[0];
+    best = -1.0f;
+    for (int i = 0; i < count; ++i) {
+        const float area = std::fabs((p1 - p0).cross(c[i].world - p0).dot(normal));
+        if (area > best) {
+            best = area;
+            chosen[2] = i;
+        }
+    }
+    const Vector3 p2 = c[chosen[2]].world;
+
+    // Fourth point: the one furthest outside the triangle, measured by the
+    // most negative signed area it forms with any triangle edge
+    const float winding = (p1 - p0).cross(p2 - p0).dot(normal) >= 0.0f ? 1.0f : -1.0f;
+    chosen[3] = chosen[0];
+    best = 0.0f;
+    const Vector3 tri[3] = {p0, p1, p2};
+    for (int i = 0; i < count; ++i) {
+        float outside = 0.0f;
+        for (int e = 0; e < 3; ++e) {
+            const Vector3& u = tri[e];
+            const Vector3& v = tri[(e + 1) % 3];
+            outside = std::min(outside, winding * (v - u).cross(c[i].world - u).dot(normal));
+        }
+        if (outside < best) {
+            best = outside;
+            chosen[3] = i;
+        }
+    }
+
+    Candidate picked[4];
+    int picks = 0;
+    for (int k = 0; k < 4; ++k) {
+        bool duplicate = false;
+        for (int j = 0; j < k; ++j) duplicate = duplicate || chosen[j] == chosen[k];
+        if (!duplicate) picked[picks++] = c[chosen[k]];
+    }
+    std::copy_n(picked, picks, c);
+    return picks;
+}
+
+// Index of the old point closest to world (on A) within distance, or -1
+int closestOld(const Candidate* old, int oldCount, const bool* used, const Vector3& world, float distance) noexcept {
+    int match = -1;
+    float bestSq = distance * distance;
+    for (int j = 0; j < oldCount; ++j) {
+        const float d = (old[j].world - world).lengthSquared();
+        if (!used[j] && d <= bestSq) {
+            bestSq = d;
+            match = j;
+        }
+    }
+    return match;
+}
+
+void collidePair(const RigidBodies& bodies, const BroadphasePair& pair, const ContactManifold* cached,
+                 const NarrowphaseSettings& settings, ContactManifold& out) noexcept {
+    out.bodyA = pair.a;
+    out.bodyB = pair.b;
+    out.pointCount = 0;
+
+    const Pose poseA = bodyPose(bodies, pair.a);
+    const Pose poseB = bodyPose(bodies, pair.b);
+    CollisionResult result;
+    if (!collide(bodies.shape[pair.a], poseA, bodies.shape[pair.b], poseB, settings.margin, result)) return;
+    out.normal = result.normal;
+
+    // Previous points moved with the bodies, back in world space
+    Candidate old[ContactManifold::MAX_POINTS];
+    bool used[ContactManifold::MAX_POINTS] = {};
+    int oldCount = 0;
+    if (cached != nullptr && cached->normal.dot(result.normal) > NORMAL_MATCH_COS) {
+        for (int j = 0; j < cached->pointCount; ++j) {
+            old[oldCount].point = cached->points[j];
+            old[oldCount].world = poseA.toWorld(cached->points[j].localA);
+            ++oldCount;
+        }
+    }
+
+    Candidate candidates[MAX_CANDIDATES];
+    int count = 0;
+    for (int i = 0; i < result.pointCount; ++i) {
+        const CollisionResult::Point& p = result.points[i];
+        Candidate& c = candidates[count++];
+        c.point = {poseA.toLocal(p.onA), poseB.toLocal(p.onB), p.separation};
+        c.world = p.onA;
+        const int match = closestOld(old, oldCount, used, p.onA, settings.matchDistance);
+        if (match >= 0) {
+            used[match] = true;
+            c.point.normalImpulse = old[match].point.normalImpulse;
+            c.point.tangentImpulse1 = old[match].point.tangentImpulse1;
+            c.point.tangentImpulse2 = old[match].point.tangentImpulse2;
+        }
+    }
+
+    if (result.incremental) {
+        // Keep old points that still touch and have not slid apart
+        for (int j = 0; j < oldCount; ++j) {
+            if (used[j]) continue;
+            const Vector3 onB = poseB.toWorld(old[j].point.localB);
+            const Vector3 d = onB - old[j].world;
+            const float separation = d.dot(result.normal);
+            const Vector3 drift = d - result.normal * separation;
+            if (separation > settings.margin || drift.lengthSquared() > settings.matchDistance * settings.matchDistance)
+                continue;
+            Candidate& c = candidates[count++];
+            c = old[j];
+            c.point.separation = separation;
+        }
+    }
+
+    count = reduce(candidates, count, result.normal);
+    for (int i = 0; i < count; ++i) out.points[i] = candidates[i].point;
+    out.pointCount = count;
+}
+
+} // namespace
+
+void ContactCache::update(const RigidBodies& bodies, std::span<const BroadphasePair> pairs, core::JobSystem* jobs,
+                          core::memory::FrameArena* scratch) {
+    assert(std::is_sorted(pairs.begin(), pairs.end()));
+    previous.swap(current);
+    current.clear();
+    if (pairs.empty()) return;
+    std::span<ContactManifold> results;
+    if (scratch != nullptr) {
+        results = scratch->allocateArray<ContactManifold>(pairs.size());
+    } else {
+        slots.resize(pairs.size());
+        results = slots;
+    }
+
+    auto collideRange = [&](std::size_t first, std::size_t last) {
+        // Both lists are sorted: walk the old manifolds alongside the pairs
+        auto old = std::lower_bound(previous.begin(), previous.end(), pairs[first], pairLess);
+        for (std::size_t i = first; i < last; ++i) {
+            const BroadphasePair& pair = pairs[i];
+            while (old != previous.end() && pairLess(*old, pair)) ++old;
+            const bool hit = old != previous.end() && old->bodyA == pair.a && old->bodyB == pair.b;
+            collidePair(bodies, pair, hit ? &*old : nullptr, config, results[i]);
+        }
+    };
+    if (jobs != nullptr && pairs.size() > PAIRS_PER_JOB) {
+        jobs->parallelFor(0, pairs.size(), PAIRS_PER_JOB, collideRange);
+    } else {
+        collideRange(0, pairs.size());
+    }
+
+    for (const ContactManifold& m : results) {
+        if (m.pointCount > 0) current.push_back(m);
+    }
+}
+
+const ContactManifold* ContactCache::find(std::uint32_t a, std::uint32_t b) const noexcept {
+    const BroadphasePair key{a, b};
+    const auto it = std::lower_bound(current.begin(), current.end(), key, pairLess);
+    return it != current.end() && it->bodyA == a && it->bodyB == b ? &*it : nullptr;
+}
+
+void ContactCache::clear() noexcept {
+    current.clear();
+    previous.clear();
+}
+
+} // namespace physics
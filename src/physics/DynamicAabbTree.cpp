@@ -0,0 +1,307 @@
+#include "include/DynamicAabbTree.h"
+
+#include <algorithm>
+#include <cassert>
+
+namespace physics {
+
+namespace {
+
+bool sameBox(const Aabb& a, const Aabb& b) noexcept {
+    return a.min.x == b.min.x && a.min.y == b.min.y && a.min.z == b.min.z &&
+           a.max.x == b.max.x && a.max.y == b.max.y && a.max.z == b.max.z;
+}
+
+} // namespace
+
+DynamicAabbTree::DynamicAabbTree(float margin, float displacementMultiplier)
+    : margin(margin), displacementMultiplier(displacementMultiplier) {
+    assert(margin >= 0.0f);
+}
+
+std::int32_t DynamicAabbTree::allocateNode() {
+    if (freeList == NULL_NODE) {
+        nodes.emplace_back();
+        return static_cast<std::int32_t>(nodes.size() - 1);
+    }
+    const std::int32_t id = freeList;
+    freeList = nodes[id].parent;
+    nodes[id] = Node{};
+    return id;
+}
+
+void DynamicAabbTree::freeNode(std::int32_t id) {
+    nodes[id].parent = freeList;
+    nodes[id].height = -1;
+    freeList = id;
+}
+
+Aabb DynamicAabbTree::fatten(const Aabb& box, const math::Vector3& displacement) const noexcept {
+    Aabb fat = box.expanded(margin);
+    const math::Vector3 d = displacement * displacementMultiplier;
+    // Stretch only in the direction of travel
+    (d.x < 0.0f ? fat.min.x : fat.max.x) += d.x;
+    (d.y < 0.0f ? fat.min.y : fat.max.y) += d.y;
+    (d.z < 0.0f ? fat.min.z : fat.max.z) += d.z;
+    return fat;
+}
+
+std::int32_t DynamicAabbTree::createProxy(const Aabb& box, std::uint32_t userId) {
+    const std::int32_t leaf = allocateNode();
+    nodes[leaf].box = fatten(box, {});
+    nodes[leaf].userId = userId;
+    insertLeaf(leaf);
+    ++leafCount;
+    return leaf;
+}
+
+void DynamicAabbTree::destroyProxy(std::int32_t proxy) {
+    assert(proxy >= 0 && static_cast<std::size_t>(proxy) < nodes.size() && nodes[proxy].isLeaf());
+    removeLeaf(proxy);
+    freeNode(proxy);
+    --leafCount;
+}
+
+bool DynamicAabbTree::moveProxy(std::int32_t proxy, const Aabb& box, const math::Vector3& displacement) {
+    assert(proxy >= 0 && static_cast<std::size_t>(proxy) < nodes.size() && nodes[proxy].isLeaf());
+    Node& leaf = nodes[proxy];
+    if (leaf.box.contains(box)) return false;
+
+    const Aabb fat = fatten(box, displacement);
+    if (fat.overlaps(leaf.box)) {
+        // Still near its old place in the tree: refit instead of reinserting
+        leaf.box = fat;
+        refitAncestors(leaf.parent, false);
+    } else {
+        removeLeaf(proxy);
+        nodes[proxy].box = fat;
+        insertLeaf(proxy);
+    }
+    return true;
+}
+
+void DynamicAabbTree::insertLeaf(std::int32_t leaf) {
+    if (root == NULL_NODE) {
+        root = leaf;
+        nodes[root].parent = NULL_NODE;
+        return;
+    }
+
+    // Descend towards the cheapest sibling under the surface-area heuristic
+    const Aabb leafBox = nodes[leaf].box;
+    std::int32_t index = root;
+    while (!nodes[index].isLeaf()) {
+        const Node& n = nodes[index];
+        const float area = n.box.surfaceArea();
+        const float combinedArea = n.box.merged(leafBox).surfaceArea();
+
+        // Cost of making a new parent for this node and the leaf
+        const float cost = 2.0f * combinedArea;
+        // Minimum cost of pushing the leaf further down the tree
+        const float inheritanceCost = 2.0f * (combinedArea - area);
+
+        auto descendCost = [&](std::int32_t child) {
+            const Node& c = nodes[child];
+            const float merged = leafBox.merged(c.box).surfaceArea();
+            return c.isLeaf() ? merged + inheritanceCost
+                              : merged - c.box.surfaceArea() + inheritanceCost;
+        };
+        const float cost1 = descendCost(n.child1);
+        const float cost2 = descendCost(n.child2);
+
+        if (cost < cost1 && cost < cost2) break;
+        index = cost1 < cost2 ? n.child1 : n.child2;
+    }
+
+    // Splice a new parent in above the chosen sibling
+    const std::int32_t sibling = index;
+    const std::int32_t oldParent = nodes[sibling].parent;
+    const std::int32_t newParent = allocateNode();
+    nodes[newParent].parent = oldParent;
+    nodes[newParent].box = leafBox.merged(nodes[sibling].box);
+    nodes[newParent].height = nodes[sibling].height + 1;
+    nodes[newParent].child1 = sibling;
+    nodes[newParent].child2 = leaf;
+    nodes[sibling].parent = newParent;
+    nodes[leaf].parent = newParent;
+
+    if (oldParent == NULL_NODE) {
+        root = newParent;
+    } else if (nodes[oldParent].child1 == sibling) {
+        nodes[oldParent].child1 = newParent;
+    } else {
+        nodes[oldParent].child2 = newParent;
+    }
+
+    refitAncestors(newParent, true);
+}
+
+void DynamicAabbTree::removeLeaf(std::int32_t leaf) {
+    if (leaf == root) {
+        root = NULL_NODE;
+        return;
+    }
+
+    const std::int32_t parent = nodes[leaf].parent;
+    const std::int32_t grandParent = nodes[parent].parent;
+    const std::int32_t sibling = nodes[parent].child1 == leaf ? nodes[parent].child2 : nodes[parent].child1;
+
+    // The sibling takes the parent's place
+    nodes[sibling].parent = grandParent;
+    freeNode(parent);
+    if (grandParent == NULL_NODE) {
+        root = sibling;
+        return;
+    }
+    if (nodes[grandParent].child1 == parent) {
+        nodes[grandParent].child1 = sibling;
+    } else {
+        nodes[grandParent].child2 = sibling;
+    }
+    refitAncestors(grandParent, true);
+}
+
+void DynamicAabbTree::refitAncestors(std::int32_t start, bool rebalance) {
+    std::int32_t index = start;
+    while (index != NULL_NODE) {
+        if (rebalance) index = balance(index);
+
+        Node& n = nodes[index];
+        const Node& c1 = nodes[n.child1];
+        const Node& c2 = nodes[n.child2];
+        const Aabb box = c1.box.merged(c2.box);
+        const std::int32_t height = 1 + std::max(c1.height, c2.height);
+
+        // Pure refits stop where nothing changes; above that the tree is already correct
+        if (!rebalance && height == n.height && sameBox(box, n.box)) return;
+        n.box = box;
+        n.height = height;
+        index = n.parent;
+    }
+}
+
+// Rotates node a's taller grandchild up if a is out of balance.
+// Returns the index of the subtree's new root.
+std::int32_t DynamicAabbTree::balance(std::int32_t iA) {
+    Node& A = nodes[iA];
+    if (A.isLeaf() || A.height < 2) return iA;
+
+    const std::int32_t iB = A.child1;
+    const std::int32_t iC = A.child2;
+    Node& B = nodes[iB];
+    Node& C = nodes[iC];
+    const std::int32_t diff = C.height - B.height;
+
+    // Rotate the taller child up; shared by both directions
+    auto rotate = [&](std::int32_t iUp, std::int32_t iOther, bool upIsChild2) {
+        Node& up = nodes[iUp];
+        const std::int32_t iF = up.child1;
+        const std::int32_t iG = up.child2;
+        Node& F = nodes[iF];
+        Node& G = nodes[iG];
+
+        // up replaces A
+        up.child1 = iA;
+        up.parent = A.parent;
+        A.parent = iUp;
+        if (up.parent == NULL_NODE) {
+            root = iUp;
+        } else if (nodes[up.parent].child1 == iA) {
+            nodes[up.parent].child1 = iUp;
+        } else {
+            nodes[up.parent].child2 = iUp;
+        }
+
+        // A keeps the other child plus the shorter grandchild
+        const Node& other = nodes[iOther];
+        const bool keepF = F.height > G.height;
+        const std::int32_t iTall = keepF ? iF : iG;
+        const std::int32_t iShort = keepF ? iG : iF;
+        up.child2 = iTall;
+        (upIsChild2 ? A.child2 : A.child1) = iShort;
+        nodes[iShort].parent = iA;
+        A.box = other.box.merged(nodes[iShort].box);
+        up.box = A.box.merged(nodes[iTall].box);
+        A.height = 1 + std::max(other.height, nodes[iShort].height);
+        up.height = 1 + std::max(A.height, nodes[iTall].height);
+        return iUp;
+    };
+
+    if (diff > 1) return rotate(iC, iB, true);
+    if (diff < -1) return rotate(iB, iC, false);
+    return iA;
+}
+
+void DynamicAabbTree::findPairs(std::vector<BroadphasePair>& out) const {
+    collectPairs(out);
+}
+
+void DynamicAabbTree::findPairs(std::pmr::vector<BroadphasePair>& out) const {
+    collectPairs(out);
+}
+
+template <typename Pairs>
+void DynamicAabbTree::collectPairs(Pairs& out) const {
+    out.clear();
+    if (root == NULL_NODE) return;
+
+    // Simultaneous descent of the tree against itself: each subtree is tested
+    // against its sibling once, instead of one root-to-leaf query per proxy.
+    pending.clear();
+    internal.assign(1, root);
+    while (!internal.empty()) {
+        const Node& n = nodes[internal.back()];
+        internal.pop_back();
+        if (n.isLeaf()) continue;
+        internal.push_back(n.child1);
+        internal.push_back(n.child2);
+        pending.push_back({n.child1, n.child2});
+
+        while (!pending.empty()) {
+            const NodePair p = pending.back();
+            pending.pop_back();
+            const Node& a = nodes[p.a];
+            const Node& b = nodes[p.b];
+            if (!a.box.overlaps(b.box)) continue;
+            if (a.isLeaf() && b.isLeaf()) {
+                out.push_back(a.userId < b.userId ? BroadphasePair{a.userId, b.userId}
+                                                  : BroadphasePair{b.userId, a.userId});
+            } else if (b.isLeaf() || (!a.isLeaf() && a.height >= b.height)) {
+                pending.push_back({a.child1, p.b});
+                pending.push_back({a.child2, p.b});
+            } else {
+                pending.push_back({p.a, b.child1});
+                pending.push_back({p.a, b.child2});
+            }
+        }
+    }
+    sortAndDeduplicate(out);
+}
+
+bool DynamicAabbTree::validate() const {
+    if (root == NULL_NODE) return leafCount == 0;
+    if (nodes[root].parent != NULL_NODE) return false;
+
+    std::size_t freeCount = 0;
+    for (std::int32_t i = freeList; i != NULL_NODE; i = nodes[i].parent) {
+        if (nodes[i].height != -1) return false;
+        ++freeCount;
+    }
+    // A tree with n leaves has n - 1 internal nodes
+    if (nodes.size() != 2 * leafCount - 1 + freeCount) return false;
+    return validateNode(root);
+}
+
+bool DynamicAabbTree::validateNode(std::int32_t id) const {
+    const Node& n = nodes[id];
+    if (n.isLeaf()) return n.child2 == NULL_NODE && n.height == 0;
+
+    const Node& c1 = nodes[n.child1];
+    const Node& c2 = nodes[n.child2];
+    if (c1.parent != id || c2.parent != id) return false;
+    if (n.height != 1 + std::max(c1.height, c2.height)) return false;
+    if (!n.box.contains(c1.box) || !n.box.contains(c2.box)) return false;
+    return validateNode(n.child1) && validateNode(n.child2);
+}
+
+} // namespace physics
@@ -0,0 +1,282 @@
+#include "include/Fluid.h"
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <numbers>
+#include <utility>
+
+#include "include/JobSystem.h"
+#include "include/SimdPack.h"
+
+namespace physics {
+
+namespace {
+
+using math::Vector3;
+using math::simd::forEachPack;
+
+template <typename Range>
+void runRange(core::JobSystem* jobs, std::size_t count, std::size_t grain, Range&& range) {
+    if (jobs && count > grain) {
+        jobs->parallelFor(0, count, grain, range);
+    } else {
+        range(0, count);
+    }
+}
+
+std::uint32_t cellsAlong(float extent, float cellSize) noexcept {
+    return std::max(1u, static_cast<std::uint32_t>(std::ceil(extent / cellSize)));
+}
+
+std::uint32_t clampCell(float offset, float inverseCellSize, std::uint32_t cells) noexcept {
+    const float c = std::floor(offset * inverseCellSize);
+    if (!(c > 0.0f)) return 0; // also NaN
+    return std::min(static_cast<std::uint32_t>(c), cells - 1);
+}
+
+// Gather src[order[k]] into dst[k] for k in [begin, end)
+void gather(const math::Vector3SoA& src, math::Vector3SoA& dst, const std::uint32_t* order,
+            std::size_t begin, std::size_t end) noexcept {
+    const float* sx = src.x(); const float* sy = src.y(); const float* sz = src.z();
+    float* dx = dst.x(); float* dy = dst.y(); float* dz = dst.z();
+    for (std::size_t k = begin; k < end; ++k) {
+        const std::uint32_t i = order[k];
+        dx[k] = sx[i];
+        dy[k] = sy[i];
+        dz[k] = sz[i];
+    }
+}
+
+} // namespace
+
+SphFluid::SphFluid(const FluidSettings& settings) : config(settings) {
+    assert(config.smoothingRadius > 0.0f && config.particleMass > 0.0f && config.restDensity > 0.0f);
+    const Vector3 extent = config.boundsMax - config.boundsMin;
+    assert(extent.x > 0.0f && extent.y > 0.0f && extent.z > 0.0f);
+    gridX = cellsAlong(extent.x, config.smoothingRadius);
+    gridY = cellsAlong(extent.y, config.smoothingRadius);
+    gridZ = cellsAlong(extent.z, config.smoothingRadius);
+    assert(cellCount() < (std::size_t{1} << 32) - 1);
+    inverseCellSize = 1.0f / config.smoothingRadius;
+    cellStarts.assign(cellCount() + 1, 0);
+}
+
+void SphFluid::reserve(std::size_t count) {
+    position.reserve(count);
+    velocity.reserve(count);
+    density.reserve(count);
+    pressure.reserve(count);
+    acceleration.reserve(count);
+}
+
+std::size_t SphFluid::add(const Vector3& p, const Vector3& v) {
+    assert(size() < (std::size_t{1} << 32) - 1);
+    position.pushBack(p);
+    velocity.pushBack(v);
+    density.pushBack(config.restDensity);
+    pressure.pushBack(0.0f);
+    acceleration.pushBack({});
+    return size() - 1;
+}
+
+float SphFluid::restSpacing() const noexcept {
+    return std::cbrt(config.particleMass / config.restDensity);
+}
+
+std::size_t SphFluid::addBlock(const Vector3& min, const Vector3& max) {
+    const float s = restSpacing();
+    const auto along = [s](float lo, float hi) {
+        return hi > lo ? static_cast<std::size_t>((hi - lo) / s) : std::size_t{0};
+    };
+    const std::size_t nx = along(min.x, max.x), ny = along(min.y, max.y), nz = along(min.z, max.z);
+    reserve(size() + nx * ny * nz);
+    for (std::size_t z = 0; z < nz; ++z) {
+        for (std::size_t y = 0; y < ny; ++y) {
+            for (std::size_t x = 0; x < nx; ++x) {
+                add({min.x + (static_cast<float>(x) + 0.5f) * s, min.y + (static_cast<float>(y) + 0.5f) * s,
+                     min.z + (static_cast<float>(z) + 0.5f) * s});
+            }
+        }
+    }
+    return nx * ny * nz;
+}
+
+std::uint32_t SphFluid::cellOf(const Vector3& p) const noexcept {
+    const std::uint32_t x = clampCell(p.x - config.boundsMin.x, inverseCellSize, gridX);
+    const std::uint32_t y = clampCell(p.y - config.boundsMin.y, inverseCellSize, gridY);
+    const std::uint32_t z = clampCell(p.z - config.boundsMin.z, inverseCellSize, gridZ);
+    return x + gridX * (y + gridY * z);
+}
+
+void SphFluid::buildGrid(core::JobSystem* jobs) {
+    const std::size_t n = size();
+    const std::size_t cells = cellCount();
+    particleCell.resize(n);
+    runRange(jobs, n, PARTICLES_PER_JOB, [&](std::size_t begin, std::size_t end) {
+        for (std::size_t i = begin; i < end; ++i) particleCell[i] = cellOf(position.get(i));
+    });
+
+    // Counting sort: histogram, exclusive prefix sum, stable scatter. After
+    // the scatter cellStarts[c] holds the end of cell c, so shift it back.
+    std::fill(cellStarts.begin(), cellStarts.end(), 0u);
+    for (std::size_t i = 0; i < n; ++i) ++cellStarts[particleCell[i]];
+    std::uint32_t sum = 0;
+    for (std::size_t c = 0; c < cells; ++c) sum += std::exchange(cellStarts[c], sum);
+    order.resize(n);
+    for (std::size_t i = 0; i < n; ++i) order[cellStarts[particleCell[i]]++] = static_cast<std::uint32_t>(i);
+    std::copy_backward(cellStarts.begin(), cellStarts.end() - 1, cellStarts.end());
+    cellStarts[0] = 0;
+
+    // Reorder the persistent streams; density, pressure and acceleration are recomputed
+    scratch.resize(n);
+    runRange(jobs, n, PARTICLES_PER_JOB, [&](std::size_t begin, std::size_t end) {
+        gather(position, scratch, order.data(), begin, end);
+    });
+    std::swap(position, scratch);
+    runRange(jobs, n, PARTICLES_PER_JOB, [&](std::size_t begin, std::size_t end) {
+        gather(velocity, scratch, order.data(), begin, end);
+    });
+    std::swap(velocity, scratch);
+}
+
+std::size_t SphFluid::neighbourRanges(std::uint32_t cell, IndexRange (&out)[9]) const noexcept {
+    const std::uint32_t x = cell % gridX, y = (cell / gridX) % gridY, z = cell / (gridX * gridY);
+    const std::uint32_t x0 = x > 0 ? x - 1 : 0, x1 = std::min(x + 1, gridX - 1);
+    std::size_t count = 0;
+    for (std::uint32_t nz = z > 0 ? z - 1 : 0; nz <= std::min(z + 1, gridZ - 1); ++nz) {
+        for (std::uint32_t ny = y > 0 ? y - 1 : 0; ny <= std::min(y + 1, gridY - 1); ++ny) {
+            const std::uint32_t row = gridX * (ny + gridY * nz);
+            const IndexRange r{cellStarts[row + x0], cellStarts[row + x1 + 1]};
+            if (r.begin != r.end) out[count++] = r;
+        }
+    }
+    return count;
+}
+
+void SphFluid::computeDensity(core::JobSystem* jobs) {
+    const float h = config.smoothingRadius;
+    const float poly6 = config.particleMass * 315.0f / (64.0f * std::numbers::pi_v<float> * std::pow(h, 9.0f));
+    const float* px = position.x(); const float* py = position.y(); const float* pz = position.z();
+    runRange(jobs, cellCount(), CELLS_PER_JOB, [&](std::size_t firstCell, std::size_t lastCell) {
+        IndexRange ranges[9];
+        for (std::size_t c = firstCell; c < lastCell; ++c) {
+            const std::uint32_t first = cellStarts[c];
+            if (first == cellStarts[c + 1]) continue;
+            const std::size_t rangeCount = neighbourRanges(static_cast<std::uint32_t>(c), ranges);
+            // Lanes are particles of this cell; neighbours are broadcast in a
+            // fixed order, so every backend sums each particle identically.
+            forEachPack(cellStarts[c + 1] - first, [&]<typename P>(std::size_t begin, std::size_t end) {
+                const auto h2 = P::set1(h * h), zero = P::zero();
+                for (std::size_t i = first + begin; i < first + end; i += P::WIDTH) {
+                    const auto xi = P::load(px + i), yi = P::load(py + i), zi = P::load(pz + i);
+                    auto sum = zero;
+                    for (std::size_t r = 0; r < rangeCount; ++r) {
+                        for (std::uint32_t j = ranges[r].begin; j < ranges[r].end; ++j) {
+                            const auto dx = P::sub(xi, P::set1(px[j]));
+                            const auto dy = P::sub(yi, P::set1(py[j]));
+                            const auto dz = P::sub(zi, P::set1(pz[j]));
+                            const auto r2 = P::add(P::add(P::mul(dx, dx), P::mul(dy, dy)), P::mul(dz, dz));
+                            const auto d = P::max(P::sub(h2, r2), zero);
+                            sum = P::add(sum, P::mul(P::mul(d, d), d));
+                        }
+                    }
+                    const auto rho = P::mul(P::set1(poly6), sum);
+                    P::store(density.data() + i, rho);
+                    P::store(pressure.data() + i,
+                             P::max(P::mul(P::set1(config.stiffness), P::sub(rho, P::set1(config.restDensity))), zero));
+                }
+            });
+        }
+    });
+}
+
+void SphFluid::computeForces(core::JobSystem* jobs) {
+    const float h = config.smoothingRadius;
+    const float kernel = 45.0f / (std::numbers::pi_v<float> * std::pow(h, 6.0f));
+    const float spiky = config.particleMass * kernel;                        // |grad W| = spiky (h - r)^2
+    const float laplacian = config.viscosity * config.particleMass * kernel; // mu lap W = laplacian (h - r)
+    const float* px = position.x(); const float* py = position.y(); const float* pz = position.z();
+    const float* vx = velocity.x(); const float* vy = velocity.y(); const float* vz = velocity.z();
+    float* ax = acceleration.x(); float* ay = acceleration.y(); float* az = acceleration.z();
+    runRange(jobs, cellCount(), CELLS_PER_JOB, [&](std::size_t firstCell, std::size_t lastCell) {
+        IndexRange ranges[9];
+        for (std::size_t c = firstCell; c < lastCell; ++c) {
+            const std::uint32_t first = cellStarts[c];
+            if (first == cellStarts[c + 1]) continue;
+            const std::size_t rangeCount = neighbourRanges(static_cast<std::uint32_t>(c), ranges);
+            forEachPack(cellStarts[c + 1] - first, [&]<typename P>(std::size_t begin, std::size_t end) {
+                const auto support = P::set1(h), zero = P::zero(), half = P::set1(0.5f);
+                // Keeps coincident particles (and i itself) finite; their dx is 0 anyway
+                const auto tiny = P::set1(1e-12f);
+                for (std::size_t i = first + begin; i < first + end; i += P::WIDTH) {
+                    const auto xi = P::load(px + i), yi = P::load(py + i), zi = P::load(pz + i);
+                    const auto uxi = P::load(vx + i), uyi = P::load(vy + i), uzi = P::load(vz + i);
+                    const auto pi = P::load(pressure.data() + i);
+                    auto fx = zero, fy = zero, fz = zero;
+                    for (std::size_t r = 0; r < rangeCount; ++r) {
+                        for (std::uint32_t j = ranges[r].begin; j < ranges[r].end; ++j) {
+                            const auto dx = P::sub(xi, P::set1(px[j]));
+                            const auto dy = P::sub(yi, P::set1(py[j]));
+                            const auto dz = P::sub(zi, P::set1(pz[j]));
+                            const auto r2 = P::add(P::add(P::mul(dx, dx), P::mul(dy, dy)), P::mul(dz, dz));
+                            const auto dist = P::sqrt(P::max(r2, tiny));
+                            const auto q = P::max(P::sub(support, dist), zero); // 0 beyond h
+                            const auto invRhoJ = P::set1(1.0f / density[j]);
+                            // Symmetrized pressure pushes i away from j along (xi - xj) / r
+                            const auto push = P::div(P::mul(P::mul(P::mul(P::set1(spiky), P::add(pi, P::set1(pressure[j]))),
+                                                                   P::mul(half, invRhoJ)),
+                                                            P::mul(q, q)),
+                                                     dist);
+                            // Viscosity pulls v_i towards v_j
+                            const auto drag = P::mul(P::mul(P::set1(laplacian), invRhoJ), q);
+                            fx = P::add(fx, P::add(P::mul(push, dx), P::mul(drag, P::sub(P::set1(vx[j]), uxi))));
+                            fy = P::add(fy, P::add(P::mul(push, dy), P::mul(drag, P::sub(P::set1(vy[j]), uyi))));
+                            fz = P::add(fz, P::add(P::mul(push, dz), P::mul(drag, P::sub(P::set1(vz[j]), uzi))));
+                        }
+                    }
+                    const auto invRhoI = P::div(P::set1(1.0f), P::load(density.data() + i));
+                    P::store(ax + i, P::add(P::mul(fx, invRhoI), P::set1(config.gravity.x)));
+                    P::store(ay + i, P::add(P::mul(fy, invRhoI), P::set1(config.gravity.y)));
+                    P::store(az + i, P::add(P::mul(fz, invRhoI), P::set1(config.gravity.z)));
+                }
+            });
+        }
+    });
+}
+
+void SphFluid::integrate(float dt, core::JobSystem* jobs) {
+    float* px = position.x(); float* py = position.y(); float* pz = position.z();
+    float* vx = velocity.x(); float* vy = velocity.y(); float* vz = velocity.z();
+    const float* ax = acceleration.x(); const float* ay = acceleration.y(); const float* az = acceleration.z();
+    runRange(jobs, size(), PARTICLES_PER_JOB, [&](std::size_t first, std::size_t last) {
+        forEachPack(last - first, [&]<typename P>(std::size_t begin, std::size_t end) {
+            const auto step = P::set1(dt), bounce = P::set1(config.restitution);
+            // One axis: v += a dt, x += v dt, then clamp into [lo, hi]. A wall
+            // hit turns v into the inward direction, scaled by restitution.
+            const auto axis = [&](float* x, float* v, const float* a, float lo, float hi, std::size_t i) {
+                const auto nv = P::add(P::load(v + i), P::mul(P::load(a + i), step));
+                const auto nx = P::add(P::load(x + i), P::mul(nv, step));
+                const auto clamped = P::min(P::max(nx, P::set1(lo)), P::set1(hi));
+                const auto hit = P::sub(clamped, nx);
+                P::store(v + i, P::selectNonZero(hit, P::copySign(P::mul(nv, bounce), hit), nv));
+                P::store(x + i, clamped);
+            };
+            for (std::size_t i = first + begin; i < first + end; i += P::WIDTH) {
+                axis(px, vx, ax, config.boundsMin.x, config.boundsMax.x, i);
+                axis(py, vy, ay, config.boundsMin.y, config.boundsMax.y, i);
+                axis(pz, vz, az, config.boundsMin.z, config.boundsMax.z, i);
+            }
+        });
+    });
+}
+
+void SphFluid::step(float dt, core::JobSystem* jobs) {
+    assert(dt > 0.0f);
+    buildGrid(jobs);
+    computeDensity(jobs);
+    computeForces(jobs);
+    integrate(dt, jobs);
+}
+
+} // namespace physics
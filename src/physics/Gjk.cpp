@@ -0,0 +1,362 @@
+#include "include/Gjk.h"
+
+#include <cmath>
+#include <utility>
+
+namespace physics {
+
+using math::Vector3;
+
+namespace {
+
+constexpr int GJK_MAX_ITERATIONS = 64;
+constexpr float GJK_RELATIVE_TOLERANCE = 1e-5f;
+constexpr float GJK_OVERLAP_DISTANCE_SQ = 1e-10f;
+
+constexpr int EPA_MAX_ITERATIONS = 64;
+constexpr int EPA_MAX_VERTICES = 4 + EPA_MAX_ITERATIONS;
+constexpr int EPA_MAX_FACES = 256;
+constexpr float EPA_TOLERANCE = 1e-4f;
+
+// Point of the Minkowski difference with the two support points that made it
+struct SupportPoint {
+    Vector3 w; // a - b
+    Vector3 a;
+    Vector3 b;
+};
+
+SupportPoint supportPoint(const ConvexSupport& a, const ConvexSupport& b, const Vector3& direction) noexcept {
+    const Vector3 pa = a(direction);
+    const Vector3 pb = b(direction * -1.0f);
+    return {pa - pb, pa, pb};
+}
+
+struct Simplex {
+    SupportPoint v[4];
+    float lambda[4]; // barycentric weights of the closest point
+    int count = 0;
+
+    void keep(int i0) noexcept {
+        v[0] = v[i0];
+        lambda[0] = 1.0f;
+        count = 1;
+    }
+
+    void keep(int i0, int i1, float l0, float l1) noexcept {
+        const SupportPoint p0 = v[i0], p1 = v[i1];
+        v[0] = p0;
+        v[1] = p1;
+        lambda[0] = l0;
+        lambda[1] = l1;
+        count = 2;
+    }
+
+    void keep(int i0, int i1, int i2, float l0, float l1, float l2) noexcept {
+        const SupportPoint p0 = v[i0], p1 = v[i1], p2 = v[i2];
+        v[0] = p0;
+        v[1] = p1;
+        v[2] = p2;
+        lambda[0] = l0;
+        lambda[1] = l1;
+        lambda[2] = l2;
+        count = 3;
+    }
+
+    Vector3 closest() const noexcept {
+        Vector3 p;
+        for (int i = 0; i < count; ++i) p += v[i].w * lambda[i];
+        return p;
+    }
+
+    void witnesses(Vector3& pa, Vector3& pb) const noexcept {
+        pa = {};
+        pb = {};
+        for (int i = 0; i < count; ++i) {
+            pa += v[i].a * lambda[i];
+            pb += v[i].b * lambda[i];
+        }
+    }
+};
+
+// Closest point of segment v[i0] v[i1] to the origin; reduces the simplex to
+// the sub-simplex (vertex or edge) that contains it.
+void reduceSegment(Simplex& s, int i0, int i1) noexcept {
+    const Vector3 a = s.v[i0].w, b = s.v[i1].w;
+    const Vector3 ab = b - a;
+    const float t = -a.dot(ab);
+    if (t <= 0.0f) return s.keep(i0);
+    const float denom = ab.dot(ab);
+    if (t >= denom) return s.keep(i1);
+    const float u = t / denom;
+    s.keep(i0, i1, 1.0f - u, u);
+}
+
+// Ericson, Real-Time Collision Detection, 5.1.5, with the query point at the origin.
+// Returns the squared distance of the closest point.
+float reduceTriangle(Simplex& s, int ia, int ib, int ic) noexcept {
+    const Vector3 a = s.v[ia].w, b = s.v[ib].w, c = s.v[ic].w;
+    const Vector3 ab = b - a, ac = c - a;
+    const float d1 = -ab.dot(a), d2 = -ac.dot(a);
+    if (d1 <= 0.0f && d2 <= 0.0f) {
+        s.keep(ia);
+    } else {
+        const float d3 = -ab.dot(b), d4 = -ac.dot(b);
+        const float d5 = -ab.dot(c), d6 = -ac.dot(c);
+        const float vc = d1 * d4 - d3 * d2;
+        const float vb = d5 * d2 - d1 * d6;
+        const float va = d3 * d6 - d5 * d4;
+        if (d3 >= 0.0f && d4 <= d3) {
+            s.keep(ib);
+        } else if (vc <= 0.0f && d1 >= 0.0f && d3 <= 0.0f) {
+            const float v = d1 / (d1 - d3);
+            s.keep(ia, ib, 1.0f - v, v);
+        } else if (d6 >= 0.0f && d5 <= d6) {
+            s.keep(ic);
+        } else if (vb <= 0.0f && d2 >= 0.0f && d6 <= 0.0f) {
+            const float w = d2 / (d2 - d6);
+            s.keep(ia, ic, 1.0f - w, w);
+        } else if (va <= 0.0f && d4 - d3 >= 0.0f && d5 - d6 >= 0.0f) {
+            const float w = (d4 - d3) / ((d4 - d3) + (d5 - d6));
+            s.keep(ib, ic, 1.0f - w, w);
+        } else {
+            const float denom = 1.0f / (va + vb + vc);
+            const float v = vb * denom, w = vc * denom;
+            s.keep(ia, ib, ic, 1.0f - v - w, v, w);
+        }
+    }
+    return s.closest().lengthSquared();
+}
+
+// True if the origin and d lie on opposite sides of plane abc
+bool originOutsideFace(const Vector3& a, const Vector3& b, const Vector3& c, const Vector3& d) noexcept {
+    const Vector3 n = (b - a).cross(c - a);
+    const float signOrigin = -a.dot(n);
+    const float signD = (d - a).dot(n);
+    return signOrigin * signD < 0.0f;
+}
+
+// Reduces a tetrahedron; returns false if the origin is inside it.
+bool reduceTetrahedron(Simplex& s) noexcept {
+    static constexpr int FACES[4][4] = {{0, 1, 2, 3}, {0, 2, 3, 1}, {0, 3, 1, 2}, {1, 3, 2, 0}};
+    Simplex best;
+    float bestDistSq = INFINITY;
+    bool outside = false;
+    for (const auto& f : FACES) {
+        if (!originOutsideFace(s.v[f[0]].w, s.v[f[1]].w, s.v[f[2]].w, s.v[f[3]].w)) continue;
+        outside = true;
+        Simplex candidate = s;
+        const float distSq = reduceTriangle(candidate, f[0], f[1], f[2]);
+        if (distSq < bestDistSq) {
+            bestDistSq = distSq;
+            best = candidate;
+        }
+    }
+    if (!outside) return false;
+    s = best;
+    return true;
+}
+
+// Runs GJK; on return s holds the final simplex. Returns true if the shapes overlap.
+bool gjk(const ConvexSupport& a, const ConvexSupport& b, Simplex& s) noexcept {
+    Vector3 v = a.center() - b.center();
+    if (v.lengthSquared() < GJK_OVERLAP_DISTANCE_SQ) v = {1.0f, 0.0f, 0.0f};
+    s.count = 0;
+
+    float previousDistSq = INFINITY;
+    for (int iteration = 0; iteration < GJK_MAX_ITERATIONS; ++iteration) {
+        const SupportPoint w = supportPoint(a, b, v * -1.0f);
+        const float vv = v.lengthSquared();
+        // No further progress towards the origin: v is the closest point
+        if (s.count > 0 && vv - v.dot(w.w) <= GJK_RELATIVE_TOLERANCE * vv) return false;
+
+        s.v[s.count] = w;
+        s.lambda[s.count] = 0.0f;
+        ++s.count;
+
+        switch (s.count) {
+            case 1: s.lambda[0] = 1.0f; break;
+            case 2: reduceSegment(s, 0, 1); break;
+            case 3: reduceTriangle(s, 0, 1, 2); break;
+            default:
+                if (!reduceTetrahedron(s)) return true;
+                break;
+        }
+
+        v = s.closest();
+        const float distSq = v.lengthSquared();
+        if (distSq < GJK_OVERLAP_DISTANCE_SQ) return true;
+        if (distSq >= previousDistSq) return false; // numerical stall
+        previousDistSq = distSq;
+    }
+    return false;
+}
+
+// Grows a GJK simplex that contains the origin into a tetrahedron for EPA
+bool completeTetrahedron(const ConvexSupport& a, const ConvexSupport& b, Simplex& s) noexcept {
+    static const Vector3 AXES[6] = {{1, 0, 0}, {-1, 0, 0}, {0, 1, 0}, {0, -1, 0}, {0, 0, 1}, {0, 0, -1}};
+    constexpr float EPS = 1e-6f;
+
+    if (s.count == 1) {
+        for (const Vector3& axis : AXES) {
+            const SupportPoint p = supportPoint(a, b, axis);
+            if ((p.w - s.v[0].w).lengthSquared() > EPS) {
+                s.v[s.count++] = p;
+                break;
+            }
+        }
+        if (s.count == 1) return false;
+    }
+    if (s.count == 2) {
+        const Vector3 d = s.v[1].w - s.v[0].w;
+        const Vector3 ad(std::fabs(d.x), std::fabs(d.y), std::fabs(d.z));
+        const Vector3 axis = ad.x <= ad.y && ad.x <= ad.z ? Vector3(1, 0, 0)
+                           : ad.y <= ad.z                 ? Vector3(0, 1, 0)
+                                                          : Vector3(0, 0, 1);
+        const Vector3 n1 = d.cross(axis);
+        const Vector3 n2 = d.cross(n1);
+        for (const Vector3& dir : {n1, n1 * -1.0f, n2, n2 * -1.0f}) {
+            const SupportPoint p = supportPoint(a, b, dir);
+            if (d.cross(p.w - s.v[0].w).lengthSquared() > EPS * d.lengthSquared()) {
+                s.v[s.count++] = p;
+                break;
+            }
+        }
+        if (s.count == 2) return false;
+    }
+    if (s.count == 3) {
+        const Vector3 n = (s.v[1].w - s.v[0].w).cross(s.v[2].w - s.v[0].w);
+        for (const Vector3& dir : {n, n * -1.0f}) {
+            const SupportPoint p = supportPoint(a, b, dir);
+            if (std::fabs(n.dot(p.w - s.v[0].w)) > EPS * std::sqrt(n.lengthSquared())) {
+                s.v[s.count++] = p;
+                break;
+            }
+        }
+        if (s.count == 3) return false;
+    }
+    return true;
+}
+
+struct EpaFace {
+    int i, j, k;
+    Vector3 normal;
+    float distance;
+};
+
+bool makeFace(const SupportPoint* verts, int i, int j, int k, EpaFace& face) noexcept {
+    const Vector3 n = (verts[j].w - verts[i].w).cross(verts[k].w - verts[i].w);
+    const float lengthSq = n.lengthSquared();
+    if (lengthSq < 1e-18f) return false;
+    face.i = i;
+    face.j = j;
+    face.k = k;
+    face.normal = n / std::sqrt(lengthSq);
+    face.distance = face.normal.dot(verts[i].w);
+    return true;
+}
+
+} // namespace
+
+GjkResult gjkDistance(const ConvexSupport& a, const ConvexSupport& b) noexcept {
+    GjkResult result;
+    Simplex s;
+    if (gjk(a, b, s)) {
+        result.overlapping = true;
+        return result;
+    }
+    s.witnesses(result.pointA, result.pointB);
+    result.distance = (result.pointB - result.pointA).length();
+    return result;
+}
+
+bool epaPenetration(const ConvexSupport& a, const ConvexSupport& b, EpaResult& out) noexcept {
+    Simplex s;
+    if (!gjk(a, b, s)) return false;
+    if (s.count < 4 && !completeTetrahedron(a, b, s)) return false;
+
+    SupportPoint verts[EPA_MAX_VERTICES];
+    int vertexCount = 4;
+    for (int i = 0; i < 4; ++i) verts[i] = s.v[i];
+
+    // Wind the tetrahedron so every normal points away from the opposite vertex
+    if ((verts[1].w - verts[0].w).cross(verts[2].w - verts[0].w).dot(verts[3].w - verts[0].w) > 0.0f) {
+        std::swap(verts[1], verts[2]);
+    }
+    EpaFace faces[EPA_MAX_FACES];
+    int faceCount = 0;
+    static constexpr int START[4][3] = {{0, 1, 2}, {0, 3, 1}, {0, 2, 3}, {1, 3, 2}};
+    for (const auto& f : START) {
+        if (!makeFace(verts, f[0], f[1], f[2], faces[faceCount])) return false;
+        ++faceCount;
+    }
+
+    int closest = 0;
+    for (int iteration = 0; iteration < EPA_MAX_ITERATIONS; ++iteration) {
+        closest = 0;
+        for (int f = 1; f < faceCount; ++f) {
+            if (faces[f].distance < faces[closest].distance) closest = f;
+        }
+        const EpaFace face = faces[closest];
+        const SupportPoint p = supportPoint(a, b, face.normal);
+        if (p.w.dot(face.normal) - face.distance < EPA_TOLERANCE || vertexCount == EPA_MAX_VERTICES) break;
+
+        // Remove faces visible from p, keeping their boundary (horizon) edges
+        struct Edge { int from, to; };
+        Edge horizon[EPA_MAX_FACES];
+        int edgeCount = 0;
+        auto addEdge = [&](int from, int to) {
+            for (int e = 0; e < edgeCount; ++e) {
+                if (horizon[e].from == to && horizon[e].to == from) {
+                    horizon[e] = horizon[--edgeCount]; // shared by two removed faces
+                    return;
+                }
+            }
+            horizon[edgeCount++] = {from, to};
+        };
+        for (int f = 0; f < faceCount;) {
+            if (faces[f].normal.dot(p.w - verts[faces[f].i].w) > 0.0f) {
+                addEdge(faces[f].i, faces[f].j);
+                addEdge(faces[f].j, faces[f].k);
+                addEdge(faces[f].k, faces[f].i);
+                faces[f] = faces[--faceCount];
+            } else {
+                ++f;
+            }
+        }
+
+        const int newVertex = vertexCount++;
+        verts[newVertex] = p;
+        for (int e = 0; e < edgeCount; ++e) {
+            if (faceCount == EPA_MAX_FACES) return false;
+            if (makeFace(verts, horizon[e].from, horizon[e].to, newVertex, faces[faceCount])) ++faceCount;
+        }
+        if (faceCount == 0) return false;
+    }
+
+    closest = 0;
+    for (int f = 1; f < faceCount; ++f) {
+        if (faces[f].distance < faces[closest].distance) closest = f;
+    }
+    const EpaFace& face = faces[closest];
+
+    // Barycentric coordinates of the origin's projection on the face
+    const Vector3 p = face.normal * face.distance;
+    const Vector3 v0 = verts[face.j].w - verts[face.i].w;
+    const Vector3 v1 = verts[face.k].w - verts[face.i].w;
+    const Vector3 v2 = p - verts[face.i].w;
+    const float d00 = v0.dot(v0), d01 = v0.dot(v1), d11 = v1.dot(v1);
+    const float d20 = v2.dot(v0), d21 = v2.dot(v1);
+    const float denom = d00 * d11 - d01 * d01;
+    if (std::fabs(denom) < 1e-20f) return false;
+    const float v = (d11 * d20 - d01 * d21) / denom;
+    const float w = (d00 * d21 - d01 * d20) / denom;
+    const float u = 1.0f - v - w;
+
+    out.normal = face.normal;
+    out.depth = face.distance;
+    out.pointA = verts[face.i].a * u + verts[face.j].a * v + verts[face.k].a * w;
+    out.pointB = verts[face.i].b * u + verts[face.j].b * v + verts[face.k].b * w;
+    return true;
+}
+
+} // namespace physics
@@ -0,0 +1,127 @@
+#include "include/Integrator.h"
+
+#include <cassert>
+
+#include "include/SimdPack.h"
+
+namespace physics {
+
+namespace {
+
+using math::simd::forEachPack;
+
+// rotate(q, v) from Quaternion.h in pack lanes: v + w t + u x t, t = 2 u x v.
+// Pass a negated vector part (ux, uy, uz) to rotate by the conjugate.
+template <typename P>
+void rotateLanes(typename P::Reg ux, typename P::Reg uy, typename P::Reg uz, typename P::Reg w,
+                 typename P::Reg& x, typename P::Reg& y, typename P::Reg& z) noexcept {
+    const auto u2x = P::add(ux, ux), u2y = P::add(uy, uy), u2z = P::add(uz, uz);
+    const auto tx = P::sub(P::mul(u2y, z), P::mul(u2z, y));
+    const auto ty = P::sub(P::mul(u2z, x), P::mul(u2x, z));
+    const auto tz = P::sub(P::mul(u2x, y), P::mul(u2y, x));
+    const auto cx = P::sub(P::mul(uy, tz), P::mul(uz, ty));
+    const auto cy = P::sub(P::mul(uz, tx), P::mul(ux, tz));
+    const auto cz = P::sub(P::mul(ux, ty), P::mul(uy, tx));
+    x = P::add(P::add(x, P::mul(tx, w)), cx);
+    y = P::add(P::add(y, P::mul(ty, w)), cy);
+    z = P::add(P::add(z, P::mul(tz, w)), cz);
+}
+
+} // namespace
+
+void integrateVelocities(RigidBodies& bodies, float dt, const IntegratorSettings& settings,
+                         std::size_t first, std::size_t last) noexcept {
+    assert(first <= last && last <= bodies.size());
+    const float linearFactor = 1.0f / (1.0f + dt * settings.linearDamping);
+    const float angularFactor = 1.0f / (1.0f + dt * settings.angularDamping);
+    float* vx = bodies.linearVelocity.x() + first; float* vy = bodies.linearVelocity.y() + first; float* vz = bodies.linearVelocity.z() + first;
+    float* wx = bodies.angularVelocity.x() + first; float* wy = bodies.angularVelocity.y() + first; float* wz = bodies.angularVelocity.z() + first;
+    const float* fx = bodies.force.x() + first; const float* fy = bodies.force.y() + first; const float* fz = bodies.force.z() + first;
+    const float* tx = bodies.torque.x() + first; const float* ty = bodies.torque.y() + first; const float* tz = bodies.torque.z() + first;
+    const float* ix = bodies.inverseInertia.x() + first; const float* iy = bodies.inverseInertia.y() + first; const float* iz = bodies.inverseInertia.z() + first;
+    const float* qx = bodies.qx.data() + first; const float* qy = bodies.qy.data() + first;
+    const float* qz = bodies.qz.data() + first; const float* qw = bodies.qw.data() + first;
+    const float* invMass = bodies.inverseMass.data() + first;
+
+    forEachPack(last - first, [&]<typename P>(std::size_t begin, std::size_t end) {
+        const auto step = P::set1(dt);
+        const auto gx = P::set1(settings.gravity.x), gy = P::set1(settings.gravity.y), gz = P::set1(settings.gravity.z);
+        const auto one = P::set1(1.0f), zero = P::zero();
+        const auto linDamp = P::set1(linearFactor), angDamp = P::set1(angularFactor);
+        for (std::size_t i = begin; i < end; i += P::WIDTH) {
+            // Linear: v = (v + (g * dynamic + F / m) dt) * damping
+            const auto im = P::load(invMass + i);
+            const auto dynamic = P::selectNonZero(im, one, zero);
+            const auto ax = P::add(P::mul(gx, dynamic), P::mul(P::load(fx + i), im));
+            const auto ay = P::add(P::mul(gy, dynamic), P::mul(P::load(fy + i), im));
+            const auto az = P::add(P::mul(gz, dynamic), P::mul(P::load(fz + i), im));
+            P::store(vx + i, P::mul(P::add(P::load(vx + i), P::mul(ax, step)), linDamp));
+            P::store(vy + i, P::mul(P::add(P::load(vy + i), P::mul(ay, step)), linDamp));
+            P::store(vz + i, P::mul(P::add(P::load(vz + i), P::mul(az, step)), linDamp));
+
+            // Angular: alpha = R I^-1 R^T tau, evaluated in body space
+            const auto ux = P::load(qx + i), uy = P::load(qy + i), uz = P::load(qz + i), w = P::load(qw + i);
+            auto bx = P::load(tx + i), by = P::load(ty + i), bz = P::load(tz + i);
+            rotateLanes<P>(P::sub(zero, ux), P::sub(zero, uy), P::sub(zero, uz), w, bx, by, bz);
+            bx = P::mul(bx, P::load(ix + i));
+            by = P::mul(by, P::load(iy + i));
+            bz = P::mul(bz, P::load(iz + i));
+            rotateLanes<P>(ux, uy, uz, w, bx, by, bz);
+            P::store(wx + i, P::mul(P::add(P::load(wx + i), P::mul(bx, step)), angDamp));
+            P::store(wy + i, P::mul(P::add(P::load(wy + i), P::mul(by, step)), angDamp));
+            P::store(wz + i, P::mul(P::add(P::load(wz + i), P::mul(bz, step)), angDamp));
+        }
+    });
+}
+
+void integratePositions(RigidBodies& bodies, float dt, std::size_t first, std::size_t last) noexcept {
+    assert(first <= last && last <= bodies.size());
+    float* px = bodies.position.x() + first; float* py = bodies.position.y() + first; float* pz = bodies.position.z() + first;
+    const float* vx = bodies.linearVelocity.x() + first; const float* vy = bodies.linearVelocity.y() + first; const float* vz = bodies.linearVelocity.z() + first;
+    const float* wx = bodies.angularVelocity.x() + first; const float* wy = bodies.angularVelocity.y() + first; const float* wz = bodies.angularVelocity.z() + first;
+    float* qx = bodies.qx.data() + first; float* qy = bodies.qy.data() + first;
+    float* qz = bodies.qz.data() + first; float* qw = bodies.qw.data() + first;
+
+    forEachPack(last - first, [&]<typename P>(std::size_t begin, std::size_t end) {
+        const auto step = P::set1(dt);
+        const auto halfStep = P::set1(0.5f * dt);
+        for (std::size_t i = begin; i < end; i += P::WIDTH) {
+            P::store(px + i, P::add(P::load(px + i), P::mul(P::load(vx + i), step)));
+            P::store(py + i, P::add(P::load(py + i), P::mul(P::load(vy + i), step)));
+            P::store(pz + i, P::add(P::load(pz + i), P::mul(P::load(vz + i), step)));
+
+            // q += 0.5 dt (w, 0) * q, then renormalize
+            const auto ox = P::load(wx + i), oy = P::load(wy + i), oz = P::load(wz + i);
+            const auto x = P::load(qx + i), y = P::load(qy + i), z = P::load(qz + i), w = P::load(qw + i);
+            const auto dx = P::sub(P::add(P::mul(ox, w), P::mul(oy, z)), P::mul(oz, y));
+            const auto dy = P::sub(P::add(P::mul(oy, w), P::mul(oz, x)), P::mul(ox, z));
+            const auto dz = P::sub(P::add(P::mul(oz, w), P::mul(ox, y)), P::mul(oy, x));
+            const auto dw = P::add(P::add(P::mul(ox, x), P::mul(oy, y)), P::mul(oz, z));
+            const auto nx = P::add(x, P::mul(dx, halfStep));
+            const auto ny = P::add(y, P::mul(dy, halfStep));
+            const auto nz = P::add(z, P::mul(dz, halfStep));
+            const auto nw = P::sub(w, P::mul(dw, halfStep));
+            const auto lengthSq = P::add(P::add(P::add(P::mul(nx, nx), P::mul(ny, ny)), P::mul(nz, nz)), P::mul(nw, nw));
+            const auto invLength = P::div(P::set1(1.0f), P::sqrt(lengthSq));
+            P::store(qx + i, P::mul(nx, invLength));
+            P::store(qy + i, P::mul(ny, invLength));
+            P::store(qz + i, P::mul(nz, invLength));
+            P::store(qw + i, P::mul(nw, invLength));
+        }
+    });
+}
+
+void integrateVelocities(RigidBodies& bodies, float dt, const IntegratorSettings& settings) noexcept {
+    integrateVelocities(bodies, dt, settings, 0, bodies.size());
+}
+
+void integratePositions(RigidBodies& bodies, float dt) noexcept {
+    integratePositions(bodies, dt, 0, bodies.size());
+}
+
+void integrate(RigidBodies& bodies, float dt, const IntegratorSettings& settings) noexcept {
+    integrateVelocities(bodies, dt, settings);
+    integratePositions(bodies, dt);
+}
+
+} // namespace physics
@@ -0,0 +1,80 @@
+#include "include/Islands.h"
+
+#include <cassert>
+
+namespace physics {
+
+std::uint32_t Islands::findRoot(std::uint32_t i) noexcept {
+    // Path halving
+    while (parent[i] != i) {
+        parent[i] = parent[parent[i]];
+        i = parent[i];
+    }
+    return i;
+}
+
+void Islands::build(const RigidBodies& bodies, std::span<const BroadphasePair> links) {
+    const auto bodyCount = static_cast<std::uint32_t>(bodies.size());
+    parent.resize(bodyCount);
+    for (std::uint32_t i = 0; i < bodyCount; ++i) parent[i] = i;
+
+    // Union dynamic pairs; the smaller index becomes the root
+    for (const BroadphasePair& link : links) {
+        assert(link.a < bodyCount && link.b < bodyCount);
+        if (bodies.isStatic(link.a) || bodies.isStatic(link.b)) continue;
+        const std::uint32_t ra = findRoot(link.a);
+        const std::uint32_t rb = findRoot(link.b);
+        if (ra < rb) {
+            parent[rb] = ra;
+        } else if (rb < ra) {
+            parent[ra] = rb;
+        }
+    }
+
+    // Number islands in order of their smallest body (= the root)
+    bodyIsland.assign(bodyCount, NONE);
+    std::uint32_t islandCount = 0;
+    for (std::uint32_t i = 0; i < bodyCount; ++i) {
+        if (bodies.isStatic(i)) continue;
+        const std::uint32_t root = findRoot(i);
+        bodyIsland[i] = root == i ? islandCount++ : bodyIsland[root];
+    }
+
+    // Counting sort of bodies and links by island; stable, so ascending inside
+    bodyStart.assign(islandCount + 1, 0);
+    for (std::uint32_t i = 0; i < bodyCount; ++i) {
+        if (bodyIsland[i] != NONE) ++bodyStart[bodyIsland[i] + 1];
+    }
+    for (std::uint32_t k = 0; k < islandCount; ++k) bodyStart[k + 1] += bodyStart[k];
+    bodyIndices.resize(bodyStart[islandCount]);
+    parent.assign(bodyStart.begin(), bodyStart.end() - 1); // reuse as write cursors
+    for (std::uint32_t i = 0; i < bodyCount; ++i) {
+        if (bodyIsland[i] != NONE) bodyIndices[parent[bodyIsland[i]]++] = i;
+    }
+
+    auto linkIsland = [&](const BroadphasePair& link) {
+        return bodyIsland[link.a] != NONE ? bodyIsland[link.a] : bodyIsland[link.b];
+    };
+    linkStart.assign(islandCount + 1, 0);
+    for (const BroadphasePair& link : links) {
+        const std::uint32_t island = linkIsland(link);
+        if (island != NONE) ++linkStart[island + 1];
+    }
+    for (std::uint32_t k = 0; k < islandCount; ++k) linkStart[k + 1] += linkStart[k];
+    linkIndices.resize(linkStart[islandCount]);
+    parent.assign(linkStart.begin(), linkStart.end() - 1);
+    for (std::uint32_t l = 0; l < links.size(); ++l) {
+        const std::uint32_t island = linkIsland(links[l]);
+        if (island != NONE) linkIndices[parent[island]++] = l;
+    }
+}
+
+void Islands::clear() noexcept {
+    bodyIndices.clear();
+    bodyStart.clear();
+    linkIndices.clear();
+    linkStart.clear();
+    bodyIsland.clear();
+}
+
+} // namespace physics
@@ -0,0 +1,61 @@
+#include "include/Joints.h"
+
+#include <cassert>
+
+#include "include/Quaternion.h"
+
+namespace physics {
+
+namespace {
+
+math::Vector3 toBodyPoint(const RigidBodies& bodies, std::uint32_t i, const math::Vector3& world) noexcept {
+    return math::rotate(bodies.orientation(i).conjugate(), world - bodies.position.get(i));
+}
+
+math::Vector3 toBodyDirection(const RigidBodies& bodies, std::uint32_t i, const math::Vector3& world) noexcept {
+    return math::rotate(bodies.orientation(i).conjugate(), world);
+}
+
+} // namespace
+
+std::size_t Joints::addBallSocket(const RigidBodies& bodies, std::uint32_t a, std::uint32_t b,
+                                  const math::Vector3& worldAnchor) {
+    assert(a < bodies.size() && b < bodies.size() && a != b);
+    BallSocketJoint j;
+    j.bodyA = a;
+    j.bodyB = b;
+    j.localAnchorA = toBodyPoint(bodies, a, worldAnchor);
+    j.localAnchorB = toBodyPoint(bodies, b, worldAnchor);
+    ballSockets.push_back(j);
+    return ballSockets.size() - 1;
+}
+
+std::size_t Joints::addDistance(const RigidBodies& bodies, std::uint32_t a, std::uint32_t b,
+                                const math::Vector3& worldAnchorA, const math::Vector3& worldAnchorB) {
+    assert(a < bodies.size() && b < bodies.size() && a != b);
+    DistanceJoint j;
+    j.bodyA = a;
+    j.bodyB = b;
+    j.localAnchorA = toBodyPoint(bodies, a, worldAnchorA);
+    j.localAnchorB = toBodyPoint(bodies, b, worldAnchorB);
+    j.length = (worldAnchorB - worldAnchorA).length();
+    distances.push_back(j);
+    return distances.size() - 1;
+}
+
+std::size_t Joints::addHinge(const RigidBodies& bodies, std::uint32_t a, std::uint32_t b,
+                             const math::Vector3& worldAnchor, const math::Vector3& worldAxis) {
+    assert(a < bodies.size() && b < bodies.size() && a != b);
+    const math::Vector3 axis = worldAxis.normalized();
+    HingeJoint j;
+    j.bodyA = a;
+    j.bodyB = b;
+    j.localAnchorA = toBodyPoint(bodies, a, worldAnchor);
+    j.localAnchorB = toBodyPoint(bodies, b, worldAnchor);
+    j.localAxisA = toBodyDirection(bodies, a, axis);
+    j.localAxisB = toBodyDirection(bodies, b, axis);
+    hinges.push_back(j);
+    return hinges.size() - 1;
+}
+
+} // namespace physics
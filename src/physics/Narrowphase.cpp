@@ -0,0 +1,381 @@
+#include "include/Narrowphase.h"
+
+#include <algorithm>
+#include <cmath>
+#include <utility>
+
+#include "include/Gjk.h"
+
+namespace physics {
+
+using math::Vector3;
+
+namespace {
+
+// Favor faces over edges and A over B unless the alternative is clearly
+// better; avoids feature flip-flop between frames (Box2D's tolerances).
+constexpr float FACE_RELATIVE_TOLERANCE = 0.98f;
+constexpr float EDGE_RELATIVE_TOLERANCE = 0.95f;
+constexpr float ABSOLUTE_TOLERANCE = 0.001f;
+
+// Below this core distance the closest-point direction is unreliable
+constexpr float MIN_CORE_DISTANCE = 1e-5f;
+
+void addPoint(CollisionResult& out, const Vector3& onA, const Vector3& onB, float separation) noexcept {
+    if (out.pointCount < CollisionResult::MAX_POINTS) out.points[out.pointCount++] = {onA, onB, separation};
+}
+
+// Any unit vector perpendicular to v
+Vector3 perpendicular(const Vector3& v) noexcept {
+    const Vector3 other = std::fabs(v.x) < 0.57f ? Vector3(1.0f, 0.0f, 0.0f) : Vector3(0.0f, 1.0f, 0.0f);
+    return v.cross(other).normalized();
+}
+
+// Contact between two "core point + radius" features
+bool pointContact(const Vector3& coreA, float radiusA, const Vector3& coreB, float radiusB, float margin,
+                  const Vector3& fallbackNormal, CollisionResult& out) noexcept {
+    const Vector3 d = coreB - coreA;
+    const float distSq = d.lengthSquared();
+    const float reach = radiusA + radiusB + margin;
+    if (distSq > reach * reach) return false;
+    const float dist = std::sqrt(distSq);
+    out.normal = dist > MIN_CORE_DISTANCE ? d / dist : fallbackNormal;
+    out.pointCount = 0;
+    out.incremental = false;
+    addPoint(out, coreA + out.normal * radiusA, coreB - out.normal * radiusB, dist - radiusA - radiusB);
+    return true;
+}
+
+void capsuleSegment(const Shape& capsule, const Pose& pose, Vector3& p, Vector3& q) noexcept {
+    const Vector3 half = pose.axis(1) * capsule.halfHeight;
+    p = pose.position - half;
+    q = pose.position + half;
+}
+
+Vector3 closestPointOnSegment(const Vector3& p, const Vector3& q, const Vector3& point) noexcept {
+    const Vector3 d = q - p;
+    const float lengthSq = d.lengthSquared();
+    if (lengthSq <= 0.0f) return p;
+    const float t = std::clamp((point - p).dot(d) / lengthSq, 0.0f, 1.0f);
+    return p + d * t;
+}
+
+constexpr int MAX_CLIP_VERTICES = 8; // a quad clipped by four planes
+
+// Keeps the part of polygon in on the side plane.dot(p) <= offset
+int clipPolygon(const Vector3* in, int count, const Vector3& plane, float offset, Vector3* out) noexcept {
+    int written = 0;
+    for (int i = 0; i < count && written < MAX_CLIP_VERTICES; ++i) {
+        const Vector3& p = in[i];
+        const Vector3& q = in[(i + 1) % count];
+        const float dp = plane.dot(p) - offset;
+        const float dq = plane.dot(q) - offset;
+        if (dp <= 0.0f) out[written++] = p;
+        // Strict crossings only: a vertex on the plane is already emitted as itself
+        const bool crosses = (dp < 0.0f && dq > 0.0f) || (dp > 0.0f && dq < 0.0f);
+        if (crosses && written < MAX_CLIP_VERTICES) out[written++] = p + (q - p) * (dp / (dp - dq));
+    }
+    return written;
+}
+
+struct BoxFrame {
+    const Pose* pose;
+    Vector3 axes[3];
+    float half[3];
+
+    BoxFrame(const Shape& box, const Pose& p) noexcept
+        : pose(&p), axes{p.axis(0), p.axis(1), p.axis(2)}, half{box.halfExtents.x, box.halfExtents.y, box.halfExtents.z} {}
+};
+
+// Clips the face of inc most opposed to the reference face of ref on axis.
+// flip is true when ref is body B.
+void boxFaceContact(const BoxFrame& ref, const BoxFrame& inc, int axis, bool flip, float margin,
+                    CollisionResult& out) noexcept {
+    Vector3 n = ref.axes[axis];
+    if ((inc.pose->position - ref.pose->position).dot(n) < 0.0f) n = n * -1.0f;
+
+    int incAxis = 0;
+    float best = -1.0f;
+    for (int j = 0; j < 3; ++j) {
+        const float d = std::fabs(n.dot(inc.axes[j]));
+        if (d > best) {
+            best = d;
+            incAxis = j;
+        }
+    }
+    const float incSign = n.dot(inc.axes[incAxis]) > 0.0f ? -1.0f : 1.0f;
+    const Vector3 c = inc.pose->position + inc.axes[incAxis] * (incSign * inc.half[incAxis]);
+    const int u = (incAxis + 1) % 3, v = (incAxis + 2) % 3;
+    const Vector3 du = inc.axes[u] * inc.half[u], dv = inc.axes[v] * inc.half[v];
+
+    Vector3 bufferA[MAX_CLIP_VERTICES] = {c + du + dv, c - du + dv, c - du - dv, c + du - dv};
+    Vector3 bufferB[MAX_CLIP_VERTICES];
+    Vector3* poly = bufferA;
+    Vector3* scratch = bufferB;
+    int count = 4;
+    for (int k : {(axis + 1) % 3, (axis + 2) % 3}) {
+        const Vector3& side = ref.axes[k];
+        const float centerDot = side.dot(ref.pose->position);
+        count = clipPolygon(poly, count, side, centerDot + ref.half[k], scratch);
+        std::swap(poly, scratch);
+        count = clipPolygon(poly, count, side * -1.0f, -centerDot + ref.half[k], scratch);
+        std::swap(poly, scratch);
+        if (count == 0) return;
+    }
+
+    const Vector3 refCenter = ref.pose->position + n * ref.half[axis];
+    out.normal = flip ? n * -1.0f : n;
+    for (int i = 0; i < count; ++i) {
+        const float separation = n.dot(poly[i] - refCenter);
+        if (separation > margin) continue;
+        const Vector3 onRef = poly[i] - n * separation;
+        if (flip) {
+            addPoint(out, poly[i], onRef, separation);
+        } else {
+            addPoint(out, onRef, poly[i], separation);
+        }
+    }
+}
+
+} // namespace
+
+void closestPointsSegments(const Vector3& p1, const Vector3& q1, const Vector3& p2, const Vector3& q2, float& s,
+                           float& t, Vector3& c1, Vector3& c2) noexcept {
+    // Ericson, Real-Time Collision Detection, 5.1.9
+    constexpr float EPS = 1e-12f;
+    const Vector3 d1 = q1 - p1, d2 = q2 - p2, r = p1 - p2;
+    const float a = d1.dot(d1), e = d2.dot(d2), f = d2.dot(r);
+    if (a <= EPS && e <= EPS) {
+        s = t = 0.0f;
+    } else if (a <= EPS) {
+        s = 0.0f;
+        t = std::clamp(f / e, 0.0f, 1.0f);
+    } else {
+        const float c = d1.dot(r);
+        if (e <= EPS) {
+            t = 0.0f;
+            s = std::clamp(-c / a, 0.0f, 1.0f);
+        } else {
+            const float b = d1.dot(d2);
+            const float denom = a * e - b * b;
+            s = denom > EPS ? std::clamp((b * f - c * e) / denom, 0.0f, 1.0f) : 0.0f;
+            t = (b * s + f) / e;
+            if (t < 0.0f) {
+                t = 0.0f;
+                s = std::clamp(-c / a, 0.0f, 1.0f);
+            } else if (t > 1.0f) {
+                t = 1.0f;
+                s = std::clamp((b - c) / a, 0.0f, 1.0f);
+            }
+        }
+    }
+    c1 = p1 + d1 * s;
+    c2 = p2 + d2 * t;
+}
+
+bool collideSpheres(const Shape& a, const Pose& poseA, const Shape& b, const Pose& poseB, float margin,
+                    CollisionResult& out) noexcept {
+    return pointContact(poseA.position, a.radius, poseB.position, b.radius, margin, {0.0f, 1.0f, 0.0f}, out);
+}
+
+bool collideSphereCapsule(const Shape& a, const Pose& poseA, const Shape& b, const Pose& poseB, float margin,
+                          CollisionResult& out) noexcept {
+    Vector3 p, q;
+    capsuleSegment(b, poseB, p, q);
+    const Vector3 core = closestPointOnSegment(p, q, poseA.position);
+    return pointContact(poseA.position, a.radius, core, b.radius, margin, perpendicular(poseB.axis(1)), out);
+}
+
+bool collideCapsules(const Shape& a, const Pose& poseA, const Shape& b, const Pose& poseB, float margin,
+                     CollisionResult& out) noexcept {
+    Vector3 p1, q1, p2, q2;
+    capsuleSegment(a, poseA, p1, q1);
+    capsuleSegment(b, poseB, p2, q2);
+    float s, t;
+    Vector3 c1, c2;
+    closestPointsSegments(p1, q1, p2, q2, s, t, c1, c2);
+
+    const Vector3 axisA = poseA.axis(1);
+    Vector3 fallback = axisA.cross(poseB.axis(1));
+    fallback = fallback.lengthSquared() > 1e-6f ? fallback.normalized() : perpendicular(axisA);
+    if (!pointContact(c1, a.radius, c2, b.radius, margin, fallback, out)) return false;
+
+    // Nearly parallel cores: contact along the overlap, two points at its ends
+    const Vector3 d1 = q1 - p1, d2 = q2 - p2;
+    const float lengthSq1 = d1.lengthSquared();
+    if (lengthSq1 <= 0.0f || d2.lengthSquared() <= 0.0f) return true;
+    if (d1.cross(d2).lengthSquared() > 1e-4f * lengthSq1 * d2.lengthSquared()) return true;
+    const float t0 = std::clamp((p2 - p1).dot(d1) / lengthSq1, 0.0f, 1.0f);
+    const float t1 = std::clamp((q2 - p1).dot(d1) / lengthSq1, 0.0f, 1.0f);
+    if (std::fabs(t1 - t0) * std::sqrt(lengthSq1) < 2.0f * MIN_CORE_DISTANCE) return true;
+
+    const Vector3 n = out.normal;
+    out.pointCount = 0;
+    for (float tA : {std::min(t0, t1), std::max(t0, t1)}) {
+        const Vector3 onCoreA = p1 + d1 * tA;
+        const Vector3 onCoreB = closestPointOnSegment(p2, q2, onCoreA);
+        const float separation = (onCoreB - onCoreA).dot(n) - a.radius - b.radius;
+        if (separation <= margin) addPoint(out, onCoreA + n * a.radius, onCoreB - n * b.radius, separation);
+    }
+    return out.pointCount > 0;
+}
+
+bool collideSphereBox(const Shape& a, const Pose& poseA, const Shape& b, const Pose& poseB, float margin,
+                      CollisionResult& out) noexcept {
+    const Vector3 center = poseB.toLocal(poseA.position);
+    const Vector3& h = b.halfExtents;
+    const Vector3 clamped(std::clamp(center.x, -h.x, h.x), std::clamp(center.y, -h.y, h.y),
+                          std::clamp(center.z, -h.z, h.z));
+    out.pointCount = 0;
+    out.incremental = false;
+
+    if (clamped.x != center.x || clamped.y != center.y || clamped.z != center.z) {
+        const Vector3 onBox = poseB.toWorld(clamped);
+        return pointContact(poseA.position, a.radius, onBox, 0.0f, margin, {0.0f, 1.0f, 0.0f}, out);
+    }
+
+    // Center inside the box: push out through the nearest face
+    const float depth[3] = {h.x - std::fabs(center.x), h.y - std::fabs(center.y), h.z - std::fabs(center.z)};
+    const float coord[3] = {center.x, center.y, center.z};
+    const int k = depth[0] <= depth[1] && depth[0] <= depth[2] ? 0 : (depth[1] <= depth[2] ? 1 : 2);
+    const float sign = coord[k] >= 0.0f ? 1.0f : -1.0f;
+    const Vector3 faceNormal = poseB.axis(k) * sign; // out of the box, towards the sphere center
+    out.normal = faceNormal * -1.0f;
+    const Vector3 onBox = poseA.position + faceNormal * depth[k];
+    addPoint(out, poseA.position + out.normal * a.radius, onBox, -depth[k] - a.radius);
+    return true;
+}
+
+bool collideBoxes(const Shape& a, const Pose& poseA, const Shape& b, const Pose& poseB, float margin,
+                  CollisionResult& out) noexcept {
+    const BoxFrame boxA(a, poseA), boxB(b, poseB);
+    const Vector3 d = poseB.position - poseA.position;
+
+    float absR[3][3];
+    for (int i = 0; i < 3; ++i) {
+        for (int j = 0; j < 3; ++j) absR[i][j] = std::fabs(boxA.axes[i].dot(boxB.axes[j])) + 1e-6f;
+    }
+
+    float faceA = -INFINITY, faceB = -INFINITY, edge = -INFINITY;
+    int axisA = 0, axisB = 0, edgeI = 0, edgeJ = 0;
+    Vector3 edgeAxis;
+
+    for (int i = 0; i < 3; ++i) {
+        const float r = boxA.half[i] + boxB.half[0] * absR[i][0] + boxB.half[1] * absR[i][1] + boxB.half[2] * absR[i][2];
+        const float s = std::fabs(d.dot(boxA.axes[i])) - r;
+        if (s > margin) return false;
+        if (s > faceA) {
+            faceA = s;
+            axisA = i;
+        }
+    }
+    for (int j = 0; j < 3; ++j) {
+        const float r = boxB.half[j] + boxA.half[0] * absR[0][j] + boxA.half[1] * absR[1][j] + boxA.half[2] * absR[2][j];
+        const float s = std::fabs(d.dot(boxB.axes[j])) - r;
+        if (s > margin) return false;
+        if (s > faceB) {
+            faceB = s;
+            axisB = j;
+        }
+    }
+    for (int i = 0; i < 3; ++i) {
+        for (int j = 0; j < 3; ++j) {
+            Vector3 axis = boxA.axes[i].cross(boxB.axes[j]);
+            const float length = axis.length();
+            if (length < 1e-5f) continue; // parallel edges: covered by the face axes
+            axis /= length;
+            float rA = 0.0f, rB = 0.0f;
+            for (int k = 0; k < 3; ++k) {
+                rA += boxA.half[k] * std::fabs(boxA.axes[k].dot(axis));
+                rB += boxB.half[k] * std::fabs(boxB.axes[k].dot(axis));
+            }
+            const float s = std::fabs(d.dot(axis)) - rA - rB;
+            if (s > margin) return false;
+            if (s > edge) {
+                edge = s;
+                edgeI = i;
+                edgeJ = j;
+                edgeAxis = axis;
+            }
+        }
+    }
+
+    out.pointCount = 0;
+    out.incremental = false;
+    const bool useB = faceB > FACE_RELATIVE_TOLERANCE * faceA + ABSOLUTE_TOLERANCE;
+    const float face = useB ? faceB : faceA;
+    if (edge > EDGE_RELATIVE_TOLERANCE * face + ABSOLUTE_TOLERANCE) {
+        const Vector3 n = edgeAxis.dot(d) < 0.0f ? edgeAxis * -1.0f : edgeAxis;
+        Vector3 centerA = poseA.position, centerB = poseB.position;
+        for (int k = 0; k < 3; ++k) {
+            if (k != edgeI) centerA += boxA.axes[k] * (n.dot(boxA.axes[k]) >= 0.0f ? boxA.half[k] : -boxA.half[k]);
+            if (k != edgeJ) centerB += boxB.axes[k] * (n.dot(boxB.axes[k]) >= 0.0f ? -boxB.half[k] : boxB.half[k]);
+        }
+        const Vector3 ea = boxA.axes[edgeI] * boxA.half[edgeI];
+        const Vector3 eb = boxB.axes[edgeJ] * boxB.half[edgeJ];
+        float s, t;
+        Vector3 c1, c2;
+        closestPointsSegments(centerA - ea, centerA + ea, centerB - eb, centerB + eb, s, t, c1, c2);
+        out.normal = n;
+        addPoint(out, c1, c2, n.dot(c2 - c1));
+    } else if (useB) {
+        boxFaceContact(boxB, boxA, axisB, true, margin, out);
+    } else {
+        boxFaceContact(boxA, boxB, axisA, false, margin, out);
+    }
+    return out.pointCount > 0;
+}
+
+bool collideConvex(const Shape& a, const Pose& poseA, const Shape& b, const Pose& poseB, float margin,
+                   CollisionResult& out) noexcept {
+    out.pointCount = 0;
+    out.incremental = true;
+    const float radiusA = a.coreRadius(), radiusB = b.coreRadius();
+
+    const GjkResult cores = gjkDistance({&a, &poseA, false}, {&b, &poseB, false});
+    if (!cores.overlapping && cores.distance > MIN_CORE_DISTANCE) {
+        if (cores.distance > radiusA + radiusB + margin) return false;
+        out.normal = (cores.pointB - cores.pointA) / cores.distance;
+        addPoint(out, cores.pointA + out.normal * radiusA, cores.pointB - out.normal * radiusB,
+                 cores.distance - radiusA - radiusB);
+        return true;
+    }
+
+    // Cores overlap: the full shapes penetrate deeply
+    EpaResult epa;
+    if (!epaPenetration({&a, &poseA, true}, {&b, &poseB, true}, epa)) return false;
+    out.normal = epa.normal;
+    addPoint(out, epa.pointA, epa.pointB, -epa.depth);
+    return true;
+}
+
+bool collide(const Shape& a, const Pose& poseA, const Shape& b, const Pose& poseB, float margin,
+             CollisionResult& out) noexcept {
+    if (!a.collides() || !b.collides()) return false;
+    // Tests are written for the lower shape type first; swap and mirror otherwise
+    if (a.type > b.type) {
+        if (!collide(b, poseB, a, poseA, margin, out)) return false;
+        out.normal = out.normal * -1.0f;
+        for (int i = 0; i < out.pointCount; ++i) std::swap(out.points[i].onA, out.points[i].onB);
+        return true;
+    }
+
+    switch (a.type) {
+        case ShapeType::Sphere:
+            if (b.type == ShapeType::Sphere) return collideSpheres(a, poseA, b, poseB, margin, out);
+            if (b.type == ShapeType::Capsule) return collideSphereCapsule(a, poseA, b, poseB, margin, out);
+            if (b.type == ShapeType::Box) return collideSphereBox(a, poseA, b, poseB, margin, out);
+            break;
+        case ShapeType::Capsule:
+            if (b.type == ShapeType::Capsule) return collideCapsules(a, poseA, b, poseB, margin, out);
+            break;
+        case ShapeType::Box:
+            if (b.type == ShapeType::Box) return collideBoxes(a, poseA, b, poseB, margin, out);
+            break;
+        default:
+            break;
+    }
+    return collideConvex(a, poseA, b, poseB, margin, out);
+}
+
+} // namespace physics
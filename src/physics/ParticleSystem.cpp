@@ -0,0 +1,186 @@
+#include "include/ParticleSystem.h"
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <numbers>
+
+#include "include/JobSystem.h"
+#include "include/SimdPack.h"
+
+namespace physics {
+
+namespace {
+
+using math::Vector3;
+using math::simd::forEachPack;
+
+// splitmix64: one 64-bit state, good enough for visual randomness and the
+// same sequence on every platform (unlike std distributions).
+std::uint64_t nextRandom(std::uint64_t& state) noexcept {
+    std::uint64_t z = (state += 0x9E3779B97F4A7C15ull);
+    z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+    z = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+    return z ^ (z >> 31);
+}
+
+// Uniform in [0, 1) from the top 24 bits
+float unitRandom(std::uint64_t& state) noexcept {
+    return static_cast<float>(nextRandom(state) >> 40) * 0x1.0p-24f;
+}
+
+float randomIn(std::uint64_t& state, float lo, float hi) noexcept {
+    return lo + (hi - lo) * unitRandom(state);
+}
+
+// Uniform direction inside the cone of half angle spread around axis
+Vector3 coneDirection(std::uint64_t& state, const Vector3& axis, float spread) noexcept {
+    const float cosTheta = randomIn(state, std::cos(spread), 1.0f);
+    const float sinTheta = std::sqrt(std::max(0.0f, 1.0f - cosTheta * cosTheta));
+    const float phi = 2.0f * std::numbers::pi_v<float> * unitRandom(state);
+    // Orthonormal basis around axis (Frisvad / Duff et al.)
+    const float sign = std::copysign(1.0f, axis.z);
+    const float a = -1.0f / (sign + axis.z);
+    const float b = axis.x * axis.y * a;
+    const Vector3 t1{1.0f + sign * axis.x * axis.x * a, sign * b, -sign * axis.x};
+    const Vector3 t2{b, sign + axis.y * axis.y * a, -axis.y};
+    return axis * cosTheta + (t1 * std::cos(phi) + t2 * std::sin(phi)) * sinTheta;
+}
+
+} // namespace
+
+void ParticleSystem::reserve(std::size_t count) {
+    position.reserve(count);
+    velocity.reserve(count);
+    life.reserve(count);
+    lifetime.reserve(count);
+}
+
+void ParticleSystem::clear() noexcept {
+    position.clear();
+    velocity.clear();
+    life.clear();
+    lifetime.clear();
+}
+
+std::size_t ParticleSystem::emit(const Vector3& p, const Vector3& v, float seconds) {
+    assert(seconds > 0.0f);
+    if (size() >= config.maxParticles) return NONE;
+    position.pushBack(p);
+    velocity.pushBack(v);
+    life.pushBack(seconds);
+    lifetime.pushBack(seconds);
+    return size() - 1;
+}
+
+std::size_t ParticleSystem::kill(std::size_t index) noexcept {
+    assert(index < size());
+    position.swapRemove(index);
+    velocity.swapRemove(index);
+    life.swapRemove(index);
+    lifetime.swapRemove(index);
+    return size();
+}
+
+std::size_t ParticleSystem::addEmitter(const EmitterDesc& desc) {
+    assert(desc.minSpeed <= desc.maxSpeed && desc.minLifetime <= desc.maxLifetime);
+    assert(desc.minLifetime > 0.0f && desc.rate >= 0.0f);
+    Emitter e;
+    e.desc = desc;
+    e.rngState = desc.seed;
+    emitters.push_back(e);
+    return emitters.size() - 1;
+}
+
+std::uint32_t ParticleSystem::simulate(float dt, std::size_t first, std::size_t last) noexcept {
+    assert(first <= last && last <= size());
+    const float dragFactor = 1.0f / (1.0f + dt * config.drag);
+    float* px = position.x() + first; float* py = position.y() + first; float* pz = position.z() + first;
+    float* vx = velocity.x() + first; float* vy = velocity.y() + first; float* vz = velocity.z() + first;
+    float* remaining = life.data() + first;
+
+    forEachPack(last - first, [&]<typename P>(std::size_t begin, std::size_t end) {
+        const auto step = P::set1(dt), drag = P::set1(dragFactor);
+        const auto gx = P::mul(P::set1(config.gravity.x), step);
+        const auto gy = P::mul(P::set1(config.gravity.y), step);
+        const auto gz = P::mul(P::set1(config.gravity.z), step);
+        for (std::size_t i = begin; i < end; i += P::WIDTH) {
+            // Semi-implicit Euler, as for rigid bodies: v first, then x with the new v
+            const auto nvx = P::mul(P::add(P::load(vx + i), gx), drag);
+            const auto nvy = P::mul(P::add(P::load(vy + i), gy), drag);
+            const auto nvz = P::mul(P::add(P::load(vz + i), gz), drag);
+            P::store(vx + i, nvx);
+            P::store(vy + i, nvy);
+            P::store(vz + i, nvz);
+            P::store(px + i, P::add(P::load(px + i), P::mul(nvx, step)));
+            P::store(py + i, P::add(P::load(py + i), P::mul(nvy, step)));
+            P::store(pz + i, P::add(P::load(pz + i), P::mul(nvz, step)));
+            P::store(remaining + i, P::sub(P::load(remaining + i), step));
+        }
+    });
+
+    std::uint32_t dead = 0;
+    for (std::size_t i = 0; i < last - first; ++i) dead += remaining[i] <= 0.0f ? 1u : 0u;
+    return dead;
+}
+
+void ParticleSystem::removeDead() {
+    std::size_t pending = 0;
+    for (std::uint32_t d : deadPerChunk) pending += d;
+
+    // Chunks in order; each kill pulls a particle from the tail into slot i,
+    // so slot i is checked again. Dead tail particles are caught that way,
+    // which keeps later chunk counts valid as upper bounds.
+    for (std::size_t c = 0; c < deadPerChunk.size() && pending > 0; ++c) {
+        if (deadPerChunk[c] == 0) continue;
+        const std::size_t end = (c + 1) * PARTICLES_PER_JOB;
+        for (std::size_t i = c * PARTICLES_PER_JOB; i < std::min(end, size()) && pending > 0; ++i) {
+            while (i < size() && life[i] <= 0.0f) {
+                kill(i);
+                --pending;
+            }
+        }
+    }
+}
+
+void ParticleSystem::spawn(Emitter& e, float dt) {
+    const EmitterDesc& d = e.desc;
+    e.carry += d.rate * dt;
+    const float whole = std::floor(e.carry);
+    e.carry -= whole;
+    const Vector3 axis = d.direction.normalized();
+    for (auto n = static_cast<std::size_t>(whole); n > 0; --n) {
+        std::uint64_t& s = e.rngState;
+        const Vector3 p{d.position.x + d.extents.x * randomIn(s, -1.0f, 1.0f),
+                        d.position.y + d.extents.y * randomIn(s, -1.0f, 1.0f),
+                        d.position.z + d.extents.z * randomIn(s, -1.0f, 1.0f)};
+        const Vector3 v = coneDirection(s, axis, d.spread) * randomIn(s, d.minSpeed, d.maxSpeed);
+        if (emit(p, v, randomIn(s, d.minLifetime, d.maxLifetime)) == NONE) {
+            e.carry = 0.0f; // full: drop the rest rather than bursting later
+            return;
+        }
+    }
+}
+
+void ParticleSystem::update(float dt, core::JobSystem* jobs) {
+    assert(dt > 0.0f);
+    const std::size_t chunks = (size() + PARTICLES_PER_JOB - 1) / PARTICLES_PER_JOB;
+    deadPerChunk.assign(chunks, 0);
+    auto simulateRange = [&](std::size_t begin, std::size_t end) {
+        for (std::size_t c = begin; c < end; ++c) {
+            deadPerChunk[c] = simulate(dt, c * PARTICLES_PER_JOB, std::min((c + 1) * PARTICLES_PER_JOB, size()));
+        }
+    };
+    if (jobs && chunks > 1) {
+        jobs->parallelFor(0, chunks, 1, simulateRange);
+    } else {
+        simulateRange(0, chunks);
+    }
+
+    removeDead();
+    for (Emitter& e : emitters) {
+        if (e.desc.enabled) spawn(e, dt);
+    }
+}
+
+} // namespace physics
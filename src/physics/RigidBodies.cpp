@@ -0,0 +1,97 @@
+#include "include/RigidBodies.h"
+
+#include <algorithm>
+#include <cassert>
+
+namespace physics {
+
+namespace {
+
+float invertOrZero(float v) noexcept {
+    return v > 0.0f ? 1.0f / v : 0.0f;
+}
+
+} // namespace
+
+void RigidBodies::reserve(std::size_t count) {
+    position.reserve(count);
+    linearVelocity.reserve(count);
+    angularVelocity.reserve(count);
+    qx.reserve(count);
+    qy.reserve(count);
+    qz.reserve(count);
+    qw.reserve(count);
+    force.reserve(count);
+    torque.reserve(count);
+    inverseMass.reserve(count);
+    inverseInertia.reserve(count);
+    shape.reserve(count);
+}
+
+std::size_t RigidBodies::add(const BodyDesc& desc) {
+    assert(desc.mass >= 0.0f);
+    const std::size_t index = size();
+    const bool isStaticBody = desc.mass == 0.0f;
+    position.pushBack(desc.position);
+    // Static bodies never move, whatever velocity they were created with
+    linearVelocity.pushBack(isStaticBody ? math::Vector3{} : desc.linearVelocity);
+    angularVelocity.pushBack(isStaticBody ? math::Vector3{} : desc.angularVelocity);
+    const math::Quaternion q = desc.orientation.normalized();
+    qx.pushBack(q.x);
+    qy.pushBack(q.y);
+    qz.pushBack(q.z);
+    qw.pushBack(q.w);
+    force.pushBack({});
+    torque.pushBack({});
+    inverseMass.pushBack(invertOrZero(desc.mass));
+    inverseInertia.pushBack(isStaticBody ? math::Vector3{}
+                                         : math::Vector3{invertOrZero(desc.inertia.x), invertOrZero(desc.inertia.y),
+                                                         invertOrZero(desc.inertia.z)});
+    shape.pushBack(desc.shape);
+    return index;
+}
+
+std::size_t RigidBodies::remove(std::size_t index) noexcept {
+    assert(index < size());
+    const std::size_t last = size() - 1;
+    position.swapRemove(index);
+    linearVelocity.swapRemove(index);
+    angularVelocity.swapRemove(index);
+    qx.swapRemove(index);
+    qy.swapRemove(index);
+    qz.swapRemove(index);
+    qw.swapRemove(index);
+    force.swapRemove(index);
+    torque.swapRemove(index);
+    inverseMass.swapRemove(index);
+    inverseInertia.swapRemove(index);
+    shape.swapRemove(index);
+    return last;
+}
+
+void RigidBodies::clear() noexcept {
+    position.clear();
+    linearVelocity.clear();
+    angularVelocity.clear();
+    qx.clear();
+    qy.clear();
+    qz.clear();
+    qw.clear();
+    force.clear();
+    torque.clear();
+    inverseMass.clear();
+    inverseInertia.clear();
+    shape.clear();
+}
+
+void RigidBodies::clearForces() noexcept {
+    const std::size_t n = size();
+    std::fill_n(force.x(), n, 0.0f);
+    std::fill_n(force.y(), n, 0.0f);
+    std::fill_n(force.z(), n, 0.0f);
+    std::fill_n(torque.x(), n, 0.0f);
+    std::fill_n(torque.y(), n, 0.0f);
+    std::fill_n(torque.z(), n, 0.0f);
+}
+
+} // namespace physics
@@ -0,0 +1,90 @@
+#include "include/Shapes.h"
+
+#include <cassert>
+#include <cmath>
+
+namespace physics {
+
+using math::Vector3;
+
+Vector3 ConvexHull::support(const Vector3& direction) const noexcept {
+    assert(!vertices.empty());
+    const Vector3* best = &vertices[0];
+    float bestDot = best->dot(direction);
+    for (const Vector3& v : vertices) {
+        const float d = v.dot(direction);
+        if (d > bestDot) {
+            bestDot = d;
+            best = &v;
+        }
+    }
+    return *best;
+}
+
+Vector3 Shape::coreSupport(const Pose& pose, const Vector3& direction) const noexcept {
+    const Vector3 d = pose.unrotate(direction);
+    Vector3 local;
+    switch (type) {
+        case ShapeType::None:
+        case ShapeType::Sphere:
+            break;
+        case ShapeType::Capsule:
+            local = {0.0f, d.y >= 0.0f ? halfHeight : -halfHeight, 0.0f};
+            break;
+        case ShapeType::Box:
+            local = {d.x >= 0.0f ? halfExtents.x : -halfExtents.x,
+                     d.y >= 0.0f ? halfExtents.y : -halfExtents.y,
+                     d.z >= 0.0f ? halfExtents.z : -halfExtents.z};
+            break;
+        case ShapeType::ConvexHull:
+            local = hull->support(d);
+            break;
+    }
+    return pose.toWorld(local);
+}
+
+Vector3 Shape::support(const Pose& pose, const Vector3& direction) const noexcept {
+    const Vector3 core = coreSupport(pose, direction);
+    const float r = coreRadius();
+    if (r == 0.0f) return core;
+    const float lengthSq = direction.lengthSquared();
+    return lengthSq > 0.0f ? core + direction * (r / std::sqrt(lengthSq)) : core;
+}
+
+Aabb Shape::bounds(const Pose& pose) const noexcept {
+    // Extent along world axis k is the support distance along +k
+    Vector3 extent;
+    switch (type) {
+        case ShapeType::None:
+            break;
+        case ShapeType::Sphere:
+            extent = {radius, radius, radius};
+            break;
+        case ShapeType::Capsule: {
+            const Vector3 up = pose.axis(1);
+            extent = {std::fabs(up.x) * halfHeight + radius, std::fabs(up.y) * halfHeight + radius,
+                      std::fabs(up.z) * halfHeight + radius};
+            break;
+        }
+        case ShapeType::Box: {
+            const math::Rotation3& r = pose.rotation;
+            auto row = [&](int i) {
+                return std::fabs(r.m[i][0]) * halfExtents.x + std::fabs(r.m[i][1]) * halfExtents.y +
+                       std::fabs(r.m[i][2]) * halfExtents.z;
+            };
+            extent = {row(0), row(1), row(2)};
+            break;
+        }
+        case ShapeType::ConvexHull: {
+            Aabb box{pose.toWorld(hull->vertices[0]), pose.toWorld(hull->vertices[0])};
+            for (const Vector3& v : hull->vertices) {
+                const Vector3 p = pose.toWorld(v);
+                box = box.merged({p, p});
+            }
+            return box;
+        }
+    }
+    return Aabb::fromCenterHalfExtents(pose.position, extent);
+}
+
+} // namespace physics
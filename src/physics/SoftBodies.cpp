@@ -0,0 +1,374 @@
+#include "include/SoftBodies.h"
+
+#include <algorithm>
+#include <bit>
+#include <cassert>
+#include <tuple>
+#include <utility>
+
+#include "include/JobSystem.h"
+#include "include/SimdPack.h"
+
+namespace physics {
+
+namespace {
+
+using math::Vector3;
+using math::simd::forEachPack;
+using math::simd::PackScalar;
+
+template <typename Range>
+void runRange(core::JobSystem* jobs, std::size_t count, std::size_t grain, Range&& range) {
+    if (jobs && count > grain) {
+        jobs->parallelFor(0, count, grain, range);
+    } else {
+        range(0, count);
+    }
+}
+
+std::span<const std::uint32_t> particlesOf(const DistanceConstraint& c) noexcept { return {&c.a, 2}; }
+std::span<const std::uint32_t> particlesOf(const VolumeConstraint& c) noexcept { return c.particles; }
+
+float tetVolume(const Vector3& p0, const Vector3& p1, const Vector3& p2, const Vector3& p3) noexcept {
+    return (p1 - p0).cross(p2 - p0).dot(p3 - p0) / 6.0f;
+}
+
+// Greedy coloring: each constraint takes the lowest color none of its
+// particles has yet. Constraints are then stably sorted by color, so each
+// color is a contiguous range and keeps the insertion (memory) order.
+template <typename Group>
+void colorGroup(Group& group, std::vector<std::uint64_t>& particleColors, std::size_t particleCount) {
+    auto& constraints = group.constraints;
+    particleColors.assign(particleCount, 0);
+    std::vector<std::uint32_t> colorOf(constraints.size());
+    std::uint32_t counts[SoftBodies::MAX_COLORS + 1] = {};
+    for (std::size_t i = 0; i < constraints.size(); ++i) {
+        std::uint64_t used = 0;
+        for (std::uint32_t p : particlesOf(constraints[i])) used |= particleColors[p];
+        const auto color = static_cast<std::uint32_t>(std::countr_one(used)); // MAX_COLORS when all taken
+        if (color < SoftBodies::MAX_COLORS) {
+            for (std::uint32_t p : particlesOf(constraints[i])) particleColors[p] |= std::uint64_t{1} << color;
+        }
+        colorOf[i] = color;
+        ++counts[color];
+    }
+
+    group.colorStart.clear();
+    group.colorStart.push_back(0);
+    std::uint32_t offsets[SoftBodies::MAX_COLORS + 1];
+    for (int c = 0; c <= SoftBodies::MAX_COLORS; ++c) {
+        offsets[c] = group.colorStart.back();
+        if (counts[c] > 0) group.colorStart.push_back(group.colorStart.back() + counts[c]);
+    }
+    group.overflowColor = counts[SoftBodies::MAX_COLORS] > 0;
+    decltype(group.constraints) sorted(constraints.size());
+    for (std::size_t i = 0; i < constraints.size(); ++i) sorted[offsets[colorOf[i]]++] = constraints[i];
+    constraints.swap(sorted);
+    group.colored = true;
+}
+
+// Mirrors color-sorted distance constraints into lane streams
+template <typename Lanes>
+void fillLanes(Lanes& lanes, std::span<const DistanceConstraint> constraints) {
+    lanes.a.clear();
+    lanes.b.clear();
+    lanes.restLength.clear();
+    lanes.compliance.clear();
+    lanes.a.reserve(constraints.size());
+    lanes.b.reserve(constraints.size());
+    lanes.restLength.reserve(constraints.size());
+    lanes.compliance.reserve(constraints.size());
+    for (const DistanceConstraint& c : constraints) {
+        lanes.a.pushBack(c.a);
+        lanes.b.pushBack(c.b);
+        lanes.restLength.pushBack(c.restLength);
+        lanes.compliance.pushBack(c.compliance);
+    }
+}
+
+// One XPBD projection of constraints [i, i + P::WIDTH), one per lane. The
+// lanes' particles are disjoint (same color), so gather/scatter is safe.
+template <typename P, typename Lanes>
+void solveDistanceLanes(const Lanes& c, std::size_t i, float* x, float* y, float* z, const float* inverseMass,
+                        float inverseStepSquared) noexcept {
+    const std::uint32_t* ia = c.a.data() + i;
+    const std::uint32_t* ib = c.b.data() + i;
+    const auto zero = P::zero();
+    const auto pa = P::gather(inverseMass, ia), pb = P::gather(inverseMass, ib);
+    const auto ax = P::gather(x, ia), ay = P::gather(y, ia), az = P::gather(z, ia);
+    const auto bx = P::gather(x, ib), by = P::gather(y, ib), bz = P::gather(z, ib);
+    const auto dx = P::sub(ax, bx), dy = P::sub(ay, by), dz = P::sub(az, bz);
+    const auto length = P::sqrt(P::add(P::add(P::mul(dx, dx), P::mul(dy, dy)), P::mul(dz, dz)));
+    const auto w = P::add(pa, pb);
+    const auto denominator = P::add(w, P::mul(P::load(c.compliance.data() + i), P::set1(inverseStepSquared)));
+    // Both ends pinned or coincident ends: no correction
+    const auto valid = P::mul(w, length);
+    const auto lambda = P::selectNonZero(valid, P::div(P::sub(P::load(c.restLength.data() + i), length), denominator), zero);
+    const auto scale = P::selectNonZero(valid, P::div(lambda, length), zero);
+    const auto cx = P::mul(dx, scale), cy = P::mul(dy, scale), cz = P::mul(dz, scale);
+    P::scatter(x, ia, P::add(ax, P::mul(cx, pa)));
+    P::scatter(y, ia, P::add(ay, P::mul(cy, pa)));
+    P::scatter(z, ia, P::add(az, P::mul(cz, pa)));
+    P::scatter(x, ib, P::sub(bx, P::mul(cx, pb)));
+    P::scatter(y, ib, P::sub(by, P::mul(cy, pb)));
+    P::scatter(z, ib, P::sub(bz, P::mul(cz, pb)));
+}
+
+void solveVolume(const VolumeConstraint& c, float* x, float* y, float* z, const float* inverseMass,
+                 float inverseStepSquared) noexcept {
+    // Gradient of the volume at each vertex: the opposite face normal (area-weighted) / 6
+    static constexpr std::uint32_t OPPOSITE[4][3] = {{1, 3, 2}, {0, 2, 3}, {0, 3, 1}, {0, 1, 2}};
+    Vector3 p[4];
+    float w[4];
+    for (int k = 0; k < 4; ++k) {
+        const std::uint32_t id = c.particles[k];
+        p[k] = {x[id], y[id], z[id]};
+        w[k] = inverseMass[id];
+    }
+    Vector3 gradient[4];
+    float denominator = c.compliance * inverseStepSquared;
+    for (int k = 0; k < 4; ++k) {
+        const Vector3& o = p[OPPOSITE[k][0]];
+        gradient[k] = (p[OPPOSITE[k][1]] - o).cross(p[OPPOSITE[k][2]] - o) / 6.0f;
+        denominator += w[k] * gradient[k].lengthSquared();
+    }
+    if (denominator == 0.0f) return;
+    const float lambda = (c.restVolume - tetVolume(p[0], p[1], p[2], p[3])) / denominator;
+    for (int k = 0; k < 4; ++k) {
+        const std::uint32_t id = c.particles[k];
+        const Vector3 moved = p[k] + gradient[k] * (lambda * w[k]);
+        x[id] = moved.x;
+        y[id] = moved.y;
+        z[id] = moved.z;
+    }
+}
+
+// Solves every color of a group in order; each color in SIMD lanes and parallel chunks
+template <typename Group, typename Serial, typename Lanes>
+void solveGroup(const Group& group, core::JobSystem* jobs, Serial&& serial, Lanes&& lanes) {
+    const std::size_t colors = group.colorStart.size() - 1;
+    for (std::size_t color = 0; color < colors; ++color) {
+        const std::size_t first = group.colorStart[color], last = group.colorStart[color + 1];
+        if (group.overflowColor && color + 1 == colors) {
+            for (std::size_t i = first; i < last; ++i) serial(i);
+            continue;
+        }
+        runRange(jobs, last - first, SoftBodies::CONSTRAINTS_PER_JOB, [&](std::size_t begin, std::size_t end) {
+            lanes(first + begin, first + end);
+        });
+    }
+}
+
+} // namespace
+
+void SoftBodies::reserve(std::size_t particles) {
+    position.reserve(particles);
+    velocity.reserve(particles);
+    previous.reserve(particles);
+    inverseMass.reserve(particles);
+}
+
+std::uint32_t SoftBodies::addParticle(const Vector3& p, float mass) {
+    assert(mass >= 0.0f && size() < (std::size_t{1} << 32) - 1);
+    position.pushBack(p);
+    velocity.pushBack({});
+    previous.pushBack(p);
+    inverseMass.pushBack(mass > 0.0f ? 1.0f / mass : 0.0f);
+    return static_cast<std::uint32_t>(size() - 1);
+}
+
+void SoftBodies::pin(std::uint32_t i) noexcept {
+    assert(i < size());
+    inverseMass[i] = 0.0f;
+    velocity.set(i, {});
+}
+
+void SoftBodies::addDistance(std::uint32_t a, std::uint32_t b, float compliance) {
+    assert(a < size() && b < size() && a != b && compliance >= 0.0f);
+    stretch.constraints.push_back({a, b, (position.get(a) - position.get(b)).length(), compliance});
+    stretch.colored = false;
+}
+
+void SoftBodies::addBending(std::uint32_t a, std::uint32_t b, float compliance) {
+    assert(a < size() && b < size() && a != b && compliance >= 0.0f);
+    bending.constraints.push_back({a, b, (position.get(a) - position.get(b)).length(), compliance});
+    bending.colored = false;
+}
+
+void SoftBodies::addVolume(std::uint32_t a, std::uint32_t b, std::uint32_t c, std::uint32_t d, float compliance) {
+    assert(a < size() && b < size() && c < size() && d < size() && compliance >= 0.0f);
+    VolumeConstraint v;
+    v.particles[0] = a;
+    v.particles[1] = b;
+    v.particles[2] = c;
+    v.particles[3] = d;
+    v.restVolume = tetVolume(position.get(a), position.get(b), position.get(c), position.get(d));
+    v.compliance = compliance;
+    volume.constraints.push_back(v);
+    volume.colored = false;
+}
+
+std::uint32_t SoftBodies::addCloth(std::span<const Vector3> vertices, std::span<const std::uint32_t> triangles,
+                                   const SoftBodyMaterial& material) {
+    assert(triangles.size() % 3 == 0);
+    const auto first = static_cast<std::uint32_t>(size());
+    reserve(size() + vertices.size());
+    for (const Vector3& v : vertices) addParticle(v, material.particleMass);
+
+    // (lower, upper, opposite vertex) per triangle edge; sorting puts the
+    // two triangles of a shared edge next to each other
+    std::vector<std::tuple<std::uint32_t, std::uint32_t, std::uint32_t>> edges;
+    edges.reserve(triangles.size());
+    for (std::size_t t = 0; t < triangles.size(); t += 3) {
+        for (int k = 0; k < 3; ++k) {
+            const std::uint32_t a = triangles[t + k], b = triangles[t + (k + 1) % 3], o = triangles[t + (k + 2) % 3];
+            assert(a < vertices.size() && b < vertices.size() && o < vertices.size());
+            edges.emplace_back(std::min(a, b), std::max(a, b), o);
+        }
+    }
+    std::sort(edges.begin(), edges.end());
+    for (std::size_t i = 0; i < edges.size(); ++i) {
+        const auto [a, b, o] = edges[i];
+        if (i > 0 && std::get<0>(edges[i - 1]) == a && std::get<1>(edges[i - 1]) == b) {
+            addBending(first + std::get<2>(edges[i - 1]), first + o, material.bendCompliance);
+        } else {
+            addDistance(first + a, first + b, material.stretchCompliance);
+        }
+    }
+    return first;
+}
+
+std::uint32_t SoftBodies::addClothGrid(const Vector3& origin, const Vector3& u, const Vector3& v,
+                                       std::uint32_t cols, std::uint32_t rows, const SoftBodyMaterial& material) {
+    assert(cols >= 2 && rows >= 2);
+    std::vector<Vector3> vertices;
+    vertices.reserve(std::size_t{cols} * rows);
+    for (std::uint32_t j = 0; j < rows; ++j) {
+        for (std::uint32_t i = 0; i < cols; ++i) {
+            vertices.push_back(origin + u * (static_cast<float>(i) / static_cast<float>(cols - 1)) +
+                               v * (static_cast<float>(j) / static_cast<float>(rows - 1)));
+        }
+    }
+    std::vector<std::uint32_t> triangles;
+    triangles.reserve(std::size_t{cols - 1} * (rows - 1) * 6);
+    for (std::uint32_t j = 0; j + 1 < rows; ++j) {
+        for (std::uint32_t i = 0; i + 1 < cols; ++i) {
+            const std::uint32_t q = j * cols + i;
+            triangles.insert(triangles.end(), {q, q + cols, q + 1, q + 1, q + cols, q + cols + 1});
+        }
+    }
+    return addCloth(vertices, triangles, material);
+}
+
+std::uint32_t SoftBodies::addTetMesh(std::span<const Vector3> vertices, std::span<const std::uint32_t> tetrahedra,
+                                     const SoftBodyMaterial& material) {
+    assert(tetrahedra.size() % 4 == 0);
+    const auto first = static_cast<std::uint32_t>(size());
+    reserve(size() + vertices.size());
+    for (const Vector3& v : vertices) addParticle(v, material.particleMass);
+
+    std::vector<std::pair<std::uint32_t, std::uint32_t>> edges;
+    edges.reserve(tetrahedra.size() / 4 * 6);
+    for (std::size_t t = 0; t < tetrahedra.size(); t += 4) {
+        for (int a = 0; a < 4; ++a) {
+            for (int b = a + 1; b < 4; ++b) {
+                const std::uint32_t i = tetrahedra[t + a], j = tetrahedra[t + b];
+                assert(i < vertices.size() && j < vertices.size());
+                edges.emplace_back(std::min(i, j), std::max(i, j));
+            }
+        }
+        addVolume(first + tetrahedra[t], first + tetrahedra[t + 1], first + tetrahedra[t + 2],
+                  first + tetrahedra[t + 3], material.volumeCompliance);
+    }
+    std::sort(edges.begin(), edges.end());
+    edges.erase(std::unique(edges.begin(), edges.end()), edges.end());
+    for (const auto& [a, b] : edges) addDistance(first + a, first + b, material.stretchCompliance);
+    return first;
+}
+
+std::size_t SoftBodies::colorCount() const noexcept {
+    std::size_t count = 0;
+    for (const auto* starts : {&stretch.colorStart, &bending.colorStart, &volume.colorStart}) {
+        if (!starts->empty()) count += starts->size() - 1;
+    }
+    return count;
+}
+
+void SoftBodies::substep(float h, core::JobSystem* jobs) {
+    float* x = position.x(); float* y = position.y(); float* z = position.z();
+    float* vx = velocity.x(); float* vy = velocity.y(); float* vz = velocity.z();
+    float* ox = previous.x(); float* oy = previous.y(); float* oz = previous.z();
+    const float* w = inverseMass.data();
+
+    // Predict: v += g h for free particles, remember x, x += v h
+    runRange(jobs, size(), PARTICLES_PER_JOB, [&](std::size_t first, std::size_t last) {
+        forEachPack(last - first, [&]<typename P>(std::size_t begin, std::size_t end) {
+            const auto step = P::set1(h), one = P::set1(1.0f), zero = P::zero();
+            const auto gx = P::set1(config.gravity.x * h), gy = P::set1(config.gravity.y * h), gz = P::set1(config.gravity.z * h);
+            const auto predict = [&](float* p, float* v, float* o, typename P::Reg g, std::size_t i) {
+                const auto free = P::selectNonZero(P::load(w + i), one, zero);
+                const auto nv = P::add(P::load(v + i), P::mul(g, free));
+                const auto current = P::load(p + i);
+                P::store(v + i, nv);
+                P::store(o + i, current);
+                P::store(p + i, P::add(current, P::mul(nv, step)));
+            };
+            for (std::size_t i = first + begin; i < first + end; i += P::WIDTH) {
+                predict(x, vx, ox, gx, i);
+                predict(y, vy, oy, gy, i);
+                predict(z, vz, oz, gz, i);
+            }
+        });
+    });
+
+    const float inverseStepSquared = 1.0f / (h * h);
+    for (const auto& [group, c] : {std::pair{&stretch, &stretchLanes}, std::pair{&bending, &bendingLanes}}) {
+        solveGroup(
+            *group, jobs,
+            [&](std::size_t i) { solveDistanceLanes<PackScalar>(*c, i, x, y, z, w, inverseStepSquared); },
+            [&](std::size_t first, std::size_t last) {
+                forEachPack(last - first, [&]<typename P>(std::size_t begin, std::size_t end) {
+                    for (std::size_t i = first + begin; i < first + end; i += P::WIDTH) {
+                        solveDistanceLanes<P>(*c, i, x, y, z, w, inverseStepSquared);
+                    }
+                });
+            });
+    }
+    const auto solveVolumes = [&](std::size_t first, std::size_t last) {
+        for (std::size_t i = first; i < last; ++i) solveVolume(volume.constraints[i], x, y, z, w, inverseStepSquared);
+    };
+    solveGroup(volume, jobs, [&](std::size_t i) { solveVolumes(i, i + 1); }, solveVolumes);
+
+    // Ground, then v = (x - x_old) / h with damping
+    const float ground = config.groundHeight;
+    const float damping = 1.0f / (1.0f + h * config.damping);
+    runRange(jobs, size(), PARTICLES_PER_JOB, [&](std::size_t first, std::size_t last) {
+        forEachPack(last - first, [&]<typename P>(std::size_t begin, std::size_t end) {
+            const auto factor = P::set1(damping / h), floor = P::set1(ground);
+            for (std::size_t i = first + begin; i < first + end; i += P::WIDTH) {
+                const auto py = P::max(P::load(y + i), floor);
+                P::store(y + i, py);
+                P::store(vx + i, P::mul(P::sub(P::load(x + i), P::load(ox + i)), factor));
+                P::store(vy + i, P::mul(P::sub(py, P::load(oy + i)), factor));
+                P::store(vz + i, P::mul(P::sub(P::load(z + i), P::load(oz + i)), factor));
+            }
+        });
+    });
+}
+
+void SoftBodies::step(float dt, core::JobSystem* jobs) {
+    assert(dt > 0.0f && config.substeps > 0);
+    if (!stretch.colored) {
+        colorGroup(stretch, particleColors, size());
+        fillLanes(stretchLanes, stretch.constraints);
+    }
+    if (!bending.colored) {
+        colorGroup(bending, particleColors, size());
+        fillLanes(bendingLanes, bending.constraints);
+    }
+    if (!volume.colored) colorGroup(volume, particleColors, size());
+    const float h = dt / static_cast<float>(config.substeps);
+    for (int s = 0; s < config.substeps; ++s) substep(h, jobs);
+}
+
+} // namespace physics
@@ -0,0 +1,743 @@
+#include "include/Solver.h"
+
+#include <algorithm>
+#include <bit>
+#include <cassert>
+#include <cmath>
+
+#include "include/Affine3.h"
+#include "include/JobSystem.h"
+#include "include/SimdPack.h"
+
+namespace physics {
+
+using math::Vector3;
+using math::simd::forEachPack;
+
+namespace {
+
+constexpr std::uint32_t NO_BODY = ~std::uint32_t{0};
+constexpr std::uint32_t NO_COLOR = ~std::uint32_t{0};
+constexpr std::size_t LANES = ConstraintSolver::LANES;
+constexpr int MAX_POINTS = ContactManifold::MAX_POINTS;
+
+// Symmetric 3x3 matrix (world inverse inertia, joint effective mass)
+struct Matrix3 {
+    float m[3][3] = {};
+
+    Vector3 operator*(const Vector3& v) const noexcept {
+        return {m[0][0] * v.x + m[0][1] * v.y + m[0][2] * v.z, m[1][0] * v.x + m[1][1] * v.y + m[1][2] * v.z,
+                m[2][0] * v.x + m[2][1] * v.y + m[2][2] * v.z};
+    }
+};
+
+// R diag(d) R^T: body-space principal inverse inertia in world space
+Matrix3 worldInverseInertia(const math::Rotation3& r, const Vector3& d) noexcept {
+    const float diag[3] = {d.x, d.y, d.z};
+    Matrix3 out;
+    for (int i = 0; i < 3; ++i) {
+        for (int j = 0; j < 3; ++j) {
+            float sum = 0.0f;
+            for (int k = 0; k < 3; ++k) sum += r.m[i][k] * diag[k] * r.m[j][k];
+            out.m[i][j] = sum;
+        }
+    }
+    return out;
+}
+
+// Inverse by cofactors; zero for a singular matrix (both bodies static)
+Matrix3 inverse(const Matrix3& a) noexcept {
+    Matrix3 c;
+    c.m[0][0] = a.m[1][1] * a.m[2][2] - a.m[1][2] * a.m[2][1];
+    c.m[0][1] = a.m[0][2] * a.m[2][1] - a.m[0][1] * a.m[2][2];
+    c.m[0][2] = a.m[0][1] * a.m[1][2] - a.m[0][2] * a.m[1][1];
+    c.m[1][0] = a.m[1][2] * a.m[2][0] - a.m[1][0] * a.m[2][2];
+    c.m[1][1] = a.m[0][0] * a.m[2][2] - a.m[0][2] * a.m[2][0];
+    c.m[1][2] = a.m[0][2] * a.m[1][0] - a.m[0][0] * a.m[1][2];
+    c.m[2][0] = a.m[1][0] * a.m[2][1] - a.m[1][1] * a.m[2][0];
+    c.m[2][1] = a.m[0][1] * a.m[2][0] - a.m[0][0] * a.m[2][1];
+    c.m[2][2] = a.m[0][0] * a.m[1][1] - a.m[0][1] * a.m[1][0];
+    const float det = a.m[0][0] * c.m[0][0] + a.m[0][1] * c.m[1][0] + a.m[0][2] * c.m[2][0];
+    if (std::fabs(det) < 1e-20f) return {};
+    const float invDet = 1.0f / det;
+    for (auto& row : c.m) {
+        for (float& x : row) x *= invDet;
+    }
+    return c;
+}
+
+// Deterministic unit tangent of a unit normal; stable while the normal
+// turns slowly, so tangent impulses stay meaningful for warm starting
+Vector3 tangentOf(const Vector3& n) noexcept {
+    const Vector3 other = std::fabs(n.x) < 0.57f ? Vector3(1.0f, 0.0f, 0.0f) : Vector3(0.0f, 1.0f, 0.0f);
+    return n.cross(other).normalized();
+}
+
+struct BodyState {
+    Vector3 position;
+    math::Rotation3 rotation;
+    float inverseMass;
+    Matrix3 inverseInertia;
+};
+
+BodyState bodyState(const RigidBodies& bodies, std::uint32_t i) noexcept {
+    const math::Rotation3 r = bodies.orientation(i).toRotation3();
+    return {bodies.position.get(i), r, bodies.inverseMass[i], worldInverseInertia(r, bodies.inverseInertia.get(i))};
+}
+
+bool isDynamic(const RigidBodies& bodies, std::uint32_t i) noexcept {
+    return i != NO_BODY && !bodies.isStatic(i);
+}
+
+} // namespace
+
+// --- Prepared data ---
+
+/**
+ * One SIMD batch: LANES manifolds, each field stored as [LANES] so a pack
+ * loads one field of every lane at once.
+ */
+struct ConstraintSolver::ContactBatch {
+    // Jacobian row along dir: armA = rA x dir, angularA = IA^-1 armA, likewise for B
+    struct Row {
+        float armA[3][LANES];
+        float armB[3][LANES];
+        float angularA[3][LANES];
+        float angularB[3][LANES];
+        float mass[LANES];      // 1 / effective mass, 0 for missing points
+        float impulse[LANES];   // accumulated
+    };
+    struct Point {
+        Row normal, tangent1, tangent2;
+        float bias[LANES];      // target relative normal speed (negative: may approach)
+    };
+
+    std::uint32_t bodyA[LANES];
+    std::uint32_t bodyB[LANES];
+    ContactManifold* manifold[LANES];
+    int pointCount;             // max over lanes
+    float inverseMassA[LANES];
+    float inverseMassB[LANES];
+    float friction[LANES];
+    float normal[3][LANES];
+    float tangent1[3][LANES];
+    float tangent2[3][LANES];
+    Point points[MAX_POINTS];
+};
+
+/**
+ * One joint prepared for the step. Ball-socket and hinge use the point
+ * part (K inverse), distance uses row 0, hinge adds two angular rows.
+ */
+struct ConstraintSolver::JointRow {
+    enum class Kind : std::uint8_t { BallSocket, Distance, Hinge } kind;
+    std::uint32_t index;        // into the joint array of its kind
+    std::uint32_t bodyA, bodyB;
+    float inverseMassA, inverseMassB;
+    Matrix3 inverseInertiaA, inverseInertiaB;
+    Vector3 rA, rB;             // world arms
+    // Point part
+    Matrix3 pointMass;          // K^-1
+    Vector3 pointBias;
+    Vector3 pointImpulse;
+    // Distance row / hinge angular rows
+    Vector3 axis[2];
+    float mass[2];
+    float bias[2];
+    float impulse[2];
+};
+
+namespace {
+
+using ContactBatch = ConstraintSolver::ContactBatch;
+using JointRow = ConstraintSolver::JointRow;
+
+void prepareRow(ContactBatch::Row& row, std::size_t lane, const Vector3& rA, const Vector3& rB, const Vector3& dir,
+                const BodyState& a, const BodyState& b, float impulse) noexcept {
+    const Vector3 armA = rA.cross(dir), armB = rB.cross(dir);
+    const Vector3 angularA = a.inverseInertia * armA, angularB = b.inverseInertia * armB;
+    const float k = a.inverseMass + b.inverseMass + armA.dot(angularA) + armB.dot(angularB);
+    const Vector3* vectors[4] = {&armA, &armB, &angularA, &angularB};
+    float(*fields[4])[LANES] = {row.armA, row.armB, row.angularA, row.angularB};
+    for (int f = 0; f < 4; ++f) {
+        fields[f][0][lane] = vectors[f]->x;
+        fields[f][1][lane] = vectors[f]->y;
+        fields[f][2][lane] = vectors[f]->z;
+    }
+    row.mass[lane] = k > 0.0f ? 1.0f / k : 0.0f;
+    row.impulse[lane] = impulse;
+}
+
+void storeVector(float (&field)[3][LANES], std::size_t lane, const Vector3& v) noexcept {
+    field[0][lane] = v.x;
+    field[1][lane] = v.y;
+    field[2][lane] = v.z;
+}
+
+void prepareLane(ContactBatch& batch, std::size_t lane, const RigidBodies& bodies, const SolverSettings& settings,
+                 float dt) noexcept {
+    ContactManifold& m = *batch.manifold[lane];
+    const BodyState a = bodyState(bodies, m.bodyA), b = bodyState(bodies, m.bodyB);
+    const Vector3 n = m.normal, t1 = tangentOf(n), t2 = n.cross(t1);
+    batch.inverseMassA[lane] = a.inverseMass;
+    batch.inverseMassB[lane] = b.inverseMass;
+    batch.friction[lane] = settings.friction;
+    storeVector(batch.normal, lane, n);
+    storeVector(batch.tangent1, lane, t1);
+    storeVector(batch.tangent2, lane, t2);
+
+    const float warm = settings.warmStarting ? 1.0f : 0.0f;
+    for (int k = 0; k < m.pointCount; ++k) {
+        const ContactPoint& cp = m.points[k];
+        ContactBatch::Point& p = batch.points[k];
+        const Vector3 rA = math::rotate(a.rotation, cp.localA), rB = math::rotate(b.rotation, cp.localB);
+        prepareRow(p.normal, lane, rA, rB, n, a, b, warm * cp.normalImpulse);
+        prepareRow(p.tangent1, lane, rA, rB, t1, a, b, warm * cp.tangentImpulse1);
+        prepareRow(p.tangent2, lane, rA, rB, t2, a, b, warm * cp.tangentImpulse2);
+        if (cp.separation > 0.0f) {
+            // Speculative: allow closing the gap within this step, no more
+            p.bias[lane] = cp.separation / dt;
+        } else {
+            const float correction = std::max(-cp.separation - settings.linearSlop, 0.0f);
+            p.bias[lane] = -std::min(settings.baumgarte * correction / dt, settings.maxCorrectionSpeed);
+        }
+    }
+    // Batches are reused across steps: lanes with fewer points must not see stale rows
+    for (int k = m.pointCount; k < MAX_POINTS; ++k) {
+        ContactBatch::Point& p = batch.points[k];
+        for (ContactBatch::Row* row : {&p.normal, &p.tangent1, &p.tangent2}) {
+            row->mass[lane] = 0.0f;
+            row->impulse[lane] = 0.0f;
+        }
+        p.bias[lane] = 0.0f;
+    }
+}
+
+// Lane-generic view of one side's velocities, gathered from the SoA streams
+template <typename P>
+struct LaneVelocity {
+    typename P::Reg vx, vy, vz, wx, wy, wz;
+};
+
+template <typename P>
+LaneVelocity<P> gather(const RigidBodies& bodies, const std::uint32_t* index, std::size_t lane) noexcept {
+    float v[6][LANES] = {};
+    for (std::size_t l = lane; l < lane + P::WIDTH; ++l) {
+        const std::uint32_t i = index[l];
+        if (i == NO_BODY) continue;
+        v[0][l] = bodies.linearVelocity.x()[i];
+        v[1][l] = bodies.linearVelocity.y()[i];
+        v[2][l] = bodies.linearVelocity.z()[i];
+        v[3][l] = bodies.angularVelocity.x()[i];
+        v[4][l] = bodies.angularVelocity.y()[i];
+        v[5][l] = bodies.angularVelocity.z()[i];
+    }
+    return {P::load(v[0] + lane), P::load(v[1] + lane), P::load(v[2] + lane),
+            P::load(v[3] + lane), P::load(v[4] + lane), P::load(v[5] + lane)};
+}
+
+// Writes back dynamic bodies only: static ones may sit in several lanes
+template <typename P>
+void scatter(RigidBodies& bodies, const std::uint32_t* index, std::size_t lane, const LaneVelocity<P>& s) noexcept {
+    float v[6][LANES];
+    P::store(v[0] + lane, s.vx);
+    P::store(v[1] + lane, s.vy);
+    P::store(v[2] + lane, s.vz);
+    P::store(v[3] + lane, s.wx);
+    P::store(v[4] + lane, s.wy);
+    P::store(v[5] + lane, s.wz);
+    for (std::size_t l = lane; l < lane + P::WIDTH; ++l) {
+        const std::uint32_t i = index[l];
+        if (!isDynamic(bodies, i)) continue;
+        bodies.linearVelocity.x()[i] = v[0][l];
+        bodies.linearVelocity.y()[i] = v[1][l];
+        bodies.linearVelocity.z()[i] = v[2][l];
+        bodies.angularVelocity.x()[i] = v[3][l];
+        bodies.angularVelocity.y()[i] = v[4][l];
+        bodies.angularVelocity.z()[i] = v[5][l];
+    }
+}
+
+template <typename P>
+typename P::Reg dot3(const float (&a)[3][LANES], std::size_t lane, typename P::Reg x, typename P::Reg y,
+                     typename P::Reg z) noexcept {
+    return P::add(P::add(P::mul(P::load(a[0] + lane), x), P::mul(P::load(a[1] + lane), y)),
+                  P::mul(P::load(a[2] + lane), z));
+}
+
+// Relative velocity of the contact along the row: dir.(vB - vA) + armB.wB - armA.wA
+template <typename P>
+typename P::Reg rowVelocity(const ContactBatch::Row& row, const float (&dir)[3][LANES], std::size_t lane,
+                            const LaneVelocity<P>& a, const LaneVelocity<P>& b) noexcept {
+    const auto linear = dot3<P>(dir, lane, P::sub(b.vx, a.vx), P::sub(b.vy, a.vy), P::sub(b.vz, a.vz));
+    const auto angular = P::sub(dot3<P>(row.armB, lane, b.wx, b.wy, b.wz), dot3<P>(row.armA, lane, a.wx, a.wy, a.wz));
+    return P::add(linear, angular);
+}
+
+template <typename P>
+void applyRow(const ContactBatch& batch, const ContactBatch::Row& row, const float (&dir)[3][LANES], std::size_t lane,
+              typename P::Reg lambda, LaneVelocity<P>& a, LaneVelocity<P>& b) noexcept {
+    const auto la = P::mul(lambda, P::load(batch.inverseMassA + lane));
+    const auto lb = P::mul(lambda, P::load(batch.inverseMassB + lane));
+    const auto dx = P::load(dir[0] + lane), dy = P::load(dir[1] + lane), dz = P::load(dir[2] + lane);
+    a.vx = P::sub(a.vx, P::mul(dx, la));
+    a.vy = P::sub(a.vy, P::mul(dy, la));
+    a.vz = P::sub(a.vz, P::mul(dz, la));
+    b.vx = P::add(b.vx, P::mul(dx, lb));
+    b.vy = P::add(b.vy, P::mul(dy, lb));
+    b.vz = P::add(b.vz, P::mul(dz, lb));
+    a.wx = P::sub(a.wx, P::mul(P::load(row.angularA[0] + lane), lambda));
+    a.wy = P::sub(a.wy, P::mul(P::load(row.angularA[1] + lane), lambda));
+    a.wz = P::sub(a.wz, P::mul(P::load(row.angularA[2] + lane), lambda));
+    b.wx = P::add(b.wx, P::mul(P::load(row.angularB[0] + lane), lambda));
+    b.wy = P::add(b.wy, P::mul(P::load(row.angularB[1] + lane), lambda));
+    b.wz = P::add(b.wz, P::mul(P::load(row.angularB[2] + lane), lambda));
+}
+
+void warmStartBatch(ContactBatch& batch, RigidBodies& bodies) noexcept {
+    forEachPack(LANES, [&]<typename P>(std::size_t begin, std::size_t end) {
+        for (std::size_t lane = begin; lane < end; lane += P::WIDTH) {
+            LaneVelocity<P> a = gather<P>(bodies, batch.bodyA, lane), b = gather<P>(bodies, batch.bodyB, lane);
+            for (int k = 0; k < batch.pointCount; ++k) {
+                const ContactBatch::Point& p = batch.points[k];
+                applyRow<P>(batch, p.normal, batch.normal, lane, P::load(p.normal.impulse + lane), a, b);
+                applyRow<P>(batch, p.tangent1, batch.tangent1, lane, P::load(p.tangent1.impulse + lane), a, b);
+                applyRow<P>(batch, p.tangent2, batch.tangent2, lane, P::load(p.tangent2.impulse + lane), a, b);
+            }
+            scatter<P>(bodies, batch.bodyA, lane, a);
+            scatter<P>(bodies, batch.bodyB, lane, b);
+        }
+    });
+}
+
+void solveBatch(ContactBatch& batch, RigidBodies& bodies) noexcept {
+    forEachPack(LANES, [&]<typename P>(std::size_t begin, std::size_t end) {
+        const auto zero = P::zero();
+        for (std::size_t lane = begin; lane < end; lane += P::WIDTH) {
+            LaneVelocity<P> a = gather<P>(bodies, batch.bodyA, lane), b = gather<P>(bodies, batch.bodyB, lane);
+            const auto friction = P::load(batch.friction + lane);
+            for (int k = 0; k < batch.pointCount; ++k) {
+                ContactBatch::Point& p = batch.points[k];
+
+                // Friction first, bounded by the current normal impulse
+                const auto maxFriction = P::mul(friction, P::load(p.normal.impulse + lane));
+                const auto minFriction = P::sub(zero, maxFriction);
+                auto solveFriction = [&](ContactBatch::Row& row, const float (&dir)[3][LANES]) {
+                    const auto speed = rowVelocity<P>(row, dir, lane, a, b);
+                    const auto old = P::load(row.impulse + lane);
+                    const auto accumulated = P::min(P::max(P::sub(old, P::mul(P::load(row.mass + lane), speed)),
+                                                           minFriction),
+                                                    maxFriction);
+                    P::store(row.impulse + lane, accumulated);
+                    applyRow<P>(batch, row, dir, lane, P::sub(accumulated, old), a, b);
+                };
+                solveFriction(p.tangent1, batch.tangent1);
+                solveFriction(p.tangent2, batch.tangent2);
+
+                // Normal: push only
+                const auto speed = P::add(rowVelocity<P>(p.normal, batch.normal, lane, a, b), P::load(p.bias + lane));
+                const auto old = P::load(p.normal.impulse + lane);
+                const auto accumulated = P::max(P::sub(old, P::mul(P::load(p.normal.mass + lane), speed)), zero);
+                P::store(p.normal.impulse + lane, accumulated);
+                applyRow<P>(batch, p.normal, batch.normal, lane, P::sub(accumulated, old), a, b);
+            }
+            scatter<P>(bodies, batch.bodyA, lane, a);
+            scatter<P>(bodies, batch.bodyB, lane, b);
+        }
+    });
+}
+
+void storeImpulses(ContactBatch& batch) noexcept {
+    for (std::size_t lane = 0; lane < LANES; ++lane) {
+        ContactManifold* m = batch.manifold[lane];
+        if (m == nullptr) continue;
+        for (int k = 0; k < m->pointCount; ++k) {
+            m->points[k].normalImpulse = batch.points[k].normal.impulse[lane];
+            m->points[k].tangentImpulse1 = batch.points[k].tangent1.impulse[lane];
+            m->points[k].tangentImpulse2 = batch.points[k].tangent2.impulse[lane];
+        }
+    }
+}
+
+// --- Joints (scalar, serial) ---
+
+struct Velocity {
+    Vector3 v, w;
+};
+
+Velocity velocityOf(const RigidBodies& bodies, std::uint32_t i) noexcept {
+    return {bodies.linearVelocity.get(i), bodies.angularVelocity.get(i)};
+}
+
+// Applies +impulse at rB to B and -impulse at rA to A (linear and angular)
+void applyPointImpulse(RigidBodies& bodies, const JointRow& j, const Vector3& impulse) noexcept {
+    if (isDynamic(bodies, j.bodyA)) {
+        bodies.linearVelocity.set(j.bodyA, bodies.linearVelocity.get(j.bodyA) - impulse * j.inverseMassA);
+        bodies.angularVelocity.set(j.bodyA,
+                                   bodies.angularVelocity.get(j.bodyA) - j.inverseInertiaA * j.rA.cross(impulse));
+    }
+    if (isDynamic(bodies, j.bodyB)) {
+        bodies.linearVelocity.set(j.bodyB, bodies.linearVelocity.get(j.bodyB) + impulse * j.inverseMassB);
+        bodies.angularVelocity.set(j.bodyB,
+                                   bodies.angularVelocity.get(j.bodyB) + j.inverseInertiaB * j.rB.cross(impulse));
+    }
+}
+
+// Applies an angular impulse +axis * lambda to B and the opposite to A
+void applyAngularImpulse(RigidBodies& bodies, const JointRow& j, const Vector3& axis, float lambda) noexcept {
+    const Vector3 impulse = axis * lambda;
+    if (isDynamic(bodies, j.bodyA)) {
+        bodies.angularVelocity.set(j.bodyA, bodies.angularVelocity.get(j.bodyA) - j.inverseInertiaA * impulse);
+    }
+    if (isDynamic(bodies, j.bodyB)) {
+        bodies.angularVelocity.set(j.bodyB, bodies.angularVelocity.get(j.bodyB) + j.inverseInertiaB * impulse);
+    }
+}
+
+// Velocity of B's anchor relative to A's
+Vector3 anchorVelocity(const RigidBodies& bodies, const JointRow& j) noexcept {
+    const Velocity a = velocityOf(bodies, j.bodyA), b = velocityOf(bodies, j.bodyB);
+    return b.v + b.w.cross(j.rB) - a.v - a.w.cross(j.rA);
+}
+
+void warmStartJoint(RigidBodies& bodies, const JointRow& j) noexcept {
+    if (j.kind == JointRow::Kind::Distance) {
+        applyPointImpulse(bodies, j, j.axis[0] * j.impulse[0]);
+        return;
+    }
+    applyPointImpulse(bodies, j, j.pointImpulse);
+    if (j.kind == JointRow::Kind::Hinge) {
+        for (int r = 0; r < 2; ++r) applyAngularImpulse(bodies, j, j.axis[r], j.impulse[r]);
+    }
+}
+
+void solveJoint(RigidBodies& bodies, JointRow& j) noexcept {
+    if (j.kind == JointRow::Kind::Distance) {
+        const float speed = j.axis[0].dot(anchorVelocity(bodies, j)) + j.bias[0];
+        const float lambda = -j.mass[0] * speed;
+        j.impulse[0] += lambda;
+        applyPointImpulse(bodies, j, j.axis[0] * lambda);
+        return;
+    }
+    if (j.kind == JointRow::Kind::Hinge) {
+        for (int r = 0; r < 2; ++r) {
+            const float speed =
+                j.axis[r].dot(bodies.angularVelocity.get(j.bodyB) - bodies.angularVelocity.get(j.bodyA)) + j.bias[r];
+            const float lambda = -j.mass[r] * speed;
+            j.impulse[r] += lambda;
+            applyAngularImpulse(bodies, j, j.axis[r], lambda);
+        }
+    }
+    const Vector3 lambda = j.pointMass * ((anchorVelocity(bodies, j) + j.pointBias) * -1.0f);
+    j.pointImpulse += lambda;
+    applyPointImpulse(bodies, j, lambda);
+}
+
+JointRow jointBase(const RigidBodies& bodies, JointRow::Kind kind, std::size_t index, std::uint32_t a,
+                   std::uint32_t b, const Vector3& localA, const Vector3& localB, Vector3& worldA,
+                   Vector3& worldB) noexcept {
+    const BodyState sa = bodyState(bodies, a), sb = bodyState(bodies, b);
+    JointRow j{};
+    j.kind = kind;
+    j.index = static_cast<std::uint32_t>(index);
+    j.bodyA = a;
+    j.bodyB = b;
+    j.inverseMassA = sa.inverseMass;
+    j.inverseMassB = sb.inverseMass;
+    j.inverseInertiaA = sa.inverseInertia;
+    j.inverseInertiaB = sb.inverseInertia;
+    j.rA = math::rotate(sa.rotation, localA);
+    j.rB = math::rotate(sb.rotation, localB);
+    worldA = sa.position + j.rA;
+    worldB = sb.position + j.rB;
+    return j;
+}
+
+// K = (mA + mB) I - [rA]x IA^-1 [rA]x - [rB]x IB^-1 [rB]x, built column by column
+void preparePoint(JointRow& j, const Vector3& error, float biasFactor) noexcept {
+    Matrix3 k;
+    const Vector3 basis[3] = {{1.0f, 0.0f, 0.0f}, {0.0f, 1.0f, 0.0f}, {0.0f, 0.0f, 1.0f}};
+    for (int c = 0; c < 3; ++c) {
+        const Vector3& e = basis[c];
+        const Vector3 column = e * (j.inverseMassA + j.inverseMassB) + (j.inverseInertiaA * j.rA.cross(e)).cross(j.rA) +
+                               (j.inverseInertiaB * j.rB.cross(e)).cross(j.rB);
+        k.m[0][c] = column.x;
+        k.m[1][c] = column.y;
+        k.m[2][c] = column.z;
+    }
+    j.pointMass = inverse(k);
+    j.pointBias = error * biasFactor;
+}
+
+} // namespace
+
+// --- ConstraintSolver ---
+
+ConstraintSolver::ConstraintSolver(const SolverSettings& settings) noexcept : config(settings) {}
+
+ConstraintSolver::~ConstraintSolver() = default;
+
+std::size_t ConstraintSolver::batchCount() const noexcept {
+    return batches.size();
+}
+
+void ConstraintSolver::buildIslands(const RigidBodies& bodies, std::span<ContactManifold> manifolds) {
+    links.clear();
+    linkManifold.clear();
+    for (std::size_t i = 0; i < manifolds.size(); ++i) {
+        const ContactManifold& m = manifolds[i];
+        if (m.pointCount == 0 || (bodies.isStatic(m.bodyA) && bodies.isStatic(m.bodyB))) continue;
+        links.push_back({m.bodyA, m.bodyB});
+        linkManifold.push_back(static_cast<std::uint32_t>(i));
+    }
+    for (const JointRow& j : jointRows) links.push_back({j.bodyA, j.bodyB});
+    if (links.empty()) {
+        islands.clear(); // only single bodies, none with anything to solve
+    } else {
+        islands.build(bodies, links);
+    }
+
+    // Joint rows by island; rows between static bodies join none and are skipped
+    const std::size_t contactLinks = linkManifold.size();
+    islandJoints.assign(islands.count() + 1, 0);
+    jointOrder.clear();
+    for (std::size_t k = 0; k < islands.count(); ++k) {
+        for (const std::uint32_t l : islands.links(k)) {
+            if (l >= contactLinks) jointOrder.push_back(static_cast<std::uint32_t>(l - contactLinks));
+        }
+        islandJoints[k + 1] = static_cast<std::uint32_t>(jointOrder.size());
+    }
+}
+
+void ConstraintSolver::buildBatches(const RigidBodies& bodies, std::span<ContactManifold> manifolds) {
+    const std::size_t contactLinks = linkManifold.size();
+    bodyColors.resize(bodies.size()); // all zero between solves; cleared below per linked body
+    linkSlot.resize(contactLinks);
+    islandColors.assign(islands.count() + 1, 0);
+    colorStart.clear();
+    serialColor.clear();
+    maxColors = 0;
+    activeIslands = 0;
+
+    std::uint32_t total = 0;
+    for (std::size_t k = 0; k < islands.count(); ++k) {
+        const std::span<const std::uint32_t> islandLinks = islands.links(k);
+        activeIslands += islandLinks.empty() ? 0 : 1;
+        if (islandLinks.empty() || islandLinks.front() >= contactLinks) { // resting alone, or joints only
+            islandColors[k + 1] = static_cast<std::uint32_t>(colorStart.size());
+            continue;
+        }
+
+        // Greedy coloring: first color that neither dynamic body already uses
+        std::uint32_t perColor[MAX_COLORS + 1] = {};
+        for (const std::uint32_t l : islandLinks) {
+            if (l >= contactLinks) break; // joints follow the contacts
+            const ContactManifold& m = manifolds[linkManifold[l]];
+            const bool dynamicA = !bodies.isStatic(m.bodyA), dynamicB = !bodies.isStatic(m.bodyB);
+            const std::uint64_t used = (dynamicA ? bodyColors[m.bodyA] : 0) | (dynamicB ? bodyColors[m.bodyB] : 0);
+            int color = MAX_COLORS;
+            if (used != ~std::uint64_t{0}) {
+                color = std::countr_zero(~used);
+                if (dynamicA) bodyColors[m.bodyA] |= std::uint64_t{1} << color;
+                if (dynamicB) bodyColors[m.bodyB] |= std::uint64_t{1} << color;
+            }
+            linkSlot[l] = static_cast<std::uint32_t>(color);
+            ++perColor[color];
+        }
+
+        // Batches per color; the overflow color gets one manifold per batch
+        std::uint32_t firstBatch[MAX_COLORS + 1];
+        for (int c = 0; c <= MAX_COLORS; ++c) {
+            firstBatch[c] = total;
+            if (perColor[c] == 0) continue;
+            colorStart.push_back(total);
+            serialColor.push_back(c == MAX_COLORS ? 1 : 0);
+            total += c == MAX_COLORS ? perColor[c] : static_cast<std::uint32_t>((perColor[c] + LANES - 1) / LANES);
+        }
+        islandColors[k + 1] = static_cast<std::uint32_t>(colorStart.size());
+        maxColors = std::max<std::size_t>(maxColors, islandColors[k + 1] - islandColors[k]);
+
+        std::uint32_t filled[MAX_COLORS + 1] = {};
+        for (const std::uint32_t l : islandLinks) {
+            if (l >= contactLinks) break;
+            const std::uint32_t c = linkSlot[l];
+            const std::uint32_t slot = filled[c]++;
+            linkSlot[l] = c == MAX_COLORS ? (firstBatch[c] + slot) * LANES : firstBatch[c] * LANES + slot;
+        }
+    }
+    colorStart.push_back(total);
+
+    batches.resize(total);
+    for (ContactBatch& b : batches) {
+        std::fill_n(b.bodyA, LANES, NO_BODY);
+        std::fill_n(b.bodyB, LANES, NO_BODY);
+        std::fill_n(b.manifold, LANES, nullptr);
+        b.pointCount = 0;
+    }
+    for (std::size_t l = 0; l < contactLinks; ++l) {
+        ContactManifold& m = manifolds[linkManifold[l]];
+        ContactBatch& b = batches[linkSlot[l] / LANES];
+        const std::size_t lane = linkSlot[l] % LANES;
+        b.bodyA[lane] = m.bodyA;
+        b.bodyB[lane] = m.bodyB;
+        b.manifold[lane] = &m;
+        b.pointCount = std::max(b.pointCount, m.pointCount);
+        bodyColors[m.bodyA] = 0;
+        bodyColors[m.bodyB] = 0;
+    }
+
+    // Jobs of consecutive islands with about BATCHES_PER_JOB batches and joint
+    // rows each; an island bigger than that is a job of its own
+    groupStart.assign(1, 0);
+    std::size_t work = 0;
+    for (std::size_t k = 0; k < islands.count(); ++k) {
+        const std::size_t islandWork = colorStart[islandColors[k + 1]] - colorStart[islandColors[k]] +
+                                       islandJoints[k + 1] - islandJoints[k];
+        if (islandWork == 0) continue;
+        if (work > 0 && (work >= BATCHES_PER_JOB || islandWork > BATCHES_PER_JOB)) {
+            groupStart.push_back(static_cast<std::uint32_t>(k));
+            work = 0;
+        }
+        work += islandWork;
+    }
+    if (work > 0) groupStart.push_back(static_cast<std::uint32_t>(islands.count()));
+}
+
+template <typename Kernel>
+void ConstraintSolver::forEachBatch(core::JobSystem* jobs, std::size_t firstColor, std::size_t lastColor,
+                                    Kernel&& kernel) {
+    for (std::size_t c = firstColor; c < lastColor; ++c) {
+        const std::size_t first = colorStart[c], last = colorStart[c + 1];
+        if (jobs != nullptr && serialColor[c] == 0 && last - first > BATCHES_PER_JOB) {
+            jobs->parallelFor(first, last, BATCHES_PER_JOB, [&](std::size_t begin, std::size_t end) {
+                for (std::size_t i = begin; i < end; ++i) kernel(batches[i]);
+            });
+        } else {
+            for (std::size_t i = first; i < last; ++i) kernel(batches[i]);
+        }
+    }
+}
+
+void ConstraintSolver::solveIsland(RigidBodies& bodies, std::size_t island, core::JobSystem* jobs) {
+    const std::size_t firstColor = islandColors[island], lastColor = islandColors[island + 1];
+    const std::span<const std::uint32_t> rows(jointOrder.data() + islandJoints[island],
+                                              islandJoints[island + 1] - islandJoints[island]);
+    if (firstColor == lastColor && rows.empty()) return; // a body without constraints
+    if (config.warmStarting) {
+        for (const std::uint32_t r : rows) warmStartJoint(bodies, jointRows[r]);
+        forEachBatch(jobs, firstColor, lastColor, [&](ContactBatch& b) { warmStartBatch(b, bodies); });
+    }
+    for (int iteration = 0; iteration < config.velocityIterations; ++iteration) {
+        for (const std::uint32_t r : rows) solveJoint(bodies, jointRows[r]);
+        forEachBatch(jobs, firstColor, lastColor, [&](ContactBatch& b) { solveBatch(b, bodies); });
+    }
+}
+
+void ConstraintSolver::prepareJoints(const RigidBodies& bodies, const Joints& joints, float dt) {
+    const float biasFactor = config.baumgarte / dt;
+    const float warm = config.warmStarting ? 1.0f : 0.0f;
+    jointRows.clear();
+    Vector3 worldA, worldB;
+
+    for (std::size_t i = 0; i < joints.ballSockets.size(); ++i) {
+        const BallSocketJoint& s = joints.ballSockets[i];
+        JointRow j = jointBase(bodies, JointRow::Kind::BallSocket, i, s.bodyA, s.bodyB, s.localAnchorA, s.localAnchorB,
+                               worldA, worldB);
+        preparePoint(j, worldB - worldA, biasFactor);
+        j.pointImpulse = s.impulse * warm;
+        jointRows.push_back(j);
+    }
+
+    for (std::size_t i = 0; i < joints.distances.size(); ++i) {
+        const DistanceJoint& d = joints.distances[i];
+        JointRow j = jointBase(bodies, JointRow::Kind::Distance, i, d.bodyA, d.bodyB, d.localAnchorA, d.localAnchorB,
+                               worldA, worldB);
+        const Vector3 delta = worldB - worldA;
+        const float length = delta.length();
+        j.axis[0] = length > 1e-6f ? delta / length : Vector3(0.0f, 1.0f, 0.0f);
+        const Vector3 armA = j.rA.cross(j.axis[0]), armB = j.rB.cross(j.axis[0]);
+        const float k = j.inverseMassA + j.inverseMassB + armA.dot(j.inverseInertiaA * armA) +
+                        armB.dot(j.inverseInertiaB * armB);
+        j.mass[0] = k > 0.0f ? 1.0f / k : 0.0f;
+        j.bias[0] = (length - d.length) * biasFactor;
+        j.impulse[0] = d.impulse * warm;
+        jointRows.push_back(j);
+    }
+
+    for (std::size_t i = 0; i < joints.hinges.size(); ++i) {
+        const HingeJoint& h = joints.hinges[i];
+        JointRow j = jointBase(bodies, JointRow::Kind::Hinge, i, h.bodyA, h.bodyB, h.localAnchorA, h.localAnchorB,
+                               worldA, worldB);
+        preparePoint(j, worldB - worldA, biasFactor);
+        j.pointImpulse = h.impulse * warm;
+        // Lock rotation about the two directions perpendicular to the hinge axis;
+        // axisA x axisB is the rotation that would carry A's axis onto B's
+        const Vector3 axisA = math::rotate(bodies.orientation(h.bodyA), h.localAxisA);
+        const Vector3 axisB = math::rotate(bodies.orientation(h.bodyB), h.localAxisB);
+        const Vector3 misalignment = axisA.cross(axisB);
+        j.axis[0] = tangentOf(axisA);
+        j.axis[1] = axisA.cross(j.axis[0]);
+        for (int r = 0; r < 2; ++r) {
+            const float k = j.axis[r].dot(j.inverseInertiaA * j.axis[r]) + j.axis[r].dot(j.inverseInertiaB * j.axis[r]);
+            j.mass[r] = k > 0.0f ? 1.0f / k : 0.0f;
+            j.bias[r] = j.axis[r].dot(misalignment) * biasFactor;
+            j.impulse[r] = h.angularImpulse[r] * warm;
+        }
+        jointRows.push_back(j);
+    }
+}
+
+void ConstraintSolver::solve(RigidBodies& bodies, std::span<ContactManifold> manifolds, Joints& joints, float dt,
+                             core::JobSystem* jobs) {
+    assert(dt > 0.0f);
+    prepareJoints(bodies, joints, dt);
+    buildIslands(bodies, manifolds);
+    buildBatches(bodies, manifolds);
+
+    // Preparing only reads bodies and writes each batch, so it needs no coloring
+    auto prepare = [&](std::size_t begin, std::size_t end) {
+        for (std::size_t i = begin; i < end; ++i) {
+            for (std::size_t lane = 0; lane < LANES; ++lane) {
+                if (batches[i].manifold[lane] != nullptr) prepareLane(batches[i], lane, bodies, config, dt);
+            }
+        }
+    };
+    if (jobs != nullptr && batches.size() > BATCHES_PER_JOB) {
+        jobs->parallelFor(0, batches.size(), BATCHES_PER_JOB, prepare);
+    } else {
+        prepare(0, batches.size());
+    }
+
+    // Islands are independent: every job solves its islands through all
+    // iterations, and a large island splits its colors across threads
+    auto solveGroups = [&](std::size_t begin, std::size_t end) {
+        for (std::size_t g = begin; g < end; ++g) {
+            for (std::size_t k = groupStart[g]; k < groupStart[g + 1]; ++k) solveIsland(bodies, k, jobs);
+        }
+    };
+    const std::size_t groups = groupStart.size() - 1;
+    if (jobs != nullptr && groups > 1) {
+        jobs->parallelFor(0, groups, 1, solveGroups);
+    } else {
+        solveGroups(0, groups);
+    }
+
+    for (ContactBatch& b : batches) storeImpulses(b);
+    for (const JointRow& j : jointRows) {
+        switch (j.kind) {
+            case JointRow::Kind::BallSocket:
+                joints.ballSockets[j.index].impulse = j.pointImpulse;
+                break;
+            case JointRow::Kind::Distance:
+                joints.distances[j.index].impulse = j.impulse[0];
+                break;
+            case JointRow::Kind::Hinge:
+                joints.hinges[j.index].impulse = j.pointImpulse;
+                joints.hinges[j.index].angularImpulse[0] = j.impulse[0];
+                joints.hinges[j.index].angularImpulse[1] = j.impulse[1];
+                break;
+        }
+    }
+}
+
+} // namespace physics
@@ -0,0 +1,135 @@
+#include "include/SweepAndPrune.h"
+
+#include <algorithm>
+
+namespace physics {
+
+void SweepAndPrune::update(std::span<const Aabb> boxes, std::vector<BroadphasePair>& out) {
+    prepare(boxes);
+    out.clear();
+    sweep(out);
+    sortAndDeduplicate(out);
+}
+
+void SweepAndPrune::update(std::span<const Aabb> boxes, std::pmr::vector<BroadphasePair>& out) {
+    prepare(boxes);
+    out.clear();
+    sweep(out);
+    sortAndDeduplicate(out);
+}
+
+void SweepAndPrune::prepare(std::span<const Aabb> boxes) {
+    const std::size_t count = boxes.size();
+    for (int a = 0; a < 3; ++a) {
+        boxMin[a].resize(count);
+        boxMax[a].resize(count);
+    }
+    float* minX = boxMin[0].data(); float* minY = boxMin[1].data(); float* minZ = boxMin[2].data();
+    float* maxX = boxMax[0].data(); float* maxY = boxMax[1].data(); float* maxZ = boxMax[2].data();
+    for (std::size_t i = 0; i < count; ++i) {
+        const Aabb& b = boxes[i];
+        minX[i] = b.min.x; minY[i] = b.min.y; minZ[i] = b.min.z;
+        maxX[i] = b.max.x; maxY[i] = b.max.y; maxZ[i] = b.max.z;
+    }
+
+    chooseAxis();
+    updateOrder(count);
+
+    // Gather in sort order; the sweep axis goes first
+    const int axes[3] = {axis, (axis + 1) % 3, (axis + 2) % 3};
+    for (int k = 0; k < 3; ++k) {
+        sortedMin[k].resize(count);
+        sortedMax[k].resize(count);
+        const float* srcMin = boxMin[axes[k]].data();
+        const float* srcMax = boxMax[axes[k]].data();
+        float* dstMin = sortedMin[k].data();
+        float* dstMax = sortedMax[k].data();
+        for (std::size_t i = 0; i < count; ++i) {
+            dstMin[i] = srcMin[order[i]];
+            dstMax[i] = srcMax[order[i]];
+        }
+    }
+}
+
+void SweepAndPrune::chooseAxis() {
+    const std::size_t count = boxMin[0].size();
+    if (count < 2) return;
+
+    // Variance of box centers (scaled by 2, which does not change the argmax)
+    float variance[3];
+    for (int a = 0; a < 3; ++a) {
+        const float* lo = boxMin[a].data();
+        const float* hi = boxMax[a].data();
+        float sum = 0.0f, sumSq = 0.0f;
+        for (std::size_t i = 0; i < count; ++i) {
+            const float c = lo[i] + hi[i];
+            sum += c;
+            sumSq += c * c;
+        }
+        const float mean = sum / static_cast<float>(count);
+        variance[a] = sumSq / static_cast<float>(count) - mean * mean;
+    }
+
+    const int best = static_cast<int>(std::max_element(variance, variance + 3) - variance);
+    if (variance[best] > variance[axis] * AXIS_HYSTERESIS) axis = best;
+}
+
+void SweepAndPrune::updateOrder(std::size_t count) {
+    const bool axisChanged = axis != sortedAxis;
+    const std::size_t previous = order.size();
+
+    // Drop indices that no longer exist and append the new ones
+    std::erase_if(order, [count](std::uint32_t id) { return id >= count; });
+    const std::size_t kept = order.size();
+    for (std::size_t id = previous; id < count; ++id) order.push_back(static_cast<std::uint32_t>(id));
+    const std::size_t added = count - kept;
+
+    const float* key = boxMin[axis].data();
+    resorted = axisChanged || previous == 0 || added > count / 8;
+    if (resorted) {
+        std::sort(order.begin(), order.end(), [key](std::uint32_t a, std::uint32_t b) {
+            return key[a] < key[b] || (key[a] == key[b] && a < b);
+        });
+    } else {
+        // Nearly sorted from last update: insertion sort is close to linear
+        for (std::size_t i = 1; i < count; ++i) {
+            const std::uint32_t id = order[i];
+            const float k = key[id];
+            std::size_t j = i;
+            while (j > 0 && key[order[j - 1]] > k) {
+                order[j] = order[j - 1];
+                --j;
+            }
+            order[j] = id;
+        }
+    }
+    sortedAxis = axis;
+}
+
+template <typename Pairs>
+void SweepAndPrune::sweep(Pairs& out) {
+    const std::size_t count = order.size();
+    std::size_t tests = 0;
+    const float* min0 = sortedMin[0].data(); const float* max0 = sortedMax[0].data();
+    const float* min1 = sortedMin[1].data(); const float* max1 = sortedMax[1].data();
+    const float* min2 = sortedMin[2].data(); const float* max2 = sortedMax[2].data();
+
+    for (std::size_t i = 0; i < count; ++i) {
+        const float hi0 = max0[i];
+        const float lo1 = min1[i], hi1 = max1[i];
+        const float lo2 = min2[i], hi2 = max2[i];
+        // Every later box starts at or after min0[i]; stop once they start past our end
+        std::size_t j = i + 1;
+        for (; j < count && min0[j] <= hi0; ++j) {
+            // Non-short-circuit: the secondary-axis tests are unpredictable, branches cost more
+            if ((min1[j] <= hi1) & (lo1 <= max1[j]) & (min2[j] <= hi2) & (lo2 <= max2[j])) {
+                const std::uint32_t a = order[i], b = order[j];
+                out.push_back(a < b ? BroadphasePair{a, b} : BroadphasePair{b, a});
+            }
+        }
+        tests += j - i - 1;
+    }
+    sweepTests = tests;
+}
+
+} // namespace physics
@@ -0,0 +1,161 @@
+#include "include/World.h"
+
+#include <chrono>
+
+#include "include/JobSystem.h"
+
+namespace physics {
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+// Seconds since start; moves start to now for the next phase
+double lap(Clock::time_point& start) noexcept {
+    const Clock::time_point now = Clock::now();
+    const double seconds = std::chrono::duration<double>(now - start).count();
+    start = now;
+    return seconds;
+}
+
+} // namespace
+
+World::World(const WorldSettings& settings) noexcept
+    : integrator(settings.integrator), clock(settings.fixedStep, settings.maxStepsPerUpdate),
+      contactCache(settings.narrowphase),
+      broadphaseKind(settings.broadphase == BroadphaseKind::Automatic ? BroadphaseKind::SweepAndPrune
+                                                                       : settings.broadphase),
+      adaptiveBroadphase(settings.broadphase == BroadphaseKind::Automatic), solver(settings.solver) {
+    const core::TaskGraph::TaskId collision = stepGraph.add([this] { collide(); });
+    const core::TaskGraph::TaskId velocities = stepGraph.add([this] { integrateVelocityPhase(); });
+    const core::TaskGraph::TaskId solve = stepGraph.add([this] { solvePhase(); });
+    const core::TaskGraph::TaskId positions = stepGraph.add([this] { integratePositionPhase(); });
+    stepGraph.precede(collision, solve);
+    stepGraph.precede(velocities, solve);
+    stepGraph.precede(solve, positions);
+}
+
+int World::update(float frameSeconds) {
+    const int steps = clock.advance(frameSeconds);
+    for (int i = 0; i < steps; ++i) step();
+    if (steps > 0) bodySet.clearForces();
+    return steps;
+}
+
+void World::collide() {
+    Clock::time_point start = Clock::now();
+    // Bodies with a shape, ascending, and their bounds in the same order
+    std::size_t count = 0;
+    for (std::size_t i = 0; i < bodySet.size(); ++i) count += bodySet.shape[i].collides() ? 1 : 0;
+    const std::span<std::uint32_t> collidables = arena.allocateArray<std::uint32_t>(count);
+    const std::span<Aabb> bounds = arena.allocateArray<Aabb>(count);
+    count = 0;
+    for (std::size_t i = 0; i < bodySet.size(); ++i) {
+        if (bodySet.shape[i].collides()) collidables[count++] = static_cast<std::uint32_t>(i);
+    }
+
+    const float margin = contactCache.settings().margin;
+    auto boundsRange = [&](std::size_t begin, std::size_t end) {
+        for (std::size_t i = begin; i < end; ++i) {
+            const std::uint32_t body = collidables[i];
+            const Pose pose{bodySet.position.get(body), bodySet.orientation(body).toRotation3()};
+            bounds[i] = bodySet.shape[body].bounds(pose).expanded(margin);
+        }
+    };
+    if (jobSystem != nullptr && collidables.size() > BODIES_PER_JOB) {
+        jobSystem->parallelFor(0, collidables.size(), BODIES_PER_JOB, boundsRange);
+    } else {
+        boundsRange(0, collidables.size());
+    }
+    profile.bounds = lap(start);
+
+    std::pmr::vector<BroadphasePair> pairs(arena.resource());
+    pairs.reserve(pairEstimate);
+    findPairs(collidables, bounds, pairs);
+    pairEstimate = pairs.size();
+    // Back to body indices; collidables is ascending, so pairs stay sorted
+    std::size_t kept = 0;
+    for (const BroadphasePair& p : pairs) {
+        const std::uint32_t a = collidables[p.a], b = collidables[p.b];
+        if (!bodySet.isStatic(a) || !bodySet.isStatic(b)) pairs[kept++] = {a, b};
+    }
+    pairs.resize(kept);
+    profile.broadphase = lap(start);
+    contactCache.update(bodySet, pairs, jobSystem, &arena);
+    profile.narrowphase = lap(start);
+}
+
+void World::findPairs(std::span<const std::uint32_t> collidables, std::span<const Aabb> bounds,
+                      std::pmr::vector<BroadphasePair>& pairs) {
+    if (broadphaseKind == BroadphaseKind::SweepAndPrune) {
+        sweepAndPrune.update(bounds, pairs);
+        if (adaptiveBroadphase && sweepAndPrune.lastSweepTests() > SWEEP_TESTS_PER_BOX * bounds.size()) {
+            broadphaseKind = BroadphaseKind::DynamicAabbTree; // from the next step on
+            adaptiveBroadphase = false;
+        }
+        return;
+    }
+
+    // One proxy per collidable slot; a slot whose body changed just moves
+    const float dt = clock.step();
+    for (std::size_t i = 0; i < bounds.size(); ++i) {
+        const auto slot = static_cast<std::uint32_t>(i);
+        if (i == treeProxies.size()) {
+            treeProxies.push_back(aabbTree.createProxy(bounds[i], slot));
+        } else {
+            aabbTree.moveProxy(treeProxies[i], bounds[i], bodySet.linearVelocity.get(collidables[i]) * dt);
+        }
+    }
+    while (treeProxies.size() > bounds.size()) {
+        aabbTree.destroyProxy(treeProxies.back());
+        treeProxies.pop_back();
+    }
+    // Fat boxes overlap more often; keep the pairs whose bounds overlap, as
+    // sweep and prune reports them
+    aabbTree.findPairs(pairs);
+    std::erase_if(pairs, [&](const BroadphasePair& p) { return !bounds[p.a].overlaps(bounds[p.b]); });
+}
+
+void World::integrateVelocityPhase() {
+    Clock::time_point start = Clock::now();
+    const float dt = clock.step();
+    auto range = [&](std::size_t begin, std::size_t end) { integrateVelocities(bodySet, dt, integrator, begin, end); };
+    if (jobSystem != nullptr && bodySet.size() > BODIES_PER_JOB) {
+        jobSystem->parallelFor(0, bodySet.size(), BODIES_PER_JOB, range);
+    } else {
+        range(0, bodySet.size());
+    }
+    profile.integrateVelocities = lap(start);
+}
+
+void World::solvePhase() {
+    Clock::time_point start = Clock::now();
+    solver.solve(bodySet, contactCache.manifolds(), jointSet, clock.step(), jobSystem);
+    profile.solve = lap(start);
+}
+
+void World::integratePositionPhase() {
+    Clock::time_point start = Clock::now();
+    const float dt = clock.step();
+    auto range = [&](std::size_t begin, std::size_t end) { integratePositions(bodySet, dt, begin, end); };
+    if (jobSystem != nullptr && bodySet.size() > BODIES_PER_JOB) {
+        jobSystem->parallelFor(0, bodySet.size(), BODIES_PER_JOB, range);
+    } else {
+        range(0, bodySet.size());
+    }
+    profile.integratePositions = lap(start);
+}
+
+void World::step() {
+    arena.reset();
+    if (jobSystem != nullptr) {
+        stepGraph.run(*jobSystem);
+        return;
+    }
+    collide();
+    integrateVelocityPhase();
+    solvePhase();
+    integratePositionPhase();
+}
+
+} // namespace physics
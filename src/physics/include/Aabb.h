@@ -0,0 +1,61 @@
+#pragma once
+
+#include <algorithm>
+
+#include "include/Vector3.h"
+
+/**
+ * @file Aabb.h
+ * @brief Axis-aligned bounding boxes for the broadphase.
+ */
+
+namespace physics {
+
+/**
+ * @brief Axis-aligned box given by its minimum and maximum corners.
+ */
+struct Aabb {
+    math::Vector3 min;
+    math::Vector3 max;
+
+    static constexpr Aabb fromCenterHalfExtents(const math::Vector3& center, const math::Vector3& halfExtents) noexcept {
+        return {center - halfExtents, center + halfExtents};
+    }
+
+    /** @brief True if the boxes overlap or touch. */
+    constexpr bool overlaps(const Aabb& o) const noexcept {
+        return min.x <= o.max.x && o.min.x <= max.x &&
+               min.y <= o.max.y && o.min.y <= max.y &&
+               min.z <= o.max.z && o.min.z <= max.z;
+    }
+
+    /** @brief True if o lies completely inside this box. */
+    constexpr bool contains(const Aabb& o) const noexcept {
+        return min.x <= o.min.x && min.y <= o.min.y && min.z <= o.min.z &&
+               o.max.x <= max.x && o.max.y <= max.y && o.max.z <= max.z;
+    }
+
+    /** @brief Smallest box enclosing both. */
+    constexpr Aabb merged(const Aabb& o) const noexcept {
+        return {{std::min(min.x, o.min.x), std::min(min.y, o.min.y), std::min(min.z, o.min.z)},
+                {std::max(max.x, o.max.x), std::max(max.y, o.max.y), std::max(max.z, o.max.z)}};
+    }
+
+    /** @brief Box grown by margin on every side. */
+    constexpr Aabb expanded(float margin) const noexcept {
+        const math::Vector3 m(margin, margin, margin);
+        return {min - m, max + m};
+    }
+
+    /**
+     * @brief Surface area; the cost metric of the AABB tree (SAH).
+     */
+    constexpr float surfaceArea() const noexcept {
+        const math::Vector3 d = max - min;
+        return 2.0f * (d.x * d.y + d.y * d.z + d.z * d.x);
+    }
+
+    constexpr math::Vector3 center() const noexcept { return (min + max) * 0.5f; }
+};
+
+} // namespace physics
@@ -0,0 +1,32 @@
+#pragma once
+
+#include <string_view>
+
+#include "RigidBodies.h"
+#include "include/Snapshot.h"
+
+/**
+ * @file BodySnapshot.h
+ * @brief Checkpointing the state streams of RigidBodies through core::SnapshotWriter / SnapshotView.
+ */
+
+namespace physics {
+
+/**
+ * @brief Registers the streams that change while simulating, plus mass and inertia, under prefix.
+ *
+ * Shapes are not saved (convex hulls are pointers); a checkpoint is restored
+ * into bodies rebuilt the same way, e.g. from the same scene file. The writer
+ * keeps pointers into the streams, so register again after adding or
+ * removing bodies.
+ */
+void addToSnapshot(core::SnapshotWriter& writer, const RigidBodies& bodies, std::string_view prefix = "bodies");
+
+/**
+ * @brief Copies the saved streams back into bodies.
+ *
+ * @return False, leaving bodies untouched, if an array is missing or holds another body count.
+ */
+bool restoreFromSnapshot(const core::SnapshotView& view, RigidBodies& bodies, std::string_view prefix = "bodies");
+
+} // namespace physics
@@ -0,0 +1,39 @@
+#pragma once
+
+#include <compare>
+#include <cstdint>
+#include <memory_resource>
+#include <vector>
+
+/**
+ * @file Broadphase.h
+ * @brief Output type shared by the broadphase implementations.
+ *
+ * DynamicAabbTree needs explicit proxy updates but scales to large scenes
+ * and many static objects; SweepAndPrune takes the whole box array each frame
+ * and is fastest for up to a few thousand boxes, or for scenes spread out
+ * mostly along one axis (its sweep tests every box overlapping on that axis,
+ * which grows quickly in dense uniform 3D clouds). Both report each
+ * overlapping pair exactly once, as (smaller id, larger id), sorted, so the
+ * result is independent of internal order and deterministic.
+ */
+
+namespace physics {
+
+/**
+ * @brief Two ids whose bounding boxes overlap; always a < b.
+ */
+struct BroadphasePair {
+    std::uint32_t a;
+    std::uint32_t b;
+
+    constexpr auto operator<=>(const BroadphasePair&) const noexcept = default;
+};
+
+/**
+ * @brief Sorts pairs and drops duplicates in place.
+ */
+void sortAndDeduplicate(std::vector<BroadphasePair>& pairs);
+void sortAndDeduplicate(std::pmr::vector<BroadphasePair>& pairs);
+
+} // namespace physics
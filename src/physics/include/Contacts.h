@@ -0,0 +1,128 @@
+#pragma once
+
+#include <cstdint>
+#include <span>
+#include <vector>
+
+#include "include/Vector3.h"
+#include "Broadphase.h"
+#include "RigidBodies.h"
+
+namespace core {
+class JobSystem;
+namespace memory {
+class FrameArena;
+}
+}
+
+/**
+ * @file Contacts.h
+ * @brief Persistent contact manifolds between body pairs.
+ */
+
+namespace physics {
+
+/**
+ * @brief One contact point of a manifold.
+ *
+ * Anchors are stored in body space so the point follows the bodies between
+ * frames; the accumulated impulses are what the solver warm-starts from.
+ */
+struct ContactPoint {
+    math::Vector3 localA;       /**< Point on A, body space of A. */
+    math::Vector3 localB;       /**< Point on B, body space of B. */
+    float separation = 0.0f;    /**< Along the normal; negative when penetrating. */
+    float normalImpulse = 0.0f;
+    float tangentImpulse1 = 0.0f;
+    float tangentImpulse2 = 0.0f;
+};
+
+/**
+ * @brief Contact points shared by one pair of bodies (bodyA < bodyB).
+ */
+struct ContactManifold {
+    static constexpr int MAX_POINTS = 4;
+
+    std::uint32_t bodyA = 0;
+    std::uint32_t bodyB = 0;
+    math::Vector3 normal;       /**< World space, unit, from A to B. */
+    int pointCount = 0;
+    ContactPoint points[MAX_POINTS];
+};
+
+/**
+ * @brief Tuning of contact generation.
+ */
+struct NarrowphaseSettings {
+    float margin = 0.02f;        /**< Speculative distance: closer points are reported before they touch. */
+    float matchDistance = 0.02f; /**< Max drift for a point to count as the same contact next frame. */
+};
+
+/**
+ * @class ContactCache
+ * @brief Runs the narrowphase over broadphase pairs and keeps manifolds alive across frames.
+ *
+ * Every update re-collides each pair and matches the new points against the
+ * pair's manifold from the previous update; a matched point inherits the
+ * old impulses, so the solver starts close to last frame's solution (warm
+ * starting). Points are matched by the distance of their body-space anchors,
+ * which is robust for every shape type without feature ids.
+ *
+ * Tests that report one point per call (GJK/EPA pairs) are accumulated
+ * instead: old points that still touch are kept and the new one is added, so
+ * a box on a hull builds a full manifold over a few frames. Manifolds with
+ * more than four points are reduced to the four spanning the largest area,
+ * which is all a solver needs for a stable face contact.
+ *
+ * The cache is keyed by body indices. RigidBodies::remove() moves a body to
+ * another index, so call clear() after removing bodies (the manifolds are
+ * rebuilt on the next update, only warm starting is lost).
+ *
+ * Example usage:
+ * @code
+ * physics::ContactCache contacts;
+ * contacts.update(bodies, pairs, &jobs); // pairs from a broadphase, sorted
+ * for (const physics::ContactManifold& m : contacts.manifolds()) solve(m);
+ * @endcode
+ */
+class ContactCache {
+public:
+    explicit ContactCache(const NarrowphaseSettings& settings = {}) noexcept : config(settings) {}
+
+    /**
+     * @brief Replaces the manifolds with those of the given pairs.
+     *
+     * @param pairs Candidate pairs, sorted and unique as produced by the
+     *        broadphases; pairs whose shapes do not touch are dropped.
+     * @param jobs Optional job system to collide pairs in parallel; the result
+     *        is the same with or without it.
+     * @param scratch Optional arena for the per-pair results (one manifold
+     *        per pair, most of them empty); without it the cache keeps its
+     *        own buffer.
+     */
+    void update(const RigidBodies& bodies, std::span<const BroadphasePair> pairs, core::JobSystem* jobs = nullptr,
+                core::memory::FrameArena* scratch = nullptr);
+
+    /** @brief Touching pairs, sorted by (bodyA, bodyB). */
+    std::span<ContactManifold> manifolds() noexcept { return current; }
+    std::span<const ContactManifold> manifolds() const noexcept { return current; }
+
+    /** @brief Manifold of a pair (a < b), or nullptr if it is not touching. */
+    const ContactManifold* find(std::uint32_t a, std::uint32_t b) const noexcept;
+
+    /** @brief Forgets all manifolds (and their warm-start impulses). */
+    void clear() noexcept;
+
+    NarrowphaseSettings& settings() noexcept { return config; }
+
+    /** @brief Pairs per job when colliding in parallel. */
+    static constexpr std::size_t PAIRS_PER_JOB = 256;
+
+private:
+    NarrowphaseSettings config;
+    std::vector<ContactManifold> current;  // sorted by pair
+    std::vector<ContactManifold> previous; // last update, for matching
+    std::vector<ContactManifold> slots;    // one per input pair, compacted into current; unless given an arena
+};
+
+} // namespace physics
@@ -0,0 +1,168 @@
+#pragma once
+
+#include <cstdint>
+#include <memory_resource>
+#include <vector>
+
+#include "Aabb.h"
+#include "Broadphase.h"
+
+/**
+ * @file DynamicAabbTree.h
+ * @brief Incrementally updated bounding volume hierarchy.
+ */
+
+namespace physics {
+
+/**
+ * @class DynamicAabbTree
+ * @brief Binary AABB tree over "fat" proxy boxes.
+ *
+ * Each proxy stores its tight box enlarged by a margin (and stretched along
+ * its displacement when one is given), so small motions stay inside the fat
+ * box and cost nothing. When a proxy escapes its fat box:
+ *  - if the new fat box still overlaps the old one, the leaf is updated in
+ *    place and its ancestors are refit bottom-up, stopping as soon as a
+ *    parent box is unchanged;
+ *  - otherwise (teleports, very fast objects) the leaf is reinserted at the
+ *    position the surface-area heuristic picks.
+ * Insertions and removals keep the tree shallow with AVL-style rotations.
+ *
+ * Nodes live in one array with a free list, so proxy ids stay valid until
+ * destroyProxy() and the tree never allocates per node.
+ *
+ * Example usage:
+ * @code
+ * physics::DynamicAabbTree tree;
+ * std::int32_t proxy = tree.createProxy(box, bodyIndex);
+ * tree.moveProxy(proxy, newBox, velocity * dt);
+ * tree.findPairs(pairs);
+ * @endcode
+ */
+class DynamicAabbTree {
+public:
+    static constexpr std::int32_t NULL_NODE = -1;
+
+    /**
+     * @param margin Distance added around every tight box.
+     * @param displacementMultiplier Scale of the displacement used to stretch fat boxes.
+     */
+    explicit DynamicAabbTree(float margin = 0.1f, float displacementMultiplier = 2.0f);
+
+    /**
+     * @brief Adds a proxy and returns its id.
+     *
+     * @param box Tight bounds of the object.
+     * @param userId Value reported in pairs (usually the body index).
+     */
+    std::int32_t createProxy(const Aabb& box, std::uint32_t userId);
+
+    /**
+     * @brief Removes a proxy; its id may be reused by a later createProxy().
+     */
+    void destroyProxy(std::int32_t proxy);
+
+    /**
+     * @brief Updates a proxy after its object moved.
+     *
+     * @param box New tight bounds.
+     * @param displacement Expected motion until the next update (e.g. v * dt).
+     * @return True if the fat box changed (refit or reinsertion).
+     */
+    bool moveProxy(std::int32_t proxy, const Aabb& box, const math::Vector3& displacement = {});
+
+    /**
+     * @brief Changes the id a proxy reports, e.g. after a body swap-remove.
+     */
+    void setUserId(std::int32_t proxy, std::uint32_t userId) noexcept { nodes[proxy].userId = userId; }
+
+    std::uint32_t userId(std::int32_t proxy) const noexcept { return nodes[proxy].userId; }
+
+    const Aabb& fatAabb(std::int32_t proxy) const noexcept { return nodes[proxy].box; }
+
+    /**
+     * @brief Calls callback(userId) for every proxy whose fat box overlaps box.
+     *
+     * The callback returns false to stop the query early.
+     */
+    template <typename Callback>
+    void query(const Aabb& box, Callback&& callback) const {
+        if (root == NULL_NODE) return;
+        stack.clear();
+        stack.push_back(root);
+        while (!stack.empty()) {
+            const std::int32_t id = stack.back();
+            stack.pop_back();
+            const Node& n = nodes[id];
+            if (!n.box.overlaps(box)) continue;
+            if (n.isLeaf()) {
+                if (!callback(n.userId)) return;
+            } else {
+                stack.push_back(n.child1);
+                stack.push_back(n.child2);
+            }
+        }
+    }
+
+    /**
+     * @brief Replaces out with every pair of proxies whose fat boxes overlap.
+     *
+     * Pairs use user ids, are sorted and contain no duplicates.
+     */
+    void findPairs(std::vector<BroadphasePair>& out) const;
+
+    /** @brief Same, into a vector on a memory resource (e.g. a frame arena). */
+    void findPairs(std::pmr::vector<BroadphasePair>& out) const;
+
+    // --- Diagnostics ---
+
+    std::size_t proxyCount() const noexcept { return leafCount; }
+
+    /** @brief Height of the tree (0 for a single leaf, -1 when empty). */
+    int height() const noexcept { return root == NULL_NODE ? -1 : nodes[root].height; }
+
+    /**
+     * @brief Checks parent links, heights, node counts and box containment.
+     *
+     * Intended for tests; walks the whole tree.
+     */
+    bool validate() const;
+
+private:
+    struct Node {
+        Aabb box;
+        std::int32_t parent = NULL_NODE; /**< Next free node while on the free list. */
+        std::int32_t child1 = NULL_NODE;
+        std::int32_t child2 = NULL_NODE;
+        std::int32_t height = 0;         /**< 0 for leaves, -1 for free nodes. */
+        std::uint32_t userId = 0;
+
+        bool isLeaf() const noexcept { return child1 == NULL_NODE; }
+    };
+
+    std::int32_t allocateNode();
+    void freeNode(std::int32_t id);
+    void insertLeaf(std::int32_t leaf);
+    void removeLeaf(std::int32_t leaf);
+    void refitAncestors(std::int32_t start, bool rebalance);
+    std::int32_t balance(std::int32_t a);
+    Aabb fatten(const Aabb& box, const math::Vector3& displacement) const noexcept;
+    bool validateNode(std::int32_t id) const;
+    template <typename Pairs>
+    void collectPairs(Pairs& out) const;
+
+    std::vector<Node> nodes;
+    std::int32_t root = NULL_NODE;
+    std::int32_t freeList = NULL_NODE;
+    std::size_t leafCount = 0;
+    float margin;
+    float displacementMultiplier;
+    mutable std::vector<std::int32_t> stack; // reused traversal stack
+    struct NodePair {
+        std::int32_t a, b;
+    };
+    mutable std::vector<NodePair> pending;    // findPairs() scratch: subtree pairs to test
+    mutable std::vector<std::int32_t> internal; // findPairs() scratch: nodes whose children are paired
+};
+
+} // namespace physics
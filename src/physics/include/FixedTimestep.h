@@ -0,0 +1,68 @@
+#pragma once
+
+#include <algorithm>
+#include <cassert>
+
+namespace physics {
+
+/**
+ * @class FixedTimestep
+ * @brief Accumulator that turns variable frame times into whole fixed steps.
+ *
+ * The simulation always advances by step() seconds, which keeps it stable
+ * and reproducible regardless of frame rate. Leftover time carries over to
+ * the next frame; alpha() tells a renderer how far to interpolate between
+ * the last two simulated states.
+ *
+ * To avoid a "spiral of death" on slow frames, at most maxSteps steps are
+ * issued per frame and any time beyond that is dropped.
+ *
+ * Example usage:
+ * @code
+ * physics::FixedTimestep clock(1.0f / 60.0f);
+ * for (int n = clock.advance(frameSeconds); n > 0; --n) world.step();
+ * @endcode
+ */
+class FixedTimestep {
+public:
+    /**
+     * @param step Simulation step in seconds (> 0).
+     * @param maxSteps Upper bound on steps issued by one advance() call (>= 1).
+     */
+    explicit FixedTimestep(float step = 1.0f / 60.0f, int maxSteps = 8) noexcept
+        : stepSeconds(step), maxStepsPerFrame(maxSteps) {
+        assert(step > 0.0f && maxSteps >= 1);
+    }
+
+    /**
+     * @brief Adds a frame's worth of time and returns how many steps to run.
+     */
+    int advance(float frameSeconds) noexcept {
+        accumulator += std::max(frameSeconds, 0.0f);
+        int steps = static_cast<int>(accumulator / stepSeconds);
+        if (steps > maxStepsPerFrame) {
+            steps = maxStepsPerFrame;
+            accumulator = 0.0f;
+            return steps;
+        }
+        accumulator -= static_cast<float>(steps) * stepSeconds;
+        return steps;
+    }
+
+    float step() const noexcept { return stepSeconds; }
+
+    /**
+     * @brief Fraction of a step left in the accumulator, in [0, 1).
+     */
+    float alpha() const noexcept { return accumulator / stepSeconds; }
+
+    /** @brief Drops any accumulated time. */
+    void reset() noexcept { accumulator = 0.0f; }
+
+private:
+    float stepSeconds;
+    int maxStepsPerFrame;
+    float accumulator = 0.0f;
+};
+
+} // namespace physics
@@ -0,0 +1,70 @@
+#pragma once
+
+#include "include/Vector3.h"
+#include "Shapes.h"
+
+/**
+ * @file Gjk.h
+ * @brief GJK distance and EPA penetration depth between convex shapes.
+ *
+ * Both algorithms only see shapes through their support functions, so they
+ * work for any convex shape, including hulls. GJK iterates a simplex of the
+ * Minkowski difference A - B towards the origin: its closest point gives the
+ * distance and witness points of separated shapes. When the origin is inside
+ * (the shapes overlap), EPA expands a polytope from that simplex until it
+ * finds the face of A - B closest to the origin, which gives the minimum
+ * translation to separate them.
+ */
+
+namespace physics {
+
+/**
+ * @brief Support mapping of a posed shape, with or without its radius.
+ */
+struct ConvexSupport {
+    const Shape* shape;
+    const Pose* pose;
+    bool includeRadius = true;
+
+    math::Vector3 operator()(const math::Vector3& direction) const noexcept {
+        return includeRadius ? shape->support(*pose, direction) : shape->coreSupport(*pose, direction);
+    }
+
+    /** @brief A point inside the shape, used to seed the search. */
+    const math::Vector3& center() const noexcept { return pose->position; }
+};
+
+/**
+ * @brief Result of gjkDistance().
+ */
+struct GjkResult {
+    bool overlapping = false;
+    float distance = 0.0f;  /**< 0 when overlapping. */
+    math::Vector3 pointA;   /**< Closest point on A (valid when separated). */
+    math::Vector3 pointB;   /**< Closest point on B. */
+};
+
+/**
+ * @brief Distance and closest points between two convex shapes.
+ */
+GjkResult gjkDistance(const ConvexSupport& a, const ConvexSupport& b) noexcept;
+
+/**
+ * @brief Result of epaPenetration().
+ */
+struct EpaResult {
+    math::Vector3 normal; /**< Unit direction from A to B; moving B by normal * depth separates. */
+    float depth = 0.0f;
+    math::Vector3 pointA; /**< Deepest point of A inside B. */
+    math::Vector3 pointB; /**< Deepest point of B inside A. */
+};
+
+/**
+ * @brief Penetration depth and direction of two overlapping convex shapes.
+ *
+ * @return False if the shapes do not overlap or the polytope degenerates
+ *         (e.g. flat shapes); out is then unspecified.
+ */
+bool epaPenetration(const ConvexSupport& a, const ConvexSupport& b, EpaResult& out) noexcept;
+
+} // namespace physics
@@ -0,0 +1,66 @@
+#pragma once
+
+#include "include/Vector3.h"
+#include "RigidBodies.h"
+
+/**
+ * @file Integrator.h
+ * @brief Semi-implicit (symplectic) Euler integration of every body at once.
+ *
+ * A step is split in two passes so a constraint solver can run in between:
+ *  1. integrateVelocities: v += (g + F/m) dt, w += I^-1 tau dt, then damping.
+ *  2. integratePositions:  x += v dt, q += 0.5 (w, 0) q dt, renormalized.
+ * Using the updated velocity for the position update is what makes the
+ * scheme symplectic: energy stays bounded for oscillators and orbits instead
+ * of growing as with explicit Euler.
+ *
+ * Both passes are SIMD kernels over the SoA streams (see math/SimdPack.h).
+ * The SSE and scalar backends give identical bits. Gyroscopic torque is
+ * ignored, which keeps spinning bodies stable at the cost of not modeling
+ * precession of asymmetric bodies.
+ */
+
+namespace physics {
+
+/**
+ * @brief Global parameters of the integrator.
+ */
+struct IntegratorSettings {
+    math::Vector3 gravity{0.0f, -9.81f, 0.0f};
+    float linearDamping = 0.0f;  /**< Per-second damping rate; v *= 1 / (1 + dt * rate). */
+    float angularDamping = 0.0f; /**< Same for angular velocity. */
+};
+
+/**
+ * @brief Applies gravity, accumulated forces/torques and damping to velocities.
+ *
+ * Static bodies (inverse mass 0) are skipped implicitly: gravity is masked
+ * and their inverse mass and inertia are zero.
+ */
+void integrateVelocities(RigidBodies& bodies, float dt, const IntegratorSettings& settings) noexcept;
+
+/**
+ * @brief integrateVelocities over bodies [first, last) only.
+ *
+ * Bodies are independent, so disjoint ranges may run on different threads;
+ * the result does not depend on how the bodies are split.
+ */
+void integrateVelocities(RigidBodies& bodies, float dt, const IntegratorSettings& settings,
+                         std::size_t first, std::size_t last) noexcept;
+
+/**
+ * @brief Advances positions and orientations with the current velocities.
+ */
+void integratePositions(RigidBodies& bodies, float dt) noexcept;
+
+/**
+ * @brief integratePositions over bodies [first, last) only.
+ */
+void integratePositions(RigidBodies& bodies, float dt, std::size_t first, std::size_t last) noexcept;
+
+/**
+ * @brief integrateVelocities followed by integratePositions.
+ */
+void integrate(RigidBodies& bodies, float dt, const IntegratorSettings& settings) noexcept;
+
+} // namespace physics
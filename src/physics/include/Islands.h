@@ -0,0 +1,82 @@
+#pragma once
+
+#include <cstdint>
+#include <span>
+#include <vector>
+
+#include "Broadphase.h"
+#include "RigidBodies.h"
+
+/**
+ * @file Islands.h
+ * @brief Partition of bodies into independently solvable groups.
+ */
+
+namespace physics {
+
+/**
+ * @class Islands
+ * @brief Connected components of dynamic bodies linked by contacts or joints.
+ *
+ * Constraints in different islands never touch the same dynamic body, so a
+ * solver may process islands on different threads without synchronization
+ * and still get the same result as a sequential solve. Static bodies do not
+ * join islands (they are never written), so everything resting on the same
+ * ground still splits into separate islands.
+ *
+ * The layout is deterministic: islands are ordered by their smallest body
+ * index, and bodies and links inside an island are in ascending order.
+ *
+ * Example usage:
+ * @code
+ * physics::Islands islands;
+ * islands.build(bodies, contactPairs);
+ * jobs.parallelFor(0, islands.count(), 1, [&](std::size_t begin, std::size_t end) {
+ *     for (std::size_t i = begin; i < end; ++i) solve(islands.links(i));
+ * });
+ * @endcode
+ */
+class Islands {
+public:
+    /**
+     * @brief Recomputes the islands.
+     *
+     * @param bodies Body set; only isStatic() is read.
+     * @param links Body index pairs that constrain each other (contacts, joints).
+     *        A link's index in this span is what links() reports.
+     */
+    void build(const RigidBodies& bodies, std::span<const BroadphasePair> links);
+
+    /** @brief Leaves no islands, e.g. when nothing links any body; keeps capacity. */
+    void clear() noexcept;
+
+    /** @brief Number of islands, including single bodies without links. */
+    std::size_t count() const noexcept { return bodyStart.empty() ? 0 : bodyStart.size() - 1; }
+
+    /** @brief Dynamic bodies of island i, ascending. */
+    std::span<const std::uint32_t> bodies(std::size_t i) const noexcept {
+        return {bodyIndices.data() + bodyStart[i], bodyStart[i + 1] - bodyStart[i]};
+    }
+
+    /** @brief Indices into the links passed to build() that belong to island i, ascending. */
+    std::span<const std::uint32_t> links(std::size_t i) const noexcept {
+        return {linkIndices.data() + linkStart[i], linkStart[i + 1] - linkStart[i]};
+    }
+
+    /** @brief Island of a dynamic body; NONE for static bodies. */
+    std::uint32_t islandOf(std::size_t body) const noexcept { return bodyIsland[body]; }
+
+    static constexpr std::uint32_t NONE = ~std::uint32_t{0};
+
+private:
+    std::uint32_t findRoot(std::uint32_t i) noexcept;
+
+    std::vector<std::uint32_t> bodyIndices;
+    std::vector<std::uint32_t> bodyStart;
+    std::vector<std::uint32_t> linkIndices;
+    std::vector<std::uint32_t> linkStart;
+    std::vector<std::uint32_t> bodyIsland;
+    std::vector<std::uint32_t> parent; // union-find scratch
+};
+
+} // namespace physics
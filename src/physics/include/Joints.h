@@ -0,0 +1,105 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "include/Vector3.h"
+#include "RigidBodies.h"
+
+/**
+ * @file Joints.h
+ * @brief Bilateral constraints between pairs of bodies.
+ */
+
+namespace physics {
+
+/**
+ * @brief Keeps two anchor points together; the bodies rotate freely about it.
+ */
+struct BallSocketJoint {
+    std::uint32_t bodyA = 0;
+    std::uint32_t bodyB = 0;
+    math::Vector3 localAnchorA;  /**< Body space of A. */
+    math::Vector3 localAnchorB;  /**< Body space of B. */
+    math::Vector3 impulse;       /**< Accumulated by the solver (warm start). */
+};
+
+/**
+ * @brief Keeps two anchor points at a fixed distance (a massless rod).
+ */
+struct DistanceJoint {
+    std::uint32_t bodyA = 0;
+    std::uint32_t bodyB = 0;
+    math::Vector3 localAnchorA;
+    math::Vector3 localAnchorB;
+    float length = 0.0f;
+    float impulse = 0.0f;
+};
+
+/**
+ * @brief Ball-socket that also keeps one axis of A aligned with one of B,
+ *        leaving a single rotational degree of freedom about it.
+ */
+struct HingeJoint {
+    std::uint32_t bodyA = 0;
+    std::uint32_t bodyB = 0;
+    math::Vector3 localAnchorA;
+    math::Vector3 localAnchorB;
+    math::Vector3 localAxisA;    /**< Unit hinge axis, body space of A. */
+    math::Vector3 localAxisB;    /**< The same axis in body space of B. */
+    math::Vector3 impulse;       /**< Point part. */
+    float angularImpulse[2] = {0.0f, 0.0f};
+};
+
+/**
+ * @class Joints
+ * @brief Every joint of a world, grouped by type.
+ *
+ * The add functions take world-space anchors and axes at the current body
+ * poses, which is how joints are usually authored; the arrays are public
+ * for direct edits. Joints refer to bodies by index, so like the contact
+ * cache they must be patched when bodies are removed.
+ *
+ * Example usage:
+ * @code
+ * physics::Joints joints;
+ * joints.addHinge(bodies, door, frame, hingePoint, {0.0f, 1.0f, 0.0f});
+ * @endcode
+ */
+class Joints {
+public:
+    std::vector<BallSocketJoint> ballSockets;
+    std::vector<DistanceJoint> distances;
+    std::vector<HingeJoint> hinges;
+
+    /**
+     * @brief Joins a and b at a world point; returns the index in ballSockets.
+     */
+    std::size_t addBallSocket(const RigidBodies& bodies, std::uint32_t a, std::uint32_t b,
+                              const math::Vector3& worldAnchor);
+
+    /**
+     * @brief Keeps the world points anchorA (on a) and anchorB (on b) at their
+     *        current distance; returns the index in distances.
+     */
+    std::size_t addDistance(const RigidBodies& bodies, std::uint32_t a, std::uint32_t b,
+                            const math::Vector3& worldAnchorA, const math::Vector3& worldAnchorB);
+
+    /**
+     * @brief Hinges a and b about a world axis through a world point; returns the index in hinges.
+     */
+    std::size_t addHinge(const RigidBodies& bodies, std::uint32_t a, std::uint32_t b,
+                         const math::Vector3& worldAnchor, const math::Vector3& worldAxis);
+
+    std::size_t size() const noexcept { return ballSockets.size() + distances.size() + hinges.size(); }
+    bool empty() const noexcept { return size() == 0; }
+
+    void clear() noexcept {
+        ballSockets.clear();
+        distances.clear();
+        hinges.clear();
+    }
+};
+
+} // namespace physics
@@ -0,0 +1,81 @@
+#pragma once
+
+#include "include/Vector3.h"
+#include "Shapes.h"
+
+/**
+ * @file Narrowphase.h
+ * @brief Contact generation between pairs of posed shapes.
+ *
+ * Pairs with a closed-form test use it:
+ *  - sphere/sphere, sphere/capsule, capsule/capsule: closest points of the
+ *    cores (point or segment), two points for parallel capsules;
+ *  - sphere/box: closest point on the box;
+ *  - box/box: separating axis test over the 15 candidate axes, then the
+ *    incident face is clipped against the reference face (up to 8 points)
+ *    or, for an edge axis, one point between the two edges.
+ * Everything else (capsule/box and any hull) goes through GJK on the cores
+ * with EPA as the fallback for deep overlap. Those produce a single point per
+ * call; ContactCache accumulates them over frames into a full manifold.
+ */
+
+namespace physics {
+
+/**
+ * @brief Contacts between two shapes in one frame, in world space.
+ */
+struct CollisionResult {
+    static constexpr int MAX_POINTS = 8;
+
+    struct Point {
+        math::Vector3 onA;  /**< Point on the surface of A. */
+        math::Vector3 onB;  /**< Point on the surface of B. */
+        float separation;   /**< Along the normal; negative when penetrating. */
+    };
+
+    math::Vector3 normal;   /**< Unit direction from A to B. */
+    Point points[MAX_POINTS];
+    int pointCount = 0;
+    bool incremental = false; /**< Only the deepest point was found; accumulate over frames. */
+};
+
+/**
+ * @brief Finds contacts between two shapes, dispatching on their types.
+ *
+ * @param margin Points separated by up to this distance are still reported
+ *        (speculative contacts), so the solver sees approaching surfaces.
+ * @return True if at least one point was found.
+ */
+bool collide(const Shape& a, const Pose& poseA, const Shape& b, const Pose& poseB, float margin,
+             CollisionResult& out) noexcept;
+
+// --- Individual tests; A and B must have the named types ---
+
+bool collideSpheres(const Shape& a, const Pose& poseA, const Shape& b, const Pose& poseB, float margin,
+                    CollisionResult& out) noexcept;
+bool collideSphereCapsule(const Shape& a, const Pose& poseA, const Shape& b, const Pose& poseB, float margin,
+                          CollisionResult& out) noexcept;
+bool collideCapsules(const Shape& a, const Pose& poseA, const Shape& b, const Pose& poseB, float margin,
+                     CollisionResult& out) noexcept;
+bool collideSphereBox(const Shape& a, const Pose& poseA, const Shape& b, const Pose& poseB, float margin,
+                      CollisionResult& out) noexcept;
+bool collideBoxes(const Shape& a, const Pose& poseA, const Shape& b, const Pose& poseB, float margin,
+                  CollisionResult& out) noexcept;
+
+/**
+ * @brief GJK/EPA test for any two convex shapes; reports one point.
+ */
+bool collideConvex(const Shape& a, const Pose& poseA, const Shape& b, const Pose& poseB, float margin,
+                   CollisionResult& out) noexcept;
+
+/**
+ * @brief Closest points between segments p1-q1 and p2-q2.
+ *
+ * @param s Parameter of c1 on the first segment, in [0, 1].
+ * @param t Parameter of c2 on the second segment, in [0, 1].
+ */
+void closestPointsSegments(const math::Vector3& p1, const math::Vector3& q1, const math::Vector3& p2,
+                           const math::Vector3& q2, float& s, float& t, math::Vector3& c1,
+                           math::Vector3& c2) noexcept;
+
+} // namespace physics
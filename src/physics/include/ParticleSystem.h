@@ -0,0 +1,157 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "include/AlignedArray.h"
+#include "include/Vector3.h"
+#include "include/Vector3SoA.h"
+
+namespace core {
+class JobSystem;
+}
+
+/**
+ * @file ParticleSystem.h
+ * @brief CPU particle simulation on SoA streams.
+ */
+
+namespace physics {
+
+/**
+ * @brief Forces shared by every particle of a system.
+ */
+struct ParticleSettings {
+    math::Vector3 gravity{0.0f, -9.81f, 0.0f};
+    float drag = 0.0f;                    /**< Per-second damping rate; v *= 1 / (1 + dt * drag). */
+    std::size_t maxParticles = 1u << 24;  /**< Emission stops at this count. */
+};
+
+/**
+ * @brief Continuous particle source.
+ *
+ * Particles start at a random point of the box position +- extents, moving
+ * in a random direction within spread radians of direction, with a random
+ * speed and lifetime from the given ranges.
+ */
+struct EmitterDesc {
+    math::Vector3 position;
+    math::Vector3 extents;                  /**< Half size of the spawn box. */
+    math::Vector3 direction{0.0f, 1.0f, 0.0f}; /**< Unit cone axis. */
+    float spread = 0.3f;                    /**< Cone half angle in radians. */
+    float minSpeed = 1.0f;
+    float maxSpeed = 2.0f;
+    float minLifetime = 1.0f;               /**< Seconds. */
+    float maxLifetime = 2.0f;
+    float rate = 100.0f;                    /**< Particles per second; fractions carry over. */
+    std::uint64_t seed = 1;                 /**< Same seed, same particles. */
+    bool enabled = true;
+};
+
+/**
+ * @class ParticleSystem
+ * @brief Dense SoA particle storage with O(1) emit and kill.
+ *
+ * Live particles always occupy indices [0, size()): emit() appends and
+ * kill() moves the last particle into the freed slot, so there are no holes
+ * to skip and every kernel streams over contiguous floats. Per-particle
+ * overhead is a few bytes of SoA state and no allocation after reserve().
+ *
+ * update() runs, in order:
+ *  1. a SIMD kernel over every particle: v = (v + g dt) * drag factor,
+ *     x += v dt, life -= dt; split into chunks across a job system if one
+ *     is given (chunks are independent);
+ *  2. removal of particles whose life ran out, in index order;
+ *  3. emission from every enabled emitter, in emitter order.
+ * Steps 2 and 3 are serial, so results do not depend on the thread count.
+ *
+ * Example usage:
+ * @code
+ * physics::ParticleSystem sparks;
+ * physics::EmitterDesc e;
+ * e.rate = 5000.0f;
+ * sparks.addEmitter(e);
+ * sparks.update(dt, &jobs);
+ * draw(sparks.position, sparks.size());
+ * @endcode
+ */
+class ParticleSystem {
+public:
+    // --- Streams ---
+
+    math::Vector3SoA position;
+    math::Vector3SoA velocity;
+    math::AlignedArray<float> life;      /**< Seconds left; the particle dies at <= 0. */
+    math::AlignedArray<float> lifetime;  /**< Seconds it was emitted with (for fading by age). */
+
+    explicit ParticleSystem(const ParticleSettings& settings = {}) noexcept : config(settings) {}
+
+    std::size_t size() const noexcept { return life.size(); }
+    bool empty() const noexcept { return life.empty(); }
+
+    void reserve(std::size_t count);
+
+    /** @brief Kills every particle; keeps emitters and allocations. */
+    void clear() noexcept;
+
+    /**
+     * @brief Adds one particle.
+     *
+     * @return Its index, or NONE if maxParticles is reached.
+     */
+    std::size_t emit(const math::Vector3& p, const math::Vector3& v, float seconds);
+
+    /**
+     * @brief Removes a particle in O(1) by moving the last one into its slot.
+     *
+     * @return The previous index of the moved particle (size() before the call minus one).
+     */
+    std::size_t kill(std::size_t index) noexcept;
+
+    /** @brief Age in [0, 1]: 0 just emitted, 1 about to die. */
+    float normalizedAge(std::size_t i) const noexcept { return 1.0f - life[i] / lifetime[i]; }
+
+    // --- Emitters ---
+
+    /** @brief Adds an emitter and returns its index. */
+    std::size_t addEmitter(const EmitterDesc& desc);
+
+    /** @brief Emitter i, editable between updates (position, rate, enabled...). */
+    EmitterDesc& emitter(std::size_t i) noexcept { return emitters[i].desc; }
+
+    std::size_t emitterCount() const noexcept { return emitters.size(); }
+
+    // --- Simulation ---
+
+    /**
+     * @brief Advances every particle by dt, then removes dead ones and emits new ones.
+     *
+     * @param jobs Optional job system for the particle kernel; same result without it.
+     */
+    void update(float dt, core::JobSystem* jobs = nullptr);
+
+    ParticleSettings& settings() noexcept { return config; }
+
+    static constexpr std::size_t NONE = ~std::size_t{0};
+
+    /** @brief Particles per job and per dead-count chunk (multiple of the SIMD width). */
+    static constexpr std::size_t PARTICLES_PER_JOB = 16384;
+
+private:
+    struct Emitter {
+        EmitterDesc desc;
+        float carry = 0.0f;        // fractional particles owed from earlier updates
+        std::uint64_t rngState = 0;
+    };
+
+    std::uint32_t simulate(float dt, std::size_t first, std::size_t last) noexcept;
+    void removeDead();
+    void spawn(Emitter& e, float dt);
+
+    ParticleSettings config;
+    std::vector<Emitter> emitters;
+    std::vector<std::uint32_t> deadPerChunk;
+};
+
+} // namespace physics
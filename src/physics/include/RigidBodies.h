@@ -0,0 +1,147 @@
+#pragma once
+
+#include <cstddef>
+
+#include "include/AlignedArray.h"
+#include "include/Quaternion.h"
+#include "include/Vector3.h"
+#include "include/Vector3SoA.h"
+#include "Shapes.h"
+
+/**
+ * @file RigidBodies.h
+ * @brief Structure-of-Arrays storage for rigid bodies.
+ *
+ * Every body attribute lives in its own cache-line aligned stream, so the
+ * integrator and solver kernels touch only the streams they need and load
+ * four bodies per SIMD register. Bodies are addressed by index; removal
+ * moves the last body into the freed slot (see RigidBodies::remove).
+ */
+
+namespace physics {
+
+/**
+ * @brief Initial state of a body passed to RigidBodies::add().
+ *
+ * A mass of zero makes the body static: it is never moved by the integrator
+ * and acts as an immovable anchor for contacts and joints.
+ */
+struct BodyDesc {
+    math::Vector3 position;
+    math::Quaternion orientation;
+    math::Vector3 linearVelocity;
+    math::Vector3 angularVelocity;   /**< World space, radians per second. */
+    float mass = 1.0f;               /**< Kilograms; 0 for static bodies. */
+    math::Vector3 inertia{1.0f, 1.0f, 1.0f}; /**< Principal moments in body space (kg m^2). */
+    Shape shape;                     /**< Collision shape; the default (None) does not collide. */
+};
+
+/**
+ * @brief Principal moments of inertia of a solid box.
+ */
+constexpr math::Vector3 boxInertia(float mass, const math::Vector3& halfExtents) noexcept {
+    const float x2 = 4.0f * halfExtents.x * halfExtents.x;
+    const float y2 = 4.0f * halfExtents.y * halfExtents.y;
+    const float z2 = 4.0f * halfExtents.z * halfExtents.z;
+    return {mass / 12.0f * (y2 + z2), mass / 12.0f * (x2 + z2), mass / 12.0f * (x2 + y2)};
+}
+
+/**
+ * @brief Principal moments of inertia of a solid sphere.
+ */
+constexpr math::Vector3 sphereInertia(float mass, float radius) noexcept {
+    const float i = 0.4f * mass * radius * radius;
+    return {i, i, i};
+}
+
+/**
+ * @class RigidBodies
+ * @brief SoA container of rigid bodies.
+ *
+ * Streams are public so bulk kernels can work on them directly; keep their
+ * sizes in sync by going through add()/remove()/clear() for structural
+ * changes. Mass and inertia are stored inverted, which is what the
+ * integrator and solver consume, and a zero inverse marks a static body.
+ *
+ * Orientation is a unit quaternion split into four component streams.
+ */
+class RigidBodies {
+public:
+    // --- Streams ---
+
+    math::Vector3SoA position;
+    math::Vector3SoA linearVelocity;
+    math::Vector3SoA angularVelocity;      /**< World space. */
+    math::AlignedArray<float> qx, qy, qz, qw; /**< Orientation components. */
+    math::Vector3SoA force;                /**< Accumulated world force, cleared each step. */
+    math::Vector3SoA torque;               /**< Accumulated world torque, cleared each step. */
+    math::AlignedArray<float> inverseMass;
+    math::Vector3SoA inverseInertia;       /**< Body-space principal moments, inverted. */
+    math::AlignedArray<Shape> shape;       /**< Collision shape, centered on the body origin. */
+
+    // --- Structure ---
+
+    std::size_t size() const noexcept { return inverseMass.size(); }
+    bool empty() const noexcept { return inverseMass.empty(); }
+
+    /**
+     * @brief Pre-allocates every stream for count bodies.
+     */
+    void reserve(std::size_t count);
+
+    /**
+     * @brief Appends a body and returns its index.
+     */
+    std::size_t add(const BodyDesc& desc);
+
+    /**
+     * @brief Removes a body in O(1) by moving the last body into its slot.
+     *
+     * @return The previous index of the moved body (size() before the call
+     *         minus one), so callers can patch references to it.
+     */
+    std::size_t remove(std::size_t index) noexcept;
+
+    /**
+     * @brief Removes all bodies; keeps the allocations.
+     */
+    void clear() noexcept;
+
+    // --- Per-body access ---
+
+    math::Quaternion orientation(std::size_t i) const noexcept { return {qx[i], qy[i], qz[i], qw[i]}; }
+
+    void setOrientation(std::size_t i, const math::Quaternion& q) noexcept {
+        qx[i] = q.x;
+        qy[i] = q.y;
+        qz[i] = q.z;
+        qw[i] = q.w;
+    }
+
+    bool isStatic(std::size_t i) const noexcept { return inverseMass[i] == 0.0f; }
+
+    /**
+     * @brief Adds a force through the center of mass for the next step.
+     */
+    void applyForce(std::size_t i, const math::Vector3& f) noexcept { force.set(i, force.get(i) + f); }
+
+    /**
+     * @brief Adds a force applied at a world-space point (also produces torque).
+     */
+    void applyForceAt(std::size_t i, const math::Vector3& f, const math::Vector3& point) noexcept {
+        applyForce(i, f);
+        applyTorque(i, (point - position.get(i)).cross(f));
+    }
+
+    /**
+     * @brief Adds a world-space torque for the next step.
+     */
+    void applyTorque(std::size_t i, const math::Vector3& t) noexcept { torque.set(i, torque.get(i) + t); }
+
+    /**
+     * @brief Zeroes the force and torque accumulators of every body.
+     */
+    void clearForces() noexcept;
+};
+
+} // namespace physics
@@ -0,0 +1,145 @@
+#pragma once
+
+#include <cstdint>
+#include <type_traits>
+#include <vector>
+
+#include "include/Affine3.h"
+#include "include/Vector3.h"
+#include "Aabb.h"
+
+/**
+ * @file Shapes.h
+ * @brief Collision shapes and rigid poses used by the narrowphase.
+ */
+
+namespace physics {
+
+/**
+ * @brief Position and rotation of a shape in world space.
+ *
+ * The rotation is kept as a matrix: narrowphase code rotates many vectors
+ * per pair and needs the box axes (the matrix columns) directly.
+ */
+struct Pose {
+    math::Vector3 position;
+    math::Rotation3 rotation;
+
+    /** @brief Local axis i (0 = x, 1 = y, 2 = z) in world space. */
+    constexpr math::Vector3 axis(int i) const noexcept {
+        return {rotation.m[0][i], rotation.m[1][i], rotation.m[2][i]};
+    }
+
+    /** @brief Local direction to world. */
+    constexpr math::Vector3 rotate(const math::Vector3& d) const noexcept { return math::rotate(rotation, d); }
+
+    /** @brief World direction to local (multiplies by the transpose). */
+    constexpr math::Vector3 unrotate(const math::Vector3& d) const noexcept {
+        return {rotation.m[0][0] * d.x + rotation.m[1][0] * d.y + rotation.m[2][0] * d.z,
+                rotation.m[0][1] * d.x + rotation.m[1][1] * d.y + rotation.m[2][1] * d.z,
+                rotation.m[0][2] * d.x + rotation.m[1][2] * d.y + rotation.m[2][2] * d.z};
+    }
+
+    constexpr math::Vector3 toWorld(const math::Vector3& p) const noexcept { return position + rotate(p); }
+    constexpr math::Vector3 toLocal(const math::Vector3& p) const noexcept { return unrotate(p - position); }
+};
+
+/**
+ * @brief Convex polytope given by its vertices in body space.
+ *
+ * Only the vertices are needed: the narrowphase treats hulls through their
+ * support function (GJK/EPA). The hull is owned by the caller and shared by
+ * every shape that points at it.
+ */
+struct ConvexHull {
+    std::vector<math::Vector3> vertices;
+
+    /** @brief Vertex furthest along direction (local space). */
+    math::Vector3 support(const math::Vector3& direction) const noexcept;
+};
+
+enum class ShapeType : std::uint8_t {
+    None,       /**< No collision. */
+    Sphere,
+    Capsule,
+    Box,
+    ConvexHull,
+};
+
+/**
+ * @brief Collision shape of one body, centered on the body origin.
+ *
+ * Trivially copyable so it can be stored as a RigidBodies stream; build it
+ * with the named constructors. Spheres and capsules are "core + radius"
+ * shapes (a point or a segment along local y, inflated by radius), which is
+ * what makes their tests cheap and exact.
+ *
+ * Example usage:
+ * @code
+ * physics::BodyDesc d;
+ * d.shape = physics::Shape::box({0.5f, 0.5f, 0.5f});
+ * @endcode
+ */
+struct Shape {
+    ShapeType type = ShapeType::None;
+    float radius = 0.0f;          /**< Sphere and capsule radius. */
+    float halfHeight = 0.0f;      /**< Capsule: half length of the core segment along local y. */
+    math::Vector3 halfExtents;    /**< Box half size. */
+    const ConvexHull* hull = nullptr;
+
+    static constexpr Shape sphere(float radius) noexcept {
+        Shape s;
+        s.type = ShapeType::Sphere;
+        s.radius = radius;
+        return s;
+    }
+
+    static constexpr Shape capsule(float halfHeight, float radius) noexcept {
+        Shape s;
+        s.type = ShapeType::Capsule;
+        s.halfHeight = halfHeight;
+        s.radius = radius;
+        return s;
+    }
+
+    static constexpr Shape box(const math::Vector3& halfExtents) noexcept {
+        Shape s;
+        s.type = ShapeType::Box;
+        s.halfExtents = halfExtents;
+        return s;
+    }
+
+    static constexpr Shape convexHull(const ConvexHull& hull) noexcept {
+        Shape s;
+        s.type = ShapeType::ConvexHull;
+        s.hull = &hull;
+        return s;
+    }
+
+    /** @brief False for ShapeType::None. */
+    constexpr bool collides() const noexcept { return type != ShapeType::None; }
+
+    /**
+     * @brief Furthest point along a world direction, including the radius.
+     */
+    math::Vector3 support(const Pose& pose, const math::Vector3& direction) const noexcept;
+
+    /**
+     * @brief Furthest point of the core (radius excluded) along a world direction.
+     */
+    math::Vector3 coreSupport(const Pose& pose, const math::Vector3& direction) const noexcept;
+
+    /** @brief Radius around the core: the sphere/capsule radius, 0 otherwise. */
+    constexpr float coreRadius() const noexcept {
+        return type == ShapeType::Sphere || type == ShapeType::Capsule ? radius : 0.0f;
+    }
+
+    /**
+     * @brief World-space bounds at the given pose.
+     */
+    Aabb bounds(const Pose& pose) const noexcept;
+};
+
+static_assert(std::is_trivially_copyable_v<Shape>, "Shape is stored in an AlignedArray");
+
+} // namespace physics
@@ -0,0 +1,203 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <span>
+#include <vector>
+
+#include "include/AlignedArray.h"
+#include "include/Vector3.h"
+#include "include/Vector3SoA.h"
+
+namespace core {
+class JobSystem;
+}
+
+/**
+ * @file SoftBodies.h
+ * @brief Cloth and soft bodies with extended position-based dynamics (XPBD).
+ *
+ * Each substep predicts positions from velocities, projects every
+ * constraint once and derives velocities from the position change (Macklin
+ * et al., "Small Steps in Physics Simulation"). Stiffness comes from more
+ * substeps, not more iterations; with one projection per substep the
+ * Lagrange multipliers need not be stored. Compliance (inverse stiffness,
+ * in m/N) is scaled by 1/dt^2, so material behaviour does not depend on the
+ * substep count.
+ *
+ * Constraints of each kind are greedily colored so that no two constraints
+ * of a color share a particle; a color is then solved in SIMD lanes and in
+ * parallel chunks. Colors run one after the other in a fixed order, so the
+ * result is the same for every thread count and SIMD backend.
+ */
+
+namespace physics {
+
+/**
+ * @brief Keeps two particles at their rest distance.
+ *
+ * Also used for bending: across every edge shared by two triangles, the two
+ * opposite vertices are kept at their rest distance with a softer compliance.
+ */
+struct DistanceConstraint {
+    std::uint32_t a = 0;
+    std::uint32_t b = 0;
+    float restLength = 0.0f;
+    float compliance = 0.0f;
+};
+
+/**
+ * @brief Keeps the signed volume of a tetrahedron.
+ */
+struct VolumeConstraint {
+    std::uint32_t particles[4] = {};
+    float restVolume = 0.0f;
+    float compliance = 0.0f;
+};
+
+/**
+ * @brief Global simulation settings.
+ */
+struct SoftBodySettings {
+    math::Vector3 gravity{0.0f, -9.81f, 0.0f};
+    int substeps = 8;
+    float damping = 0.0f;                                      /**< Per-second velocity damping. */
+    float groundHeight = std::numeric_limits<float>::lowest(); /**< Particles stay above this y. */
+};
+
+/**
+ * @brief Mass and compliance for a mesh added to SoftBodies.
+ */
+struct SoftBodyMaterial {
+    float particleMass = 0.01f;      /**< kg per vertex. */
+    float stretchCompliance = 0.0f;  /**< Edges; 0 is inextensible. */
+    float bendCompliance = 1.0e-3f;  /**< Cloth bending across shared edges. */
+    float volumeCompliance = 0.0f;   /**< Tetrahedra; 0 is incompressible. */
+};
+
+/**
+ * @class SoftBodies
+ * @brief SoA particles with distance, bending and volume constraints.
+ *
+ * Example usage:
+ * @code
+ * physics::SoftBodies cloth;
+ * const std::uint32_t first = cloth.addClothGrid({-1, 2, 0}, {2, 0, 0}, {0, 0, 2}, 64, 64, {});
+ * cloth.pin(first);           // hang it by two corners
+ * cloth.pin(first + 63);
+ * cloth.step(1.0f / 60.0f, &jobs);
+ * @endcode
+ */
+class SoftBodies {
+public:
+    // --- Particle streams ---
+
+    math::Vector3SoA position;
+    math::Vector3SoA velocity;
+    math::AlignedArray<float> inverseMass;  /**< 0 for pinned particles. */
+
+    explicit SoftBodies(const SoftBodySettings& settings = {}) noexcept : config(settings) {}
+
+    std::size_t size() const noexcept { return inverseMass.size(); }
+
+    void reserve(std::size_t particles);
+
+    /** @brief Adds a particle; mass 0 pins it. */
+    std::uint32_t addParticle(const math::Vector3& p, float mass);
+
+    /** @brief Fixes a particle in place. */
+    void pin(std::uint32_t i) noexcept;
+
+    // --- Constraints (rest state from the current positions) ---
+
+    void addDistance(std::uint32_t a, std::uint32_t b, float compliance);
+    void addBending(std::uint32_t a, std::uint32_t b, float compliance);
+    void addVolume(std::uint32_t a, std::uint32_t b, std::uint32_t c, std::uint32_t d, float compliance);
+
+    /**
+     * @brief Adds a triangle mesh as cloth: a distance constraint per edge and
+     * a bending constraint per edge shared by two triangles.
+     *
+     * @param triangles Three vertex indices per triangle.
+     * @return Index of the first new particle; vertex i becomes particle first + i.
+     */
+    std::uint32_t addCloth(std::span<const math::Vector3> vertices, std::span<const std::uint32_t> triangles,
+                           const SoftBodyMaterial& material);
+
+    /**
+     * @brief Adds a cols x rows vertex grid spanning origin + [0, 1] u + [0, 1] v as cloth.
+     *
+     * Vertex (i, j) becomes particle first + j * cols + i.
+     */
+    std::uint32_t addClothGrid(const math::Vector3& origin, const math::Vector3& u, const math::Vector3& v,
+                               std::uint32_t cols, std::uint32_t rows, const SoftBodyMaterial& material);
+
+    /**
+     * @brief Adds a tetrahedral mesh as a soft body: a distance constraint per
+     * edge and a volume constraint per tetrahedron.
+     *
+     * @param tetrahedra Four vertex indices per tetrahedron.
+     * @return Index of the first new particle.
+     */
+    std::uint32_t addTetMesh(std::span<const math::Vector3> vertices, std::span<const std::uint32_t> tetrahedra,
+                             const SoftBodyMaterial& material);
+
+    // --- Simulation ---
+
+    /**
+     * @brief Advances by dt in settings().substeps substeps.
+     *
+     * @param jobs Optional job system; same result without it.
+     */
+    void step(float dt, core::JobSystem* jobs = nullptr);
+
+    SoftBodySettings& settings() noexcept { return config; }
+
+    /** @brief Constraints in solve order (grouped by color once step() has run). */
+    std::span<const DistanceConstraint> distanceConstraints() const noexcept { return stretch.constraints; }
+    std::span<const DistanceConstraint> bendingConstraints() const noexcept { return bending.constraints; }
+    std::span<const VolumeConstraint> volumeConstraints() const noexcept { return volume.constraints; }
+
+    /** @brief Colors of all constraint kinds together, after the last step(). */
+    std::size_t colorCount() const noexcept;
+
+    /** @brief Colors tried before a constraint goes to the serial overflow color. */
+    static constexpr int MAX_COLORS = 64;
+
+    /** @brief Constraints per job within a color. */
+    static constexpr std::size_t CONSTRAINTS_PER_JOB = 2048;
+
+    /** @brief Particles per job in the predict and velocity passes. */
+    static constexpr std::size_t PARTICLES_PER_JOB = 8192;
+
+private:
+    template <typename Constraint>
+    struct Group {
+        std::vector<Constraint> constraints;
+        std::vector<std::uint32_t> colorStart;  // color c: [colorStart[c], colorStart[c + 1])
+        bool overflowColor = false;             // last color shares particles, solved serially
+        bool colored = false;
+    };
+
+    // Distance constraints in color order as streams for the SIMD kernel
+    struct DistanceLanes {
+        math::AlignedArray<std::uint32_t> a;
+        math::AlignedArray<std::uint32_t> b;
+        math::AlignedArray<float> restLength;
+        math::AlignedArray<float> compliance;
+    };
+
+    void substep(float h, core::JobSystem* jobs);
+
+    SoftBodySettings config;
+    math::Vector3SoA previous;  // positions at the start of the substep
+    Group<DistanceConstraint> stretch;
+    Group<DistanceConstraint> bending;
+    DistanceLanes stretchLanes;
+    DistanceLanes bendingLanes;
+    Group<VolumeConstraint> volume;
+    std::vector<std::uint64_t> particleColors;  // coloring scratch
+};
+
+} // namespace physics
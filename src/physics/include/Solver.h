@@ -0,0 +1,141 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+#include "Contacts.h"
+#include "Islands.h"
+#include "Joints.h"
+#include "RigidBodies.h"
+
+namespace core {
+class JobSystem;
+}
+
+/**
+ * @file Solver.h
+ * @brief Sequential-impulse velocity solver for contacts and joints.
+ *
+ * Each iteration applies, one constraint at a time, the impulse that makes
+ * the constraint's relative velocity right given everything solved so far
+ * (projected Gauss-Seidel). Accumulated impulses are clamped, not the
+ * per-iteration ones: contacts push but never pull, and friction stays
+ * inside a box of half-size friction * normal impulse per tangent.
+ *
+ * Contacts and joints are first split into islands (see Islands): no
+ * constraint of one island touches a dynamic body of another, so islands
+ * are solved independently, small ones grouped into jobs of about
+ * BATCHES_PER_JOB batches.
+ *
+ * Inside an island, contacts are the bulk of the work and are solved in
+ * SIMD lanes: manifolds are greedily colored so that no two manifolds of a
+ * color share a dynamic body, and each color is cut into batches of LANES
+ * manifolds solved together, one manifold per lane. Batches of a color are
+ * independent, so the colors of a large island (a pile) are also split
+ * across threads; colors run one after the other. Since the order of
+ * updates is fixed by the islands and the coloring, results are the same
+ * for every SIMD backend and thread count.
+ *
+ * Joints are few in typical scenes and are solved in order before the
+ * contacts of their island in each iteration.
+ */
+
+namespace physics {
+
+/**
+ * @brief Tuning of the solver.
+ */
+struct SolverSettings {
+    int velocityIterations = 8;
+    float friction = 0.6f;          /**< Coulomb coefficient for every contact. */
+    float baumgarte = 0.2f;         /**< Fraction of position error fed back per step. */
+    float linearSlop = 0.005f;      /**< Penetration allowed without correction (avoids jitter). */
+    float maxCorrectionSpeed = 3.0f; /**< Cap on the separation speed used to resolve penetration (m/s). */
+    bool warmStarting = true;       /**< Start from last step's impulses. */
+};
+
+/**
+ * @class ConstraintSolver
+ * @brief Solves contact manifolds and joints for one step.
+ *
+ * Run it between integrateVelocities() and integratePositions(): it turns
+ * the unconstrained velocities into velocities that satisfy the constraints.
+ * The accumulated impulses are written back into the manifolds and joints
+ * for warm starting the next step.
+ *
+ * Example usage:
+ * @code
+ * physics::ConstraintSolver solver;
+ * physics::integrateVelocities(bodies, dt, integratorSettings);
+ * solver.solve(bodies, contacts.manifolds(), joints, dt, &jobs);
+ * physics::integratePositions(bodies, dt);
+ * @endcode
+ */
+class ConstraintSolver {
+public:
+    explicit ConstraintSolver(const SolverSettings& settings = {}) noexcept;
+    ~ConstraintSolver();
+
+    /**
+     * @brief Updates the velocities of bodies so the constraints hold.
+     *
+     * @param jobs Optional job system to solve islands, and the batches of
+     *        each color of a large island, in parallel; the result is
+     *        bit-identical without it.
+     */
+    void solve(RigidBodies& bodies, std::span<ContactManifold> manifolds, Joints& joints, float dt,
+               core::JobSystem* jobs = nullptr);
+
+    SolverSettings& settings() noexcept { return config; }
+
+    /** @brief Most colors used by one island in the last solve, counting the serial overflow color. */
+    std::size_t colorCount() const noexcept { return maxColors; }
+
+    /** @brief Islands with at least one contact or joint in the last solve. */
+    std::size_t islandCount() const noexcept { return activeIslands; }
+
+    /** @brief SIMD batches built by the last solve. */
+    std::size_t batchCount() const noexcept;
+
+    /** @brief Manifolds per batch (SSE width). */
+    static constexpr std::size_t LANES = 4;
+
+    /** @brief Colors tried before a manifold goes to the serial overflow color. */
+    static constexpr int MAX_COLORS = 64;
+
+    /** @brief Batches per job when islands or a color are solved in parallel. */
+    static constexpr std::size_t BATCHES_PER_JOB = 64;
+
+    // Prepared per-step data, defined in Solver.cpp; public so its kernels can name them.
+    struct ContactBatch;
+    struct JointRow;
+
+private:
+    void buildIslands(const RigidBodies& bodies, std::span<ContactManifold> manifolds);
+    void buildBatches(const RigidBodies& bodies, std::span<ContactManifold> manifolds);
+    template <typename Kernel>
+    void forEachBatch(core::JobSystem* jobs, std::size_t firstColor, std::size_t lastColor, Kernel&& kernel);
+    void solveIsland(RigidBodies& bodies, std::size_t island, core::JobSystem* jobs);
+    void prepareJoints(const RigidBodies& bodies, const Joints& joints, float dt);
+
+    SolverSettings config;
+    Islands islands;
+    std::vector<BroadphasePair> links;       // touching manifolds, then joint rows
+    std::vector<std::uint32_t> linkManifold; // manifold of each contact link
+    std::vector<ContactBatch> batches;       // grouped by island, then by color
+    std::vector<std::uint32_t> colorStart;   // batches of color c: [colorStart[c], colorStart[c + 1])
+    std::vector<std::uint8_t> serialColor;   // per color: overflow color, one manifold per batch
+    std::vector<std::uint32_t> islandColors; // colors of island i: [islandColors[i], islandColors[i + 1])
+    std::vector<std::uint32_t> islandJoints; // joint rows of island i: [islandJoints[i], islandJoints[i + 1])
+    std::vector<std::uint32_t> jointOrder;   // joint rows grouped by island
+    std::vector<std::uint32_t> groupStart;   // islands of job g: [groupStart[g], groupStart[g + 1])
+    std::vector<std::uint64_t> bodyColors;   // coloring scratch: colors used per body, all zero between solves
+    std::vector<std::uint32_t> linkSlot;     // coloring scratch: color, then batch * LANES + lane, per link
+    std::vector<JointRow> jointRows;
+    std::size_t maxColors = 0;
+    std::size_t activeIslands = 0;
+};
+
+} // namespace physics
@@ -0,0 +1,88 @@
+#pragma once
+
+#include <cstdint>
+#include <span>
+#include <vector>
+
+#include "include/AlignedArray.h"
+#include "Aabb.h"
+#include "Broadphase.h"
+
+/**
+ * @file SweepAndPrune.h
+ * @brief Sort-and-sweep broadphase over an array of boxes.
+ */
+
+namespace physics {
+
+/**
+ * @class SweepAndPrune
+ * @brief Finds overlapping boxes by sorting them along one axis and sweeping.
+ *
+ * The sweep axis is the one along which box centers vary most, re-chosen
+ * every update with some hysteresis so it does not flip between nearly equal
+ * axes. The sort order of the previous update is kept: with frame-to-frame
+ * coherence it is almost sorted already, so an insertion sort restores it in
+ * close to linear time. A full sort only happens when the axis changes or
+ * many boxes were added.
+ *
+ * Boxes are copied into SoA min/max streams and gathered into sort order
+ * before the sweep, so the inner loop reads contiguous floats.
+ *
+ * Example usage:
+ * @code
+ * physics::SweepAndPrune sap;
+ * std::vector<physics::BroadphasePair> pairs;
+ * sap.update(boxes, pairs); // pair ids are indices into boxes
+ * @endcode
+ */
+class SweepAndPrune {
+public:
+    /**
+     * @brief Replaces out with every pair of overlapping boxes.
+     *
+     * Ids are indices into boxes. Boxes may be added or removed between
+     * calls; indices that persist keep benefiting from the cached order.
+     * Pairs are sorted and contain no duplicates.
+     */
+    void update(std::span<const Aabb> boxes, std::vector<BroadphasePair>& out);
+
+    /** @brief Same, into a vector on a memory resource (e.g. a frame arena). */
+    void update(std::span<const Aabb> boxes, std::pmr::vector<BroadphasePair>& out);
+
+    /** @brief Axis used by the last update (0 = x, 1 = y, 2 = z). */
+    int sweepAxis() const noexcept { return axis; }
+
+    /** @brief True if the last update had to fully re-sort. */
+    bool lastUpdateResorted() const noexcept { return resorted; }
+
+    /** @brief Box pairs the last update tested (those overlapping along the sweep axis). */
+    std::size_t lastSweepTests() const noexcept { return sweepTests; }
+
+    /**
+     * @brief Relative variance gain needed before switching to another axis.
+     */
+    static constexpr float AXIS_HYSTERESIS = 1.2f;
+
+private:
+    void prepare(std::span<const Aabb> boxes);
+    void chooseAxis();
+    void updateOrder(std::size_t count);
+    template <typename Pairs>
+    void sweep(Pairs& out);
+
+    math::AlignedArray<float> boxMin[3];
+    math::AlignedArray<float> boxMax[3];
+
+    std::vector<std::uint32_t> order; // box indices sorted by min along axis
+    // Boxes gathered in sort order; [0] is the sweep axis
+    math::AlignedArray<float> sortedMin[3];
+    math::AlignedArray<float> sortedMax[3];
+
+    int axis = 0;
+    int sortedAxis = 0; // axis the cached order is sorted along
+    bool resorted = false;
+    std::size_t sweepTests = 0;
+};
+
+} // namespace physics
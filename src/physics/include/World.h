@@ -0,0 +1,184 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include "Aabb.h"
+#include "Contacts.h"
+#include "DynamicAabbTree.h"
+#include "FixedTimestep.h"
+#include "Integrator.h"
+#include "Joints.h"
+#include "RigidBodies.h"
+#include "Solver.h"
+#include "FrameArena.h"
+#include "SweepAndPrune.h"
+#include "TaskGraph.h"
+
+namespace core {
+class JobSystem;
+}
+
+/**
+ * @file World.h
+ * @brief Top-level physics simulation: bodies plus the fixed-step pipeline.
+ */
+
+namespace physics {
+
+/**
+ * @brief Broadphase a World finds candidate pairs with; every choice reports the same pairs.
+ */
+enum class BroadphaseKind {
+    Automatic,       /**< Sweep and prune until its sweep degenerates, then the tree for good. */
+    SweepAndPrune,   /**< Fastest for up to a few thousand boxes spread along one axis. */
+    DynamicAabbTree, /**< Scales to large, dense or regular scenes; serial updates. */
+};
+
+/**
+ * @brief Construction parameters of a World.
+ */
+struct WorldSettings {
+    float fixedStep = 1.0f / 60.0f; /**< Seconds per simulation step. */
+    int maxStepsPerUpdate = 8;      /**< Cap on catch-up steps per update() call. */
+    BroadphaseKind broadphase = BroadphaseKind::Automatic;
+    IntegratorSettings integrator;
+    NarrowphaseSettings narrowphase;
+    SolverSettings solver;
+};
+
+/**
+ * @brief Wall-clock seconds each phase of one World::step() took.
+ *
+ * With a job system, collision detection and velocity integration run at
+ * the same time, so total() can exceed the step's wall time.
+ */
+struct StepProfile {
+    double bounds = 0.0;      /**< Bounds of every body with a shape. */
+    double broadphase = 0.0;  /**< Sweep and prune or tree, minus static-static pairs. */
+    double narrowphase = 0.0; /**< Contact manifolds of the pairs. */
+    double integrateVelocities = 0.0;
+    double solve = 0.0;
+    double integratePositions = 0.0;
+
+    double total() const noexcept {
+        return bounds + broadphase + narrowphase + integrateVelocities + solve + integratePositions;
+    }
+};
+
+/**
+ * @class World
+ * @brief Owns the bodies and advances all of them per call.
+ *
+ * Each step finds contacts between bodies that have a shape (a broadphase
+ * over their bounds, then the narrowphase), integrates velocities,
+ * solves contacts and joints, then integrates positions. With a job system
+ * the phases run as a core::TaskGraph: collision detection only reads
+ * poses and velocity integration only writes velocities, so the two run
+ * concurrently, and the solve waits for both.
+ *
+ * Example usage:
+ * @code
+ * physics::World world;
+ * world.bodies().add({.position = {0.0f, 10.0f, 0.0f}, .mass = 2.0f});
+ * while (running) world.update(frameSeconds);
+ * @endcode
+ */
+class World {
+public:
+    explicit World(const WorldSettings& settings = {}) noexcept;
+
+    RigidBodies& bodies() noexcept { return bodySet; }
+    const RigidBodies& bodies() const noexcept { return bodySet; }
+
+    IntegratorSettings& integratorSettings() noexcept { return integrator; }
+
+    SolverSettings& solverSettings() noexcept { return solver.settings(); }
+
+    Joints& joints() noexcept { return jointSet; }
+    const Joints& joints() const noexcept { return jointSet; }
+
+    /** @brief Contact manifolds found by the last step. */
+    ContactCache& contacts() noexcept { return contactCache; }
+    const ContactCache& contacts() const noexcept { return contactCache; }
+
+    /**
+     * @brief Runs the simulation on jobs from now on; nullptr runs it on the calling thread.
+     *
+     * The job system is not owned and must outlive its use by the world.
+     * Results are identical with or without one, for any thread count.
+     */
+    void setJobSystem(core::JobSystem* jobs) noexcept { jobSystem = jobs; }
+
+    /**
+     * @brief Runs as many fixed steps as frameSeconds accounts for.
+     *
+     * Forces and torques applied before the call act on every step it runs
+     * and are cleared once at least one step has run.
+     *
+     * @return The number of steps taken.
+     */
+    int update(float frameSeconds);
+
+    /**
+     * @brief Advances every body by exactly one fixed step; keeps forces.
+     */
+    void step();
+
+    /**
+     * @brief Interpolation factor between the last two steps, in [0, 1).
+     */
+    float interpolationAlpha() const noexcept { return clock.alpha(); }
+
+    float fixedStep() const noexcept { return clock.step(); }
+
+    /** @brief Phase timings of the last step(). */
+    const StepProfile& lastStepProfile() const noexcept { return profile; }
+
+    /** @brief Broadphase the next step uses; never Automatic. */
+    BroadphaseKind activeBroadphase() const noexcept { return broadphaseKind; }
+
+    /** @brief Scratch memory of the current step; reset at the start of every step(). */
+    const core::memory::FrameArena& frameArena() const noexcept { return arena; }
+
+    /** @brief Bodies per job when the step is split across threads (multiple of the SIMD width). */
+    static constexpr std::size_t BODIES_PER_JOB = 4096;
+
+    /**
+     * @brief Automatic switches to the tree once a sweep tests more boxes per box than this.
+     *
+     * Boxes that share a coordinate on the sweep axis (lattices, dense piles)
+     * are all tested against each other; a sparse scene tests a handful.
+     */
+    static constexpr std::size_t SWEEP_TESTS_PER_BOX = 192;
+
+private:
+    void collide();
+    void findPairs(std::span<const std::uint32_t> collidables, std::span<const Aabb> bounds,
+                   std::pmr::vector<BroadphasePair>& pairs);
+    void integrateVelocityPhase();
+    void solvePhase();
+    void integratePositionPhase();
+
+    RigidBodies bodySet;
+    IntegratorSettings integrator;
+    FixedTimestep clock;
+    core::JobSystem* jobSystem = nullptr;
+    core::TaskGraph stepGraph; // the phases of step() on jobSystem
+    core::memory::FrameArena arena; // per-step scratch
+    StepProfile profile;
+
+    // Collision detection
+    ContactCache contactCache;
+    BroadphaseKind broadphaseKind; // never Automatic
+    bool adaptiveBroadphase;       // Automatic: may still switch to the tree
+    SweepAndPrune sweepAndPrune;
+    DynamicAabbTree aabbTree;
+    std::vector<std::int32_t> treeProxies; // tree proxy of each collidable slot
+    std::size_t pairEstimate = 0; // broadphase pairs of the last step, reserved in the arena
+
+    Joints jointSet;
+    ConstraintSolver solver;
+};
+
+} // namespace physics
@@ -0,0 +1,61 @@
+#include "include/Culling.h"
+
+#include <algorithm>
+#include <array>
+#include <vector>
+
+#include "include/JobSystem.h"
+
+namespace render {
+
+namespace {
+
+// Per-chunk counts live on the stack up to this many chunks (16M objects)
+constexpr std::size_t STACK_CHUNKS = 1024;
+
+// Culls chunk c into visible[c * OBJECTS_PER_JOB, ...), then slides the chunks' results together
+template <typename Kernel>
+void cullChunked(std::size_t count, math::AlignedArray<std::uint32_t>& visible, core::JobSystem* jobs,
+                 Kernel&& kernel) {
+    visible.resizeForOverwrite(count);
+    const std::size_t chunks = (count + OBJECTS_PER_JOB - 1) / OBJECTS_PER_JOB;
+    if (jobs == nullptr || chunks <= 1) {
+        visible.resizeForOverwrite(kernel(0, count, visible.data()));
+        return;
+    }
+    std::array<std::size_t, STACK_CHUNKS> local;
+    std::vector<std::size_t> spill(chunks > STACK_CHUNKS ? chunks : 0);
+    std::size_t* found = chunks > STACK_CHUNKS ? spill.data() : local.data();
+    jobs->parallelFor(0, chunks, 1, [&](std::size_t begin, std::size_t end) {
+        for (std::size_t c = begin; c < end; ++c) {
+            const std::size_t first = c * OBJECTS_PER_JOB;
+            found[c] = kernel(first, std::min(first + OBJECTS_PER_JOB, count), visible.data() + first);
+        }
+    });
+    std::size_t n = found[0];
+    for (std::size_t c = 1; c < chunks; ++c) {
+        const std::uint32_t* from = visible.data() + c * OBJECTS_PER_JOB;
+        // Destination never passes the source: copying forward is safe
+        std::copy(from, from + found[c], visible.data() + n);
+        n += found[c];
+    }
+    visible.resizeForOverwrite(n);
+}
+
+} // namespace
+
+void cullSpheres(const math::Frustum& frustum, const math::BoundingSpheres& spheres,
+                 math::AlignedArray<std::uint32_t>& visible, core::JobSystem* jobs) {
+    cullChunked(spheres.size(), visible, jobs, [&](std::size_t first, std::size_t last, std::uint32_t* out) {
+        return math::cullSpheres(frustum, spheres, first, last, out);
+    });
+}
+
+void cullBoxes(const math::Frustum& frustum, const math::BoundingBoxes& boxes,
+               math::AlignedArray<std::uint32_t>& visible, core::JobSystem* jobs) {
+    cullChunked(boxes.size(), visible, jobs, [&](std::size_t first, std::size_t last, std::uint32_t* out) {
+        return math::cullBoxes(frustum, boxes, first, last, out);
+    });
+}
+
+} // namespace render
@@ -0,0 +1,123 @@
+#include "include/Image.h"
+
+#include <algorithm>
+#include <array>
+#include <fstream>
+#include <string_view>
+
+namespace render {
+
+namespace {
+
+// Pixels as packed RGB rows, each preceded by a PNG filter-type byte when hasFilter is set
+std::vector<std::uint8_t> rgbRows(const Image& image, bool hasFilter) {
+    std::vector<std::uint8_t> bytes;
+    bytes.reserve(std::size_t{image.height} * (std::size_t{image.width} * 3 + 1));
+    for (std::uint32_t y = 0; y < image.height; ++y) {
+        if (hasFilter) bytes.push_back(0); // filter type None
+        for (std::uint32_t x = 0; x < image.width; ++x) {
+            const std::uint32_t p = image.at(x, y);
+            bytes.insert(bytes.end(), {static_cast<std::uint8_t>(p), static_cast<std::uint8_t>(p >> 8),
+                                       static_cast<std::uint8_t>(p >> 16)});
+        }
+    }
+    return bytes;
+}
+
+constexpr std::array<std::uint32_t, 256> CRC_TABLE = [] {
+    std::array<std::uint32_t, 256> table{};
+    for (std::uint32_t n = 0; n < 256; ++n) {
+        std::uint32_t c = n;
+        for (int k = 0; k < 8; ++k) c = c & 1 ? 0xEDB88320u ^ (c >> 1) : c >> 1;
+        table[n] = c;
+    }
+    return table;
+}();
+
+std::uint32_t crc32(std::uint32_t crc, const std::uint8_t* data, std::size_t size) noexcept {
+    crc = ~crc;
+    for (std::size_t i = 0; i < size; ++i) crc = CRC_TABLE[(crc ^ data[i]) & 0xFF] ^ (crc >> 8);
+    return ~crc;
+}
+
+std::uint32_t adler32(const std::uint8_t* data, std::size_t size) noexcept {
+    constexpr std::uint32_t MOD = 65521;
+    // 5552 bytes is the longest run whose sums cannot overflow 32 bits before the modulo
+    std::uint32_t a = 1, b = 0;
+    while (size > 0) {
+        const std::size_t run = std::min<std::size_t>(size, 5552);
+        for (std::size_t i = 0; i < run; ++i) {
+            a += data[i];
+            b += a;
+        }
+        a %= MOD;
+        b %= MOD;
+        data += run;
+        size -= run;
+    }
+    return b << 16 | a;
+}
+
+void putBigEndian(std::vector<std::uint8_t>& out, std::uint32_t value) {
+    out.insert(out.end(), {static_cast<std::uint8_t>(value >> 24), static_cast<std::uint8_t>(value >> 16),
+                           static_cast<std::uint8_t>(value >> 8), static_cast<std::uint8_t>(value)});
+}
+
+void putChunk(std::vector<std::uint8_t>& out, std::string_view type, const std::vector<std::uint8_t>& data) {
+    putBigEndian(out, static_cast<std::uint32_t>(data.size()));
+    const std::size_t typeAt = out.size();
+    out.insert(out.end(), type.begin(), type.end());
+    out.insert(out.end(), data.begin(), data.end());
+    // The CRC covers the type and the data
+    putBigEndian(out, crc32(0, out.data() + typeAt, out.size() - typeAt));
+}
+
+bool writeFile(const std::string& path, const std::uint8_t* data, std::size_t size) {
+    std::ofstream file(path, std::ios::binary);
+    file.write(reinterpret_cast<const char*>(data), static_cast<std::streamsize>(size));
+    return static_cast<bool>(file);
+}
+
+} // namespace
+
+bool writePpm(const std::string& path, const Image& image) {
+    const std::string header = "P6\n" + std::to_string(image.width) + " " + std::to_string(image.height) + "\n255\n";
+    std::vector<std::uint8_t> bytes(header.begin(), header.end());
+    const std::vector<std::uint8_t> rows = rgbRows(image, false);
+    bytes.insert(bytes.end(), rows.begin(), rows.end());
+    return writeFile(path, bytes.data(), bytes.size());
+}
+
+bool writePng(const std::string& path, const Image& image) {
+    constexpr std::size_t MAX_STORED_BLOCK = 65535;
+    const std::vector<std::uint8_t> raw = rgbRows(image, true);
+
+    std::vector<std::uint8_t> out = {0x89, 'P', 'N', 'G', '\r', '\n', 0x1A, '\n'};
+    std::vector<std::uint8_t> header;
+    putBigEndian(header, image.width);
+    putBigEndian(header, image.height);
+    header.insert(header.end(), {8, 2, 0, 0, 0}); // 8-bit RGB, deflate, adaptive filters, no interlace
+    putChunk(out, "IHDR", header);
+
+    std::vector<std::uint8_t> zlib = {0x78, 0x01}; // deflate, 32 KiB window, no preset dictionary
+    zlib.reserve(raw.size() + raw.size() / MAX_STORED_BLOCK * 5 + 16);
+    std::size_t offset = 0;
+    do {
+        const std::size_t length = std::min(raw.size() - offset, MAX_STORED_BLOCK);
+        const bool last = offset + length == raw.size();
+        const auto len = static_cast<std::uint16_t>(length);
+        const auto nlen = static_cast<std::uint16_t>(~len);
+        zlib.insert(zlib.end(), {static_cast<std::uint8_t>(last), static_cast<std::uint8_t>(len),
+                                 static_cast<std::uint8_t>(len >> 8), static_cast<std::uint8_t>(nlen),
+                                 static_cast<std::uint8_t>(nlen >> 8)});
+        zlib.insert(zlib.end(), raw.begin() + static_cast<std::ptrdiff_t>(offset),
+                    raw.begin() + static_cast<std::ptrdiff_t>(offset + length));
+        offset += length;
+    } while (offset < raw.size());
+    putBigEndian(zlib, adler32(raw.data(), raw.size()));
+    putChunk(out, "IDAT", zlib);
+    putChunk(out, "IEND", {});
+    return writeFile(path, out.data(), out.size());
+}
+
+} // namespace render
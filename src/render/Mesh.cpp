@@ -0,0 +1,59 @@
+#include "include/Mesh.h"
+
+#include <cassert>
+#include <cmath>
+#include <numbers>
+
+namespace render {
+
+Mesh makePlane(float size) {
+    const float h = 0.5f * size;
+    Mesh mesh;
+    mesh.positions = {{-h, 0.0f, -h}, {h, 0.0f, -h}, {h, 0.0f, h}, {-h, 0.0f, h}};
+    // todo.md lists (0, 1, 2), (0, 2, 3), which winds towards -Y; flipped so the plane faces up
+    mesh.indices = {0, 2, 1, 0, 3, 2};
+    return mesh;
+}
+
+Mesh makeBox(const math::Vector3& halfExtents) {
+    const math::Vector3& e = halfExtents;
+    Mesh mesh;
+    for (int corner = 0; corner < 8; ++corner) {
+        mesh.positions.emplace_back(corner & 1 ? e.x : -e.x, corner & 2 ? e.y : -e.y, corner & 4 ? e.z : -e.z);
+    }
+    // Corner bit 0 is +x, bit 1 +y, bit 2 +z; each quad is counter-clockwise seen from outside
+    mesh.indices = {
+        1, 3, 7, 1, 7, 5, // +x
+        0, 4, 6, 0, 6, 2, // -x
+        2, 6, 7, 2, 7, 3, // +y
+        0, 1, 5, 0, 5, 4, // -y
+        4, 5, 7, 4, 7, 6, // +z
+        0, 2, 3, 0, 3, 1, // -z
+    };
+    return mesh;
+}
+
+Mesh makeSphere(float radius, std::uint32_t segments, std::uint32_t rings) {
+    assert(segments >= 3 && rings >= 2);
+    Mesh mesh;
+    for (std::uint32_t r = 0; r <= rings; ++r) {
+        const float polar = std::numbers::pi_v<float> * static_cast<float>(r) / static_cast<float>(rings);
+        for (std::uint32_t s = 0; s <= segments; ++s) {
+            const float azimuth = 2.0f * std::numbers::pi_v<float> * static_cast<float>(s) / static_cast<float>(segments);
+            mesh.positions.emplace_back(radius * std::sin(polar) * std::cos(azimuth), radius * std::cos(polar),
+                                        -radius * std::sin(polar) * std::sin(azimuth));
+        }
+    }
+    const std::uint32_t stride = segments + 1;
+    for (std::uint32_t r = 0; r < rings; ++r) {
+        for (std::uint32_t s = 0; s < segments; ++s) {
+            const std::uint32_t a = r * stride + s, b = a + stride;
+            // The rows at the poles collapse to a point: skip their degenerate halves
+            if (r != 0) mesh.indices.insert(mesh.indices.end(), {a, b, a + 1});
+            if (r != rings - 1) mesh.indices.insert(mesh.indices.end(), {a + 1, b, b + 1});
+        }
+    }
+    return mesh;
+}
+
+} // namespace render
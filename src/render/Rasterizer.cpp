@@ -0,0 +1,372 @@
+#include "include/Rasterizer.h"
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cassert>
+#include <cmath>
+#include <limits>
+
+#include "include/JobSystem.h"
+#include "include/SimdPack.h"
+
+namespace render {
+
+namespace {
+
+template <typename Range>
+void runRange(core::JobSystem* jobs, std::size_t count, std::size_t grain, Range&& range) {
+    if (jobs != nullptr && count > grain) {
+        jobs->parallelFor(0, count, grain, range);
+    } else {
+        range(0, count);
+    }
+}
+
+constexpr std::size_t VERTICES_PER_JOB = 4096;
+constexpr std::size_t TRIANGLES_PER_JOB = 1024;
+
+// x offsets of the pixel centres in a block row
+constexpr float PIXEL_CENTERS[Rasterizer::BLOCK_SIZE] = {0.5f, 1.5f, 2.5f, 3.5f, 4.5f, 5.5f, 6.5f, 7.5f};
+
+// Outcode bits of a clip-space vertex, one per frustum plane it lies outside of
+std::uint32_t outcode(const math::Vector4& v) noexcept {
+    return (v.x < -v.w ? 1u : 0u) | (v.x > v.w ? 2u : 0u) | (v.y < -v.w ? 4u : 0u) | (v.y > v.w ? 8u : 0u) |
+           (v.z < -v.w ? 16u : 0u) | (v.z > v.w ? 32u : 0u);
+}
+
+constexpr std::uint32_t NEAR_BIT = 16;
+
+math::Vector4 lerp(const math::Vector4& a, const math::Vector4& b, float t) noexcept {
+    return {a.x + (b.x - a.x) * t, a.y + (b.y - a.y) * t, a.z + (b.z - a.z) * t, a.w + (b.w - a.w) * t};
+}
+
+std::uint32_t shade(std::uint32_t color, float intensity) noexcept {
+    std::uint32_t out = color & 0xFF000000u;
+    for (int shift = 0; shift < 24; shift += 8) {
+        const float channel = static_cast<float>((color >> shift) & 0xFF) * intensity + 0.5f;
+        out |= static_cast<std::uint32_t>(std::min(channel, 255.0f)) << shift;
+    }
+    return out;
+}
+
+} // namespace
+
+Rasterizer::Rasterizer(std::uint32_t width, std::uint32_t height)
+    : targetWidth(width),
+      targetHeight(height),
+      tilesX((width + TILE_SIZE - 1) / TILE_SIZE),
+      tilesY((height + TILE_SIZE - 1) / TILE_SIZE),
+      blocksX(tilesX * (TILE_SIZE / BLOCK_SIZE)),
+      stride(std::size_t{tilesX} * TILE_SIZE) {
+    assert(width > 0 && height > 0);
+    const std::size_t rows = std::size_t{tilesY} * TILE_SIZE;
+    color.resize(stride * rows);
+    depth.resize(stride * rows);
+    blockMaxDepth.resize(std::size_t{blocksX} * tilesY * (TILE_SIZE / BLOCK_SIZE));
+    tileMaxDepth.resize(std::size_t{tilesX} * tilesY);
+    bins.resize(tileMaxDepth.size());
+    tileCounters.resize(tileMaxDepth.size());
+    clear();
+}
+
+void Rasterizer::clear(std::uint32_t clearColor, float clearDepth) {
+    std::fill(color.begin(), color.end(), clearColor);
+    const std::size_t rows = depth.size() / stride;
+    for (std::size_t y = 0; y < rows; ++y) {
+        float* row = depth.data() + y * stride;
+        const std::size_t inside = y < targetHeight ? targetWidth : 0;
+        std::fill(row, row + inside, clearDepth);
+        std::fill(row + inside, row + stride, -std::numeric_limits<float>::infinity());
+    }
+    // Bounds over the padding are loose but never read: no triangle covers it
+    std::fill(blockMaxDepth.begin(), blockMaxDepth.end(), clearDepth);
+    std::fill(tileMaxDepth.begin(), tileMaxDepth.end(), clearDepth);
+}
+
+void Rasterizer::setLight(const math::Vector3& direction, float ambientFraction) noexcept {
+    lightDirection = direction.normalized();
+    ambient = ambientFraction;
+}
+
+void Rasterizer::draw(const Mesh& mesh, const mat4& model, std::uint32_t drawColor) {
+    assert(mesh.indices.size() % 3 == 0);
+    draws.push_back({&mesh, viewProjection * model, model, drawColor});
+}
+
+Image Rasterizer::image() const {
+    Image out{targetWidth, targetHeight, {}};
+    out.pixels.resize(std::size_t{targetWidth} * targetHeight);
+    for (std::uint32_t y = 0; y < targetHeight; ++y) {
+        std::copy_n(color.begin() + static_cast<std::ptrdiff_t>(y * stride), targetWidth,
+                    out.pixels.begin() + static_cast<std::ptrdiff_t>(std::size_t{y} * targetWidth));
+    }
+    return out;
+}
+
+void Rasterizer::render(core::JobSystem* jobs) {
+    counters = {};
+    setupTriangles(jobs);
+    bin();
+    runRange(jobs, bins.size(), 1, [&](std::size_t first, std::size_t last) {
+        for (std::size_t tile = first; tile < last; ++tile) rasterizeTile(tile);
+    });
+    for (TileCounters& tile : tileCounters) {
+        counters.tilesCulled += tile.tilesCulled;
+        counters.blocksCulled += tile.blocksCulled;
+        tile = {};
+    }
+    draws.clear();
+}
+
+void Rasterizer::setupTriangles(core::JobSystem* jobs) {
+    vertexOffset.assign(1, 0);
+    triangleOffset.assign(1, 0);
+    for (const Draw& d : draws) {
+        vertexOffset.push_back(vertexOffset.back() + d.mesh->positions.size());
+        triangleOffset.push_back(triangleOffset.back() + d.mesh->triangleCount());
+    }
+    clipPositions.resize(vertexOffset.back());
+    worldPositions.resize(vertexOffset.back());
+    triangles.resize(2 * triangleOffset.back());
+    counters.triangles = triangleOffset.back();
+
+    runRange(jobs, vertexOffset.back(), VERTICES_PER_JOB, [&](std::size_t first, std::size_t last) {
+        std::size_t d = static_cast<std::size_t>(
+            std::upper_bound(vertexOffset.begin(), vertexOffset.end(), first) - vertexOffset.begin() - 1);
+        for (std::size_t i = first; i < last; ++i) {
+            while (i >= vertexOffset[d + 1]) ++d;
+            const math::Vector3& p = draws[d].mesh->positions[i - vertexOffset[d]];
+            const auto& c = draws[d].mvp.m;
+            const auto& w = draws[d].model.m;
+            clipPositions[i] = {c[0][0] * p.x + c[0][1] * p.y + c[0][2] * p.z + c[0][3],
+                                c[1][0] * p.x + c[1][1] * p.y + c[1][2] * p.z + c[1][3],
+                                c[2][0] * p.x + c[2][1] * p.y + c[2][2] * p.z + c[2][3],
+                                c[3][0] * p.x + c[3][1] * p.y + c[3][2] * p.z + c[3][3]};
+            worldPositions[i] = {w[0][0] * p.x + w[0][1] * p.y + w[0][2] * p.z + w[0][3],
+                                 w[1][0] * p.x + w[1][1] * p.y + w[1][2] * p.z + w[1][3],
+                                 w[2][0] * p.x + w[2][1] * p.y + w[2][2] * p.z + w[2][3]};
+        }
+    });
+
+    const float width = static_cast<float>(targetWidth);
+    const float height = static_cast<float>(targetHeight);
+    const auto maxX = static_cast<std::int32_t>(targetWidth) - 1;
+    const auto maxY = static_cast<std::int32_t>(targetHeight) - 1;
+
+    // Fills out from a clip-space triangle wound counter-clockwise in NDC when front facing
+    const auto setup = [&](const std::array<math::Vector4, 3>& clip, float intensityFront, float intensityBack,
+                           std::uint32_t baseColor, Triangle& out) {
+        out.valid = false;
+        float x[3], y[3], z[3];
+        for (int i = 0; i < 3; ++i) {
+            const float invW = 1.0f / clip[i].w;
+            // NDC y points up, rows go down
+            x[i] = (clip[i].x * invW * 0.5f + 0.5f) * width;
+            y[i] = (0.5f - clip[i].y * invW * 0.5f) * height;
+            z[i] = clip[i].z * invW * 0.5f + 0.5f;
+        }
+        // Edge i runs from vertex i + 1 to vertex i + 2; sharing an edge negates a, b and c exactly
+        for (int i = 0; i < 3; ++i) {
+            const int j = (i + 1) % 3, k = (i + 2) % 3;
+            out.a[i] = y[j] - y[k];
+            out.b[i] = x[k] - x[j];
+            out.c[i] = x[j] * y[k] - x[k] * y[j];
+        }
+        float area = out.a[0] * x[0] + out.b[0] * y[0] + out.c[0];
+        if (area == 0.0f || !std::isfinite(area)) return;
+        // Counter-clockwise in NDC is clockwise on screen, where the edge functions come out negative
+        const bool front = area < 0.0f;
+        if (!front && cullBackFaces) return;
+        if (front) {
+            for (int i = 0; i < 3; ++i) {
+                out.a[i] = -out.a[i];
+                out.b[i] = -out.b[i];
+                out.c[i] = -out.c[i];
+            }
+            area = -area;
+        }
+
+        const float minX = std::min({x[0], x[1], x[2]}), maxXf = std::max({x[0], x[1], x[2]});
+        const float minY = std::min({y[0], y[1], y[2]}), maxYf = std::max({y[0], y[1], y[2]});
+        // Pixel centres (x + 0.5) inside the bounds, clamped to the screen
+        out.x0 = static_cast<std::int32_t>(std::max(std::ceil(minX - 0.5f), 0.0f));
+        out.y0 = static_cast<std::int32_t>(std::max(std::ceil(minY - 0.5f), 0.0f));
+        out.x1 = static_cast<std::int32_t>(std::min(std::floor(maxXf - 0.5f), static_cast<float>(maxX)));
+        out.y1 = static_cast<std::int32_t>(std::min(std::floor(maxYf - 0.5f), static_cast<float>(maxY)));
+        if (out.x0 > out.x1 || out.y0 > out.y1) return;
+
+        for (int i = 0; i < 3; ++i) {
+            // Top-left rule: a pixel exactly on a left edge (a > 0) or a flat top edge (b > 0) is covered
+            const bool topLeft = out.a[i] > 0.0f || (out.a[i] == 0.0f && out.b[i] > 0.0f);
+            out.bias[i] = topLeft ? -std::numeric_limits<float>::denorm_min() : 0.0f;
+        }
+        out.margin = (width + height + 1.0f) * 4.0f * std::numeric_limits<float>::epsilon() *
+                     std::max({std::abs(out.a[0]) + std::abs(out.b[0]), std::abs(out.a[1]) + std::abs(out.b[1]),
+                               std::abs(out.a[2]) + std::abs(out.b[2])});
+
+        // Depth plane through the vertices, relative to vertex 0 to keep the large c terms out of it
+        out.zx = (out.a[1] * (z[1] - z[0]) + out.a[2] * (z[2] - z[0])) / area;
+        out.zy = (out.b[1] * (z[1] - z[0]) + out.b[2] * (z[2] - z[0])) / area;
+        out.zc = z[0] - out.zx * x[0] - out.zy * y[0];
+        // Interpolated depth may undershoot the vertices by a few ulps
+        out.minDepth = std::min({z[0], z[1], z[2]}) - 1e-6f;
+        out.color = shade(baseColor, front ? intensityFront : intensityBack);
+        out.valid = true;
+    };
+
+    runRange(jobs, triangleOffset.back(), TRIANGLES_PER_JOB, [&](std::size_t first, std::size_t last) {
+        std::size_t d = static_cast<std::size_t>(
+            std::upper_bound(triangleOffset.begin(), triangleOffset.end(), first) - triangleOffset.begin() - 1);
+        for (std::size_t t = first; t < last; ++t) {
+            while (t >= triangleOffset[d + 1]) ++d;
+            Triangle* out = &triangles[2 * t];
+            out[0].valid = out[1].valid = false;
+
+            const std::uint32_t* index = draws[d].mesh->indices.data() + 3 * (t - triangleOffset[d]);
+            const std::size_t base = vertexOffset[d];
+            const std::array<math::Vector4, 3> clip = {clipPositions[base + index[0]], clipPositions[base + index[1]],
+                                                       clipPositions[base + index[2]]};
+            const std::uint32_t c0 = outcode(clip[0]), c1 = outcode(clip[1]), c2 = outcode(clip[2]);
+            if ((c0 & c1 & c2) != 0) continue; // all outside one plane
+
+            const math::Vector3& w0 = worldPositions[base + index[0]];
+            const math::Vector3 normal =
+                (worldPositions[base + index[1]] - w0).cross(worldPositions[base + index[2]] - w0).normalized();
+            const float lit = std::max(-normal.dot(lightDirection), 0.0f);
+            const float unlit = std::max(normal.dot(lightDirection), 0.0f);
+            const float front = ambient + (1.0f - ambient) * lit;
+            const float back = ambient + (1.0f - ambient) * unlit;
+
+            if (((c0 | c1 | c2) & NEAR_BIT) == 0) {
+                setup(clip, front, back, draws[d].color, out[0]);
+                continue;
+            }
+            // Clip against the near plane (z = -w); one triangle comes out as one or two
+            std::array<math::Vector4, 4> polygon;
+            int count = 0;
+            for (int i = 0; i < 3; ++i) {
+                const math::Vector4& p = clip[i];
+                const math::Vector4& q = clip[(i + 1) % 3];
+                const float dp = p.z + p.w, dq = q.z + q.w;
+                if (dp >= 0.0f) polygon[count++] = p;
+                if ((dp >= 0.0f) != (dq >= 0.0f)) polygon[count++] = lerp(p, q, dp / (dp - dq));
+            }
+            for (int i = 0; i + 2 < count; ++i) {
+                setup({polygon[0], polygon[i + 1], polygon[i + 2]}, front, back, draws[d].color, out[i]);
+            }
+        }
+    });
+}
+
+void Rasterizer::bin() {
+    for (std::vector<std::uint32_t>& tile : bins) tile.clear();
+    for (std::size_t slot = 0; slot < triangles.size(); ++slot) {
+        const Triangle& t = triangles[slot];
+        if (!t.valid) continue;
+        ++counters.visible;
+        const std::uint32_t tx0 = static_cast<std::uint32_t>(t.x0) / TILE_SIZE;
+        const std::uint32_t tx1 = static_cast<std::uint32_t>(t.x1) / TILE_SIZE;
+        const std::uint32_t ty0 = static_cast<std::uint32_t>(t.y0) / TILE_SIZE;
+        const std::uint32_t ty1 = static_cast<std::uint32_t>(t.y1) / TILE_SIZE;
+        for (std::uint32_t ty = ty0; ty <= ty1; ++ty) {
+            for (std::uint32_t tx = tx0; tx <= tx1; ++tx) {
+                bins[std::size_t{ty} * tilesX + tx].push_back(static_cast<std::uint32_t>(slot));
+            }
+        }
+        counters.binned += std::size_t{tx1 - tx0 + 1} * (ty1 - ty0 + 1);
+    }
+}
+
+void Rasterizer::rasterizeTile(std::size_t tile) {
+    constexpr std::uint32_t BLOCKS_PER_SIDE = TILE_SIZE / BLOCK_SIZE;
+    const auto tileX = static_cast<std::uint32_t>(tile % tilesX);
+    const auto tileY = static_cast<std::uint32_t>(tile / tilesX);
+    const std::int32_t pixelX0 = static_cast<std::int32_t>(tileX * TILE_SIZE);
+    const std::int32_t pixelY0 = static_cast<std::int32_t>(tileY * TILE_SIZE);
+    TileCounters& tileCounter = tileCounters[tile];
+
+    for (const std::uint32_t slot : bins[tile]) {
+        const Triangle& t = triangles[slot];
+        if (t.minDepth >= tileMaxDepth[tile]) {
+            ++tileCounter.tilesCulled;
+            continue;
+        }
+        const auto bx0 = static_cast<std::uint32_t>(std::max(t.x0, pixelX0)) / BLOCK_SIZE;
+        const auto bx1 = static_cast<std::uint32_t>(std::min(t.x1, pixelX0 + std::int32_t{TILE_SIZE} - 1)) / BLOCK_SIZE;
+        const auto by0 = static_cast<std::uint32_t>(std::max(t.y0, pixelY0)) / BLOCK_SIZE;
+        const auto by1 = static_cast<std::uint32_t>(std::min(t.y1, pixelY0 + std::int32_t{TILE_SIZE} - 1)) / BLOCK_SIZE;
+        bool written = false;
+        for (std::uint32_t by = by0; by <= by1; ++by) {
+            for (std::uint32_t bx = bx0; bx <= bx1; ++bx) {
+                float& blockMax = blockMaxDepth[std::size_t{by} * blocksX + bx];
+                if (t.minDepth >= blockMax) {
+                    ++tileCounter.blocksCulled;
+                    continue;
+                }
+                if (!rasterizeBlock(t, bx * BLOCK_SIZE, by * BLOCK_SIZE)) continue;
+                written = true;
+                float farthest = -std::numeric_limits<float>::infinity();
+                for (std::uint32_t row = 0; row < BLOCK_SIZE; ++row) {
+                    const float* d = depth.data() + (std::size_t{by} * BLOCK_SIZE + row) * stride + bx * BLOCK_SIZE;
+                    for (std::uint32_t i = 0; i < BLOCK_SIZE; ++i) farthest = std::max(farthest, d[i]);
+                }
+                blockMax = farthest;
+            }
+        }
+        if (written) {
+            float farthest = -std::numeric_limits<float>::infinity();
+            for (std::uint32_t by = 0; by < BLOCKS_PER_SIDE; ++by) {
+                const float* row = blockMaxDepth.data() + std::size_t{tileY * BLOCKS_PER_SIDE + by} * blocksX +
+                                   tileX * BLOCKS_PER_SIDE;
+                for (std::uint32_t bx = 0; bx < BLOCKS_PER_SIDE; ++bx) farthest = std::max(farthest, row[bx]);
+            }
+            tileMaxDepth[tile] = farthest;
+        }
+    }
+}
+
+bool Rasterizer::rasterizeBlock(const Triangle& t, std::uint32_t blockX, std::uint32_t blockY) {
+    const float x0 = static_cast<float>(blockX);
+    const float y0 = static_cast<float>(blockY);
+    // Reject the block if some edge is negative at the block's most inside pixel centre
+    for (int i = 0; i < 3; ++i) {
+        const float x = x0 + (t.a[i] > 0.0f ? PIXEL_CENTERS[BLOCK_SIZE - 1] : PIXEL_CENTERS[0]);
+        const float y = y0 + (t.b[i] > 0.0f ? PIXEL_CENTERS[BLOCK_SIZE - 1] : PIXEL_CENTERS[0]);
+        if (t.a[i] * x + t.b[i] * y + t.c[i] < -t.margin) return false;
+    }
+
+    bool written = false;
+    math::simd::forEachPack(BLOCK_SIZE, [&]<typename P>(std::size_t begin, std::size_t end) {
+        for (std::uint32_t row = 0; row < BLOCK_SIZE; ++row) {
+            const std::size_t offset = (std::size_t{blockY} + row) * stride + blockX;
+            float* depthRow = depth.data() + offset;
+            std::uint32_t* colorRow = color.data() + offset;
+            const auto py = P::set1(y0 + PIXEL_CENTERS[row]);
+            for (std::size_t i = begin; i < end; i += P::WIDTH) {
+                const auto px = P::add(P::set1(x0), P::load(PIXEL_CENTERS + i));
+                auto inside = P::lessThan(
+                    P::set1(t.bias[0]),
+                    P::add(P::add(P::mul(P::set1(t.a[0]), px), P::mul(P::set1(t.b[0]), py)), P::set1(t.c[0])));
+                for (int e = 1; e < 3; ++e) {
+                    const auto edge =
+                        P::add(P::add(P::mul(P::set1(t.a[e]), px), P::mul(P::set1(t.b[e]), py)), P::set1(t.c[e]));
+                    inside = P::maskAnd(inside, P::lessThan(P::set1(t.bias[e]), edge));
+                }
+                const auto z = P::add(P::add(P::mul(P::set1(t.zx), px), P::mul(P::set1(t.zy), py)), P::set1(t.zc));
+                const auto stored = P::load(depthRow + i);
+                const auto pass = P::maskAnd(inside, P::lessThan(z, stored));
+                int bits = P::moveMask(pass);
+                if (bits == 0) continue;
+                P::store(depthRow + i, P::selectNonZero(pass, z, stored));
+                for (; bits != 0; bits &= bits - 1) {
+                    colorRow[i + static_cast<std::size_t>(std::countr_zero(static_cast<unsigned>(bits)))] = t.color;
+                }
+                written = true;
+            }
+        }
+    });
+    return written;
+}
+
+} // namespace render
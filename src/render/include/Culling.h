@@ -0,0 +1,48 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+#include "include/AlignedArray.h"
+#include "include/Frustum.h"
+
+namespace core {
+class JobSystem;
+}
+
+/**
+ * @file Culling.h
+ * @brief Frustum culling of whole bounds arrays, split into chunks across jobs.
+ */
+
+namespace render {
+
+/** @brief Objects per culling job (a multiple of the eight-wide kernel group). */
+constexpr std::size_t OBJECTS_PER_JOB = 16384;
+
+/**
+ * @brief Replaces visible with the ascending indices of the spheres that intersect frustum.
+ *
+ * With jobs set, chunks of OBJECTS_PER_JOB are culled in parallel into
+ * their own stretch of visible and then packed together, so the result is
+ * the same as a single-threaded pass. visible keeps its capacity between
+ * calls and is never cleared before the kernels write it: reuse one list
+ * per view and a call neither allocates nor touches memory twice.
+ *
+ * Example usage:
+ * @code
+ * const math::Frustum camera = math::extractFrustum(projection * view);
+ * render::cullSpheres(camera, bounds, visible, &jobs);
+ * for (const std::uint32_t i : visible) rasterizer.draw(*meshes[i], models[i], colors[i]);
+ * @endcode
+ */
+void cullSpheres(const math::Frustum& frustum, const math::BoundingSpheres& spheres,
+                 math::AlignedArray<std::uint32_t>& visible, core::JobSystem* jobs = nullptr);
+
+/**
+ * @brief cullSpheres() for axis-aligned boxes.
+ */
+void cullBoxes(const math::Frustum& frustum, const math::BoundingBoxes& boxes,
+               math::AlignedArray<std::uint32_t>& visible, core::JobSystem* jobs = nullptr);
+
+} // namespace render
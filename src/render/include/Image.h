@@ -0,0 +1,46 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+/**
+ * @file Image.h
+ * @brief RGBA8 images and the PPM/PNG writers used to dump rendered frames.
+ */
+
+namespace render {
+
+/**
+ * @brief Packs a color as RGBA8: red in the low byte, so the bytes in memory read R, G, B, A.
+ */
+constexpr std::uint32_t rgba(std::uint8_t r, std::uint8_t g, std::uint8_t b, std::uint8_t a = 255) noexcept {
+    return std::uint32_t{r} | std::uint32_t{g} << 8 | std::uint32_t{b} << 16 | std::uint32_t{a} << 24;
+}
+
+/**
+ * @brief Row-major RGBA8 pixels, top row first.
+ */
+struct Image {
+    std::uint32_t width = 0;
+    std::uint32_t height = 0;
+    std::vector<std::uint32_t> pixels; /**< width * height, see rgba(). */
+
+    std::uint32_t at(std::uint32_t x, std::uint32_t y) const noexcept { return pixels[std::size_t{y} * width + x]; }
+};
+
+/**
+ * @brief Writes a binary (P6) PPM, dropping alpha. Returns false if the file could not be written.
+ */
+bool writePpm(const std::string& path, const Image& image);
+
+/**
+ * @brief Writes an 8-bit RGB PNG, dropping alpha. Returns false if the file could not be written.
+ *
+ * The zlib stream uses stored (uncompressed) deflate blocks, so no
+ * compression library is needed and writing costs about as much as a copy;
+ * files come out the size of the PPM.
+ */
+bool writePng(const std::string& path, const Image& image);
+
+} // namespace render
@@ -0,0 +1,43 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include "include/Vector3.h"
+
+/**
+ * @file Mesh.h
+ * @brief CPU-side triangle meshes for the software rasterizer.
+ */
+
+namespace render {
+
+/**
+ * @brief Indexed triangle list in model space.
+ *
+ * Triangles are counter-clockwise when seen from the side they face; the
+ * rasterizer shades them flat from their face normal.
+ */
+struct Mesh {
+    std::vector<math::Vector3> positions;
+    std::vector<std::uint32_t> indices; /**< Three per triangle. */
+
+    std::size_t triangleCount() const noexcept { return indices.size() / 3; }
+};
+
+/**
+ * @brief The unit plane from todo.md: y = 0, corners at +-size / 2, facing +Y.
+ */
+Mesh makePlane(float size = 1.0f);
+
+/**
+ * @brief Axis-aligned box centred on the origin, faces pointing outwards.
+ */
+Mesh makeBox(const math::Vector3& halfExtents);
+
+/**
+ * @brief UV sphere centred on the origin with the given number of segments around and rings down.
+ */
+Mesh makeSphere(float radius, std::uint32_t segments = 16, std::uint32_t rings = 8);
+
+} // namespace render
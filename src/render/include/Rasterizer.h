@@ -0,0 +1,175 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "Image.h"
+#include "Mesh.h"
+#include "include/AlignedArray.h"
+#include "include/Mat4.h"
+#include "include/Vector3.h"
+#include "include/Vector4.h"
+
+namespace core {
+class JobSystem;
+}
+
+/**
+ * @file Rasterizer.h
+ * @brief Headless tile-based software rasterizer: binned triangles, SIMD edge functions, hierarchical depth.
+ */
+
+namespace render {
+
+/**
+ * @brief Work counters of the last Rasterizer::render().
+ */
+struct RasterizerStats {
+    std::size_t triangles = 0;   /**< Submitted by draw(). */
+    std::size_t visible = 0;     /**< Left after clipping and culling (near-plane splits count twice). */
+    std::size_t binned = 0;      /**< Triangle/tile pairs. */
+    std::size_t tilesCulled = 0; /**< Triangle/tile pairs rejected by the tile depth bound. */
+    std::size_t blocksCulled = 0; /**< Triangle/block pairs rejected by the block depth bound. */
+};
+
+/**
+ * @class Rasterizer
+ * @brief Renders flat-shaded meshes into an RGBA8 color buffer and a float depth buffer on the CPU.
+ *
+ * draw() only records a mesh, its model matrix and a color; render() runs
+ * the frame in three passes:
+ *
+ * - setup, in parallel over triangles: vertices go through
+ *   viewProjection * model (the MVP of todo.md), triangles are clipped
+ *   against the near plane, back faces culled, and edge functions, the
+ *   depth plane and a Lambert-shaded color computed;
+ * - binning, in submission order: each triangle is appended to the list of
+ *   every TILE_SIZE x TILE_SIZE screen tile its bounds touch;
+ * - rasterization, in parallel over tiles: a tile walks its list in order
+ *   and covers it BLOCK_SIZE x BLOCK_SIZE pixels at a time, evaluating the
+ *   three edge functions and the depth plane a SIMD pack of pixels at once.
+ *
+ * The depth buffer is hierarchical: every block and every tile keeps the
+ * farthest depth stored in it, and a triangle whose nearest vertex lies
+ * behind that bound skips the tile or block without touching a pixel.
+ *
+ * Depth is the OpenGL NDC depth mapped to [0, 1] with a LESS test, so the
+ * standard projections of MatrixTransform.h work unchanged. Coverage uses
+ * the top-left rule, so triangles that share an edge never both draw a
+ * pixel on it. Tiles never share pixels and keep their triangles in
+ * submission order, so frames are bit-identical for every thread count and
+ * SIMD backend.
+ *
+ * Example usage:
+ * @code
+ * render::Rasterizer rasterizer(1280, 720);
+ * rasterizer.setViewProjection(math::perspective(fov, 1280.0f / 720.0f, 0.1f, 100.0f) * view);
+ * rasterizer.clear(render::rgba(30, 30, 40));
+ * rasterizer.draw(plane, model, render::rgba(200, 200, 200));
+ * rasterizer.render(&jobs);
+ * render::writePng("frame.png", rasterizer.image());
+ * @endcode
+ */
+class Rasterizer {
+public:
+    /** @brief Pixels per side of a binning tile, the unit of parallel work. */
+    static constexpr std::uint32_t TILE_SIZE = 64;
+    /** @brief Pixels per side of a hierarchical-depth block. */
+    static constexpr std::uint32_t BLOCK_SIZE = 8;
+
+    Rasterizer(std::uint32_t width, std::uint32_t height);
+
+    std::uint32_t width() const noexcept { return targetWidth; }
+    std::uint32_t height() const noexcept { return targetHeight; }
+
+    /** @brief Fills the color buffer and resets depth (1 is the far plane). */
+    void clear(std::uint32_t color = rgba(0, 0, 0), float depth = 1.0f);
+
+    /** @brief Projection * view used by the draws of the next render(). */
+    void setViewProjection(const mat4& viewProjection) noexcept { this->viewProjection = viewProjection; }
+
+    /** @brief Directional light: the direction the light travels in world space, plus the unlit fraction. */
+    void setLight(const math::Vector3& direction, float ambient = 0.2f) noexcept;
+
+    /** @brief Back faces are dropped unless disabled (they are then lit from their back side). */
+    void setCullBackFaces(bool cull) noexcept { cullBackFaces = cull; }
+
+    /**
+     * @brief Queues mesh for the next render().
+     *
+     * Only a pointer to mesh is kept: it must stay alive and unchanged until
+     * render() returns.
+     */
+    void draw(const Mesh& mesh, const mat4& model, std::uint32_t color);
+
+    /** @brief Rasterizes the queued draws over the current buffers and empties the queue. */
+    void render(core::JobSystem* jobs = nullptr);
+
+    /** @brief Copy of the color buffer. */
+    Image image() const;
+
+    std::uint32_t pixel(std::uint32_t x, std::uint32_t y) const noexcept { return color[std::size_t{y} * stride + x]; }
+    float depthAt(std::uint32_t x, std::uint32_t y) const noexcept { return depth[std::size_t{y} * stride + x]; }
+
+    const RasterizerStats& stats() const noexcept { return counters; }
+
+private:
+    struct Draw {
+        const Mesh* mesh;
+        mat4 mvp;
+        mat4 model;
+        std::uint32_t color;
+    };
+
+    // Screen-space triangle ready for the tile pass; edge function i is a[i] * x + b[i] * y + c[i]
+    struct Triangle {
+        float a[3], b[3], c[3];
+        float bias[3];      // pixel covered if bias < edge: 0, or -denorm_min for top-left edges
+        float margin;       // rounding slack of the block corner test
+        float zx, zy, zc;   // depth plane
+        float minDepth;     // nearest vertex, for the depth bounds
+        std::int32_t x0, y0, x1, y1; // covered pixel range, inclusive
+        std::uint32_t color;
+        bool valid;
+    };
+
+    struct TileCounters {
+        std::size_t tilesCulled = 0;
+        std::size_t blocksCulled = 0;
+    };
+
+    void setupTriangles(core::JobSystem* jobs);
+    void bin();
+    void rasterizeTile(std::size_t tile);
+    bool rasterizeBlock(const Triangle& triangle, std::uint32_t blockX, std::uint32_t blockY);
+
+    std::uint32_t targetWidth, targetHeight;
+    std::uint32_t tilesX, tilesY;
+    std::uint32_t blocksX;
+    std::size_t stride; // padded to whole tiles
+
+    mat4 viewProjection;
+    math::Vector3 lightDirection{0.0f, -1.0f, 0.0f};
+    float ambient = 0.2f;
+    bool cullBackFaces = true;
+
+    std::vector<std::uint32_t> color;
+    math::AlignedArray<float> depth; // -infinity in the padding, so nothing is ever drawn there
+    std::vector<float> blockMaxDepth;
+    std::vector<float> tileMaxDepth;
+
+    std::vector<Draw> draws;
+    RasterizerStats counters;
+
+    // render() scratch
+    std::vector<std::size_t> vertexOffset;   // first vertex of draw d, with the total at the end
+    std::vector<std::size_t> triangleOffset; // first triangle of draw d, with the total at the end
+    std::vector<math::Vector4> clipPositions;
+    std::vector<math::Vector3> worldPositions;
+    std::vector<Triangle> triangles;               // two slots per input triangle (near-plane splits)
+    std::vector<std::vector<std::uint32_t>> bins;   // triangle slots per tile, in submission order
+    std::vector<TileCounters> tileCounters;
+};
+
+} // namespace render
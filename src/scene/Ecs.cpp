@@ -0,0 +1,236 @@
+#include "include/Ecs.h"
+
+#include <bit>
+#include <mutex>
+
+namespace scene {
+
+namespace {
+
+constexpr std::size_t COLUMN_ALIGNMENT = 64;
+
+constexpr std::size_t roundUp(std::size_t value, std::size_t alignment) noexcept {
+    return (value + alignment - 1) & ~(alignment - 1);
+}
+
+// Component ids are shared by every registry, so the table is global
+struct ComponentTable {
+    std::mutex mutex;
+    std::array<detail::ComponentInfo, MAX_COMPONENTS> infos{};
+    std::size_t count = 0;
+};
+
+ComponentTable& componentTable() {
+    static ComponentTable table;
+    return table;
+}
+
+} // namespace
+
+namespace detail {
+
+ComponentId registerComponent(std::size_t size, std::size_t alignment) {
+    ComponentTable& table = componentTable();
+    std::lock_guard lock(table.mutex);
+    assert(table.count < MAX_COMPONENTS && "raise MAX_COMPONENTS");
+    assert(alignment <= COLUMN_ALIGNMENT);
+    table.infos[table.count] = {size, alignment};
+    return static_cast<ComponentId>(table.count++);
+}
+
+const ComponentInfo& componentInfo(ComponentId id) noexcept {
+    // Entries are written once, before the id that reads them is handed out
+    return componentTable().infos[id];
+}
+
+} // namespace detail
+
+Registry::Registry() : chunkPool(CHUNK_BYTES, COLUMN_ALIGNMENT, 16) {
+    archetypeFor(0);
+}
+
+Registry::~Registry() = default;
+
+std::uint32_t Registry::archetypeFor(ComponentMask mask) {
+    if (const auto found = archetypeIndex.find(mask); found != archetypeIndex.end()) return found->second;
+
+    auto archetype = std::make_unique<Archetype>();
+    archetype->mask = mask;
+    archetype->addEdge.fill(NO_EDGE);
+    archetype->removeEdge.fill(NO_EDGE);
+    std::size_t rowBytes = sizeof(Entity);
+    for (ComponentMask bits = mask; bits != 0; bits &= bits - 1) {
+        const auto id = static_cast<ComponentId>(std::countr_zero(bits));
+        archetype->components.push_back(id);
+        rowBytes += detail::componentInfo(id).size;
+    }
+    // Every column may lose up to a cache line to alignment
+    const std::size_t padding = COLUMN_ALIGNMENT * (archetype->components.size() + 1);
+    assert(CHUNK_BYTES > padding + rowBytes && "components too large for one chunk");
+    archetype->capacity = (CHUNK_BYTES - padding) / rowBytes;
+    std::size_t offset = roundUp(archetype->capacity * sizeof(Entity), COLUMN_ALIGNMENT);
+    for (const ComponentId id : archetype->components) {
+        archetype->columnOffset[id] = static_cast<std::uint32_t>(offset);
+        offset = roundUp(offset + archetype->capacity * detail::componentInfo(id).size, COLUMN_ALIGNMENT);
+    }
+    assert(offset <= CHUNK_BYTES);
+
+    const auto index = static_cast<std::uint32_t>(archetypes.size());
+    archetypes.push_back(std::move(archetype));
+    archetypeIndex.emplace(mask, index);
+    return index;
+}
+
+std::uint32_t Registry::pushRow(std::uint32_t index, Entity entity) {
+    Archetype& archetype = *archetypes[index];
+    if (archetype.count == archetype.chunks.size() * archetype.capacity) {
+        archetype.chunks.push_back(static_cast<std::byte*>(chunkPool.allocate()));
+    }
+    const auto row = static_cast<std::uint32_t>(archetype.count++);
+    archetype.entities(row / archetype.capacity)[row % archetype.capacity] = entity;
+    return row;
+}
+
+void Registry::eraseRow(std::uint32_t index, std::uint32_t row) {
+    Archetype& archetype = *archetypes[index];
+    const auto last = static_cast<std::uint32_t>(archetype.count - 1);
+    if (row != last) {
+        // Fill the hole with the last row
+        const Entity moved = archetype.entities(last / archetype.capacity)[last % archetype.capacity];
+        archetype.entities(row / archetype.capacity)[row % archetype.capacity] = moved;
+        for (const ComponentId id : archetype.components) {
+            std::memcpy(archetype.component(row, id), archetype.component(last, id), detail::componentInfo(id).size);
+        }
+        records[moved.index].row = row;
+    }
+    --archetype.count;
+    if (archetype.count == (archetype.chunks.size() - 1) * archetype.capacity) {
+        chunkPool.deallocate(archetype.chunks.back());
+        archetype.chunks.pop_back();
+    }
+}
+
+Entity Registry::createEntity(ComponentMask mask) {
+    std::uint32_t index;
+    if (freeIndices.empty()) {
+        index = static_cast<std::uint32_t>(records.size());
+        records.push_back({FREE, 0, 0});
+    } else {
+        index = freeIndices.back();
+        freeIndices.pop_back();
+    }
+    Record& record = records[index];
+    const Entity entity{index, record.generation};
+    record.archetype = archetypeFor(mask);
+    record.row = pushRow(record.archetype, entity);
+    ++liveCount;
+    return entity;
+}
+
+void Registry::destroy(Entity entity) {
+    assert(alive(entity));
+    Record& record = records[entity.index];
+    eraseRow(record.archetype, record.row);
+    record.archetype = FREE;
+    ++record.generation;
+    freeIndices.push_back(entity.index);
+    --liveCount;
+}
+
+void Registry::moveEntity(Entity entity, std::uint32_t target) {
+    Record& record = records[entity.index];
+    const std::uint32_t source = record.archetype;
+    const std::uint32_t row = pushRow(target, entity);
+    const Archetype& from = *archetypes[source];
+    const Archetype& to = *archetypes[target];
+    for (const ComponentId id : from.components) {
+        if ((to.mask >> id) & 1) {
+            std::memcpy(to.component(row, id), from.component(record.row, id), detail::componentInfo(id).size);
+        }
+    }
+    eraseRow(source, record.row);
+    record.archetype = target;
+    record.row = row;
+}
+
+void* Registry::addComponent(Entity entity, ComponentId id) {
+    assert(alive(entity));
+    const std::uint32_t source = records[entity.index].archetype;
+    if (!((archetypes[source]->mask >> id) & 1)) {
+        std::uint32_t target = archetypes[source]->addEdge[id];
+        if (target == NO_EDGE) {
+            // archetypeFor may grow the archetype list; look the source up again afterwards
+            target = archetypeFor(archetypes[source]->mask | (ComponentMask{1} << id));
+            archetypes[source]->addEdge[id] = target;
+            archetypes[target]->removeEdge[id] = source;
+        }
+        moveEntity(entity, target);
+    }
+    return componentPointer(entity, id);
+}
+
+void Registry::removeComponent(Entity entity, ComponentId id) {
+    assert(alive(entity));
+    const std::uint32_t source = records[entity.index].archetype;
+    if (!((archetypes[source]->mask >> id) & 1)) return;
+    std::uint32_t target = archetypes[source]->removeEdge[id];
+    if (target == NO_EDGE) {
+        target = archetypeFor(archetypes[source]->mask & ~(ComponentMask{1} << id));
+        archetypes[source]->removeEdge[id] = target;
+        archetypes[target]->addEdge[id] = source;
+    }
+    moveEntity(entity, target);
+}
+
+QueryState& Registry::queryState(ComponentMask include, ComponentMask exclude) {
+    std::unique_ptr<QueryState>& state = queries[{include, exclude}];
+    if (state == nullptr) {
+        state = std::make_unique<QueryState>();
+        state->include = include;
+        state->exclude = exclude;
+    }
+    refresh(*state);
+    return *state;
+}
+
+void Registry::refresh(QueryState& state) {
+    for (; state.archetypesSeen < archetypes.size(); ++state.archetypesSeen) {
+        const ComponentMask mask = archetypes[state.archetypesSeen]->mask;
+        if ((mask & state.include) == state.include && (mask & state.exclude) == 0) {
+            state.archetypes.push_back(static_cast<std::uint32_t>(state.archetypesSeen));
+        }
+    }
+}
+
+void Registry::apply(CommandBuffer& buffer) {
+    for (const CommandBuffer::Command& command : buffer.commands) {
+        switch (command.op) {
+        case CommandBuffer::Op::Create: {
+            const Entity entity = createEntity(command.mask);
+            std::size_t offset = command.payload;
+            for (const ComponentId id : archetypes[records[entity.index].archetype]->components) {
+                const std::size_t size = detail::componentInfo(id).size;
+                std::memcpy(componentPointer(entity, id), buffer.payload.data() + offset, size);
+                offset += size;
+            }
+            break;
+        }
+        case CommandBuffer::Op::Destroy:
+            if (alive(command.entity)) destroy(command.entity);
+            break;
+        case CommandBuffer::Op::Add:
+            if (alive(command.entity)) {
+                const auto id = static_cast<ComponentId>(std::countr_zero(command.mask));
+                std::memcpy(addComponent(command.entity, id), buffer.payload.data() + command.payload,
+                            detail::componentInfo(id).size);
+            }
+            break;
+        case CommandBuffer::Op::Remove:
+            if (alive(command.entity)) removeComponent(command.entity, static_cast<ComponentId>(std::countr_zero(command.mask)));
+            break;
+        }
+    }
+    buffer.clear();
+}
+
+} // namespace scene
@@ -0,0 +1,247 @@
+#include "include/SceneFile.h"
+
+#include <charconv>
+#include <fstream>
+#include <random>
+#include <sstream>
+
+namespace scene {
+
+namespace {
+
+// Whitespace-separated words of one statement, consumed front to back.
+class Statement {
+public:
+    explicit Statement(std::string_view line) {
+        std::size_t i = 0;
+        while (i < line.size()) {
+            while (i < line.size() && (line[i] == ' ' || line[i] == '\t' || line[i] == '\r')) ++i;
+            const std::size_t start = i;
+            while (i < line.size() && line[i] != ' ' && line[i] != '\t' && line[i] != '\r') ++i;
+            if (i > start) words.push_back(line.substr(start, i - start));
+        }
+    }
+
+    bool empty() const noexcept { return words.empty(); }
+    bool done() const noexcept { return next == words.size(); }
+
+    std::string_view peek() const noexcept { return done() ? std::string_view{} : words[next]; }
+
+    bool keyword(std::string_view expected) {
+        if (peek() != expected) return false;
+        ++next;
+        return true;
+    }
+
+    template <typename T>
+    bool number(T& value) {
+        if (done()) return false;
+        const std::string_view word = words[next];
+        const auto [end, error] = std::from_chars(word.data(), word.data() + word.size(), value);
+        if (error != std::errc{} || end != word.data() + word.size()) return false;
+        ++next;
+        return true;
+    }
+
+    bool vector(math::Vector3& v) { return number(v.x) && number(v.y) && number(v.z); }
+
+private:
+    std::vector<std::string_view> words;
+    std::size_t next = 0;
+};
+
+bool parseShape(Statement& s, physics::Shape& shape) {
+    if (s.keyword("sphere")) {
+        float r = 0.0f;
+        if (!s.number(r) || r <= 0.0f) return false;
+        shape = physics::Shape::sphere(r);
+        return true;
+    }
+    if (s.keyword("box")) {
+        math::Vector3 half;
+        if (!s.vector(half) || half.x <= 0.0f || half.y <= 0.0f || half.z <= 0.0f) return false;
+        shape = physics::Shape::box(half);
+        return true;
+    }
+    if (s.keyword("capsule")) {
+        float halfHeight = 0.0f, r = 0.0f;
+        if (!s.number(halfHeight) || !s.number(r) || halfHeight < 0.0f || r <= 0.0f) return false;
+        shape = physics::Shape::capsule(halfHeight, r);
+        return true;
+    }
+    return false;
+}
+
+// Returns the complaint about the statement, empty if it parsed.
+std::string parseStatement(Statement& s, SceneDescription& d) {
+    if (s.keyword("seed")) return s.number(d.seed) ? "" : "expected an unsigned seed";
+    if (s.keyword("dt")) return s.number(d.fixedStep) && d.fixedStep > 0.0f ? "" : "expected a positive step";
+    if (s.keyword("gravity")) return s.vector(d.gravity) ? "" : "expected three numbers";
+    if (s.keyword("iterations")) {
+        return s.number(d.velocityIterations) && d.velocityIterations > 0 ? "" : "expected a positive count";
+    }
+
+    BodyGroup g;
+    if (s.keyword("static")) {
+        g.mass = 0.0f;
+        if (!parseShape(s, g.shape)) return "expected a shape";
+        if (!s.keyword("at") || !s.vector(g.origin)) return "expected 'at x y z'";
+        d.groups.push_back(g);
+        return "";
+    }
+
+    if (s.keyword("body")) {
+        g.layout = BodyGroup::Layout::Single;
+    } else if (s.keyword("grid")) {
+        g.layout = BodyGroup::Layout::Grid;
+    } else if (s.keyword("random")) {
+        g.layout = BodyGroup::Layout::Random;
+    } else {
+        return "unknown statement '" + std::string(s.peek()) + "'";
+    }
+    if (!parseShape(s, g.shape)) return "expected a shape";
+    if (!s.keyword("mass") || !s.number(g.mass) || g.mass < 0.0f) return "expected 'mass m'";
+
+    if (g.layout == BodyGroup::Layout::Grid) {
+        if (!s.keyword("count") || !s.number(g.count[0]) || !s.number(g.count[1]) || !s.number(g.count[2])) {
+            return "expected 'count nx ny nz'";
+        }
+        if (!s.keyword("spacing") || !s.number(g.spacing)) return "expected 'spacing s'";
+    } else if (g.layout == BodyGroup::Layout::Random) {
+        if (!s.keyword("count") || !s.number(g.count[0])) return "expected 'count n'";
+        if (!s.keyword("within") || !s.vector(g.origin) || !s.vector(g.extent)) return "expected 'within min max'";
+    }
+    if (g.layout != BodyGroup::Layout::Random && (!s.keyword("at") || !s.vector(g.origin))) return "expected 'at x y z'";
+    if (g.layout == BodyGroup::Layout::Grid && s.keyword("jitter") && !s.number(g.jitter)) return "expected 'jitter j'";
+    if (s.keyword("velocity") && !s.vector(g.velocity)) return "expected 'velocity x y z'";
+    d.groups.push_back(g);
+    return "";
+}
+
+math::Vector3 inertiaOf(const physics::Shape& shape, float mass) {
+    switch (shape.type) {
+    case physics::ShapeType::Sphere:
+        return physics::sphereInertia(mass, shape.radius);
+    case physics::ShapeType::Box:
+        return physics::boxInertia(mass, shape.halfExtents);
+    case physics::ShapeType::Capsule: // the bounding box is close enough for stacking
+        return physics::boxInertia(mass, {shape.radius, shape.halfHeight + shape.radius, shape.radius});
+    default:
+        return {1.0f, 1.0f, 1.0f};
+    }
+}
+
+// mt19937 output is fixed by the standard, the distributions are not; this
+// keeps placement identical across standard libraries.
+float uniform(std::mt19937& rng, float low, float high) {
+    const float unit = static_cast<float>(rng() >> 8) * (1.0f / 16777216.0f);
+    return low + (high - low) * unit;
+}
+
+} // namespace
+
+std::size_t SceneDescription::bodyCount() const noexcept {
+    std::size_t count = 0;
+    for (const BodyGroup& g : groups) {
+        switch (g.layout) {
+        case BodyGroup::Layout::Single: count += 1; break;
+        case BodyGroup::Layout::Grid: count += std::size_t{g.count[0]} * g.count[1] * g.count[2]; break;
+        case BodyGroup::Layout::Random: count += g.count[0]; break;
+        }
+    }
+    return count;
+}
+
+physics::WorldSettings SceneDescription::worldSettings() const noexcept {
+    physics::WorldSettings settings;
+    settings.fixedStep = fixedStep;
+    settings.integrator.gravity = gravity;
+    settings.solver.velocityIterations = velocityIterations;
+    return settings;
+}
+
+bool parseScene(std::string_view text, SceneDescription& description, std::string& error) {
+    description = {};
+    std::size_t lineNumber = 0;
+    while (!text.empty()) {
+        ++lineNumber;
+        const std::size_t end = text.find('\n');
+        std::string_view line = text.substr(0, end);
+        text = end == std::string_view::npos ? std::string_view{} : text.substr(end + 1);
+        line = line.substr(0, line.find('#'));
+
+        Statement statement(line);
+        if (statement.empty()) continue;
+        std::string complaint = parseStatement(statement, description);
+        if (complaint.empty() && !statement.done()) complaint = "unexpected '" + std::string(statement.peek()) + "'";
+        if (!complaint.empty()) {
+            error = "line " + std::to_string(lineNumber) + ": " + complaint;
+            return false;
+        }
+    }
+    return true;
+}
+
+bool loadScene(const std::string& path, SceneDescription& description, std::string& error) {
+    std::ifstream file(path, std::ios::binary);
+    if (!file) {
+        error = "cannot open " + path;
+        return false;
+    }
+    std::ostringstream text;
+    text << file.rdbuf();
+    if (!parseScene(text.str(), description, error)) {
+        error = path + ":" + error;
+        return false;
+    }
+    return true;
+}
+
+void populate(const SceneDescription& description, physics::World& world) {
+    physics::RigidBodies& bodies = world.bodies();
+    bodies.reserve(bodies.size() + description.bodyCount());
+    std::mt19937 rng(description.seed);
+
+    for (const BodyGroup& g : description.groups) {
+        physics::BodyDesc body;
+        body.shape = g.shape;
+        body.mass = g.mass;
+        body.inertia = inertiaOf(g.shape, g.mass);
+        body.linearVelocity = g.velocity;
+
+        switch (g.layout) {
+        case BodyGroup::Layout::Single:
+            body.position = g.origin;
+            bodies.add(body);
+            break;
+        case BodyGroup::Layout::Grid:
+            for (std::uint32_t y = 0; y < g.count[1]; ++y) {
+                for (std::uint32_t z = 0; z < g.count[2]; ++z) {
+                    for (std::uint32_t x = 0; x < g.count[0]; ++x) {
+                        body.position = g.origin + math::Vector3(static_cast<float>(x), static_cast<float>(y),
+                                                                 static_cast<float>(z)) * g.spacing;
+                        if (g.jitter > 0.0f) {
+                            const float jx = uniform(rng, -g.jitter, g.jitter);
+                            const float jy = uniform(rng, -g.jitter, g.jitter);
+                            const float jz = uniform(rng, -g.jitter, g.jitter);
+                            body.position += {jx, jy, jz};
+                        }
+                        bodies.add(body);
+                    }
+                }
+            }
+            break;
+        case BodyGroup::Layout::Random:
+            for (std::uint32_t i = 0; i < g.count[0]; ++i) {
+                const float x = uniform(rng, g.origin.x, g.extent.x);
+                const float y = uniform(rng, g.origin.y, g.extent.y);
+                const float z = uniform(rng, g.origin.z, g.extent.z);
+                body.position = {x, y, z};
+                bodies.add(body);
+            }
+            break;
+        }
+    }
+}
+
+} // namespace scene
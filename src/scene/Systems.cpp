@@ -0,0 +1,15 @@
+#include "include/Systems.h"
+
+#include "include/Components.h"
+
+namespace scene {
+
+void syncTransforms(Registry& registry, const physics::RigidBodies& bodies, core::JobSystem* jobs) {
+    registry.query<Transform, const RigidBody>().parallelForEach(jobs, [&](Transform& transform, const RigidBody& link) {
+        assert(link.body < bodies.size());
+        transform.position = bodies.position.get(link.body);
+        transform.rotation = bodies.orientation(link.body);
+    });
+}
+
+} // namespace scene
@@ -0,0 +1,362 @@
+#include "include/TransformHierarchy.h"
+
+#include <algorithm>
+#include <cassert>
+
+#include "include/JobSystem.h"
+#include "include/SimdPack.h"
+
+namespace scene {
+
+namespace {
+
+template <typename Range>
+void runRange(core::JobSystem* jobs, std::size_t count, std::size_t grain, Range&& range) {
+    if (jobs != nullptr && count > grain) {
+        jobs->parallelFor(0, count, grain, range);
+    } else {
+        range(0, count);
+    }
+}
+
+constexpr std::int32_t UNKNOWN_DEPTH = -1;
+constexpr std::int32_t REMOVED = -2;
+
+} // namespace
+
+std::uint32_t TransformHierarchy::newSlot(std::uint32_t node) {
+    const auto slot = static_cast<std::uint32_t>(nodeOf.size());
+    nodeOf.push_back(node);
+    parentSlot.pushBack(slot);
+    position.pushBack({});
+    qx.pushBack(0.0f);
+    qy.pushBack(0.0f);
+    qz.pushBack(0.0f);
+    qw.pushBack(1.0f);
+    scale.pushBack({1.0f, 1.0f, 1.0f});
+    for (math::AlignedArray<float>& row : worldRows) row.pushBack(0.0f);
+    childBegin.push_back(0);
+    childEnd.push_back(0);
+    dirty.push_back(1); // covered by the full update after rebuild()
+    return slot;
+}
+
+std::uint32_t TransformHierarchy::add(const Transform& local, std::uint32_t parent) {
+    assert(parent == NONE || contains(parent));
+    std::uint32_t node;
+    if (freeNodes.empty()) {
+        node = static_cast<std::uint32_t>(parentOf.size());
+        parentOf.push_back(parent);
+        slotOf.push_back(NONE);
+    } else {
+        node = freeNodes.back();
+        freeNodes.pop_back();
+        parentOf[node] = parent;
+    }
+    slotOf[node] = newSlot(node);
+    setLocal(node, local);
+    ++liveCount;
+    structureChanged = true;
+    return node;
+}
+
+void TransformHierarchy::remove(std::uint32_t node) {
+    assert(contains(node));
+    // The slot stays until rebuild(), which drops it together with the subtree below it
+    slotOf[node] = NONE;
+    --liveCount;
+    structureChanged = true;
+}
+
+void TransformHierarchy::setParent(std::uint32_t node, std::uint32_t parent) {
+    assert(contains(node) && (parent == NONE || contains(parent)));
+    for (std::uint32_t ancestor = parent; ancestor != NONE; ancestor = parentOf[ancestor]) {
+        assert(ancestor != node && "a node cannot become its own descendant");
+    }
+    parentOf[node] = parent;
+    structureChanged = true;
+}
+
+void TransformHierarchy::setLocal(std::uint32_t node, const Transform& local) noexcept {
+    assert(contains(node));
+    const std::uint32_t slot = slotOf[node];
+    position.set(slot, local.position);
+    qx[slot] = local.rotation.x;
+    qy[slot] = local.rotation.y;
+    qz[slot] = local.rotation.z;
+    qw[slot] = local.rotation.w;
+    scale.set(slot, local.scale);
+    if (!dirty[slot]) {
+        dirty[slot] = 1;
+        dirtySlots.push_back(slot);
+    }
+}
+
+Transform TransformHierarchy::local(std::uint32_t node) const noexcept {
+    assert(contains(node));
+    const std::uint32_t slot = slotOf[node];
+    return {position.get(slot), {qx[slot], qy[slot], qz[slot], qw[slot]}, scale.get(slot)};
+}
+
+math::Affine3 TransformHierarchy::world(std::uint32_t node) const noexcept {
+    assert(contains(node));
+    const std::uint32_t slot = slotOf[node];
+    math::Affine3 m;
+    for (int r = 0; r < 3; ++r)
+        for (int c = 0; c < 4; ++c)
+            m.m[r][c] = worldRows[4 * r + c][slot];
+    return m;
+}
+
+void TransformHierarchy::rebuild() {
+    // Depth of every node from its parent chain; nodes under a removed node are removed too
+    std::vector<std::int32_t> depth(parentOf.size(), UNKNOWN_DEPTH);
+    std::vector<std::uint32_t> path;
+    std::vector<std::size_t> levelCounts;
+    for (const std::uint32_t start : nodeOf) {
+        path.clear();
+        for (std::uint32_t n = start; depth[n] == UNKNOWN_DEPTH;) {
+            if (slotOf[n] == NONE) {
+                depth[n] = REMOVED;
+            } else if (parentOf[n] == NONE) {
+                depth[n] = 0;
+            } else {
+                path.push_back(n);
+                n = parentOf[n];
+            }
+        }
+        for (auto it = path.rbegin(); it != path.rend(); ++it) {
+            const std::int32_t parentDepth = depth[parentOf[*it]];
+            depth[*it] = parentDepth == REMOVED ? REMOVED : parentDepth + 1;
+        }
+        const std::int32_t d = depth[start];
+        if (d >= 0) {
+            if (levelCounts.size() <= static_cast<std::size_t>(d)) levelCounts.resize(d + 1, 0);
+            ++levelCounts[d];
+        }
+    }
+
+    levelStart.assign(levelCounts.size() + 1, 0);
+    for (std::size_t l = 0; l < levelCounts.size(); ++l) levelStart[l + 1] = levelStart[l] + levelCounts[l];
+    const std::size_t count = levelStart.back();
+
+    // Bucket the surviving nodes by depth, keeping their previous order
+    std::vector<std::size_t> cursor(levelStart.begin(), levelStart.end() - 1);
+    std::vector<std::uint32_t> byDepth(count); // old slots
+    for (std::uint32_t old = 0; old < nodeOf.size(); ++old) {
+        const std::uint32_t node = nodeOf[old];
+        const std::int32_t d = depth[node];
+        if (d < 0) {
+            if (slotOf[node] != NONE) --liveCount; // descendant of a removed node
+            slotOf[node] = NONE;
+            freeNodes.push_back(node);
+            continue;
+        }
+        byDepth[cursor[d]++] = old;
+    }
+
+    // Roots keep their order; every deeper level is counting-sorted by parent slot, so the
+    // children of a node, and its descendants on any level, are contiguous
+    const std::size_t roots = levelCounts.empty() ? 0 : levelCounts[0];
+    std::vector<std::uint32_t> order(count); // new slot -> old slot
+    for (std::size_t slot = 0; slot < roots; ++slot) {
+        order[slot] = byDepth[slot];
+        slotOf[nodeOf[byDepth[slot]]] = static_cast<std::uint32_t>(slot);
+    }
+    childBegin.assign(count, static_cast<std::uint32_t>(count));
+    childEnd.assign(count, static_cast<std::uint32_t>(count));
+    std::vector<std::uint32_t> next;
+    for (std::size_t l = 0; l + 2 < levelStart.size(); ++l) {
+        const std::size_t first = levelStart[l];
+        next.assign(levelStart[l + 1] - first, 0);
+        for (std::size_t i = levelStart[l + 1]; i < levelStart[l + 2]; ++i) {
+            ++next[slotOf[parentOf[nodeOf[byDepth[i]]]] - first];
+        }
+        auto slot = static_cast<std::uint32_t>(levelStart[l + 1]);
+        for (std::size_t p = 0; p < next.size(); ++p) {
+            const std::uint32_t children = next[p];
+            childBegin[first + p] = next[p] = slot;
+            slot += children;
+            childEnd[first + p] = slot;
+        }
+        for (std::size_t i = levelStart[l + 1]; i < levelStart[l + 2]; ++i) {
+            const std::uint32_t node = nodeOf[byDepth[i]];
+            slotOf[node] = next[slotOf[parentOf[node]] - first]++;
+            order[slotOf[node]] = byDepth[i];
+        }
+    }
+
+    std::vector<std::uint32_t> nodes(count);
+    math::Vector3SoA newPosition(count), newScale(count);
+    math::AlignedArray<float> nx, ny, nz, nw;
+    nx.resize(count);
+    ny.resize(count);
+    nz.resize(count);
+    nw.resize(count);
+    for (std::size_t slot = 0; slot < count; ++slot) {
+        const std::uint32_t old = order[slot];
+        nodes[slot] = nodeOf[old];
+        newPosition.set(slot, position.get(old));
+        newScale.set(slot, scale.get(old));
+        nx[slot] = qx[old];
+        ny[slot] = qy[old];
+        nz[slot] = qz[old];
+        nw[slot] = qw[old];
+    }
+    nodeOf = std::move(nodes);
+    position = std::move(newPosition);
+    scale = std::move(newScale);
+    qx = std::move(nx);
+    qy = std::move(ny);
+    qz = std::move(nz);
+    qw = std::move(nw);
+
+    parentSlot.resize(count);
+    for (std::size_t slot = 0; slot < count; ++slot) {
+        const std::uint32_t parent = parentOf[nodeOf[slot]];
+        parentSlot[slot] = parent == NONE ? static_cast<std::uint32_t>(slot) : slotOf[parent];
+    }
+    for (math::AlignedArray<float>& row : worldRows) row.resize(count);
+    // Slots moved, so every world matrix is recomputed once
+    dirty.assign(count, 1);
+    dirtySlots.clear();
+    allDirty = true;
+}
+
+void TransformHierarchy::compose(bool root, core::JobSystem* jobs) {
+    float* w[12];
+    for (int k = 0; k < 12; ++k) w[k] = worldRows[k].data();
+    const float* px = position.x(); const float* py = position.y(); const float* pz = position.z();
+    const float* sx = scale.x(); const float* sy = scale.y(); const float* sz = scale.z();
+    const std::uint32_t* parents = parentSlot.data();
+
+    // Jobs split the concatenated ranges evenly, however the nodes are spread over ranges
+    rangeOffset.resize(merged.size() + 1);
+    rangeOffset[0] = 0;
+    for (std::size_t r = 0; r < merged.size(); ++r) {
+        rangeOffset[r + 1] = rangeOffset[r] + (merged[r].second - merged[r].first);
+    }
+    runRange(jobs, rangeOffset.back(), NODES_PER_JOB, [&](std::size_t first, std::size_t last) {
+        auto range = static_cast<std::size_t>(
+            std::upper_bound(rangeOffset.begin(), rangeOffset.end(), first) - rangeOffset.begin() - 1);
+        for (; first < last; first = rangeOffset[++range]) {
+            const std::size_t base = merged[range].first + (first - rangeOffset[range]);
+            const std::size_t count = std::min(last, rangeOffset[range + 1]) - first;
+            math::simd::forEachPack(count, [&]<typename P>(std::size_t from, std::size_t to) {
+                using Reg = typename P::Reg;
+                const Reg one = P::set1(1.0f), two = P::set1(2.0f);
+                for (std::size_t j = base + from; j < base + to; j += P::WIDTH) {
+                    // Local matrix: same operations as composeAffineTRS()
+                    const Reg x = P::load(qx.data() + j), y = P::load(qy.data() + j);
+                    const Reg z = P::load(qz.data() + j), qw4 = P::load(qw.data() + j);
+                    const Reg xx = P::mul(x, x), yy = P::mul(y, y), zz = P::mul(z, z);
+                    const Reg xy = P::mul(x, y), xz = P::mul(x, z), yz = P::mul(y, z);
+                    const Reg wx = P::mul(qw4, x), wy = P::mul(qw4, y), wz = P::mul(qw4, z);
+                    const Reg s[3] = {P::load(sx + j), P::load(sy + j), P::load(sz + j)};
+                    Reg l[3][4];
+                    l[0][0] = P::mul(P::sub(one, P::mul(two, P::add(yy, zz))), s[0]);
+                    l[0][1] = P::mul(P::mul(two, P::sub(xy, wz)), s[1]);
+                    l[0][2] = P::mul(P::mul(two, P::add(xz, wy)), s[2]);
+                    l[1][0] = P::mul(P::mul(two, P::add(xy, wz)), s[0]);
+                    l[1][1] = P::mul(P::sub(one, P::mul(two, P::add(xx, zz))), s[1]);
+                    l[1][2] = P::mul(P::mul(two, P::sub(yz, wx)), s[2]);
+                    l[2][0] = P::mul(P::mul(two, P::sub(xz, wy)), s[0]);
+                    l[2][1] = P::mul(P::mul(two, P::add(yz, wx)), s[1]);
+                    l[2][2] = P::mul(P::sub(one, P::mul(two, P::add(xx, yy))), s[2]);
+                    l[0][3] = P::load(px + j);
+                    l[1][3] = P::load(py + j);
+                    l[2][3] = P::load(pz + j);
+
+                    if (root) {
+                        for (int r = 0; r < 3; ++r)
+                            for (int c = 0; c < 4; ++c)
+                                P::store(w[4 * r + c] + j, l[r][c]);
+                        continue;
+                    }
+
+                    // world = parent world * local, in Affine3 operator* order
+                    for (int r = 0; r < 3; ++r) {
+                        const Reg a0 = P::gather(w[4 * r + 0], parents + j);
+                        const Reg a1 = P::gather(w[4 * r + 1], parents + j);
+                        const Reg a2 = P::gather(w[4 * r + 2], parents + j);
+                        const Reg a3 = P::gather(w[4 * r + 3], parents + j);
+                        for (int c = 0; c < 3; ++c) {
+                            P::store(w[4 * r + c] + j,
+                                     P::add(P::add(P::mul(a0, l[0][c]), P::mul(a1, l[1][c])), P::mul(a2, l[2][c])));
+                        }
+                        P::store(w[4 * r + 3] + j,
+                                 P::add(P::add(P::add(P::mul(a0, l[0][3]), P::mul(a1, l[1][3])), P::mul(a2, l[2][3])), a3));
+                    }
+                }
+            });
+        }
+    });
+}
+
+void TransformHierarchy::update(core::JobSystem* jobs) {
+    if (structureChanged) {
+        rebuild();
+        structureChanged = false;
+    }
+    const std::size_t levels = levelCount();
+    if (allDirty) {
+        for (std::size_t l = 0; l < levels; ++l) {
+            merged.assign(1, {static_cast<std::uint32_t>(levelStart[l]), static_cast<std::uint32_t>(levelStart[l + 1])});
+            compose(l == 0, jobs);
+        }
+        updatedCount = levelStart.empty() ? 0 : levelStart.back();
+        std::fill(dirty.begin(), dirty.end(), std::uint8_t{0});
+        allDirty = false;
+        return;
+    }
+
+    // Dirty nodes in slot order: sort a short list, scan the flags for a long one
+    if (dirtySlots.size() * 16 < nodeOf.size()) {
+        std::sort(dirtySlots.begin(), dirtySlots.end());
+    } else {
+        dirtySlots.clear();
+        for (std::size_t slot = 0; slot < dirty.size(); ++slot) {
+            if (dirty[slot]) dirtySlots.push_back(static_cast<std::uint32_t>(slot));
+        }
+    }
+
+    // Per level, the union of the dirty nodes there and the children of last level's ranges;
+    // both lists are sorted, so the union is a single merge
+    updatedCount = 0;
+    ranges.clear();
+    std::size_t seed = 0;
+    for (std::size_t l = 0; l < levels && (!ranges.empty() || seed < dirtySlots.size()); ++l) {
+        merged.clear();
+        auto append = [&](std::uint32_t first, std::uint32_t last) {
+            if (!merged.empty() && merged.back().second >= first) {
+                merged.back().second = std::max(merged.back().second, last);
+            } else {
+                merged.emplace_back(first, last);
+            }
+        };
+        std::size_t r = 0;
+        while (r < ranges.size() || (seed < dirtySlots.size() && dirtySlots[seed] < levelStart[l + 1])) {
+            const bool takeSeed = seed < dirtySlots.size() && dirtySlots[seed] < levelStart[l + 1] &&
+                                  (r == ranges.size() || dirtySlots[seed] < ranges[r].first);
+            if (takeSeed) {
+                append(dirtySlots[seed], dirtySlots[seed] + 1);
+                ++seed;
+            } else {
+                append(ranges[r].first, ranges[r].second);
+                ++r;
+            }
+        }
+
+        compose(l == 0, jobs);
+        ranges.clear();
+        for (const auto& [first, last] : merged) {
+            updatedCount += last - first;
+            const std::uint32_t childFirst = childBegin[first], childLast = childEnd[last - 1];
+            if (childFirst < childLast) ranges.emplace_back(childFirst, childLast);
+        }
+    }
+    for (const std::uint32_t slot : dirtySlots) dirty[slot] = 0;
+    dirtySlots.clear();
+}
+
+} // namespace scene
@@ -0,0 +1,43 @@
+#pragma once
+
+#include <cstdint>
+
+#include "include/Quaternion.h"
+#include "include/Vector3.h"
+
+/**
+ * @file Components.h
+ * @brief Built-in components shared by simulation and rendering systems.
+ */
+
+namespace scene {
+
+/**
+ * @brief Placement of an entity: scale, then rotation, then translation.
+ */
+struct Transform {
+    math::Vector3 position;
+    math::Quaternion rotation;
+    math::Vector3 scale{1.0f, 1.0f, 1.0f};
+};
+
+/**
+ * @brief Links an entity to a body in physics::RigidBodies.
+ *
+ * The body's state stays in the physics SoA arrays; syncTransforms() copies
+ * poses into Transform after each step.
+ */
+struct RigidBody {
+    std::uint32_t body = ~0u; /**< Index into physics::RigidBodies. */
+};
+
+/**
+ * @brief Something to draw: mesh and material handles plus a bounding sphere for culling.
+ */
+struct Renderable {
+    std::uint32_t mesh = 0;
+    std::uint32_t material = 0;
+    float boundingRadius = 1.0f; /**< Around the local origin, before scale. */
+};
+
+} // namespace scene
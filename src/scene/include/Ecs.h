@@ -0,0 +1,445 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <map>
+#include <memory>
+#include <span>
+#include <type_traits>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "include/JobSystem.h"
+#include "include/Pool.h"
+
+/**
+ * @file Ecs.h
+ * @brief Archetype entity-component storage: entities, chunked component arrays, queries, command buffers.
+ */
+
+namespace scene {
+
+/**
+ * @brief Handle to an entity; stale once the entity is destroyed (the generation no longer matches).
+ */
+struct Entity {
+    std::uint32_t index = ~0u;
+    std::uint32_t generation = 0;
+
+    bool operator==(const Entity&) const = default;
+};
+
+/** @brief Entity that never refers to a live one. */
+inline constexpr Entity NULL_ENTITY{};
+
+using ComponentId = std::uint32_t;
+using ComponentMask = std::uint64_t;
+
+/** @brief Distinct component types a program may use. */
+inline constexpr std::size_t MAX_COMPONENTS = 64;
+
+namespace detail {
+
+struct ComponentInfo {
+    std::size_t size;
+    std::size_t alignment;
+};
+
+ComponentId registerComponent(std::size_t size, std::size_t alignment);
+const ComponentInfo& componentInfo(ComponentId id) noexcept;
+
+} // namespace detail
+
+/**
+ * @brief Process-wide id of component type T, assigned on first use.
+ *
+ * Components are stored and moved with memcpy and never destroyed, so they
+ * must be trivially copyable and trivially destructible.
+ */
+template <typename T>
+ComponentId componentId() {
+    if constexpr (std::is_const_v<T>) {
+        return componentId<std::remove_const_t<T>>();
+    } else {
+        static_assert(std::is_trivially_copyable_v<T> && std::is_trivially_destructible_v<T>,
+                      "components are moved with memcpy and never destroyed");
+        static const ComponentId id = detail::registerComponent(sizeof(T), alignof(T));
+        return id;
+    }
+}
+
+/** @brief Mask with the bits of every listed component type. */
+template <typename... C>
+ComponentMask maskOf() {
+    return (ComponentMask{0} | ... | (ComponentMask{1} << componentId<C>()));
+}
+
+/**
+ * @brief All entities with exactly one set of components, stored in fixed-size chunks.
+ *
+ * Each chunk holds up to capacity rows laid out column by column: the
+ * entity handles first, then one contiguous array per component (each
+ * starting on a cache line). Rows are dense across the chunk list; removing
+ * a row moves the last row into its place.
+ */
+struct Archetype {
+    ComponentMask mask = 0;
+    std::vector<ComponentId> components; // ascending
+    std::size_t capacity = 0;            // rows per chunk
+    std::array<std::uint32_t, MAX_COMPONENTS> columnOffset{};
+    std::vector<std::byte*> chunks;
+    std::size_t count = 0;
+    std::array<std::uint32_t, MAX_COMPONENTS> addEdge;    // archetype with one more component
+    std::array<std::uint32_t, MAX_COMPONENTS> removeEdge; // archetype with one fewer
+
+    std::size_t rowsIn(std::size_t chunk) const noexcept {
+        return std::min(capacity, count - chunk * capacity);
+    }
+    Entity* entities(std::size_t chunk) const noexcept { return reinterpret_cast<Entity*>(chunks[chunk]); }
+    std::byte* column(std::size_t chunk, ComponentId id) const noexcept { return chunks[chunk] + columnOffset[id]; }
+    void* component(std::size_t row, ComponentId id) const noexcept {
+        return column(row / capacity, id) + (row % capacity) * detail::componentInfo(id).size;
+    }
+};
+
+/**
+ * @brief Archetypes matching one query, extended as new archetypes appear.
+ */
+struct QueryState {
+    ComponentMask include = 0;
+    ComponentMask exclude = 0;
+    std::vector<std::uint32_t> archetypes;
+    std::size_t archetypesSeen = 0;
+    std::vector<std::pair<const Archetype*, std::uint32_t>> chunks; // parallel iteration scratch
+};
+
+class Registry;
+
+/**
+ * @class Query
+ * @brief Iterates the entities that have all of C (and none of the excluded components).
+ *
+ * The matching archetypes are cached in the registry and only new
+ * archetypes are examined on later runs, so a query costs nothing to
+ * build again each frame. Mark read-only components const. The registry
+ * must not change structurally while a query runs; record the changes
+ * in a CommandBuffer instead.
+ */
+template <typename... C>
+class Query {
+    static_assert(sizeof...(C) > 0, "a query needs at least one component");
+
+public:
+    /** @brief Calls fn(C&...) for every entity. */
+    template <typename Fn>
+    void forEach(Fn&& fn) {
+        forEachChunk([&](std::span<const Entity> entities, std::span<C>... columns) {
+            for (std::size_t i = 0; i < entities.size(); ++i) fn(columns[i]...);
+        });
+    }
+
+    /**
+     * @brief Calls fn(entities, columns...) once per chunk with contiguous component arrays.
+     */
+    template <typename Fn>
+    void forEachChunk(Fn&& fn);
+
+    /**
+     * @brief forEach() with the chunks split across jobs (runs inline when jobs is nullptr).
+     */
+    template <typename Fn>
+    void parallelForEach(core::JobSystem* jobs, Fn&& fn) {
+        parallelForEachChunk(jobs, [&](std::size_t, std::span<const Entity> entities, std::span<C>... columns) {
+            for (std::size_t i = 0; i < entities.size(); ++i) fn(columns[i]...);
+        });
+    }
+
+    /**
+     * @brief Calls fn(chunkIndex, entities, columns...) for each chunk, split across jobs.
+     *
+     * chunkIndex runs from 0 to chunkCount() in iteration order, whichever
+     * thread runs the chunk; use it to pick per-chunk outputs (for example a
+     * CommandBuffer per chunk, applied in order) so results do not depend on
+     * scheduling.
+     */
+    template <typename Fn>
+    void parallelForEachChunk(core::JobSystem* jobs, Fn&& fn);
+
+    /** @brief Matching entities. */
+    std::size_t size();
+
+    /** @brief Matching chunks. */
+    std::size_t chunkCount();
+
+private:
+    friend class Registry;
+
+    Query(Registry& registry, QueryState& state) noexcept : registry(&registry), state(&state) {}
+
+    template <typename Fn>
+    static void visit(const Archetype& archetype, std::size_t chunk, Fn& fn) {
+        const std::size_t n = archetype.rowsIn(chunk);
+        fn(std::span<const Entity>(archetype.entities(chunk), n),
+           std::span<C>(reinterpret_cast<C*>(archetype.column(chunk, componentId<C>())), n)...);
+    }
+
+    Registry* registry;
+    QueryState* state;
+};
+
+class CommandBuffer;
+
+/**
+ * @class Registry
+ * @brief Owns all entities and their components, grouped by archetype.
+ *
+ * Adding or removing a component moves the entity's row to the archetype
+ * of its new component set (found through cached edges); destroying an
+ * entity fills its row with the archetype's last row. Chunks come from a
+ * fixed-size pool, so archetypes that grow and shrink reuse memory.
+ * Not thread safe; systems running in parallel record structural changes
+ * in CommandBuffers.
+ *
+ * Example usage:
+ * @code
+ * scene::Registry registry;
+ * scene::Entity e = registry.create(scene::Transform{}, scene::Renderable{mesh, material, 1.0f});
+ * registry.add(e, scene::RigidBody{body});
+ * registry.query<scene::Transform, const scene::RigidBody>().forEach(
+ *     [&](scene::Transform& t, const scene::RigidBody& b) { t.position = bodies.position.get(b.body); });
+ * @endcode
+ */
+class Registry {
+public:
+    Registry();
+    ~Registry();
+
+    Registry(const Registry&) = delete;
+    Registry& operator=(const Registry&) = delete;
+
+    /** @brief New entity with the given components. */
+    template <typename... C>
+    Entity create(const C&... components) {
+        const Entity entity = createEntity(maskOf<C...>());
+        (std::memcpy(componentPointer(entity, componentId<C>()), &components, sizeof(C)), ...);
+        return entity;
+    }
+
+    /** @brief Destroys a live entity; its handle becomes stale. */
+    void destroy(Entity entity);
+
+    bool alive(Entity entity) const noexcept {
+        return entity.index < records.size() && records[entity.index].generation == entity.generation &&
+               records[entity.index].archetype != FREE;
+    }
+
+    /** @brief Adds T to a live entity, or overwrites it if present. */
+    template <typename T>
+    T& add(Entity entity, const T& component) {
+        void* slot = addComponent(entity, componentId<T>());
+        std::memcpy(slot, &component, sizeof(T));
+        return *static_cast<T*>(slot);
+    }
+
+    /** @brief Removes T from a live entity if it has one. */
+    template <typename T>
+    void remove(Entity entity) {
+        removeComponent(entity, componentId<T>());
+    }
+
+    template <typename T>
+    bool has(Entity entity) const {
+        assert(alive(entity));
+        return (archetypes[records[entity.index].archetype]->mask >> componentId<T>()) & 1;
+    }
+
+    /** @brief T of a live entity, or nullptr if it has none; valid until the next structural change. */
+    template <typename T>
+    T* tryGet(Entity entity) {
+        return has<T>(entity) ? static_cast<T*>(componentPointer(entity, componentId<T>())) : nullptr;
+    }
+
+    template <typename T>
+    T& get(Entity entity) {
+        T* component = tryGet<T>(entity);
+        assert(component != nullptr);
+        return *component;
+    }
+
+    /** @brief Cached query over entities with all of C and none of exclude. */
+    template <typename... C>
+    Query<C...> query(ComponentMask exclude = 0) {
+        return Query<C...>(*this, queryState(maskOf<C...>(), exclude));
+    }
+
+    /** @brief Replays and clears commands in recording order; commands on dead entities are skipped. */
+    void apply(CommandBuffer& commands);
+
+    /** @brief Live entities. */
+    std::size_t size() const noexcept { return liveCount; }
+
+    std::size_t archetypeCount() const noexcept { return archetypes.size(); }
+
+    /** @brief Bytes per chunk: a multiple of the cache line, sized to stay in L1 while a system runs. */
+    static constexpr std::size_t CHUNK_BYTES = 16 * 1024;
+
+private:
+    template <typename... C>
+    friend class Query;
+
+    struct Record {
+        std::uint32_t archetype;
+        std::uint32_t row;
+        std::uint32_t generation;
+    };
+
+    static constexpr std::uint32_t FREE = ~0u;
+    static constexpr std::uint32_t NO_EDGE = ~0u;
+
+    Entity createEntity(ComponentMask mask);
+    void* addComponent(Entity entity, ComponentId id);
+    void removeComponent(Entity entity, ComponentId id);
+    void* componentPointer(Entity entity, ComponentId id) const noexcept {
+        const Record& record = records[entity.index];
+        return archetypes[record.archetype]->component(record.row, id);
+    }
+
+    std::uint32_t archetypeFor(ComponentMask mask);
+    std::uint32_t pushRow(std::uint32_t archetype, Entity entity);
+    void eraseRow(std::uint32_t archetype, std::uint32_t row);
+    void moveEntity(Entity entity, std::uint32_t target);
+    QueryState& queryState(ComponentMask include, ComponentMask exclude);
+    void refresh(QueryState& state);
+
+    core::memory::BlockPool chunkPool;
+    std::vector<std::unique_ptr<Archetype>> archetypes;
+    std::unordered_map<ComponentMask, std::uint32_t> archetypeIndex;
+    std::vector<Record> records;
+    std::vector<std::uint32_t> freeIndices;
+    std::size_t liveCount = 0;
+    std::map<std::pair<ComponentMask, ComponentMask>, std::unique_ptr<QueryState>> queries;
+};
+
+/**
+ * @class CommandBuffer
+ * @brief Structural changes recorded now and applied later with Registry::apply().
+ *
+ * Component values are copied into the buffer when recorded. Recording is
+ * not thread safe: give each job (or each chunk of a parallel query) its
+ * own buffer and apply them in a fixed order.
+ */
+class CommandBuffer {
+public:
+    template <typename... C>
+    void create(const C&... components) {
+        Command& command = record(Op::Create, NULL_ENTITY, maskOf<C...>());
+        // Stored in ascending component id order, the order apply() walks the mask in
+        std::array<std::pair<ComponentId, const void*>, sizeof...(C)> values{
+            std::pair<ComponentId, const void*>{componentId<C>(), &components}...};
+        std::sort(values.begin(), values.end(), [](const auto& a, const auto& b) { return a.first < b.first; });
+        command.payload = payload.size();
+        for (const auto& [id, value] : values) append(value, detail::componentInfo(id).size);
+    }
+
+    void destroy(Entity entity) { record(Op::Destroy, entity, 0); }
+
+    template <typename T>
+    void add(Entity entity, const T& component) {
+        record(Op::Add, entity, maskOf<T>()).payload = payload.size();
+        append(&component, sizeof(T));
+    }
+
+    template <typename T>
+    void remove(Entity entity) {
+        record(Op::Remove, entity, maskOf<T>());
+    }
+
+    bool empty() const noexcept { return commands.empty(); }
+    std::size_t size() const noexcept { return commands.size(); }
+
+    void clear() noexcept {
+        commands.clear();
+        payload.clear();
+    }
+
+private:
+    friend class Registry;
+
+    enum class Op : std::uint8_t { Create, Destroy, Add, Remove };
+
+    struct Command {
+        Op op;
+        Entity entity;
+        ComponentMask mask;
+        std::size_t payload;
+    };
+
+    Command& record(Op op, Entity entity, ComponentMask mask) {
+        return commands.emplace_back(Command{op, entity, mask, 0});
+    }
+
+    void append(const void* value, std::size_t bytes) {
+        const auto* first = static_cast<const std::byte*>(value);
+        payload.insert(payload.end(), first, first + bytes);
+    }
+
+    std::vector<Command> commands;
+    std::vector<std::byte> payload; // component values, unaligned (copied out with memcpy)
+};
+
+template <typename... C>
+template <typename Fn>
+void Query<C...>::forEachChunk(Fn&& fn) {
+    registry->refresh(*state);
+    for (const std::uint32_t index : state->archetypes) {
+        const Archetype& archetype = *registry->archetypes[index];
+        for (std::size_t chunk = 0; chunk < archetype.chunks.size(); ++chunk) visit(archetype, chunk, fn);
+    }
+}
+
+template <typename... C>
+template <typename Fn>
+void Query<C...>::parallelForEachChunk(core::JobSystem* jobs, Fn&& fn) {
+    registry->refresh(*state);
+    state->chunks.clear();
+    for (const std::uint32_t index : state->archetypes) {
+        const Archetype& archetype = *registry->archetypes[index];
+        for (std::size_t chunk = 0; chunk < archetype.chunks.size(); ++chunk) {
+            state->chunks.emplace_back(&archetype, static_cast<std::uint32_t>(chunk));
+        }
+    }
+    auto chunkRange = [&](std::size_t begin, std::size_t end) {
+        for (std::size_t i = begin; i < end; ++i) {
+            auto body = [&](auto... columns) { fn(i, columns...); };
+            visit(*state->chunks[i].first, state->chunks[i].second, body);
+        }
+    };
+    if (jobs != nullptr && state->chunks.size() > 1) {
+        jobs->parallelFor(0, state->chunks.size(), 1, chunkRange);
+    } else {
+        chunkRange(0, state->chunks.size());
+    }
+}
+
+template <typename... C>
+std::size_t Query<C...>::size() {
+    registry->refresh(*state);
+    std::size_t total = 0;
+    for (const std::uint32_t index : state->archetypes) total += registry->archetypes[index]->count;
+    return total;
+}
+
+template <typename... C>
+std::size_t Query<C...>::chunkCount() {
+    registry->refresh(*state);
+    std::size_t total = 0;
+    for (const std::uint32_t index : state->archetypes) total += registry->archetypes[index]->chunks.size();
+    return total;
+}
+
+} // namespace scene
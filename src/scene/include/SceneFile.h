@@ -0,0 +1,89 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "include/World.h"
+
+/**
+ * @file SceneFile.h
+ * @brief Text scene descriptions for headless runs: world settings plus groups of bodies.
+ */
+
+namespace scene {
+
+/**
+ * @brief Bodies sharing a shape and mass, placed one at a time, on a grid or at random.
+ */
+struct BodyGroup {
+    enum class Layout : std::uint8_t {
+        Single, /**< One body at origin. */
+        Grid,   /**< count[0] x count[1] x count[2] bodies from origin, spacing apart. */
+        Random  /**< count[0] bodies uniformly inside the box [origin, extent]. */
+    };
+
+    Layout layout = Layout::Single;
+    physics::Shape shape;
+    float mass = 1.0f; /**< 0 makes the bodies static. */
+    math::Vector3 origin;
+    math::Vector3 extent; /**< Random: upper corner of the box. */
+    std::uint32_t count[3] = {1, 1, 1};
+    float spacing = 1.0f;
+    float jitter = 0.0f; /**< Grid: random offset per axis, up to this much either way. */
+    math::Vector3 velocity;
+};
+
+/**
+ * @brief Everything a headless run needs to rebuild the same world.
+ *
+ * Text form, one statement per line, '#' starts a comment:
+ * @code
+ * seed 7
+ * dt 0.0166667
+ * gravity 0 -9.81 0
+ * iterations 8
+ * static box 50 1 50 at 0 -1 0
+ * body sphere 0.5 mass 2 at 0 10 0 velocity 1 0 0
+ * grid sphere 0.5 mass 1 count 10 20 10 spacing 1.1 at -5 1 -5 jitter 0.01
+ * random box 0.3 0.3 0.3 mass 1 count 500 within -10 2 -10 10 12 10
+ * @endcode
+ * Shapes are "sphere r", "box hx hy hz" and "capsule halfHeight r". Bodies
+ * from grid and random statements start at rest unless "velocity" follows.
+ */
+struct SceneDescription {
+    std::uint32_t seed = 1; /**< Drives jitter and random placement. */
+    float fixedStep = 1.0f / 60.0f;
+    math::Vector3 gravity{0.0f, -9.81f, 0.0f};
+    int velocityIterations = 8;
+    std::vector<BodyGroup> groups;
+
+    /** @brief Bodies populate() adds. */
+    std::size_t bodyCount() const noexcept;
+
+    /** @brief World settings carrying dt, gravity and the solver iterations. */
+    physics::WorldSettings worldSettings() const noexcept;
+};
+
+/**
+ * @brief Parses the text form into description.
+ *
+ * @return False with error naming the offending line; description is then unspecified.
+ */
+bool parseScene(std::string_view text, SceneDescription& description, std::string& error);
+
+/**
+ * @brief Reads and parses a scene file; false with error if it cannot be read or parsed.
+ */
+bool loadScene(const std::string& path, SceneDescription& description, std::string& error);
+
+/**
+ * @brief Adds the bodies of every group to world, in statement order.
+ *
+ * Placement only depends on the description (including its seed), so two
+ * worlds populated from equal descriptions hold bit-identical bodies.
+ */
+void populate(const SceneDescription& description, physics::World& world);
+
+} // namespace scene
@@ -0,0 +1,20 @@
+#pragma once
+
+#include "Ecs.h"
+#include "include/RigidBodies.h"
+
+/**
+ * @file Systems.h
+ * @brief Systems that connect the registry to the other engine modules.
+ */
+
+namespace scene {
+
+/**
+ * @brief Copies body positions and orientations into Transform for entities with a RigidBody.
+ *
+ * Scale is left alone. Chunks are split across jobs when jobs is set.
+ */
+void syncTransforms(Registry& registry, const physics::RigidBodies& bodies, core::JobSystem* jobs = nullptr);
+
+} // namespace scene
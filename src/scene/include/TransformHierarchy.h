@@ -0,0 +1,133 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+#include "Components.h"
+#include "include/AlignedArray.h"
+#include "include/Affine3.h"
+#include "include/Vector3SoA.h"
+
+namespace core {
+class JobSystem;
+}
+
+/**
+ * @file TransformHierarchy.h
+ * @brief Parent/child transforms in breadth-first arrays with dirty-flag world updates.
+ */
+
+namespace scene {
+
+/**
+ * @class TransformHierarchy
+ * @brief Scene graph of local transforms whose world matrices are recomputed only where something changed.
+ *
+ * Nodes are stored breadth first: all roots, then all depth-1 nodes ordered
+ * by parent, and so on, each with the index of its parent. Every parent
+ * precedes its children, one level can be updated in parallel once the
+ * previous one is done, and the descendants of a node on any level form one
+ * contiguous range. World matrices are kept as twelve float arrays (one per
+ * Affine3 entry) and composed four nodes at a time: parent rows are
+ * gathered, the local TRS matrix is built in lanes and the two multiplied.
+ *
+ * setLocal() marks a node dirty; update() walks down from the dirty nodes
+ * one level at a time, recomputing only the ranges their subtrees cover, so
+ * a frame in which nothing moved costs nothing. Results equal
+ * composeAffineTRS() chained with Affine3 multiplication, bit for bit, on
+ * every backend and thread count.
+ *
+ * Node handles are stable. add(), remove() and setParent() are O(1); the
+ * next update() rebuilds the breadth-first order and recomputes every
+ * world matrix (O(n)).
+ *
+ * Example usage:
+ * @code
+ * scene::TransformHierarchy scene;
+ * const std::uint32_t car = scene.add(carTransform);
+ * const std::uint32_t wheel = scene.add(wheelOffset, car);
+ * scene.setLocal(car, moved);
+ * scene.update(&jobs); // car and wheel recomputed, the rest skipped
+ * math::Affine3 m = scene.world(wheel);
+ * @endcode
+ */
+class TransformHierarchy {
+public:
+    /** @brief Parent of a root node. */
+    static constexpr std::uint32_t NONE = ~0u;
+
+    /** @brief Nodes per job within one level (multiple of the SIMD width). */
+    static constexpr std::size_t NODES_PER_JOB = 4096;
+
+    /** @brief New node under parent (NONE for a root); its world matrix is valid after the next update(). */
+    std::uint32_t add(const Transform& local, std::uint32_t parent = NONE);
+
+    /**
+     * @brief Removes node and its whole subtree.
+     *
+     * Descendant handles are released by the next update(), which also makes
+     * them available to add() again.
+     */
+    void remove(std::uint32_t node);
+
+    /** @brief Moves node (with its subtree) under parent; the local transform is kept. */
+    void setParent(std::uint32_t node, std::uint32_t parent);
+
+    std::uint32_t parent(std::uint32_t node) const noexcept { return parentOf[node]; }
+
+    bool contains(std::uint32_t node) const noexcept { return node < slotOf.size() && slotOf[node] != NONE; }
+
+    void setLocal(std::uint32_t node, const Transform& local) noexcept;
+    Transform local(std::uint32_t node) const noexcept;
+
+    /** @brief World matrix as of the last update(). */
+    math::Affine3 world(std::uint32_t node) const noexcept;
+
+    /** @brief Recomputes the world matrices of dirty nodes and their descendants. */
+    void update(core::JobSystem* jobs = nullptr);
+
+    /** @brief Live nodes (including those added since the last update()). */
+    std::size_t size() const noexcept { return liveCount; }
+
+    /** @brief Depth of the deepest node plus one, as of the last update(). */
+    std::size_t levelCount() const noexcept { return levelStart.empty() ? 0 : levelStart.size() - 1; }
+
+    /** @brief Nodes whose world matrix the last update() recomputed. */
+    std::size_t lastUpdateCount() const noexcept { return updatedCount; }
+
+private:
+    void rebuild();
+    void compose(bool root, core::JobSystem* jobs);
+    std::uint32_t newSlot(std::uint32_t node);
+
+    // Per node handle
+    std::vector<std::uint32_t> parentOf;
+    std::vector<std::uint32_t> slotOf; // NONE once removed
+    std::vector<std::uint32_t> freeNodes;
+    std::size_t liveCount = 0;
+    bool structureChanged = false;
+
+    // Per slot, breadth first after update()
+    std::vector<std::uint32_t> nodeOf;
+    math::AlignedArray<std::uint32_t> parentSlot; // roots point at themselves (never read)
+    math::Vector3SoA position;
+    math::AlignedArray<float> qx, qy, qz, qw;
+    math::Vector3SoA scale;
+    std::array<math::AlignedArray<float>, 12> worldRows; // entry (r, c) of Affine3 at 4 * r + c
+    std::vector<std::uint32_t> childBegin, childEnd; // children of a slot: [childBegin, childEnd)
+    std::vector<std::size_t> levelStart; // slots of level l: [levelStart[l], levelStart[l + 1])
+    std::vector<std::uint8_t> dirty;       // local transform changed since the last update
+    std::vector<std::uint32_t> dirtySlots; // slots with dirty set, in the order they were set
+    bool allDirty = false;                 // set by rebuild(): recompute everything
+    std::size_t updatedCount = 0;
+
+    // update() scratch: slot ranges to recompute on the current level (merged) and the next (ranges)
+    std::vector<std::pair<std::uint32_t, std::uint32_t>> ranges;
+    std::vector<std::pair<std::uint32_t, std::uint32_t>> merged;
+    std::vector<std::size_t> rangeOffset; // nodes in merged before range r
+};
+
+} // namespace scene
@@ -0,0 +1,96 @@
+#include <gtest/gtest.h>
+#include <type_traits>
+#include "include/Affine3.h"
+#include "include/TransformBatch.h"
+
+using math::Affine3;
+using math::Rotation3;
+using math::Scale3;
+using math::Translation3;
+
+// Composition must resolve to the cheapest representation at compile time
+static_assert(std::is_same_v<decltype(Translation3{} * Translation3{}), Translation3>);
+static_assert(std::is_same_v<decltype(Scale3{} * Scale3{}), Scale3>);
+static_assert(std::is_same_v<decltype(Rotation3{} * Rotation3{}), Rotation3>);
+static_assert(std::is_same_v<decltype(Translation3{} * Rotation3{}), Affine3>);
+static_assert(std::is_same_v<decltype(Affine3{} * Scale3{}), Affine3>);
+static_assert((Translation3{{1.0f, 2.0f, 3.0f}} * Translation3{{1.0f, 1.0f, 1.0f}}).offset.z == 4.0f);
+
+class Affine3TestFixture : public ::testing::Test {
+protected:
+    void SetUp() override {
+        t = Translation3{{1.0f, -2.0f, 3.5f}};
+        s = Scale3{{2.0f, 0.5f, -1.5f}};
+        r = Rotation3::axisAngle(math::Vector3(1.0f, 2.0f, 2.0f).normalized(), 0.7f);
+        general = t * r * s;
+    }
+
+    static void expectMatches(const Affine3& a, const mat4& expected) {
+        for (int i = 0; i < 3; ++i)
+            for (int j = 0; j < 4; ++j)
+                EXPECT_NEAR(a.m[i][j], expected.m[i][j], EPSILON) << "element " << i << "," << j;
+    }
+
+    static constexpr float EPSILON = 1e-5f;
+    Translation3 t;
+    Scale3 s;
+    Rotation3 r;
+    Affine3 general;
+};
+
+TEST_F(Affine3TestFixture, RoundTripThroughMat4) {
+    mat4 m = general.toMat4();
+    EXPECT_FLOAT_EQ(m.m[3][0], 0.0f);
+    EXPECT_FLOAT_EQ(m.m[3][3], 1.0f);
+    expectMatches(Affine3::fromMat4(m), m);
+}
+
+TEST_F(Affine3TestFixture, AxisAngleIsOrthonormal) {
+    Rotation3 rt;
+    for (int i = 0; i < 3; ++i)
+        for (int j = 0; j < 3; ++j)
+            rt.m[i][j] = r.m[j][i];
+    Rotation3 identity = r * rt;
+    for (int i = 0; i < 3; ++i)
+        for (int j = 0; j < 3; ++j)
+            EXPECT_NEAR(identity.m[i][j], i == j ? 1.0f : 0.0f, EPSILON);
+}
+
+TEST_F(Affine3TestFixture, TaggedPairsMatchMat4Products) {
+    const mat4 T = t.toMat4(), S = s.toMat4(), R = r.toMat4(), A = general.toMat4();
+    expectMatches((t * t).toAffine(), T * T);
+    expectMatches((s * s).toAffine(), S * S);
+    expectMatches((r * r).toAffine(), R * R);
+    expectMatches(t * r, T * R);
+    expectMatches(r * t, R * T);
+    expectMatches(t * s, T * S);
+    expectMatches(s * t, S * T);
+    expectMatches(r * s, R * S);
+    expectMatches(s * r, S * R);
+    expectMatches(t * general, T * A);
+    expectMatches(general * t, A * T);
+    expectMatches(s * general, S * A);
+    expectMatches(general * s, A * S);
+    expectMatches(r * general, R * A);
+    expectMatches(general * r, A * R);
+    expectMatches(general * general, A * A);
+}
+
+TEST_F(Affine3TestFixture, TransformPointMatchesMat4) {
+    const math::Vector3 p(0.3f, -4.0f, 2.0f);
+    const math::Vector3 viaAffine = math::transformPoint(general, p);
+    const math::Vector3 viaMat4 = math::transformPoint(general.toMat4(), p);
+    EXPECT_NEAR(viaAffine.x, viaMat4.x, EPSILON);
+    EXPECT_NEAR(viaAffine.y, viaMat4.y, EPSILON);
+    EXPECT_NEAR(viaAffine.z, viaMat4.z, EPSILON);
+    const math::Vector3 d = math::transformDirection(t.toAffine(), p);
+    EXPECT_FLOAT_EQ(d.x, p.x);
+}
+
+TEST_F(Affine3TestFixture, Mat4TimesAffineKeepsProjectiveRow) {
+    mat4 projection;
+    projection.m[3][2] = -1.0f;
+    projection.m[3][3] = 0.0f;
+    mat4 product = projection * general;
+    EXPECT_FLOAT_EQ(product.m[3][2], -general.m[2][2]);
+}
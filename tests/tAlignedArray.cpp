@@ -0,0 +1,73 @@
+#include <gtest/gtest.h>
+#include <cstdint>
+#include "include/AlignedArray.h"
+
+using math::AlignedArray;
+
+class AlignedArrayTestFixture : public ::testing::Test {
+protected:
+    static bool isAligned(const void* p) {
+        return reinterpret_cast<std::uintptr_t>(p) % AlignedArray<float>::ALIGNMENT == 0;
+    }
+};
+
+TEST_F(AlignedArrayTestFixture, DefaultIsEmptyWithoutAllocation) {
+    AlignedArray<float> a;
+    EXPECT_TRUE(a.empty());
+    EXPECT_EQ(a.capacity(), 0u);
+    EXPECT_EQ(a.data(), nullptr);
+}
+
+TEST_F(AlignedArrayTestFixture, PushBackGrowsAlignedAndPadded) {
+    AlignedArray<float> a;
+    for (int i = 0; i < 100; ++i) a.pushBack(static_cast<float>(i));
+    EXPECT_EQ(a.size(), 100u);
+    EXPECT_TRUE(isAligned(a.data()));
+    EXPECT_EQ(a.capacity() % 16, 0u);
+    for (int i = 0; i < 100; ++i) EXPECT_EQ(a[i], static_cast<float>(i));
+}
+
+TEST_F(AlignedArrayTestFixture, PushBackOfOwnElementSurvivesGrowth) {
+    AlignedArray<float> a(16, 3.0f);
+    ASSERT_EQ(a.size(), a.capacity());
+    a.pushBack(a[0]);
+    EXPECT_EQ(a[16], 3.0f);
+}
+
+TEST_F(AlignedArrayTestFixture, ResizeFillsNewElements) {
+    AlignedArray<int> a(3, 7);
+    a.resize(5, -1);
+    EXPECT_EQ(a[2], 7);
+    EXPECT_EQ(a[4], -1);
+}
+
+TEST_F(AlignedArrayTestFixture, ResizeForOverwriteKeepsElementsAndCapacity) {
+    AlignedArray<int> a(3, 7);
+    a.resizeForOverwrite(100);
+    EXPECT_EQ(a.size(), 100u);
+    EXPECT_EQ(a[2], 7);
+    const int* storage = a.data();
+    a.resizeForOverwrite(1);
+    a.resizeForOverwrite(100); // shrinking kept the allocation
+    EXPECT_EQ(a.data(), storage);
+    EXPECT_EQ(a[0], 7);
+}
+
+TEST_F(AlignedArrayTestFixture, SwapRemoveMovesLast) {
+    AlignedArray<int> a;
+    for (int i = 0; i < 4; ++i) a.pushBack(i);
+    a.swapRemove(1);
+    ASSERT_EQ(a.size(), 3u);
+    EXPECT_EQ(a[1], 3);
+}
+
+TEST_F(AlignedArrayTestFixture, CopyAndMove) {
+    AlignedArray<float> a(10, 1.5f);
+    AlignedArray<float> b = a;
+    b[0] = 2.0f;
+    EXPECT_EQ(a[0], 1.5f);
+    EXPECT_TRUE(isAligned(b.data()));
+    AlignedArray<float> c = std::move(b);
+    EXPECT_EQ(c[0], 2.0f);
+    EXPECT_TRUE(b.empty());
+}
@@ -0,0 +1,194 @@
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <memory_resource>
+#include <random>
+#include <vector>
+#include "include/DynamicAabbTree.h"
+#include "include/SweepAndPrune.h"
+
+using math::Vector3;
+using physics::Aabb;
+using physics::BroadphasePair;
+
+class BroadphaseTestFixture : public ::testing::Test {
+protected:
+    static std::vector<Aabb> randomBoxes(std::size_t count, std::uint32_t seed, float extent = 20.0f) {
+        std::mt19937 rng(seed);
+        std::uniform_real_distribution<float> pos(-extent, extent);
+        std::uniform_real_distribution<float> size(0.2f, 1.5f);
+        std::vector<Aabb> boxes;
+        for (std::size_t i = 0; i < count; ++i) {
+            boxes.push_back(Aabb::fromCenterHalfExtents({pos(rng), pos(rng), pos(rng)},
+                                                        {size(rng), size(rng), size(rng)}));
+        }
+        return boxes;
+    }
+
+    static std::vector<BroadphasePair> bruteForce(const std::vector<Aabb>& boxes) {
+        std::vector<BroadphasePair> pairs;
+        for (std::uint32_t i = 0; i < boxes.size(); ++i) {
+            for (std::uint32_t j = i + 1; j < boxes.size(); ++j) {
+                if (boxes[i].overlaps(boxes[j])) pairs.push_back({i, j});
+            }
+        }
+        return pairs;
+    }
+
+    // Pairs of tight boxes must be a subset of the tree's fat-box pairs
+    static bool containsAll(const std::vector<BroadphasePair>& superset, const std::vector<BroadphasePair>& subset) {
+        return std::includes(superset.begin(), superset.end(), subset.begin(), subset.end());
+    }
+
+    static void moveBoxes(std::vector<Aabb>& boxes, std::mt19937& rng, float step) {
+        std::uniform_real_distribution<float> d(-step, step);
+        for (Aabb& b : boxes) {
+            const Vector3 delta(d(rng), d(rng), d(rng));
+            b = {b.min + delta, b.max + delta};
+        }
+    }
+};
+
+TEST_F(BroadphaseTestFixture, AabbOverlapIncludesTouching) {
+    const Aabb a{{0.0f, 0.0f, 0.0f}, {1.0f, 1.0f, 1.0f}};
+    EXPECT_TRUE(a.overlaps({{1.0f, 0.5f, 0.5f}, {2.0f, 2.0f, 2.0f}}));
+    EXPECT_FALSE(a.overlaps({{1.01f, 0.5f, 0.5f}, {2.0f, 2.0f, 2.0f}}));
+    EXPECT_TRUE(a.expanded(0.5f).contains(a));
+    EXPECT_FLOAT_EQ(a.surfaceArea(), 6.0f);
+}
+
+TEST_F(BroadphaseTestFixture, SweepAndPruneMatchesBruteForceOverFrames) {
+    auto boxes = randomBoxes(500, 1);
+    std::mt19937 rng(7);
+    physics::SweepAndPrune sap;
+    std::vector<BroadphasePair> pairs;
+    for (int frame = 0; frame < 10; ++frame) {
+        sap.update(boxes, pairs);
+        EXPECT_EQ(pairs, bruteForce(boxes)) << "frame " << frame;
+        if (frame > 0) {
+            EXPECT_FALSE(sap.lastUpdateResorted());
+        }
+        moveBoxes(boxes, rng, 0.3f);
+    }
+}
+
+TEST_F(BroadphaseTestFixture, SweepAndPruneHandlesCountChanges) {
+    auto boxes = randomBoxes(300, 2);
+    physics::SweepAndPrune sap;
+    std::vector<BroadphasePair> pairs;
+    sap.update(boxes, pairs);
+
+    boxes.resize(200);
+    sap.update(boxes, pairs);
+    EXPECT_EQ(pairs, bruteForce(boxes));
+
+    const auto more = randomBoxes(250, 3);
+    boxes.insert(boxes.end(), more.begin(), more.end());
+    sap.update(boxes, pairs);
+    EXPECT_EQ(pairs, bruteForce(boxes));
+
+    boxes.clear();
+    sap.update(boxes, pairs);
+    EXPECT_TRUE(pairs.empty());
+}
+
+TEST_F(BroadphaseTestFixture, SweepAndPrunePicksAxisOfGreatestSpread) {
+    std::vector<Aabb> boxes;
+    for (int i = 0; i < 100; ++i) {
+        const float f = static_cast<float>(i);
+        boxes.push_back(Aabb::fromCenterHalfExtents({0.1f * f, 0.0f, 3.0f * f}, {0.5f, 0.5f, 0.5f}));
+    }
+    physics::SweepAndPrune sap;
+    std::vector<BroadphasePair> pairs;
+    sap.update(boxes, pairs);
+    EXPECT_EQ(sap.sweepAxis(), 2);
+    EXPECT_EQ(pairs, bruteForce(boxes));
+    EXPECT_EQ(sap.lastSweepTests(), 0u); // apart along z, so no box overlaps another on the sweep axis
+}
+
+TEST_F(BroadphaseTestFixture, TreeFindsEveryOverlapOverFrames) {
+    auto boxes = randomBoxes(500, 4);
+    std::mt19937 rng(11);
+    physics::DynamicAabbTree tree(0.1f);
+    std::vector<std::int32_t> proxies;
+    for (std::uint32_t i = 0; i < boxes.size(); ++i) proxies.push_back(tree.createProxy(boxes[i], i));
+    ASSERT_TRUE(tree.validate());
+
+    std::vector<BroadphasePair> pairs;
+    for (int frame = 0; frame < 10; ++frame) {
+        tree.findPairs(pairs);
+        EXPECT_TRUE(std::is_sorted(pairs.begin(), pairs.end()));
+        EXPECT_EQ(std::adjacent_find(pairs.begin(), pairs.end()), pairs.end());
+        EXPECT_TRUE(containsAll(pairs, bruteForce(boxes))) << "frame " << frame;
+
+        moveBoxes(boxes, rng, 0.3f);
+        for (std::size_t i = 0; i < boxes.size(); ++i) tree.moveProxy(proxies[i], boxes[i]);
+        ASSERT_TRUE(tree.validate());
+    }
+}
+
+TEST_F(BroadphaseTestFixture, TreeFatPairsMatchBruteForceOnFatBoxes) {
+    auto boxes = randomBoxes(300, 5);
+    physics::DynamicAabbTree tree(0.2f);
+    std::vector<Aabb> fat;
+    for (std::uint32_t i = 0; i < boxes.size(); ++i) {
+        const std::int32_t proxy = tree.createProxy(boxes[i], i);
+        fat.push_back(tree.fatAabb(proxy));
+    }
+    std::vector<BroadphasePair> pairs;
+    tree.findPairs(pairs);
+    EXPECT_EQ(pairs, bruteForce(fat));
+    std::pmr::vector<BroadphasePair> pmrPairs;
+    tree.findPairs(pmrPairs);
+    EXPECT_TRUE(std::equal(pmrPairs.begin(), pmrPairs.end(), pairs.begin(), pairs.end()));
+}
+
+TEST_F(BroadphaseTestFixture, TreeSmallMovesStayInFatBox) {
+    physics::DynamicAabbTree tree(0.5f);
+    const Aabb box{{0.0f, 0.0f, 0.0f}, {1.0f, 1.0f, 1.0f}};
+    const std::int32_t proxy = tree.createProxy(box, 0);
+    const Vector3 nudge(0.2f, 0.0f, 0.0f);
+    EXPECT_FALSE(tree.moveProxy(proxy, {box.min + nudge, box.max + nudge}));
+    const Vector3 jump(100.0f, 0.0f, 0.0f);
+    EXPECT_TRUE(tree.moveProxy(proxy, {box.min + jump, box.max + jump}));
+    EXPECT_TRUE(tree.fatAabb(proxy).contains({box.min + jump, box.max + jump}));
+    EXPECT_TRUE(tree.validate());
+}
+
+TEST_F(BroadphaseTestFixture, TreeDisplacementStretchesAlongMotion) {
+    physics::DynamicAabbTree tree(0.0f, 2.0f);
+    const Aabb box{{0.0f, 0.0f, 0.0f}, {1.0f, 1.0f, 1.0f}};
+    const std::int32_t proxy = tree.createProxy(box, 0);
+    const Vector3 move(-2.0f, 0.0f, 0.0f);
+    tree.moveProxy(proxy, {box.min + move, box.max + move}, move);
+    const Aabb& fat = tree.fatAabb(proxy);
+    EXPECT_FLOAT_EQ(fat.min.x, -6.0f);
+    EXPECT_FLOAT_EQ(fat.max.x, -1.0f);
+}
+
+TEST_F(BroadphaseTestFixture, TreeStaysBalancedAndReusesNodes) {
+    physics::DynamicAabbTree tree;
+    std::vector<std::int32_t> proxies;
+    // Sorted insertion is the worst case for an unbalanced tree
+    for (std::uint32_t i = 0; i < 1024; ++i) {
+        const float f = static_cast<float>(i);
+        proxies.push_back(tree.createProxy({{f, 0.0f, 0.0f}, {f + 0.5f, 0.5f, 0.5f}}, i));
+    }
+    EXPECT_TRUE(tree.validate());
+    EXPECT_LE(tree.height(), 20);
+
+    for (std::size_t i = 0; i < proxies.size(); i += 2) tree.destroyProxy(proxies[i]);
+    EXPECT_EQ(tree.proxyCount(), 512u);
+    EXPECT_TRUE(tree.validate());
+
+    const std::int32_t reused = tree.createProxy({{0.0f, 0.0f, 0.0f}, {1.0f, 1.0f, 1.0f}}, 9999);
+    EXPECT_LT(static_cast<std::size_t>(reused), 2 * proxies.size());
+    EXPECT_TRUE(tree.validate());
+
+    int hits = 0;
+    tree.query({{0.2f, 0.2f, 0.2f}, {0.3f, 0.3f, 0.3f}}, [&](std::uint32_t id) {
+        EXPECT_EQ(id, 9999u);
+        ++hits;
+        return true;
+    });
+    EXPECT_EQ(hits, 1);
+}
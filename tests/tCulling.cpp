@@ -0,0 +1,36 @@
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <random>
+#include "include/Culling.h"
+#include "include/JobSystem.h"
+#include "include/MatrixTransform.h"
+
+class CullingTestFixture : public ::testing::Test {};
+
+TEST_F(CullingTestFixture, ParallelChunksGiveTheSingleThreadedList) {
+    std::mt19937 rng(11);
+    std::uniform_real_distribution<float> position(-100.0f, 100.0f), size(0.1f, 3.0f);
+    math::BoundingSpheres spheres;
+    math::BoundingBoxes boxes;
+    constexpr std::size_t COUNT = 5 * render::OBJECTS_PER_JOB + 123;
+    for (std::size_t i = 0; i < COUNT; ++i) {
+        spheres.pushBack({position(rng), position(rng), position(rng)}, size(rng));
+        boxes.pushBack({position(rng), position(rng), position(rng)}, {size(rng), size(rng), size(rng)});
+    }
+    const math::Frustum frustum = math::extractFrustum(
+        math::perspective(1.2f, 16.0f / 9.0f, 0.1f, 80.0f) * math::lookAt({0.0f, 5.0f, 20.0f}, {0.0f, 0.0f, 0.0f}, {0.0f, 1.0f, 0.0f}));
+
+    math::AlignedArray<std::uint32_t> serial, parallel;
+    core::JobSystem jobs(4);
+    render::cullSpheres(frustum, spheres, serial);
+    render::cullSpheres(frustum, spheres, parallel, &jobs);
+    EXPECT_GT(serial.size(), 1000u);
+    EXPECT_TRUE(std::equal(parallel.begin(), parallel.end(), serial.begin(), serial.end()));
+    EXPECT_TRUE(std::is_sorted(serial.begin(), serial.end()));
+
+    render::cullBoxes(frustum, boxes, serial);
+    render::cullBoxes(frustum, boxes, parallel, &jobs);
+    EXPECT_GT(serial.size(), 1000u);
+    EXPECT_TRUE(std::equal(parallel.begin(), parallel.end(), serial.begin(), serial.end()));
+    for (const std::uint32_t i : serial) EXPECT_TRUE(frustum.intersectsBox(boxes.center.get(i), boxes.extent.get(i)));
+}
@@ -0,0 +1,210 @@
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <set>
+#include <vector>
+#include "include/Components.h"
+#include "include/Ecs.h"
+#include "include/JobSystem.h"
+#include "include/Systems.h"
+
+using math::Vector3;
+using scene::CommandBuffer;
+using scene::Entity;
+using scene::Registry;
+using scene::Renderable;
+using scene::RigidBody;
+using scene::Transform;
+
+class EcsTestFixture : public ::testing::Test {
+protected:
+    struct Health {
+        float value;
+    };
+    struct Sleeping {};
+
+    static Transform at(float x) {
+        Transform t;
+        t.position = {x, 0.0f, 0.0f};
+        return t;
+    }
+
+    // Positions visited by a query, sorted
+    static std::vector<float> xs(Registry& registry) {
+        std::vector<float> out;
+        registry.query<const Transform>().forEach([&](const Transform& t) { out.push_back(t.position.x); });
+        std::sort(out.begin(), out.end());
+        return out;
+    }
+};
+
+TEST_F(EcsTestFixture, CreateGetAndDestroy) {
+    Registry registry;
+    const Entity a = registry.create(at(1.0f), Renderable{2, 3, 0.5f});
+    const Entity b = registry.create(at(2.0f));
+    EXPECT_EQ(registry.size(), 2u);
+    EXPECT_TRUE(registry.has<Renderable>(a));
+    EXPECT_FALSE(registry.has<Renderable>(b));
+    EXPECT_EQ(registry.get<Renderable>(a).material, 3u);
+    EXPECT_EQ(registry.tryGet<Renderable>(b), nullptr);
+
+    registry.destroy(a);
+    EXPECT_FALSE(registry.alive(a));
+    EXPECT_TRUE(registry.alive(b));
+    const Entity c = registry.create(at(3.0f));
+    EXPECT_EQ(c.index, a.index); // index reused under a new generation
+    EXPECT_NE(c, a);
+    EXPECT_FALSE(registry.alive(a));
+    EXPECT_FALSE(registry.alive(scene::NULL_ENTITY));
+}
+
+TEST_F(EcsTestFixture, AddAndRemoveMoveBetweenArchetypes) {
+    Registry registry;
+    const Entity e = registry.create(at(5.0f));
+    registry.add(e, Health{10.0f});
+    registry.add(e, RigidBody{7});
+    EXPECT_EQ(registry.get<Transform>(e).position.x, 5.0f); // carried along
+    EXPECT_EQ(registry.get<Health>(e).value, 10.0f);
+    registry.add(e, Health{4.0f}); // overwrite in place
+    EXPECT_EQ(registry.get<Health>(e).value, 4.0f);
+
+    const std::size_t archetypes = registry.archetypeCount();
+    registry.remove<Health>(e);
+    EXPECT_FALSE(registry.has<Health>(e));
+    EXPECT_EQ(registry.get<RigidBody>(e).body, 7u);
+    registry.remove<Health>(e); // absent: no-op
+    registry.add(e, Health{1.0f});
+    EXPECT_EQ(registry.archetypeCount(), archetypes + 1); // {Transform, RigidBody} was new; the rest cached
+}
+
+TEST_F(EcsTestFixture, ChunksStayDenseAcrossRemovals) {
+    Registry registry;
+    std::vector<Entity> entities;
+    for (int i = 0; i < 5000; ++i) entities.push_back(registry.create(at(static_cast<float>(i)), Health{0.0f}));
+    auto query = registry.query<Transform, Health>();
+    const std::size_t fullChunks = query.chunkCount();
+    EXPECT_GT(fullChunks, 5u);
+
+    // Remove every other entity: the survivors are compacted into fewer chunks
+    for (std::size_t i = 0; i < entities.size(); i += 2) registry.destroy(entities[i]);
+    EXPECT_EQ(query.size(), 2500u);
+    EXPECT_LE(query.chunkCount(), fullChunks / 2 + 1);
+    std::vector<float> expected;
+    for (int i = 1; i < 5000; i += 2) expected.push_back(static_cast<float>(i));
+    EXPECT_EQ(xs(registry), expected);
+    for (std::size_t i = 1; i < entities.size(); i += 2) {
+        EXPECT_EQ(registry.get<Transform>(entities[i]).position.x, static_cast<float>(i));
+    }
+
+    // Every chunk column is contiguous and entity handles match their rows
+    query.forEachChunk([&](std::span<const Entity> chunkEntities, std::span<Transform> transforms, std::span<Health>) {
+        for (std::size_t i = 0; i < chunkEntities.size(); ++i) {
+            EXPECT_EQ(&registry.get<Transform>(chunkEntities[i]), &transforms[i]);
+        }
+    });
+}
+
+TEST_F(EcsTestFixture, CachedQueryPicksUpNewArchetypes) {
+    Registry registry;
+    registry.create(at(1.0f));
+    auto query = registry.query<Transform>(scene::maskOf<Sleeping>());
+    EXPECT_EQ(query.size(), 1u);
+    registry.create(at(2.0f), Renderable{});
+    registry.create(at(3.0f), Sleeping{});
+    const Entity e = registry.create(at(4.0f), Health{1.0f});
+    EXPECT_EQ(query.size(), 3u); // Sleeping excluded
+    registry.add(e, Sleeping{});
+    EXPECT_EQ(query.size(), 2u);
+    EXPECT_EQ(registry.query<const Renderable>().size(), 1u);
+}
+
+TEST_F(EcsTestFixture, CommandBufferDefersStructuralChanges) {
+    Registry registry;
+    for (int i = 0; i < 10; ++i) registry.create(at(static_cast<float>(i)), Health{static_cast<float>(i % 3)});
+    CommandBuffer commands;
+    registry.query<const Transform, const Health>().forEachChunk(
+        [&](std::span<const Entity> entities, std::span<const Transform> transforms, std::span<const Health> health) {
+            for (std::size_t i = 0; i < entities.size(); ++i) {
+                if (health[i].value == 0.0f) {
+                    commands.destroy(entities[i]);
+                    commands.destroy(entities[i]); // second one is skipped
+                    commands.create(at(transforms[i].position.x + 100.0f), Renderable{1, 2, 3.0f});
+                } else if (health[i].value == 1.0f) {
+                    commands.add(entities[i], Sleeping{});
+                    commands.remove<Health>(entities[i]);
+                }
+            }
+        });
+    EXPECT_EQ(registry.size(), 10u);
+    registry.apply(commands);
+    EXPECT_TRUE(commands.empty());
+    EXPECT_EQ(registry.size(), 10u); // 4 destroyed, 4 created
+    EXPECT_EQ(registry.query<Health>().size(), 3u);
+    EXPECT_EQ(registry.query<Sleeping>().size(), 3u);
+    std::vector<float> created;
+    registry.query<const Transform, const Renderable>().forEach([&](const Transform& t, const Renderable& r) {
+        EXPECT_EQ(r.material, 2u);
+        EXPECT_EQ(r.boundingRadius, 3.0f);
+        created.push_back(t.position.x);
+    });
+    std::sort(created.begin(), created.end());
+    EXPECT_EQ(created, (std::vector<float>{100.0f, 103.0f, 106.0f, 109.0f}));
+}
+
+TEST_F(EcsTestFixture, ParallelSystemsMatchSerial) {
+    core::JobSystem jobs(3);
+    Registry serial;
+    Registry parallel;
+    for (int i = 0; i < 20000; ++i) {
+        serial.create(at(static_cast<float>(i)), Health{static_cast<float>(i % 7)});
+        parallel.create(at(static_cast<float>(i)), Health{static_cast<float>(i % 7)});
+    }
+    auto system = [](Transform& t, Health& h) {
+        t.position.y += h.value * 0.5f;
+        h.value -= 1.0f;
+    };
+    serial.query<Transform, Health>().forEach(system);
+    auto query = parallel.query<Transform, Health>();
+    query.parallelForEach(&jobs, system);
+
+    // Per-chunk command buffers applied in chunk order give the serial result
+    std::vector<CommandBuffer> buffers(query.chunkCount());
+    query.parallelForEachChunk(&jobs, [&](std::size_t chunk, std::span<const Entity> entities, std::span<Transform>,
+                                          std::span<Health> health) {
+        for (std::size_t i = 0; i < entities.size(); ++i) {
+            if (health[i].value < 0.0f) buffers[chunk].destroy(entities[i]);
+        }
+    });
+    for (CommandBuffer& buffer : buffers) parallel.apply(buffer);
+    CommandBuffer serialBuffer;
+    serial.query<const Health>().forEachChunk([&](std::span<const Entity> entities, std::span<const Health> health) {
+        for (std::size_t i = 0; i < entities.size(); ++i) {
+            if (health[i].value < 0.0f) serialBuffer.destroy(entities[i]);
+        }
+    });
+    serial.apply(serialBuffer);
+
+    std::vector<float> a, b;
+    serial.query<const Transform>().forEach([&](const Transform& t) { a.push_back(t.position.y); });
+    parallel.query<const Transform>().forEach([&](const Transform& t) { b.push_back(t.position.y); });
+    EXPECT_EQ(a.size(), 20000u - 20000u / 7 - 1u);
+    EXPECT_EQ(a, b); // same order, not just the same set
+}
+
+TEST_F(EcsTestFixture, SyncTransformsCopiesBodyPoses) {
+    physics::RigidBodies bodies;
+    physics::BodyDesc desc;
+    desc.position = {1.0f, 2.0f, 3.0f};
+    desc.orientation = math::Quaternion::axisAngle({0, 1, 0}, 0.5f);
+    const auto body = static_cast<std::uint32_t>(bodies.add(desc));
+    Registry registry;
+    Transform scaled = at(0.0f);
+    scaled.scale = {2.0f, 2.0f, 2.0f};
+    const Entity e = registry.create(scaled, RigidBody{body});
+    const Entity still = registry.create(at(9.0f));
+    scene::syncTransforms(registry, bodies);
+    const Transform& t = registry.get<Transform>(e);
+    EXPECT_EQ(t.position.y, 2.0f);
+    EXPECT_EQ(t.rotation.y, desc.orientation.y);
+    EXPECT_EQ(t.scale.x, 2.0f);
+    EXPECT_EQ(registry.get<Transform>(still).position.x, 9.0f);
+}
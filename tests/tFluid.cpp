@@ -0,0 +1,150 @@
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <numbers>
+#include <vector>
+#include "include/Fluid.h"
+#include "include/JobSystem.h"
+#include "include/Simd.h"
+
+using math::Vector3;
+using physics::FluidSettings;
+using physics::SphFluid;
+
+class FluidTestFixture : public ::testing::Test {
+protected:
+    void SetUp() override {
+        original = math::simd::activeBackend();
+    }
+
+    void TearDown() override {
+        math::simd::setBackend(original);
+    }
+
+    // Water column against one wall of the default container
+    static void damBreak(SphFluid& fluid) {
+        fluid.addBlock({-0.5f, 0.0f, -0.2f}, {-0.25f, 0.3f, 0.2f});
+    }
+
+    static std::vector<float> state(const SphFluid& fluid) {
+        std::vector<float> out;
+        for (std::size_t i = 0; i < fluid.size(); ++i) {
+            const Vector3 p = fluid.position.get(i), v = fluid.velocity.get(i);
+            out.insert(out.end(), {p.x, p.y, p.z, v.x, v.y, v.z, fluid.density[i]});
+        }
+        return out;
+    }
+
+    // O(n^2) reference for the poly6 density
+    static float bruteForceDensity(const SphFluid& fluid, std::size_t i) {
+        const FluidSettings& s = fluid.settings();
+        const float h2 = s.smoothingRadius * s.smoothingRadius;
+        double sum = 0.0;
+        for (std::size_t j = 0; j < fluid.size(); ++j) {
+            const float r2 = (fluid.position.get(i) - fluid.position.get(j)).lengthSquared();
+            if (r2 < h2) sum += std::pow(h2 - r2, 3.0);
+        }
+        return static_cast<float>(s.particleMass * 315.0 / (64.0 * std::numbers::pi * std::pow(s.smoothingRadius, 9.0)) * sum);
+    }
+
+    math::simd::Backend original = math::simd::Backend::Scalar;
+};
+
+TEST_F(FluidTestFixture, GridSortsParticlesByCell) {
+    SphFluid fluid;
+    // Scattered particles, some outside the container (clamped into edge cells)
+    for (int i = 0; i < 500; ++i) {
+        const float t = static_cast<float>(i);
+        fluid.add({std::sin(t * 1.3f) * 0.6f, std::fmod(t * 0.037f, 1.2f) - 0.1f, std::cos(t * 0.7f) * 0.55f});
+    }
+    fluid.buildGrid();
+    const std::vector<std::uint32_t>& start = fluid.cellStart();
+    ASSERT_EQ(start.size(), fluid.cellCount() + 1);
+    EXPECT_EQ(start.back(), fluid.size());
+    for (std::size_t c = 0; c < fluid.cellCount(); ++c) {
+        for (std::uint32_t i = start[c]; i < start[c + 1]; ++i) {
+            ASSERT_EQ(fluid.cellOf(fluid.position.get(i)), c) << "particle " << i;
+        }
+    }
+}
+
+TEST_F(FluidTestFixture, DensityMatchesBruteForce) {
+    SphFluid fluid;
+    fluid.addBlock({-0.1f, 0.0f, -0.1f}, {0.1f, 0.2f, 0.1f});
+    // Break the lattice symmetry
+    for (std::size_t i = 0; i < fluid.size(); ++i) {
+        const float t = static_cast<float>(i);
+        fluid.position.set(i, fluid.position.get(i) + Vector3{std::sin(t), std::cos(t * 1.7f), std::sin(t * 2.3f)} * 0.005f);
+    }
+    fluid.buildGrid();
+    fluid.computeDensity();
+    for (std::size_t i = 0; i < fluid.size(); i += 7) {
+        EXPECT_NEAR(fluid.density[i], bruteForceDensity(fluid, i), 1e-3f * fluid.density[i]) << i;
+    }
+}
+
+TEST_F(FluidTestFixture, PressurePushesCompressedClusterApart) {
+    SphFluid fluid;
+    const float h = fluid.settings().smoothingRadius;
+    // A tight cluster: far above rest density, so it must expand
+    for (int i = 0; i < 8; ++i) {
+        fluid.add({(i & 1) * 0.2f * h, 0.5f + ((i >> 1) & 1) * 0.2f * h, ((i >> 2) & 1) * 0.2f * h});
+    }
+    fluid.buildGrid();
+    fluid.computeDensity();
+    fluid.computeForces();
+    for (std::size_t i = 0; i < fluid.size(); ++i) {
+        EXPECT_GT(fluid.pressure[i], 0.0f);
+        const Vector3 p = fluid.position.get(i), a = fluid.acceleration.get(i) - fluid.settings().gravity;
+        const Vector3 fromCenter = p - Vector3{0.1f * h, 0.5f + 0.1f * h, 0.1f * h};
+        EXPECT_GT(a.dot(fromCenter), 0.0f) << i;
+    }
+}
+
+TEST_F(FluidTestFixture, DamBreakSettlesInsideContainer) {
+    SphFluid fluid;
+    damBreak(fluid);
+    const std::size_t count = fluid.size();
+    ASSERT_GT(count, 1000u);
+    // 2 s of simulated time
+    for (int i = 0; i < 1000; ++i) fluid.step(1.0f / 500.0f);
+    ASSERT_EQ(fluid.size(), count);
+
+    const FluidSettings& s = fluid.settings();
+    float maxSpeed = 0.0f, meanDensity = 0.0f, meanX = 0.0f;
+    for (std::size_t i = 0; i < count; ++i) {
+        const Vector3 p = fluid.position.get(i);
+        ASSERT_TRUE(std::isfinite(p.x) && std::isfinite(p.y) && std::isfinite(p.z));
+        EXPECT_GE(p.x, s.boundsMin.x);
+        EXPECT_LE(p.x, s.boundsMax.x);
+        EXPECT_GE(p.y, s.boundsMin.y);
+        maxSpeed = std::max(maxSpeed, fluid.velocity.get(i).length());
+        meanDensity += fluid.density[i];
+        meanX += p.x;
+    }
+    meanDensity /= static_cast<float>(count);
+    meanX /= static_cast<float>(count);
+    EXPECT_GT(meanX, -0.3f);                               // spread out across the floor
+    EXPECT_LT(maxSpeed, 1.0f);                             // calming down
+    EXPECT_NEAR(meanDensity, s.restDensity, 0.1f * s.restDensity); // weakly compressible
+}
+
+TEST_F(FluidTestFixture, ThreadsAndBackendsGiveIdenticalResults) {
+    SphFluid serial;
+    damBreak(serial);
+    for (int i = 0; i < 20; ++i) serial.step(1.0f / 500.0f);
+    const std::vector<float> expected = state(serial);
+
+    core::JobSystem jobs(3);
+    SphFluid parallel;
+    damBreak(parallel);
+    for (int i = 0; i < 20; ++i) parallel.step(1.0f / 500.0f, &jobs);
+    EXPECT_EQ(std::memcmp(expected.data(), state(parallel).data(), expected.size() * sizeof(float)), 0);
+
+    ASSERT_TRUE(math::simd::setBackend(math::simd::Backend::Scalar));
+    SphFluid scalar;
+    damBreak(scalar);
+    for (int i = 0; i < 20; ++i) scalar.step(1.0f / 500.0f);
+    EXPECT_EQ(std::memcmp(expected.data(), state(scalar).data(), expected.size() * sizeof(float)), 0);
+}
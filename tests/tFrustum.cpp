@@ -0,0 +1,142 @@
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <cmath>
+#include <numbers>
+#include <random>
+#include <vector>
+#include "include/Frustum.h"
+#include "include/MatrixTransform.h"
+#include "include/Simd.h"
+
+using math::BoundingBoxes;
+using math::BoundingSpheres;
+using math::ClipDepth;
+using math::Frustum;
+using math::Vector3;
+using math::simd::Backend;
+
+class FrustumTestFixture : public ::testing::Test {
+protected:
+    void SetUp() override {
+        original = math::simd::activeBackend();
+    }
+
+    void TearDown() override {
+        math::simd::setBackend(original);
+    }
+
+    static constexpr float FOV = std::numbers::pi_v<float> / 2.0f;
+
+    // Camera at the origin looking down -Z, 90 degree field of view, near 1, far 100
+    static Frustum camera() {
+        return math::extractFrustum(math::perspective(FOV, 1.0f, 1.0f, 100.0f) *
+                                    math::lookAt({0.0f, 0.0f, 0.0f}, {0.0f, 0.0f, -1.0f}, {0.0f, 1.0f, 0.0f}));
+    }
+
+    static Frustum tilted() {
+        return math::extractFrustum(math::perspective(1.0f, 1.5f, 0.5f, 60.0f) *
+                                    math::lookAt({3.0f, 2.0f, 5.0f}, {-1.0f, 0.0f, -4.0f}, {0.0f, 1.0f, 0.0f}));
+    }
+
+    static BoundingSpheres randomSpheres(std::size_t count) {
+        std::mt19937 rng(42);
+        std::uniform_real_distribution<float> position(-60.0f, 60.0f), radius(0.1f, 5.0f);
+        BoundingSpheres spheres;
+        for (std::size_t i = 0; i < count; ++i) spheres.pushBack({position(rng), position(rng), position(rng)}, radius(rng));
+        return spheres;
+    }
+
+    static BoundingBoxes randomBoxes(std::size_t count) {
+        std::mt19937 rng(7);
+        std::uniform_real_distribution<float> position(-60.0f, 60.0f), extent(0.1f, 5.0f);
+        BoundingBoxes boxes;
+        for (std::size_t i = 0; i < count; ++i) {
+            boxes.pushBack({position(rng), position(rng), position(rng)}, {extent(rng), extent(rng), extent(rng)});
+        }
+        return boxes;
+    }
+
+    Backend original{};
+};
+
+TEST_F(FrustumTestFixture, PlanesAgreeWithClipSpaceForEveryProjection) {
+    const mat4 view = math::lookAt({1.0f, 2.0f, 3.0f}, {0.0f, 0.0f, -5.0f}, {0.0f, 1.0f, 0.0f});
+    struct Case {
+        mat4 projection;
+        ClipDepth depth;
+    };
+    const Case cases[] = {
+        {math::perspective(1.0f, 1.3f, 0.5f, 30.0f), ClipDepth::MinusOneToOne},
+        {math::perspectiveInfinite(1.0f, 1.3f, 0.5f), ClipDepth::MinusOneToOne},
+        {math::perspectiveReversedZ(1.0f, 1.3f, 0.5f, 30.0f), ClipDepth::ZeroToOne},
+        {math::perspectiveInfiniteReversedZ(1.0f, 1.3f, 0.5f), ClipDepth::ZeroToOne},
+        {math::ortho(-4.0f, 6.0f, -3.0f, 2.0f, 0.5f, 30.0f), ClipDepth::MinusOneToOne},
+    };
+    std::mt19937 rng(3);
+    std::uniform_real_distribution<float> coordinate(-40.0f, 40.0f);
+    for (const Case& c : cases) {
+        const mat4 viewProjection = c.projection * view;
+        const Frustum frustum = math::extractFrustum(viewProjection, c.depth);
+        std::size_t inside = 0;
+        for (int i = 0; i < 20000; ++i) {
+            const Vector3 p{coordinate(rng), coordinate(rng), coordinate(rng)};
+            const math::Vector4 clip = viewProjection * math::Vector4(p.x, p.y, p.z, 1.0f);
+            const float lowZ = c.depth == ClipDepth::ZeroToOne ? 0.0f : -clip.w;
+            const bool clipInside = clip.w > 0.0f && std::abs(clip.x) <= clip.w && std::abs(clip.y) <= clip.w &&
+                                    clip.z >= lowZ && clip.z <= clip.w;
+            float nearest = std::numeric_limits<float>::max();
+            bool planesInside = true;
+            for (const math::Plane& plane : frustum.planes) {
+                const float distance = plane.distance(p);
+                planesInside = planesInside && distance >= 0.0f;
+                if (plane.normal.lengthSquared() > 0.0f) nearest = std::min(nearest, std::abs(distance));
+            }
+            if (nearest < 1e-3f) continue; // too close to a plane for float rounding to agree
+            EXPECT_EQ(planesInside, clipInside) << p.x << " " << p.y << " " << p.z;
+            inside += clipInside;
+        }
+        EXPECT_GT(inside, 20u);
+    }
+}
+
+TEST_F(FrustumTestFixture, BoundsStraddlingPlanesStayVisible) {
+    const Frustum f = camera();
+    EXPECT_TRUE(f.intersectsSphere({0.0f, 0.0f, -10.0f}, 1.0f));
+    EXPECT_FALSE(f.intersectsSphere({0.0f, 0.0f, 10.0f}, 1.0f));   // behind
+    EXPECT_TRUE(f.intersectsSphere({0.0f, 0.0f, -0.5f}, 1.0f));    // across the near plane
+    EXPECT_FALSE(f.intersectsSphere({0.0f, 0.0f, -0.5f}, 0.2f));   // in front of it
+    EXPECT_FALSE(f.intersectsSphere({0.0f, 0.0f, -200.0f}, 50.0f)); // beyond the far plane
+    EXPECT_TRUE(f.intersectsSphere({0.0f, 0.0f, -120.0f}, 30.0f));
+    // Centre 10 / sqrt(2) outside the right plane (x = -z)
+    EXPECT_FALSE(f.intersectsBox({20.0f, 0.0f, -10.0f}, {1.0f, 1.0f, 1.0f}));
+    EXPECT_TRUE(f.intersectsBox({20.0f, 0.0f, -10.0f}, {11.0f, 1.0f, 1.0f}));
+    EXPECT_TRUE(f.intersectsBox({0.0f, 0.0f, 0.0f}, {0.5f, 0.5f, 2.0f}));
+}
+
+TEST_F(FrustumTestFixture, KernelsMatchPerObjectTestsOnEveryBackend) {
+    const Frustum frustum = tilted();
+    const BoundingSpheres spheres = randomSpheres(1003);
+    const BoundingBoxes boxes = randomBoxes(1003);
+    const std::pair<std::size_t, std::size_t> ranges[] = {{0, 1003}, {5, 998}, {13, 13}, {100, 107}};
+    for (const auto& [first, last] : ranges) {
+        std::vector<std::uint32_t> expectedSpheres, expectedBoxes;
+        for (std::size_t i = first; i < last; ++i) {
+            if (frustum.intersectsSphere(spheres.center.get(i), spheres.radius[i])) expectedSpheres.push_back(static_cast<std::uint32_t>(i));
+            if (frustum.intersectsBox(boxes.center.get(i), boxes.extent.get(i))) expectedBoxes.push_back(static_cast<std::uint32_t>(i));
+        }
+        if (last - first > 500) {
+            EXPECT_GT(expectedSpheres.size(), 10u);
+            EXPECT_LT(expectedSpheres.size(), last - first - 10);
+        }
+        for (Backend backend : {Backend::Scalar, Backend::Sse, Backend::Avx}) {
+            if (!math::simd::setBackend(backend)) continue;
+            SCOPED_TRACE(math::simd::backendName(backend));
+            std::vector<std::uint32_t> visible(last - first);
+            visible.resize(math::cullSpheres(frustum, spheres, first, last, visible.data()));
+            EXPECT_EQ(visible, expectedSpheres);
+            visible.assign(last - first, 0);
+            visible.resize(math::cullBoxes(frustum, boxes, first, last, visible.data()));
+            EXPECT_EQ(visible, expectedBoxes);
+        }
+    }
+}
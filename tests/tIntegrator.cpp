@@ -0,0 +1,180 @@
+#include <gtest/gtest.h>
+#include <cstring>
+#include <vector>
+#include "include/Integrator.h"
+#include "include/JobSystem.h"
+#include "include/Simd.h"
+#include "include/World.h"
+
+using math::Quaternion;
+using math::Vector3;
+using physics::BodyDesc;
+using physics::IntegratorSettings;
+using physics::RigidBodies;
+
+class IntegratorTestFixture : public ::testing::Test {
+protected:
+    void SetUp() override {
+        original = math::simd::activeBackend();
+    }
+
+    void TearDown() override {
+        math::simd::setBackend(original);
+    }
+
+    static RigidBodies makeBodies(int count) {
+        RigidBodies bodies;
+        for (int i = 0; i < count; ++i) {
+            const float f = static_cast<float>(i);
+            BodyDesc d;
+            d.position = {f, 2.0f * f, -f};
+            d.orientation = Quaternion::axisAngle(Vector3(1.0f, f, 2.0f).normalized(), 0.1f * f);
+            d.linearVelocity = {0.5f * f, 1.0f, 0.0f};
+            d.angularVelocity = {0.1f * f, -0.2f, 0.3f};
+            d.mass = (i % 7 == 0) ? 0.0f : 1.0f + f;
+            d.inertia = {1.0f + f, 2.0f, 3.0f};
+            bodies.add(d);
+            bodies.applyTorque(static_cast<std::size_t>(i), {f, 1.0f, -f});
+        }
+        return bodies;
+    }
+
+    static constexpr float DT = 1.0f / 60.0f;
+    math::simd::Backend original = math::simd::Backend::Scalar;
+};
+
+TEST_F(IntegratorTestFixture, FreeFallMatchesSemiImplicitEuler) {
+    RigidBodies bodies;
+    bodies.add({});
+    const IntegratorSettings settings;
+    const int steps = 60;
+    for (int i = 0; i < steps; ++i) physics::integrate(bodies, DT, settings);
+    // v_n = g n dt, x_n = g dt^2 n (n + 1) / 2
+    const float g = settings.gravity.y;
+    EXPECT_NEAR(bodies.linearVelocity.get(0).y, g * steps * DT, 1e-4f);
+    EXPECT_NEAR(bodies.position.get(0).y, g * DT * DT * steps * (steps + 1) / 2.0f, 1e-4f);
+}
+
+TEST_F(IntegratorTestFixture, StaticBodiesDoNotMove) {
+    RigidBodies bodies;
+    BodyDesc d;
+    d.mass = 0.0f;
+    d.position = {1.0f, 2.0f, 3.0f};
+    bodies.add(d);
+    bodies.applyForce(0, {100.0f, 0.0f, 0.0f});
+    physics::integrate(bodies, DT, {});
+    EXPECT_EQ(bodies.position.get(0).x, 1.0f);
+    EXPECT_EQ(bodies.position.get(0).y, 2.0f);
+}
+
+TEST_F(IntegratorTestFixture, TorqueUsesWorldSpaceInertia) {
+    // Inertia is 4 about body x; rotate the body so body x points along world y
+    RigidBodies bodies;
+    BodyDesc d;
+    d.orientation = Quaternion::axisAngle({0.0f, 0.0f, 1.0f}, 1.5707963f);
+    d.inertia = {4.0f, 1.0f, 1.0f};
+    bodies.add(d);
+    bodies.applyTorque(0, {0.0f, 8.0f, 0.0f});
+    physics::integrateVelocities(bodies, DT, {});
+    const Vector3 w = bodies.angularVelocity.get(0);
+    EXPECT_NEAR(w.y, 2.0f * DT, 1e-6f);
+    EXPECT_NEAR(w.x, 0.0f, 1e-6f);
+}
+
+TEST_F(IntegratorTestFixture, ConstantSpinMatchesAxisAngle) {
+    RigidBodies bodies;
+    BodyDesc d;
+    d.angularVelocity = {0.0f, 2.0f, 0.0f};
+    bodies.add(d);
+    const int steps = 120;
+    for (int i = 0; i < steps; ++i) physics::integratePositions(bodies, DT);
+    const Quaternion expected = Quaternion::axisAngle({0.0f, 1.0f, 0.0f}, 2.0f * steps * DT);
+    EXPECT_NEAR(std::abs(bodies.orientation(0).dot(expected)), 1.0f, 1e-4f);
+    EXPECT_NEAR(bodies.orientation(0).length(), 1.0f, 1e-6f);
+}
+
+TEST_F(IntegratorTestFixture, SpringEnergyStaysBounded) {
+    // Symplectic Euler keeps a harmonic oscillator's energy bounded over many periods
+    RigidBodies bodies;
+    BodyDesc d;
+    d.position = {1.0f, 0.0f, 0.0f};
+    bodies.add(d);
+    IntegratorSettings settings;
+    settings.gravity = {};
+    const float k = 40.0f;
+    const float initialEnergy = 0.5f * k;
+    for (int i = 0; i < 6000; ++i) {
+        bodies.clearForces();
+        bodies.applyForce(0, bodies.position.get(0) * -k);
+        physics::integrate(bodies, DT, settings);
+    }
+    const float x = bodies.position.get(0).x, v = bodies.linearVelocity.get(0).x;
+    const float energy = 0.5f * k * x * x + 0.5f * v * v;
+    EXPECT_NEAR(energy, initialEnergy, 0.1f * initialEnergy);
+}
+
+TEST_F(IntegratorTestFixture, DampingSlowsBodies) {
+    RigidBodies bodies;
+    BodyDesc d;
+    d.linearVelocity = {10.0f, 0.0f, 0.0f};
+    bodies.add(d);
+    IntegratorSettings settings;
+    settings.gravity = {};
+    settings.linearDamping = 1.0f;
+    physics::integrateVelocities(bodies, DT, settings);
+    EXPECT_NEAR(bodies.linearVelocity.get(0).x, 10.0f / (1.0f + DT), 1e-5f);
+}
+
+TEST_F(IntegratorTestFixture, ScalarBackendIsBitIdentical) {
+    RigidBodies simd = makeBodies(37);
+    RigidBodies scalar = makeBodies(37);
+    physics::integrate(simd, DT, {});
+    ASSERT_TRUE(math::simd::setBackend(math::simd::Backend::Scalar));
+    physics::integrate(scalar, DT, {});
+    const auto same = [](const float* a, const float* b, std::size_t n) { return std::memcmp(a, b, n * sizeof(float)) == 0; };
+    EXPECT_TRUE(same(simd.position.y(), scalar.position.y(), 37));
+    EXPECT_TRUE(same(simd.angularVelocity.x(), scalar.angularVelocity.x(), 37));
+    EXPECT_TRUE(same(simd.qw.data(), scalar.qw.data(), 37));
+    EXPECT_TRUE(same(simd.qx.data(), scalar.qx.data(), 37));
+}
+
+TEST_F(IntegratorTestFixture, FixedTimestepAccumulates) {
+    physics::FixedTimestep clock(0.01f, 4);
+    EXPECT_EQ(clock.advance(0.025f), 2);
+    EXPECT_NEAR(clock.alpha(), 0.5f, 1e-4f);
+    EXPECT_EQ(clock.advance(0.006f), 1);
+    // A long hitch is clamped and the excess dropped
+    EXPECT_EQ(clock.advance(1.0f), 4);
+    EXPECT_EQ(clock.alpha(), 0.0f);
+}
+
+TEST_F(IntegratorTestFixture, WorldUpdateStepsAndClearsForces) {
+    physics::WorldSettings settings;
+    settings.fixedStep = 0.01f;
+    physics::World world(settings);
+    world.bodies().add({});
+    world.bodies().applyForce(0, {1.0f, 0.0f, 0.0f});
+    EXPECT_EQ(world.update(0.035f), 3);
+    EXPECT_EQ(world.bodies().force.get(0).x, 0.0f);
+    EXPECT_NEAR(world.bodies().linearVelocity.get(0).x, 0.03f, 1e-6f);
+    EXPECT_LT(world.bodies().linearVelocity.get(0).y, 0.0f);
+}
+
+TEST_F(IntegratorTestFixture, WorldStepIsIdenticalOnJobSystem) {
+    const int count = 3 * static_cast<int>(physics::World::BODIES_PER_JOB) + 5;
+    physics::World serial;
+    physics::World parallel;
+    serial.bodies() = makeBodies(count);
+    parallel.bodies() = makeBodies(count);
+    core::JobSystem jobs(4);
+    parallel.setJobSystem(&jobs);
+    for (int i = 0; i < 5; ++i) {
+        serial.step();
+        parallel.step();
+    }
+    const auto same = [](const float* a, const float* b, std::size_t n) { return std::memcmp(a, b, n * sizeof(float)) == 0; };
+    const auto n = static_cast<std::size_t>(count);
+    EXPECT_TRUE(same(serial.bodies().position.x(), parallel.bodies().position.x(), n));
+    EXPECT_TRUE(same(serial.bodies().linearVelocity.y(), parallel.bodies().linearVelocity.y(), n));
+    EXPECT_TRUE(same(serial.bodies().qz.data(), parallel.bodies().qz.data(), n));
+}
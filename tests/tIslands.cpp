@@ -0,0 +1,80 @@
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <vector>
+#include "include/Islands.h"
+
+using physics::BodyDesc;
+using physics::BroadphasePair;
+using physics::Islands;
+using physics::RigidBodies;
+
+class IslandsTestFixture : public ::testing::Test {
+protected:
+    // Bodies 0..n-1; the listed ones are static
+    static RigidBodies makeBodies(int count, std::vector<int> statics = {}) {
+        RigidBodies bodies;
+        for (int i = 0; i < count; ++i) {
+            BodyDesc d;
+            d.mass = std::find(statics.begin(), statics.end(), i) != statics.end() ? 0.0f : 1.0f;
+            bodies.add(d);
+        }
+        return bodies;
+    }
+
+    static std::vector<std::uint32_t> toVector(std::span<const std::uint32_t> s) {
+        return {s.begin(), s.end()};
+    }
+};
+
+TEST_F(IslandsTestFixture, ChainsFormOneIsland) {
+    const RigidBodies bodies = makeBodies(6);
+    const std::vector<BroadphasePair> links = {{4, 5}, {0, 2}, {2, 3}};
+    Islands islands;
+    islands.build(bodies, links);
+    ASSERT_EQ(islands.count(), 3u); // {0,2,3}, {1}, {4,5}
+    EXPECT_EQ(toVector(islands.bodies(0)), (std::vector<std::uint32_t>{0, 2, 3}));
+    EXPECT_EQ(toVector(islands.links(0)), (std::vector<std::uint32_t>{1, 2}));
+    EXPECT_EQ(toVector(islands.bodies(1)), (std::vector<std::uint32_t>{1}));
+    EXPECT_TRUE(islands.links(1).empty());
+    EXPECT_EQ(toVector(islands.bodies(2)), (std::vector<std::uint32_t>{4, 5}));
+    EXPECT_EQ(toVector(islands.links(2)), (std::vector<std::uint32_t>{0}));
+    EXPECT_EQ(islands.islandOf(3), 0u);
+}
+
+TEST_F(IslandsTestFixture, StaticBodiesDoNotMergeIslands) {
+    // Two boxes resting on the same ground (body 0) stay independent
+    const RigidBodies bodies = makeBodies(3, {0});
+    const std::vector<BroadphasePair> links = {{0, 1}, {0, 2}};
+    Islands islands;
+    islands.build(bodies, links);
+    ASSERT_EQ(islands.count(), 2u);
+    EXPECT_EQ(islands.islandOf(0), Islands::NONE);
+    EXPECT_EQ(toVector(islands.links(0)), (std::vector<std::uint32_t>{0}));
+    EXPECT_EQ(toVector(islands.links(1)), (std::vector<std::uint32_t>{1}));
+}
+
+TEST_F(IslandsTestFixture, EveryLinkAndDynamicBodyAppearsOnce) {
+    const int count = 200;
+    const RigidBodies bodies = makeBodies(count, {0, 17, 99});
+    std::vector<BroadphasePair> links;
+    for (std::uint32_t i = 0; i + 3 < count; i += 2) links.push_back({i, i + 3});
+    links.push_back({0, 17}); // static-static: belongs to no island
+    Islands islands;
+    islands.build(bodies, links);
+
+    std::vector<int> bodySeen(count, 0), linkSeen(links.size(), 0);
+    for (std::size_t k = 0; k < islands.count(); ++k) {
+        for (std::uint32_t b : islands.bodies(k)) {
+            ++bodySeen[b];
+            EXPECT_EQ(islands.islandOf(b), k);
+        }
+        for (std::uint32_t l : islands.links(k)) {
+            ++linkSeen[l];
+            const BroadphasePair& link = links[l];
+            EXPECT_TRUE(islands.islandOf(link.a) == k || islands.islandOf(link.b) == k);
+        }
+    }
+    for (int i = 0; i < count; ++i) EXPECT_EQ(bodySeen[i], bodies.isStatic(i) ? 0 : 1) << i;
+    for (std::size_t l = 0; l + 1 < links.size(); ++l) EXPECT_EQ(linkSeen[l], 1) << l;
+    EXPECT_EQ(linkSeen.back(), 0);
+}
@@ -0,0 +1,143 @@
+#include <gtest/gtest.h>
+#include <atomic>
+#include <numeric>
+#include <thread>
+#include <vector>
+#include "include/JobSystem.h"
+#include "include/TaskGraph.h"
+
+using core::Job;
+using core::JobCounter;
+using core::JobSystem;
+using core::TaskGraph;
+
+class JobSystemTestFixture : public ::testing::Test {
+protected:
+    struct CountJob : Job {
+        std::atomic<int>* hits = nullptr;
+    };
+
+    static void countExecute(Job& job) {
+        static_cast<CountJob&>(job).hits->fetch_add(1);
+    }
+};
+
+TEST_F(JobSystemTestFixture, SubmittedJobsAllRun) {
+    JobSystem jobs(4);
+    EXPECT_EQ(jobs.threadCount(), 4u);
+    std::atomic<int> hits{0};
+    std::vector<CountJob> batch(10000); // more than one deque holds
+    JobCounter counter;
+    for (CountJob& job : batch) {
+        job.execute = &JobSystemTestFixture::countExecute;
+        job.hits = &hits;
+        jobs.submit(job, counter);
+    }
+    jobs.wait(counter);
+    EXPECT_TRUE(counter.done());
+    EXPECT_EQ(hits.load(), 10000);
+}
+
+TEST_F(JobSystemTestFixture, ForeignThreadsCanSubmit) {
+    JobSystem jobs(3);
+    std::atomic<int> hits{0};
+    std::thread foreign([&] {
+        EXPECT_EQ(jobs.currentThreadIndex(), -1);
+        std::vector<CountJob> batch(100);
+        JobCounter counter;
+        for (CountJob& job : batch) {
+            job.execute = &JobSystemTestFixture::countExecute;
+            job.hits = &hits;
+            jobs.submit(job, counter);
+        }
+        jobs.wait(counter);
+    });
+    foreign.join();
+    EXPECT_EQ(hits.load(), 100);
+}
+
+TEST_F(JobSystemTestFixture, ParallelForCoversRangeInFixedChunks) {
+    for (unsigned threads : {1u, 2u, 8u}) {
+        JobSystem jobs(threads);
+        std::vector<int> touched(10007, 0);
+        std::vector<std::size_t> chunkStarts(10007, 0);
+        jobs.parallelFor(3, touched.size(), 100, [&](std::size_t begin, std::size_t end) {
+            EXPECT_EQ((begin - 3) % 100, 0u);
+            EXPECT_TRUE(end - begin == 100 || end == touched.size());
+            for (std::size_t i = begin; i < end; ++i) {
+                ++touched[i];
+                chunkStarts[i] = begin;
+            }
+        });
+        EXPECT_EQ(std::accumulate(touched.begin(), touched.end(), 0), 10004) << threads;
+        EXPECT_EQ(touched[2], 0);
+        EXPECT_EQ(chunkStarts[250], 203u);
+        EXPECT_EQ(jobs.splitLoops(), threads > 1 ? 1u : 0u);
+        jobs.parallelFor(0, 100, 100, [](std::size_t, std::size_t) {}); // one chunk: inline
+        EXPECT_EQ(jobs.splitLoops(), threads > 1 ? 1u : 0u);
+    }
+}
+
+TEST_F(JobSystemTestFixture, NestedParallelForCompletes) {
+    JobSystem jobs(4);
+    std::atomic<long> sum{0};
+    jobs.parallelFor(0, 16, 1, [&](std::size_t outerBegin, std::size_t) {
+        jobs.parallelFor(0, 1000, 10, [&](std::size_t begin, std::size_t end) {
+            long local = 0;
+            for (std::size_t i = begin; i < end; ++i) local += static_cast<long>(i + outerBegin);
+            sum += local;
+        });
+    });
+    // sum over outer o of (sum i + 1000 o)
+    EXPECT_EQ(sum.load(), 16L * 499500L + 1000L * 120L);
+}
+
+TEST_F(JobSystemTestFixture, EmptyRangeDoesNothing) {
+    JobSystem jobs(2);
+    bool called = false;
+    jobs.parallelFor(5, 5, 1, [&](std::size_t, std::size_t) { called = true; });
+    EXPECT_FALSE(called);
+}
+
+TEST_F(JobSystemTestFixture, TaskGraphRespectsDependencies) {
+    JobSystem jobs(4);
+    std::atomic<int> clock{0};
+    int order[5] = {};
+    TaskGraph graph;
+    // a -> {b, c} -> d, e independent
+    const auto a = graph.add([&] { order[0] = clock++; });
+    const auto b = graph.add([&] { order[1] = clock++; });
+    const auto c = graph.add([&] { order[2] = clock++; });
+    const auto d = graph.add([&] { order[3] = clock++; });
+    graph.add([&] { order[4] = clock++; });
+    graph.precede(a, b);
+    graph.precede(a, c);
+    graph.precede(b, d);
+    graph.precede(c, d);
+
+    for (int run = 0; run < 3; ++run) {
+        clock = 0;
+        graph.run(jobs);
+        EXPECT_EQ(clock.load(), 5);
+        EXPECT_LT(order[0], order[1]);
+        EXPECT_LT(order[0], order[2]);
+        EXPECT_LT(order[1], order[3]);
+        EXPECT_LT(order[2], order[3]);
+    }
+}
+
+TEST_F(JobSystemTestFixture, TaskGraphWideFanOut) {
+    JobSystem jobs(4);
+    std::atomic<int> done{0};
+    int finalSeen = -1;
+    TaskGraph graph;
+    const auto root = graph.add([] {});
+    const auto sink = graph.add([&] { finalSeen = done.load(); });
+    for (int i = 0; i < 500; ++i) {
+        const auto t = graph.add([&] { ++done; });
+        graph.precede(root, t);
+        graph.precede(t, sink);
+    }
+    graph.run(jobs);
+    EXPECT_EQ(finalSeen, 500);
+}
@@ -0,0 +1,141 @@
+#include <gtest/gtest.h>
+#include <cmath>
+#include <cstring>
+#include <random>
+#include <vector>
+#include "include/MatrixInverse.h"
+#include "include/Simd.h"
+
+namespace {
+
+// Double-precision Gauss-Jordan with partial pivoting, the accuracy reference
+bool referenceInverse(const mat4& m, double out[4][4]) {
+    double a[4][8];
+    for (int i = 0; i < 4; ++i)
+        for (int j = 0; j < 4; ++j) {
+            a[i][j] = m.m[i][j];
+            a[i][j + 4] = (i == j) ? 1.0 : 0.0;
+        }
+    for (int col = 0; col < 4; ++col) {
+        int pivot = col;
+        for (int r = col + 1; r < 4; ++r)
+            if (std::abs(a[r][col]) > std::abs(a[pivot][col])) pivot = r;
+        if (std::abs(a[pivot][col]) < 1e-12) return false;
+        for (int j = 0; j < 8; ++j) std::swap(a[col][j], a[pivot][j]);
+        const double inv = 1.0 / a[col][col];
+        for (int j = 0; j < 8; ++j) a[col][j] *= inv;
+        for (int r = 0; r < 4; ++r) {
+            if (r == col) continue;
+            const double f = a[r][col];
+            for (int j = 0; j < 8; ++j) a[r][j] -= f * a[col][j];
+        }
+    }
+    for (int i = 0; i < 4; ++i)
+        for (int j = 0; j < 4; ++j) out[i][j] = a[i][j + 4];
+    return true;
+}
+
+} // namespace
+
+class MatrixInverseTestFixture : public ::testing::Test {
+protected:
+    void SetUp() override {
+        original = math::simd::activeBackend();
+        std::mt19937 rng(99);
+        std::uniform_real_distribution<float> dist(-2.0f, 2.0f);
+        for (int n = 0; n < 64; ++n) {
+            mat4 m;
+            for (auto& row : m.m) for (float& f : row) f = dist(rng);
+            // Diagonal dominance keeps the random set well conditioned
+            for (int i = 0; i < 4; ++i) m.m[i][i] += 6.0f;
+            matrices.push_back(m);
+        }
+        const math::Vector3 axis = math::Vector3(0.2f, 1.0f, -0.4f).normalized();
+        rigid = (math::Translation3{{3.0f, -1.0f, 7.0f}} * math::Rotation3::axisAngle(axis, 1.1f)).toMat4();
+    }
+
+    void TearDown() override {
+        math::simd::setBackend(original);
+    }
+
+    static void expectNearReference(const mat4& actual, const mat4& m) {
+        double ref[4][4];
+        ASSERT_TRUE(referenceInverse(m, ref));
+        for (int i = 0; i < 4; ++i)
+            for (int j = 0; j < 4; ++j)
+                EXPECT_NEAR(actual.m[i][j], ref[i][j], 1e-5 * (1.0 + std::abs(ref[i][j])));
+    }
+
+    math::simd::Backend original = math::simd::Backend::Scalar;
+    std::vector<mat4> matrices;
+    mat4 rigid;
+};
+
+TEST_F(MatrixInverseTestFixture, GeneralInverseMatchesDoubleReference) {
+    for (const mat4& m : matrices) expectNearReference(math::inverse(m), m);
+}
+
+TEST_F(MatrixInverseTestFixture, ProjectionInverseMatchesDoubleReference) {
+    mat4 p(0.0f);
+    p.m[0][0] = 1.2f; p.m[1][1] = 1.7f;
+    p.m[2][2] = -1.002f; p.m[2][3] = -0.2002f;
+    p.m[3][2] = -1.0f;
+    expectNearReference(math::inverse(p), p);
+}
+
+TEST_F(MatrixInverseTestFixture, DeterminantOfScaledIdentity) {
+    EXPECT_FLOAT_EQ(math::determinant(mat4(2.0f)), 16.0f);
+    EXPECT_FLOAT_EQ(math::determinant(mat4(0.0f)), 0.0f);
+}
+
+TEST_F(MatrixInverseTestFixture, SingularInputIsNonFinite) {
+    const mat4 singular = math::inverse(mat4(0.0f));
+    EXPECT_FALSE(std::isfinite(singular.m[0][0]));
+}
+
+TEST_F(MatrixInverseTestFixture, ScalarBackendIsBitIdentical) {
+    std::vector<mat4> simdOut(matrices.size()), scalarOut(matrices.size());
+    math::inverse(matrices, simdOut);
+    ASSERT_TRUE(math::simd::setBackend(math::simd::Backend::Scalar));
+    math::inverse(matrices, scalarOut);
+    EXPECT_EQ(std::memcmp(simdOut.data(), scalarOut.data(), simdOut.size() * sizeof(mat4)), 0);
+}
+
+TEST_F(MatrixInverseTestFixture, RigidInverseMatchesGeneral) {
+    expectNearReference(math::inverseRigid(rigid), rigid);
+    const math::Affine3 a = math::Affine3::fromMat4(rigid);
+    expectNearReference(math::inverseRigid(a).toMat4(), rigid);
+}
+
+TEST_F(MatrixInverseTestFixture, AffineInverseMatchesDoubleReference) {
+    const math::Affine3 a = math::Translation3{{1.0f, 2.0f, 3.0f}} *
+                            math::Rotation3::axisAngle({0.0f, 0.0f, 1.0f}, 0.3f) *
+                            math::Scale3{{2.0f, 0.5f, 3.0f}};
+    expectNearReference(math::inverse(a).toMat4(), a.toMat4());
+}
+
+TEST_F(MatrixInverseTestFixture, InverseTransposeForNormals) {
+    const math::Affine3 a = math::Rotation3::axisAngle({1.0f, 0.0f, 0.0f}, 0.5f) * math::Scale3{{1.0f, 4.0f, 1.0f}};
+    const mat4 expected = math::inverseTranspose(a.toMat4());
+    const math::Affine3 normalMatrix = math::inverseTranspose(a);
+    for (int i = 0; i < 3; ++i)
+        for (int j = 0; j < 3; ++j)
+            EXPECT_NEAR(normalMatrix.m[i][j], expected.m[i][j], 1e-5f);
+
+    // A normal stays perpendicular to a transformed tangent
+    const math::Vector3 tangent(0.0f, 1.0f, 1.0f), normal(0.0f, 1.0f, -1.0f);
+    const math::Vector3 t2 = math::transformDirection(a, tangent);
+    const math::Vector3 n2 = math::transformDirection(normalMatrix, normal);
+    EXPECT_NEAR(t2.dot(n2), 0.0f, 1e-5f);
+}
+
+TEST_F(MatrixInverseTestFixture, TaggedInverses) {
+    const auto t = math::inverse(math::Translation3{{1.0f, -2.0f, 3.0f}});
+    EXPECT_FLOAT_EQ(t.offset.y, 2.0f);
+    const auto s = math::inverse(math::Scale3{{2.0f, 4.0f, 0.5f}});
+    EXPECT_FLOAT_EQ(s.factors.z, 2.0f);
+    const auto r = math::Rotation3::axisAngle({0.0f, 1.0f, 0.0f}, 0.8f);
+    const auto identity = r * math::inverse(r);
+    EXPECT_NEAR(identity.m[0][0], 1.0f, 1e-6f);
+    EXPECT_NEAR(identity.m[0][2], 0.0f, 1e-6f);
+}
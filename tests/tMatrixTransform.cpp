@@ -0,0 +1,111 @@
+#include <gtest/gtest.h>
+#include <cstring>
+#include <vector>
+#include "include/MathConstants.h"
+#include "include/MatrixTransform.h"
+#include "include/TransformBatch.h"
+
+using math::Quaternion;
+using math::Vector3;
+
+// The model builders are usable in constant expressions
+static_assert(math::translate({1.0f, 2.0f, 3.0f}).m[1][3] == 2.0f);
+static_assert(math::scale({2.0f, 3.0f, 4.0f}).m[2][2] == 4.0f);
+static_assert(math::composeTRS({5.0f, 0.0f, 0.0f}, Quaternion{}, {2.0f, 2.0f, 2.0f}).m[0][0] == 2.0f);
+
+class MatrixTransformTestFixture : public ::testing::Test {
+protected:
+    static float ndcDepth(const mat4& projection, float viewZ) {
+        return math::transformPointProjective(projection, {0.0f, 0.0f, viewZ}).z;
+    }
+
+    static void expectMatrixNear(const mat4& a, const mat4& b) {
+        for (int i = 0; i < 4; ++i)
+            for (int j = 0; j < 4; ++j)
+                EXPECT_NEAR(a.m[i][j], b.m[i][j], EPSILON) << "element " << i << "," << j;
+    }
+
+    static constexpr float EPSILON = 1e-5f;
+    static constexpr float FOV = 60.0f * math::DegToRad;
+};
+
+TEST_F(MatrixTransformTestFixture, PerspectiveMapsNearFarToMinusOneOne) {
+    const mat4 p = math::perspective(FOV, 16.0f / 9.0f, 0.1f, 100.0f);
+    EXPECT_NEAR(ndcDepth(p, -0.1f), -1.0f, EPSILON);
+    EXPECT_NEAR(ndcDepth(p, -100.0f), 1.0f, 1e-4f);
+    // The top edge of the frustum lands on y = 1
+    const float y = std::tan(FOV * 0.5f) * 10.0f;
+    EXPECT_NEAR(math::transformPointProjective(p, {0.0f, y, -10.0f}).y, 1.0f, EPSILON);
+}
+
+TEST_F(MatrixTransformTestFixture, InfinitePerspectiveApproachesOne) {
+    const mat4 p = math::perspectiveInfinite(FOV, 1.0f, 0.1f);
+    EXPECT_NEAR(ndcDepth(p, -0.1f), -1.0f, EPSILON);
+    EXPECT_LT(ndcDepth(p, -1e6f), 1.0f);
+    EXPECT_NEAR(ndcDepth(p, -1e6f), 1.0f, 1e-5f);
+}
+
+TEST_F(MatrixTransformTestFixture, ReversedZMapsNearToOneFarToZero) {
+    const mat4 p = math::perspectiveReversedZ(FOV, 1.0f, 0.1f, 100.0f);
+    EXPECT_NEAR(ndcDepth(p, -0.1f), 1.0f, EPSILON);
+    EXPECT_NEAR(ndcDepth(p, -100.0f), 0.0f, EPSILON);
+    EXPECT_GT(ndcDepth(p, -1.0f), ndcDepth(p, -2.0f));
+}
+
+TEST_F(MatrixTransformTestFixture, InfiniteReversedZ) {
+    const mat4 p = math::perspectiveInfiniteReversedZ(FOV, 1.0f, 0.1f);
+    EXPECT_NEAR(ndcDepth(p, -0.1f), 1.0f, EPSILON);
+    EXPECT_NEAR(ndcDepth(p, -1000.0f), 1e-4f, 1e-9f);
+    EXPECT_GT(ndcDepth(p, -1e6f), 0.0f);
+}
+
+TEST_F(MatrixTransformTestFixture, OrthoMapsBoxToUnitCube) {
+    const mat4 p = math::ortho(-2.0f, 4.0f, -1.0f, 1.0f, 0.5f, 10.0f);
+    const Vector3 lo = math::transformPoint(p, {-2.0f, -1.0f, -0.5f});
+    const Vector3 hi = math::transformPoint(p, {4.0f, 1.0f, -10.0f});
+    EXPECT_NEAR(lo.x, -1.0f, EPSILON); EXPECT_NEAR(lo.y, -1.0f, EPSILON); EXPECT_NEAR(lo.z, -1.0f, EPSILON);
+    EXPECT_NEAR(hi.x, 1.0f, EPSILON);  EXPECT_NEAR(hi.y, 1.0f, EPSILON);  EXPECT_NEAR(hi.z, 1.0f, EPSILON);
+}
+
+TEST_F(MatrixTransformTestFixture, LookAtPlacesTargetOnMinusZ) {
+    const Vector3 eye(0.0f, 1.0f, 2.0f);
+    const mat4 view = math::lookAt(eye, {0.0f, 0.0f, 0.0f}, {0.0f, 1.0f, 0.0f});
+    const Vector3 e = math::transformPoint(view, eye);
+    EXPECT_NEAR(e.x, 0.0f, EPSILON); EXPECT_NEAR(e.y, 0.0f, EPSILON); EXPECT_NEAR(e.z, 0.0f, EPSILON);
+    const Vector3 c = math::transformPoint(view, {0.0f, 0.0f, 0.0f});
+    EXPECT_NEAR(c.x, 0.0f, EPSILON);
+    EXPECT_NEAR(c.y, 0.0f, EPSILON);
+    EXPECT_NEAR(c.z, -std::sqrt(5.0f), EPSILON);
+    // World up stays in the upper half of the view
+    EXPECT_GT(math::transformDirection(view, {0.0f, 1.0f, 0.0f}).y, 0.0f);
+}
+
+TEST_F(MatrixTransformTestFixture, RotateMatchesAxisAngle) {
+    const Vector3 axis = Vector3(1.0f, -2.0f, 0.5f).normalized();
+    expectMatrixNear(math::rotate(axis, 1.3f), math::Rotation3::axisAngle(axis, 1.3f).toMat4());
+}
+
+TEST_F(MatrixTransformTestFixture, ComposeTRSMatchesProduct) {
+    const Vector3 pos(1.0f, -2.0f, 3.0f), factors(2.0f, 0.5f, 3.0f);
+    const Quaternion q = Quaternion::axisAngle(Vector3(0.3f, 1.0f, 0.2f).normalized(), 0.9f);
+    const mat4 expected = math::translate(pos) * math::rotate(q) * math::scale(factors);
+    expectMatrixNear(math::composeTRS(pos, q, factors), expected);
+    expectMatrixNear(math::composeAffineTRS(pos, q, factors).toMat4(), expected);
+}
+
+TEST_F(MatrixTransformTestFixture, BatchComposeTRSMatchesSingle) {
+    std::vector<Vector3> pos, factors;
+    std::vector<Quaternion> rot;
+    for (int i = 0; i < 13; ++i) {
+        const float f = static_cast<float>(i);
+        pos.emplace_back(f, -f, 0.5f * f);
+        rot.push_back(Quaternion::axisAngle({0.0f, 0.0f, 1.0f}, 0.1f * f));
+        factors.emplace_back(1.0f + f, 1.0f, 2.0f);
+    }
+    std::vector<mat4> out(pos.size());
+    math::composeTRS(pos, rot, factors, out);
+    for (std::size_t i = 0; i < pos.size(); ++i) {
+        const mat4 single = math::composeTRS(pos[i], rot[i], factors[i]);
+        EXPECT_EQ(std::memcmp(&out[i], &single, sizeof(mat4)), 0);
+    }
+}
@@ -0,0 +1,174 @@
+#include <gtest/gtest.h>
+#include <cstdint>
+#include <map>
+#include <memory_resource>
+#include <set>
+#include <vector>
+#include "include/FrameArena.h"
+#include "include/Pool.h"
+
+using core::memory::BlockPool;
+using core::memory::FrameArena;
+using core::memory::ObjectPool;
+using core::memory::PoolResource;
+
+class MemoryTestFixture : public ::testing::Test {
+protected:
+    // Counts what reaches the upstream resource
+    struct CountingResource final : std::pmr::memory_resource {
+        std::size_t allocations = 0;
+        std::size_t live = 0;
+
+        void* do_allocate(std::size_t bytes, std::size_t alignment) override {
+            ++allocations;
+            ++live;
+            return std::pmr::new_delete_resource()->allocate(bytes, alignment);
+        }
+        void do_deallocate(void* p, std::size_t bytes, std::size_t alignment) override {
+            --live;
+            std::pmr::new_delete_resource()->deallocate(p, bytes, alignment);
+        }
+        bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override { return this == &other; }
+    };
+
+    static bool aligned(const void* p, std::size_t alignment) {
+        return reinterpret_cast<std::uintptr_t>(p) % alignment == 0;
+    }
+};
+
+TEST_F(MemoryTestFixture, ArenaAllocationsAreAlignedAndDisjoint) {
+    FrameArena arena(256);
+    std::vector<std::pair<std::byte*, std::size_t>> ranges;
+    for (std::size_t i = 1; i <= 200; ++i) {
+        const std::size_t alignment = std::size_t{1} << (i % 7);
+        auto* p = static_cast<std::byte*>(arena.allocate(i, alignment));
+        EXPECT_TRUE(aligned(p, alignment));
+        ranges.emplace_back(p, i);
+    }
+    std::sort(ranges.begin(), ranges.end());
+    for (std::size_t i = 1; i < ranges.size(); ++i) {
+        EXPECT_LE(ranges[i - 1].first + ranges[i - 1].second, ranges[i].first);
+    }
+    EXPECT_EQ(arena.frameStats().allocations, 200u);
+    EXPECT_EQ(arena.frameStats().bytes, 200u * 201u / 2u);
+    EXPECT_GE(arena.used(), arena.frameStats().bytes);
+}
+
+TEST_F(MemoryTestFixture, ArenaResetReusesMemoryAndKeepsStats) {
+    CountingResource upstream;
+    FrameArena arena(1024, &upstream);
+    for (int i = 0; i < 100; ++i) arena.allocateArray<float>(64); // 25 KiB over several blocks
+    const std::size_t blocks = arena.frameStats().upstreamAllocations;
+    EXPECT_GT(blocks, 1u);
+    arena.reset();
+    EXPECT_EQ(arena.lastFrameStats().allocations, 100u);
+    EXPECT_EQ(arena.lastFrameStats().upstreamAllocations, blocks + 1); // plus the coalesced block
+    EXPECT_EQ(upstream.allocations, blocks + 1);
+    EXPECT_EQ(arena.frameStats().allocations, 0u);
+    EXPECT_EQ(arena.used(), 0u);
+    EXPECT_EQ(upstream.live, 1u); // coalesced into one block
+
+    // The same workload now fits without touching upstream
+    const std::size_t before = upstream.allocations;
+    for (int frame = 0; frame < 3; ++frame) {
+        for (int i = 0; i < 100; ++i) arena.allocateArray<float>(64);
+        arena.reset();
+        EXPECT_EQ(arena.lastFrameStats().upstreamAllocations, 0u);
+    }
+    EXPECT_EQ(upstream.allocations, before);
+}
+
+TEST_F(MemoryTestFixture, ArenaLargeAndOverAlignedRequests) {
+    FrameArena arena(256);
+    void* big = arena.allocate(100000, 64);
+    EXPECT_TRUE(aligned(big, 64));
+    void* page = arena.allocate(16, 4096);
+    EXPECT_TRUE(aligned(page, 4096));
+    EXPECT_GE(arena.capacity(), 100000u);
+}
+
+TEST_F(MemoryTestFixture, ArenaResourceBacksPmrContainers) {
+    CountingResource upstream;
+    FrameArena arena(FrameArena::DEFAULT_BLOCK_SIZE, &upstream);
+    {
+        std::pmr::vector<int> values(arena.resource());
+        for (int i = 0; i < 1000; ++i) values.push_back(i);
+        EXPECT_EQ(values[999], 999);
+    }
+    EXPECT_GT(arena.frameStats().allocations, 1u); // every regrowth went through the arena
+    EXPECT_EQ(upstream.allocations, arena.frameStats().upstreamAllocations);
+}
+
+TEST_F(MemoryTestFixture, BlockPoolRecyclesBlocks) {
+    CountingResource upstream;
+    BlockPool pool(24, 8, 16, &upstream);
+    EXPECT_EQ(pool.blockSize(), 24u);
+    std::vector<void*> blocks;
+    for (int i = 0; i < 40; ++i) blocks.push_back(pool.allocate());
+    EXPECT_EQ(pool.live(), 40u);
+    EXPECT_EQ(pool.capacity(), 48u); // three chunks of 16
+    EXPECT_EQ(upstream.allocations, 3u);
+    EXPECT_EQ(std::set<void*>(blocks.begin(), blocks.end()).size(), 40u);
+    for (void* p : blocks) EXPECT_TRUE(aligned(p, 8));
+
+    void* last = blocks.back();
+    pool.deallocate(last);
+    EXPECT_EQ(pool.allocate(), last); // last in, first out
+    for (void* p : blocks) pool.deallocate(p);
+    EXPECT_EQ(pool.live(), 0u);
+    for (int i = 0; i < 48; ++i) pool.allocate();
+    EXPECT_EQ(upstream.allocations, 3u); // free list satisfied everything
+}
+
+TEST_F(MemoryTestFixture, BlockPoolStatsPerPeriod) {
+    BlockPool pool(32, 16, 8);
+    for (int i = 0; i < 5; ++i) pool.allocate();
+    EXPECT_EQ(pool.stats().allocations, 5u);
+    EXPECT_EQ(pool.stats().bytes, 5u * 32u);
+    EXPECT_EQ(pool.stats().peakBytes, 5u * 32u);
+    EXPECT_EQ(pool.stats().upstreamAllocations, 1u);
+    pool.resetStats();
+    EXPECT_EQ(pool.stats().allocations, 0u);
+    EXPECT_EQ(pool.stats().peakBytes, 5u * 32u); // still live
+    pool.allocate();
+    EXPECT_EQ(pool.stats().allocations, 1u);
+    EXPECT_EQ(pool.stats().peakBytes, 6u * 32u);
+}
+
+TEST_F(MemoryTestFixture, ObjectPoolConstructsAndDestroys) {
+    struct Tracked {
+        int value;
+        int* destroyed;
+        Tracked(int v, int* d) : value(v), destroyed(d) {}
+        ~Tracked() { ++*destroyed; }
+    };
+    int destroyed = 0;
+    ObjectPool<Tracked> pool(4);
+    Tracked* a = pool.create(1, &destroyed);
+    Tracked* b = pool.create(2, &destroyed);
+    EXPECT_EQ(a->value + b->value, 3);
+    EXPECT_EQ(pool.live(), 2u);
+    pool.destroy(a);
+    EXPECT_EQ(destroyed, 1);
+    EXPECT_EQ(pool.create(3, &destroyed), a);
+    pool.destroy(nullptr);
+    EXPECT_EQ(pool.live(), 2u);
+}
+
+TEST_F(MemoryTestFixture, PoolResourceServesNodesAndFallsBack) {
+    CountingResource upstream;
+    PoolResource nodes(64, 32, &upstream);
+    {
+        std::pmr::map<int, int> lookup(&nodes);
+        for (int i = 0; i < 100; ++i) lookup[i] = i * i;
+        EXPECT_EQ(lookup[9], 81);
+        EXPECT_EQ(nodes.blocks().live(), 100u);
+        EXPECT_EQ(upstream.allocations, 4u); // 100 nodes in chunks of 32
+
+        void* large = nodes.allocate(1000);
+        EXPECT_EQ(upstream.allocations, 5u);
+        nodes.deallocate(large, 1000);
+    }
+    EXPECT_EQ(nodes.blocks().live(), 0u);
+    EXPECT_EQ(upstream.live, 4u); // chunks stay with the pool
+}
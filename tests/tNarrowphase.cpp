@@ -0,0 +1,287 @@
+#include <gtest/gtest.h>
+#include <cmath>
+#include <cstring>
+#include <vector>
+#include "include/Contacts.h"
+#include "include/Gjk.h"
+#include "include/JobSystem.h"
+#include "include/MathConstants.h"
+#include "include/Narrowphase.h"
+#include "include/World.h"
+
+using math::Rotation3;
+using math::Vector3;
+using physics::BodyDesc;
+using physics::BroadphasePair;
+using physics::CollisionResult;
+using physics::ContactCache;
+using physics::ContactManifold;
+using physics::ConvexHull;
+using physics::Pose;
+using physics::RigidBodies;
+using physics::Shape;
+
+class NarrowphaseTestFixture : public ::testing::Test {
+protected:
+    static constexpr float EPS = 1e-4f;
+
+    static Pose at(const Vector3& p, const Rotation3& r = {}) { return {p, r}; }
+
+    static ConvexHull cubeHull(float h) {
+        ConvexHull hull;
+        for (int i = 0; i < 8; ++i) {
+            hull.vertices.emplace_back(i & 1 ? h : -h, i & 2 ? h : -h, i & 4 ? h : -h);
+        }
+        return hull;
+    }
+
+    static BodyDesc body(const Vector3& position, float mass, const Shape& shape) {
+        BodyDesc d;
+        d.position = position;
+        d.mass = mass;
+        d.shape = shape;
+        return d;
+    }
+
+    static void expectNear(const Vector3& v, const Vector3& expected, float eps = EPS) {
+        EXPECT_NEAR(v.x, expected.x, eps);
+        EXPECT_NEAR(v.y, expected.y, eps);
+        EXPECT_NEAR(v.z, expected.z, eps);
+    }
+};
+
+TEST_F(NarrowphaseTestFixture, OverlappingSpheres) {
+    CollisionResult r;
+    ASSERT_TRUE(physics::collide(Shape::sphere(1.0f), at({0, 0, 0}), Shape::sphere(0.5f), at({1.25f, 0, 0}), 0.0f, r));
+    ASSERT_EQ(r.pointCount, 1);
+    expectNear(r.normal, {1, 0, 0});
+    EXPECT_NEAR(r.points[0].separation, -0.25f, EPS);
+    expectNear(r.points[0].onA, {1.0f, 0, 0});
+    expectNear(r.points[0].onB, {0.75f, 0, 0});
+}
+
+TEST_F(NarrowphaseTestFixture, MarginControlsSpeculativeContacts) {
+    CollisionResult r;
+    const Shape s = Shape::sphere(0.5f);
+    EXPECT_FALSE(physics::collide(s, at({0, 0, 0}), s, at({1.1f, 0, 0}), 0.05f, r));
+    ASSERT_TRUE(physics::collide(s, at({0, 0, 0}), s, at({1.1f, 0, 0}), 0.2f, r));
+    EXPECT_NEAR(r.points[0].separation, 0.1f, EPS);
+}
+
+TEST_F(NarrowphaseTestFixture, SphereAgainstCapsuleSide) {
+    CollisionResult r;
+    // Vertical capsule at the origin, sphere touching its side
+    ASSERT_TRUE(physics::collide(Shape::sphere(0.5f), at({0.9f, 0.3f, 0}), Shape::capsule(1.0f, 0.5f), at({0, 0, 0}),
+                                 0.0f, r));
+    expectNear(r.normal, {-1, 0, 0});
+    EXPECT_NEAR(r.points[0].separation, -0.1f, EPS);
+    expectNear(r.points[0].onB, {0.5f, 0.3f, 0});
+}
+
+TEST_F(NarrowphaseTestFixture, ParallelCapsulesReportTwoPoints) {
+    CollisionResult r;
+    const Shape c = Shape::capsule(1.0f, 0.25f);
+    ASSERT_TRUE(physics::collideCapsules(c, at({0, 0, 0}), c, at({0.45f, 0.5f, 0}), 0.0f, r));
+    ASSERT_EQ(r.pointCount, 2);
+    expectNear(r.normal, {1, 0, 0});
+    for (int i = 0; i < 2; ++i) EXPECT_NEAR(r.points[i].separation, -0.05f, EPS);
+    EXPECT_NEAR(r.points[0].onA.y, -0.5f, EPS); // overlap of the cores is y in [-0.5, 1]
+    EXPECT_NEAR(r.points[1].onA.y, 1.0f, EPS);
+}
+
+TEST_F(NarrowphaseTestFixture, SphereCenterInsideBoxUsesNearestFace) {
+    CollisionResult r;
+    ASSERT_TRUE(physics::collide(Shape::sphere(0.25f), at({0.2f, 0.9f, 0}), Shape::box({1, 1, 1}), at({0, 0, 0}),
+                                 0.0f, r));
+    expectNear(r.normal, {0, -1, 0});
+    EXPECT_NEAR(r.points[0].separation, -0.35f, EPS);
+    expectNear(r.points[0].onB, {0.2f, 1.0f, 0});
+}
+
+TEST_F(NarrowphaseTestFixture, DispatchMirrorsSwappedPairs) {
+    CollisionResult boxFirst, sphereFirst;
+    const Shape box = Shape::box({1, 1, 1}), sphere = Shape::sphere(0.5f);
+    ASSERT_TRUE(physics::collide(sphere, at({0, 1.4f, 0}), box, at({0, 0, 0}), 0.0f, sphereFirst));
+    ASSERT_TRUE(physics::collide(box, at({0, 0, 0}), sphere, at({0, 1.4f, 0}), 0.0f, boxFirst));
+    expectNear(boxFirst.normal, sphereFirst.normal * -1.0f);
+    expectNear(boxFirst.points[0].onA, sphereFirst.points[0].onB);
+    expectNear(boxFirst.points[0].onB, sphereFirst.points[0].onA);
+    EXPECT_FLOAT_EQ(boxFirst.points[0].separation, sphereFirst.points[0].separation);
+}
+
+TEST_F(NarrowphaseTestFixture, BoxRestingOnBoxGivesFaceContact) {
+    CollisionResult r;
+    const Pose ground = at({0, -1, 0});
+    const Pose top = at({0.2f, 0.49f, 0.1f}, Rotation3::axisAngle({0, 1, 0}, 0.3f));
+    ASSERT_TRUE(physics::collide(Shape::box({4, 1, 4}), ground, Shape::box({0.5f, 0.5f, 0.5f}), top, 0.0f, r));
+    ASSERT_EQ(r.pointCount, 4);
+    expectNear(r.normal, {0, 1, 0});
+    for (int i = 0; i < 4; ++i) {
+        EXPECT_NEAR(r.points[i].separation, -0.01f, EPS);
+        EXPECT_NEAR(r.points[i].onA.y, 0.0f, EPS);
+    }
+}
+
+TEST_F(NarrowphaseTestFixture, ReferenceFaceOnBKeepsNormalFromAToB) {
+    CollisionResult r;
+    // Small box under a large one: B's bottom face is the reference
+    ASSERT_TRUE(physics::collide(Shape::box({0.5f, 0.5f, 0.5f}), at({0, 0, 0}), Shape::box({4, 1, 4}),
+                                 at({0, 1.48f, 0}), 0.0f, r));
+    ASSERT_EQ(r.pointCount, 4);
+    expectNear(r.normal, {0, 1, 0});
+    for (int i = 0; i < 4; ++i) EXPECT_NEAR(r.points[i].separation, -0.02f, EPS);
+}
+
+TEST_F(NarrowphaseTestFixture, CoincidentFacesGiveFourPoints) {
+    // Equal aligned boxes: every incident vertex lies exactly on a side plane
+    CollisionResult r;
+    const Shape box = Shape::box({0.5f, 0.5f, 0.5f});
+    ASSERT_TRUE(physics::collide(box, at({0, 0, 0}), box, at({0.99f, 0, 0}), 0.02f, r));
+    ASSERT_EQ(r.pointCount, 4);
+    expectNear(r.normal, {1, 0, 0});
+}
+
+TEST_F(NarrowphaseTestFixture, CrossedEdgesGiveOnePoint) {
+    CollisionResult r;
+    const float h = 0.5f, diagonal = h * std::sqrt(2.0f);
+    const Pose a = at({0, 0, 0}, Rotation3::axisAngle({1, 0, 0}, 0.25f * math::Pi));
+    const Pose b = at({0, 2.0f * diagonal - 0.05f, 0}, Rotation3::axisAngle({0, 0, 1}, 0.25f * math::Pi));
+    const Shape box = Shape::box({h, h, h});
+    ASSERT_TRUE(physics::collide(box, a, box, b, 0.0f, r));
+    ASSERT_EQ(r.pointCount, 1);
+    expectNear(r.normal, {0, 1, 0});
+    EXPECT_NEAR(r.points[0].separation, -0.05f, EPS);
+    expectNear(r.points[0].onA, {0, diagonal, 0});
+}
+
+TEST_F(NarrowphaseTestFixture, SeparatedBoxesBeyondMarginDoNotCollide) {
+    CollisionResult r;
+    const Shape box = Shape::box({0.5f, 0.5f, 0.5f});
+    EXPECT_FALSE(physics::collide(box, at({0, 0, 0}), box, at({1.1f, 0, 0}), 0.05f, r));
+    ASSERT_TRUE(physics::collide(box, at({0, 0, 0}), box, at({1.1f, 0, 0}), 0.2f, r));
+    EXPECT_NEAR(r.points[0].separation, 0.1f, EPS);
+}
+
+TEST_F(NarrowphaseTestFixture, GjkDistanceMatchesAnalytic) {
+    const ConvexHull hull = cubeHull(1.0f);
+    const Shape cube = Shape::convexHull(hull), ball = Shape::sphere(0.5f);
+    const Pose pa = at({0, 0, 0}), pb = at({3, 2, 0});
+    const physics::GjkResult g = physics::gjkDistance({&cube, &pa}, {&ball, &pb});
+    ASSERT_FALSE(g.overlapping);
+    // Closest point of the cube to (3, 2, 0) is (1, 1, 0)
+    EXPECT_NEAR(g.distance, std::sqrt(5.0f) - 0.5f, EPS);
+    expectNear(g.pointA, {1, 1, 0});
+}
+
+TEST_F(NarrowphaseTestFixture, GjkDetectsOverlap) {
+    const ConvexHull hull = cubeHull(1.0f);
+    const Shape cube = Shape::convexHull(hull);
+    const Pose pa = at({0, 0, 0}), pb = at({1.5f, 0.3f, -0.2f}, Rotation3::axisAngle(Vector3(1, 1, 0).normalized(), 0.7f));
+    EXPECT_TRUE(physics::gjkDistance({&cube, &pa}, {&cube, &pb}).overlapping);
+}
+
+TEST_F(NarrowphaseTestFixture, EpaMatchesBoxPenetration) {
+    const ConvexHull hull = cubeHull(0.5f);
+    const Shape cube = Shape::convexHull(hull);
+    const Pose pa = at({0, 0, 0}), pb = at({0.8f, 0.1f, 0.05f});
+    physics::EpaResult e;
+    ASSERT_TRUE(physics::epaPenetration({&cube, &pa}, {&cube, &pb}, e));
+    EXPECT_NEAR(e.depth, 0.2f, EPS);
+    expectNear(e.normal, {1, 0, 0});
+}
+
+TEST_F(NarrowphaseTestFixture, HullAgainstBoxMatchesBoxTest) {
+    const ConvexHull hull = cubeHull(0.5f);
+    const Pose pa = at({0, 0, 0}), pb = at({0.3f, 0.95f, 0.1f});
+    CollisionResult viaHull, viaBox;
+    ASSERT_TRUE(physics::collide(Shape::box({0.5f, 0.5f, 0.5f}), pa, Shape::convexHull(hull), pb, 0.0f, viaHull));
+    ASSERT_TRUE(physics::collide(Shape::box({0.5f, 0.5f, 0.5f}), pa, Shape::box({0.5f, 0.5f, 0.5f}), pb, 0.0f, viaBox));
+    EXPECT_TRUE(viaHull.incremental);
+    ASSERT_EQ(viaHull.pointCount, 1);
+    expectNear(viaHull.normal, viaBox.normal);
+    EXPECT_NEAR(viaHull.points[0].separation, viaBox.points[0].separation, EPS);
+}
+
+// --- ContactCache ---
+
+TEST_F(NarrowphaseTestFixture, ManifoldsKeepImpulsesWhileTouching) {
+    RigidBodies bodies;
+    bodies.add(body({0, 0, 0}, 0.0f, Shape::box({4, 1, 4})));
+    bodies.add(body({0, 1.49f, 0}, 1.0f, Shape::box({0.5f, 0.5f, 0.5f})));
+    const std::vector<BroadphasePair> pairs = {{0, 1}};
+    ContactCache cache;
+    cache.update(bodies, pairs);
+    ASSERT_EQ(cache.manifolds().size(), 1u);
+    ContactManifold& m = cache.manifolds()[0];
+    ASSERT_EQ(m.pointCount, 4);
+    for (int i = 0; i < m.pointCount; ++i) m.points[i].normalImpulse = 1.0f + static_cast<float>(i);
+
+    // Slide a little: every point matches its predecessor
+    bodies.position.set(1, {0.005f, 1.492f, 0});
+    cache.update(bodies, pairs);
+    const ContactManifold* next = cache.find(0, 1);
+    ASSERT_NE(next, nullptr);
+    ASSERT_EQ(next->pointCount, 4);
+    float total = 0.0f;
+    for (int i = 0; i < next->pointCount; ++i) total += next->points[i].normalImpulse;
+    EXPECT_FLOAT_EQ(total, 10.0f);
+
+    // Lifted beyond the margin: the manifold disappears
+    bodies.position.set(1, {0, 2.0f, 0});
+    cache.update(bodies, pairs);
+    EXPECT_TRUE(cache.manifolds().empty());
+    EXPECT_EQ(cache.find(0, 1), nullptr);
+}
+
+TEST_F(NarrowphaseTestFixture, IncrementalManifoldAccumulatesPoints) {
+    const ConvexHull hull = cubeHull(0.5f);
+    RigidBodies bodies;
+    bodies.add(body({0, 0, 0}, 0.0f, Shape::box({4, 1, 4})));
+    bodies.add(body({0, 1.495f, 0}, 1.0f, Shape::convexHull(hull)));
+    const std::vector<BroadphasePair> pairs = {{0, 1}};
+    ContactCache cache;
+
+    // Rock the hull so a different corner is deepest each frame
+    bodies.setOrientation(1, math::Quaternion::axisAngle({0, 0, 1}, 0.01f));
+    cache.update(bodies, pairs);
+    ASSERT_EQ(cache.manifolds().size(), 1u);
+    EXPECT_EQ(cache.manifolds()[0].pointCount, 1);
+    bodies.setOrientation(1, math::Quaternion::axisAngle({0, 0, 1}, -0.01f));
+    cache.update(bodies, pairs);
+    ASSERT_EQ(cache.manifolds().size(), 1u);
+    EXPECT_EQ(cache.manifolds()[0].pointCount, 2);
+    expectNear(cache.manifolds()[0].normal, {0, 1, 0}, 1e-3f);
+}
+
+TEST_F(NarrowphaseTestFixture, ParallelUpdateMatchesSerial) {
+    RigidBodies bodies;
+    std::vector<BroadphasePair> pairs;
+    for (std::uint32_t i = 0; i < 2000; ++i) {
+        const float x = static_cast<float>(i) * 0.9f;
+        bodies.add(body({x, 0.1f * static_cast<float>(i % 3), 0}, 1.0f, Shape::sphere(0.5f)));
+        if (i > 0) pairs.push_back({i - 1, i});
+    }
+    ContactCache serial, parallel;
+    core::JobSystem jobs(2);
+    serial.update(bodies, pairs);
+    parallel.update(bodies, pairs, &jobs);
+    ASSERT_EQ(serial.manifolds().size(), parallel.manifolds().size());
+    ASSERT_FALSE(serial.manifolds().empty());
+    EXPECT_EQ(std::memcmp(serial.manifolds().data(), parallel.manifolds().data(),
+                          serial.manifolds().size_bytes()),
+              0);
+}
+
+TEST_F(NarrowphaseTestFixture, WorldFindsContactsOfShapedBodies) {
+    physics::World world;
+    world.bodies().add(body({0, 0, 0}, 0.0f, Shape::box({4, 1, 4})));
+    world.bodies().add(body({0, 1.51f, 0}, 1.0f, Shape::sphere(0.5f)));
+    world.bodies().add(body({0, 1.51f, 0}, 1.0f, Shape{}));          // no shape: ignored
+    world.bodies().add(body({3, 0, 0}, 0.0f, Shape::sphere(1.0f))); // static-static
+    world.step();
+    ASSERT_EQ(world.contacts().manifolds().size(), 1u);
+    const ContactManifold& m = world.contacts().manifolds()[0];
+    EXPECT_EQ(m.bodyA, 0u);
+    EXPECT_EQ(m.bodyB, 1u);
+    expectNear(m.normal, {0, 1, 0});
+}
@@ -0,0 +1,170 @@
+#include <gtest/gtest.h>
+#include <cmath>
+#include <cstring>
+#include <vector>
+#include "include/JobSystem.h"
+#include "include/ParticleSystem.h"
+#include "include/Simd.h"
+
+using math::Vector3;
+using physics::EmitterDesc;
+using physics::ParticleSystem;
+
+class ParticleSystemTestFixture : public ::testing::Test {
+protected:
+    void SetUp() override {
+        original = math::simd::activeBackend();
+    }
+
+    void TearDown() override {
+        math::simd::setBackend(original);
+    }
+
+    static EmitterDesc fountain(float rate, std::uint64_t seed) {
+        EmitterDesc e;
+        e.extents = {1.0f, 0.0f, 1.0f};
+        e.spread = 0.5f;
+        e.minSpeed = 2.0f;
+        e.maxSpeed = 4.0f;
+        e.minLifetime = 0.5f;
+        e.maxLifetime = 1.5f;
+        e.rate = rate;
+        e.seed = seed;
+        return e;
+    }
+
+    // Several chunks' worth of particles from two emitters, a few steps in
+    static std::vector<float> simulate(core::JobSystem* jobs) {
+        physics::ParticleSettings settings;
+        settings.drag = 0.5f;
+        ParticleSystem particles(settings);
+        particles.addEmitter(fountain(200000.0f, 1));
+        particles.addEmitter(fountain(50000.0f, 2));
+        for (int i = 0; i < 60; ++i) particles.update(1.0f / 60.0f, jobs);
+        std::vector<float> out;
+        for (std::size_t i = 0; i < particles.size(); ++i) {
+            const Vector3 p = particles.position.get(i), v = particles.velocity.get(i);
+            out.insert(out.end(), {p.x, p.y, p.z, v.x, v.y, v.z, particles.life[i]});
+        }
+        return out;
+    }
+
+    math::simd::Backend original = math::simd::Backend::Scalar;
+};
+
+TEST_F(ParticleSystemTestFixture, KillMovesLastParticleIntoSlot) {
+    ParticleSystem particles;
+    for (int i = 0; i < 4; ++i) {
+        EXPECT_EQ(particles.emit({static_cast<float>(i), 0, 0}, {}, 1.0f), static_cast<std::size_t>(i));
+    }
+    EXPECT_EQ(particles.kill(1), 3u);
+    ASSERT_EQ(particles.size(), 3u);
+    EXPECT_EQ(particles.position.get(0).x, 0.0f);
+    EXPECT_EQ(particles.position.get(1).x, 3.0f);
+    EXPECT_EQ(particles.position.get(2).x, 2.0f);
+    EXPECT_EQ(particles.kill(2), 2u); // the last one: nothing moves
+    EXPECT_EQ(particles.size(), 2u);
+}
+
+TEST_F(ParticleSystemTestFixture, IntegratesGravityAndDrag) {
+    physics::ParticleSettings settings;
+    settings.gravity = {0, -10.0f, 0};
+    settings.drag = 1.0f;
+    ParticleSystem particles(settings);
+    particles.emit({0, 0, 0}, {2.0f, 0, 0}, 10.0f);
+    const float dt = 0.1f;
+    particles.update(dt);
+    const float factor = 1.0f / (1.0f + dt);
+    const Vector3 v = particles.velocity.get(0), p = particles.position.get(0);
+    EXPECT_FLOAT_EQ(v.x, 2.0f * factor);
+    EXPECT_FLOAT_EQ(v.y, -10.0f * dt * factor);
+    EXPECT_FLOAT_EQ(p.x, v.x * dt);
+    EXPECT_FLOAT_EQ(p.y, v.y * dt);
+    EXPECT_FLOAT_EQ(particles.life[0], 10.0f - dt);
+    EXPECT_NEAR(particles.normalizedAge(0), 0.01f, 1e-6f);
+}
+
+TEST_F(ParticleSystemTestFixture, ExpiredParticlesAreRemoved) {
+    ParticleSystem particles;
+    // Interleave short and long lives, including a dead run at the tail
+    for (int i = 0; i < 1000; ++i) particles.emit({static_cast<float>(i), 0, 0}, {}, i % 3 == 0 ? 2.0f : 0.05f);
+    for (int i = 0; i < 10; ++i) particles.emit({}, {}, 0.05f);
+    particles.update(0.1f);
+    ASSERT_EQ(particles.size(), 334u);
+    for (std::size_t i = 0; i < particles.size(); ++i) {
+        EXPECT_GT(particles.life[i], 0.0f);
+        EXPECT_FLOAT_EQ(particles.lifetime[i], 2.0f);
+    }
+}
+
+TEST_F(ParticleSystemTestFixture, ExpiryAcrossChunks) {
+    ParticleSystem particles;
+    const std::size_t n = 3 * ParticleSystem::PARTICLES_PER_JOB + 17;
+    particles.reserve(n);
+    for (std::size_t i = 0; i < n; ++i) particles.emit({}, {}, i % 2 == 0 ? 1.0f : 0.01f);
+    core::JobSystem jobs(2);
+    particles.update(0.02f, &jobs);
+    EXPECT_EQ(particles.size(), (n + 1) / 2);
+    for (std::size_t i = 0; i < particles.size(); ++i) EXPECT_GT(particles.life[i], 0.0f) << i;
+}
+
+TEST_F(ParticleSystemTestFixture, EmitterRateCarriesFractions) {
+    ParticleSystem particles;
+    EmitterDesc e = fountain(25.0f, 7);
+    e.minLifetime = e.maxLifetime = 100.0f;
+    particles.addEmitter(e);
+    // 25/s at 60 Hz is 0.4167 per update; one second must still give 25
+    for (int i = 0; i < 60; ++i) particles.update(1.0f / 60.0f);
+    EXPECT_NEAR(static_cast<float>(particles.size()), 25.0f, 1.0f);
+
+    particles.emitter(0).enabled = false;
+    const std::size_t before = particles.size();
+    particles.update(1.0f);
+    EXPECT_EQ(particles.size(), before);
+}
+
+TEST_F(ParticleSystemTestFixture, EmittedParticlesStayInCone) {
+    ParticleSystem particles;
+    EmitterDesc e = fountain(1000.0f, 3);
+    e.direction = {1, 0, 0};
+    e.extents = {};
+    particles.addEmitter(e);
+    particles.update(0.5f);
+    ASSERT_EQ(particles.size(), 500u);
+    for (std::size_t i = 0; i < particles.size(); ++i) {
+        EXPECT_EQ(particles.position.get(i).lengthSquared(), 0.0f);
+        const Vector3 v = particles.velocity.get(i);
+        // Emitted after the integration step: still at the launch velocity
+        const float speed = v.length();
+        EXPECT_GE(speed, 2.0f - 1e-4f);
+        EXPECT_LE(speed, 4.0f + 1e-4f);
+        EXPECT_GE(v.x / speed, std::cos(0.5f) - 1e-4f);
+        EXPECT_GE(particles.lifetime[i], 0.5f);
+        EXPECT_LE(particles.lifetime[i], 1.5f);
+    }
+}
+
+TEST_F(ParticleSystemTestFixture, MaxParticlesCapsEmission) {
+    physics::ParticleSettings settings;
+    settings.maxParticles = 100;
+    ParticleSystem particles(settings);
+    particles.addEmitter(fountain(10000.0f, 5));
+    particles.update(0.1f);
+    EXPECT_EQ(particles.size(), 100u);
+    EXPECT_EQ(particles.emit({}, {}, 1.0f), ParticleSystem::NONE);
+}
+
+TEST_F(ParticleSystemTestFixture, ThreadsAndBackendsGiveIdenticalResults) {
+    const std::vector<float> expected = simulate(nullptr);
+    ASSERT_GT(expected.size(), 7 * 2 * ParticleSystem::PARTICLES_PER_JOB);
+
+    core::JobSystem jobs(3);
+    const std::vector<float> parallel = simulate(&jobs);
+    ASSERT_EQ(parallel.size(), expected.size());
+    EXPECT_EQ(std::memcmp(expected.data(), parallel.data(), expected.size() * sizeof(float)), 0);
+
+    ASSERT_TRUE(math::simd::setBackend(math::simd::Backend::Scalar));
+    const std::vector<float> scalar = simulate(nullptr);
+    ASSERT_EQ(scalar.size(), expected.size());
+    EXPECT_EQ(std::memcmp(expected.data(), scalar.data(), expected.size() * sizeof(float)), 0);
+}
@@ -0,0 +1,174 @@
+#include <gtest/gtest.h>
+#include <cmath>
+#include <cstring>
+#include <random>
+#include <vector>
+#include "include/MathConstants.h"
+#include "include/Quaternion.h"
+#include "include/Simd.h"
+#include "include/TransformBatch.h"
+
+using math::Quaternion;
+using math::Vector3;
+
+static_assert((Quaternion{} * Quaternion{}).w == 1.0f);
+static_assert(Quaternion(1.0f, 2.0f, 3.0f, 4.0f).conjugate().y == -2.0f);
+
+class QuaternionTestFixture : public ::testing::Test {
+protected:
+    void SetUp() override {
+        original = math::simd::activeBackend();
+        std::mt19937 rng(7);
+        std::uniform_real_distribution<float> dist(-1.0f, 1.0f);
+        for (int i = 0; i < 37; ++i) {
+            a.push_back(Quaternion(dist(rng), dist(rng), dist(rng), dist(rng)).normalized());
+            b.push_back(Quaternion(dist(rng), dist(rng), dist(rng), dist(rng)).normalized());
+            vectors.emplace_back(dist(rng) * 10.0f, dist(rng) * 10.0f, dist(rng) * 10.0f);
+        }
+    }
+
+    void TearDown() override {
+        math::simd::setBackend(original);
+    }
+
+    // Same rotation: q and -q are equivalent
+    static void expectSameRotation(const Quaternion& q, const Quaternion& r, float eps = EPSILON) {
+        EXPECT_NEAR(std::abs(q.dot(r)), 1.0f, eps);
+    }
+
+    static void expectVectorNear(const Vector3& v, const Vector3& expected, float eps = EPSILON) {
+        EXPECT_NEAR(v.x, expected.x, eps);
+        EXPECT_NEAR(v.y, expected.y, eps);
+        EXPECT_NEAR(v.z, expected.z, eps);
+    }
+
+    // Reference slerp using the exact trigonometric formula
+    static Quaternion exactSlerp(const Quaternion& a, Quaternion b, float t) {
+        double d = a.dot(b);
+        if (d < 0.0) { b = {-b.x, -b.y, -b.z, -b.w}; d = -d; }
+        if (d > 0.9999999) return b;
+        const double theta = std::acos(d);
+        const double ca = std::sin((1.0 - t) * theta) / std::sin(theta);
+        const double cb = std::sin(t * theta) / std::sin(theta);
+        return {static_cast<float>(a.x * ca + b.x * cb), static_cast<float>(a.y * ca + b.y * cb),
+                static_cast<float>(a.z * ca + b.z * cb), static_cast<float>(a.w * ca + b.w * cb)};
+    }
+
+    static constexpr float EPSILON = 1e-6f;
+    math::simd::Backend original = math::simd::Backend::Scalar;
+    std::vector<Quaternion> a, b;
+    std::vector<Vector3> vectors;
+};
+
+TEST_F(QuaternionTestFixture, RotateMatchesMatrix) {
+    for (std::size_t i = 0; i < a.size(); ++i) {
+        const Vector3 expected = math::rotate(a[i].toRotation3(), vectors[i]);
+        expectVectorNear(math::rotate(a[i], vectors[i]), expected, 1e-5f);
+    }
+    const Quaternion q = Quaternion::axisAngle({0.0f, 1.0f, 0.0f}, math::HalfPi);
+    expectVectorNear(math::rotate(q, {1.0f, 0.0f, 0.0f}), {0.0f, 0.0f, -1.0f});
+}
+
+TEST_F(QuaternionTestFixture, ProductComposesRotations) {
+    const Quaternion q = a[0] * a[1];
+    for (const Vector3& v : vectors)
+        expectVectorNear(math::rotate(q, v), math::rotate(a[0], math::rotate(a[1], v)), 1e-5f);
+}
+
+TEST_F(QuaternionTestFixture, ConjugateAndInverseUndoRotation) {
+    expectSameRotation(a[2] * a[2].conjugate(), Quaternion{});
+    const Quaternion scaled(2.0f * a[3].x, 2.0f * a[3].y, 2.0f * a[3].z, 2.0f * a[3].w);
+    const Quaternion identity = scaled * scaled.inverse();
+    EXPECT_NEAR(identity.w, 1.0f, EPSILON);
+    EXPECT_NEAR(identity.x, 0.0f, EPSILON);
+}
+
+TEST_F(QuaternionTestFixture, NormalizeGivesUnitLength) {
+    Quaternion q(1.0f, 2.0f, 3.0f, 4.0f);
+    q.normalize();
+    EXPECT_NEAR(q.length(), 1.0f, EPSILON);
+}
+
+TEST_F(QuaternionTestFixture, MatrixRoundTrip) {
+    // Covers every Shepperd pivot: large w, x, y and z
+    std::vector<Quaternion> cases = a;
+    cases.push_back(Quaternion::axisAngle({1.0f, 0.0f, 0.0f}, 3.1f));
+    cases.push_back(Quaternion::axisAngle({0.0f, 1.0f, 0.0f}, 3.1f));
+    cases.push_back(Quaternion::axisAngle({0.0f, 0.0f, 1.0f}, 3.1f));
+    for (const Quaternion& q : cases) {
+        expectSameRotation(Quaternion::fromMat4(q.toMat4()), q, 1e-5f);
+        expectSameRotation(Quaternion::fromRotation3(q.toRotation3()), q, 1e-5f);
+    }
+}
+
+TEST_F(QuaternionTestFixture, SlerpMatchesExactFormula) {
+    for (std::size_t i = 0; i < a.size(); ++i) {
+        for (float t : {0.0f, 0.25f, 0.5f, 0.9f, 1.0f}) {
+            const Quaternion r = math::slerp(a[i], b[i], t);
+            const Quaternion e = exactSlerp(a[i], b[i], t);
+            EXPECT_NEAR(r.x, e.x, 2e-6f);
+            EXPECT_NEAR(r.y, e.y, 2e-6f);
+            EXPECT_NEAR(r.z, e.z, 2e-6f);
+            EXPECT_NEAR(r.w, e.w, 2e-6f);
+        }
+    }
+}
+
+TEST_F(QuaternionTestFixture, SlerpHandlesIdenticalAndOppositeInputs) {
+    const Quaternion q = a[0];
+    const Quaternion same = math::slerp(q, q, 0.3f);
+    expectSameRotation(same, q);
+    EXPECT_TRUE(std::isfinite(same.w));
+    // -q is the same rotation; the shorter arc is no motion at all
+    expectSameRotation(math::slerp(q, {-q.x, -q.y, -q.z, -q.w}, 0.5f), q);
+}
+
+TEST_F(QuaternionTestFixture, SlerpHasConstantAngularSpeed) {
+    const Quaternion q = Quaternion::axisAngle({0.0f, 0.0f, 1.0f}, 2.0f);
+    const Quaternion quarter = math::slerp(Quaternion{}, q, 0.25f);
+    expectSameRotation(quarter, Quaternion::axisAngle({0.0f, 0.0f, 1.0f}, 0.5f));
+}
+
+TEST_F(QuaternionTestFixture, NlerpIsNormalizedAndTakesShortArc) {
+    const Quaternion r = math::nlerp(a[0], b[0], 0.3f);
+    EXPECT_NEAR(r.length(), 1.0f, EPSILON);
+    const Quaternion q = a[1];
+    expectSameRotation(math::nlerp(q, {-q.x, -q.y, -q.z, -q.w}, 0.5f), q);
+}
+
+TEST_F(QuaternionTestFixture, BatchInterpolationMatchesSingle) {
+    std::vector<Quaternion> outSlerp(a.size()), outNlerp(a.size());
+    math::slerp(a, b, 0.37f, outSlerp);
+    math::nlerp(a, b, 0.37f, outNlerp);
+    for (std::size_t i = 0; i < a.size(); ++i) {
+        const Quaternion s = math::slerp(a[i], b[i], 0.37f);
+        const Quaternion n = math::nlerp(a[i], b[i], 0.37f);
+        EXPECT_EQ(std::memcmp(&outSlerp[i], &s, sizeof(Quaternion)), 0) << "slerp " << i;
+        EXPECT_EQ(std::memcmp(&outNlerp[i], &n, sizeof(Quaternion)), 0) << "nlerp " << i;
+    }
+}
+
+TEST_F(QuaternionTestFixture, BatchRotateMatchesMatrixPath) {
+    const Quaternion q = a[4];
+    std::vector<Vector3> out(vectors.size());
+    math::rotate(q, vectors, out);
+    math::Vector3SoA soa, soaOut;
+    for (const Vector3& v : vectors) soa.pushBack(v);
+    math::rotate(q, soa, soaOut);
+    const math::Rotation3 r = q.toRotation3();
+    for (std::size_t i = 0; i < vectors.size(); ++i) {
+        const Vector3 single = math::rotate(r, vectors[i]);
+        expectVectorNear(single, math::rotate(q, vectors[i]), 1e-5f);
+        EXPECT_EQ(std::memcmp(&out[i], &single, sizeof(Vector3)), 0);
+        const Vector3 fromSoa = soaOut.get(i);
+        EXPECT_EQ(std::memcmp(&fromSoa, &single, sizeof(Vector3)), 0);
+    }
+}
+
+TEST_F(QuaternionTestFixture, ScalarBackendIsBitIdentical) {
+    std::vector<Quaternion> simdOut(a.size()), scalarOut(a.size());
+    math::slerp(a, b, 0.6f, simdOut);
+    ASSERT_TRUE(math::simd::setBackend(math::simd::Backend::Scalar));
+    math::slerp(a, b, 0.6f, scalarOut);
+    EXPECT_EQ(std::memcmp(simdOut.data(), scalarOut.data(), a.size() * sizeof(Quaternion)), 0);
+}
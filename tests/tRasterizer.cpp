@@ -0,0 +1,265 @@
+#include <gtest/gtest.h>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <numbers>
+#include <string>
+#include <vector>
+#include "include/Image.h"
+#include "include/JobSystem.h"
+#include "include/MatrixTransform.h"
+#include "include/Mesh.h"
+#include "include/Rasterizer.h"
+#include "include/Simd.h"
+
+using math::Vector3;
+using render::Mesh;
+using render::Rasterizer;
+using render::rgba;
+
+class RasterizerTestFixture : public ::testing::Test {
+protected:
+    void SetUp() override {
+        original = math::simd::activeBackend();
+    }
+
+    void TearDown() override {
+        math::simd::setBackend(original);
+    }
+
+    static constexpr std::uint32_t BACKGROUND = rgba(0, 0, 0);
+
+    static mat4 translation(const Vector3& t) {
+        mat4 m;
+        m.m[0][3] = t.x;
+        m.m[1][3] = t.y;
+        m.m[2][3] = t.z;
+        return m;
+    }
+
+    static mat4 camera(std::uint32_t width, std::uint32_t height, const Vector3& eye) {
+        const float aspect = static_cast<float>(width) / static_cast<float>(height);
+        return math::perspective(std::numbers::pi_v<float> / 3.0f, aspect, 0.1f, 100.0f) *
+               math::lookAt(eye, {0.0f, 0.0f, 0.0f}, {0.0f, 1.0f, 0.0f});
+    }
+
+    // Square in the z = depth plane of clip space, facing the viewer (identity view-projection)
+    static Mesh square(float x0, float y0, float x1, float y1, float depth) {
+        Mesh mesh;
+        mesh.positions = {{x0, y0, depth}, {x1, y0, depth}, {x1, y1, depth}, {x0, y1, depth}};
+        mesh.indices = {0, 1, 2, 0, 2, 3};
+        return mesh;
+    }
+
+    static std::size_t covered(const Rasterizer& r) {
+        std::size_t count = 0;
+        for (std::uint32_t y = 0; y < r.height(); ++y) {
+            for (std::uint32_t x = 0; x < r.width(); ++x) count += r.pixel(x, y) != BACKGROUND;
+        }
+        return count;
+    }
+
+    // Spheres scattered in front of the camera at (0, 2, 12)
+    static void drawScene(Rasterizer& r, const Mesh& sphere) {
+        r.setViewProjection(camera(r.width(), r.height(), {0.0f, 2.0f, 12.0f}));
+        r.setLight({-1.0f, -2.0f, -0.5f});
+        std::uint32_t state = 99;
+        for (int i = 0; i < 300; ++i) {
+            state = state * 1664525u + 1013904223u;
+            const float x = static_cast<float>(state >> 8 & 1023) / 64.0f - 8.0f;
+            const float y = static_cast<float>(state >> 18 & 255) / 64.0f - 1.0f;
+            const float z = static_cast<float>(state & 255) / 16.0f - 12.0f;
+            r.draw(sphere, translation({x, y, z}), rgba(static_cast<std::uint8_t>(state >> 24), 128, 200));
+        }
+    }
+
+    math::simd::Backend original{};
+};
+
+TEST_F(RasterizerTestFixture, TodoPlaneIsVisibleFromItsCameraAndCulledFromBelow) {
+    const Mesh plane = render::makePlane();
+    Rasterizer r(64, 48);
+    r.setViewProjection(camera(64, 48, {0.0f, 1.0f, 2.0f}));
+    r.draw(plane, mat4{}, rgba(255, 255, 255));
+    r.render();
+    EXPECT_NE(r.pixel(32, 24), BACKGROUND); // the origin projects to the centre
+    EXPECT_EQ(r.pixel(0, 0), BACKGROUND);
+    // Lit straight from above with the default light
+    EXPECT_EQ(r.pixel(32, 24), rgba(255, 255, 255));
+    EXPECT_EQ(r.stats().triangles, 2u);
+    EXPECT_EQ(r.stats().visible, 2u);
+
+    r.clear();
+    r.setViewProjection(camera(64, 48, {0.0f, -1.0f, 2.0f}));
+    r.draw(plane, mat4{}, rgba(255, 255, 255));
+    r.render();
+    EXPECT_EQ(covered(r), 0u);
+    EXPECT_EQ(r.stats().visible, 0u);
+}
+
+TEST_F(RasterizerTestFixture, SharedEdgesCoverEveryPixelExactlyOnce) {
+    // Fan of thin triangles around an off-centre point
+    Mesh fan;
+    fan.positions.push_back({0.1f, -0.05f, 0.0f});
+    constexpr int SLICES = 24;
+    for (int i = 0; i <= SLICES; ++i) {
+        const float angle = 2.0f * std::numbers::pi_v<float> * static_cast<float>(i) / SLICES;
+        fan.positions.push_back({0.8f * std::cos(angle), 0.8f * std::sin(angle), 0.0f});
+    }
+    for (std::uint32_t i = 1; i <= SLICES; ++i) fan.indices.insert(fan.indices.end(), {0, i, i + 1});
+
+    Rasterizer r(96, 80);
+    r.draw(fan, mat4{}, rgba(255, 255, 255));
+    r.render();
+    const std::size_t whole = covered(r);
+    EXPECT_GT(whole, 96u * 80u / 3);
+
+    std::size_t sum = 0;
+    for (std::uint32_t i = 0; i < SLICES; ++i) {
+        Mesh slice;
+        slice.positions = fan.positions;
+        slice.indices.assign(fan.indices.begin() + 3 * i, fan.indices.begin() + 3 * i + 3);
+        r.clear();
+        r.draw(slice, mat4{}, rgba(255, 255, 255));
+        r.render();
+        sum += covered(r);
+    }
+    EXPECT_EQ(sum, whole); // no gaps, no overlaps
+
+    // Quad whose edges (and diagonal) run through pixel centres: screen x in [24.5, 72.5], y in [20.5, 60.5].
+    // Left and top edges are covered, right and bottom ones are not
+    Rasterizer q(128, 128);
+    const Mesh quad = square(-0.6171875f, 0.0546875f, 0.1328125f, 0.6796875f, 0.0f);
+    q.draw(quad, mat4{}, rgba(255, 255, 255));
+    q.render();
+    EXPECT_EQ(covered(q), 48u * 40u);
+    EXPECT_NE(q.pixel(24, 20), BACKGROUND);
+    EXPECT_NE(q.pixel(71, 59), BACKGROUND);
+    EXPECT_EQ(q.pixel(72, 20), BACKGROUND);
+    EXPECT_EQ(q.pixel(24, 60), BACKGROUND);
+}
+
+TEST_F(RasterizerTestFixture, DepthTestKeepsNearestAndHierarchyRejectsHiddenBlocks) {
+    const Mesh nearSquare = square(-1.0f, -1.0f, 1.0f, 1.0f, -0.5f);
+    const Mesh farSquare = square(-0.5f, -0.5f, 0.5f, 0.5f, 0.5f);
+    const std::uint32_t red = rgba(255, 0, 0), blue = rgba(0, 0, 255);
+    const render::Image expected = [&] {
+        Rasterizer r(128, 128);
+        r.setLight({0.0f, 0.0f, -1.0f}, 0.0f); // straight onto the squares' +Z normal
+        r.draw(farSquare, mat4{}, blue);
+        r.draw(nearSquare, mat4{}, red);
+        r.render();
+        EXPECT_EQ(r.stats().blocksCulled + r.stats().tilesCulled, 0u);
+        return r.image();
+    }();
+    EXPECT_EQ(expected.at(64, 64), red);
+
+    Rasterizer r(128, 128);
+    r.setLight({0.0f, 0.0f, -1.0f}, 0.0f);
+    r.draw(nearSquare, mat4{}, red);
+    r.draw(farSquare, mat4{}, blue);
+    r.render();
+    EXPECT_EQ(r.image().pixels, expected.pixels);
+    // The near square fills the screen: every tile the far one touches rejects it
+    EXPECT_EQ(r.stats().tilesCulled, r.stats().binned - 2 * 4);
+    EXPECT_FLOAT_EQ(r.depthAt(64, 64), 0.25f);
+}
+
+TEST_F(RasterizerTestFixture, NearPlaneClipsGeometryBehindTheCamera) {
+    // Ground plane reaching far behind a camera just above it
+    const Mesh ground = render::makePlane(200.0f);
+    Rasterizer r(80, 60);
+    r.setViewProjection(camera(80, 60, {0.0f, 0.5f, 1.0f}));
+    r.draw(ground, mat4{}, rgba(0, 255, 0));
+    r.render();
+    EXPECT_GT(r.stats().visible, r.stats().triangles); // split by the near plane
+    for (std::uint32_t x = 0; x < 80; ++x) EXPECT_NE(r.pixel(x, 59), BACKGROUND) << x;
+    for (std::uint32_t x = 0; x < 80; ++x) EXPECT_EQ(r.pixel(x, 0), BACKGROUND) << x;
+}
+
+TEST_F(RasterizerTestFixture, ThreadsAndBackendsGiveIdenticalResults) {
+    const Mesh sphere = render::makeSphere(0.6f, 24, 12);
+    Rasterizer reference(203, 117); // not a multiple of the tile size
+    math::simd::setBackend(math::simd::Backend::Scalar);
+    drawScene(reference, sphere);
+    reference.render();
+    const render::Image expected = reference.image();
+    EXPECT_GT(reference.stats().blocksCulled + reference.stats().tilesCulled, 0u);
+
+    core::JobSystem jobs(4);
+    for (const auto backend : {math::simd::Backend::Scalar, math::simd::Backend::Sse}) {
+        if (!math::simd::setBackend(backend)) continue;
+        SCOPED_TRACE(math::simd::backendName(backend));
+        Rasterizer r(203, 117);
+        drawScene(r, sphere);
+        r.render(&jobs);
+        const render::Image actual = r.image();
+        EXPECT_EQ(std::memcmp(actual.pixels.data(), expected.pixels.data(), expected.pixels.size() * 4), 0);
+        for (std::uint32_t y = 0; y < 117; ++y) {
+            for (std::uint32_t x = 0; x < 203; ++x) ASSERT_EQ(r.depthAt(x, y), reference.depthAt(x, y));
+        }
+    }
+}
+
+TEST_F(RasterizerTestFixture, ImageWritersProduceReadableFiles) {
+    render::Image image{70, 3, {}};
+    for (std::uint32_t i = 0; i < 70 * 3; ++i) image.pixels.push_back(rgba(static_cast<std::uint8_t>(i), 7, 200));
+    const auto read = [](const std::string& path) {
+        std::ifstream file(path, std::ios::binary);
+        return std::vector<std::uint8_t>(std::istreambuf_iterator<char>(file), {});
+    };
+
+    const std::string ppmPath = ::testing::TempDir() + "raster.ppm";
+    ASSERT_TRUE(render::writePpm(ppmPath, image));
+    const std::vector<std::uint8_t> ppm = read(ppmPath);
+    const std::string header = "P6\n70 3\n255\n";
+    ASSERT_EQ(ppm.size(), header.size() + 70 * 3 * 3);
+    EXPECT_EQ(std::string(ppm.begin(), ppm.begin() + static_cast<std::ptrdiff_t>(header.size())), header);
+    EXPECT_EQ(ppm[header.size() + 3 * 5], 5);
+    EXPECT_EQ(ppm[header.size() + 3 * 5 + 2], 200);
+
+    const std::string pngPath = ::testing::TempDir() + "raster.png";
+    ASSERT_TRUE(render::writePng(pngPath, image));
+    const std::vector<std::uint8_t> png = read(pngPath);
+    std::remove(ppmPath.c_str());
+    std::remove(pngPath.c_str());
+    ASSERT_GT(png.size(), 8u);
+    EXPECT_EQ(std::memcmp(png.data(), "\x89PNG\r\n\x1a\n", 8), 0);
+
+    // Walk the chunks, checking each CRC bit by bit, and unpack the stored deflate blocks
+    const auto be32 = [&](std::size_t at) {
+        return std::uint32_t{png[at]} << 24 | std::uint32_t{png[at + 1]} << 16 | std::uint32_t{png[at + 2]} << 8 |
+               png[at + 3];
+    };
+    std::vector<std::uint8_t> zlib;
+    std::vector<std::string> types;
+    for (std::size_t at = 8; at + 12 <= png.size();) {
+        const std::uint32_t length = be32(at);
+        std::uint32_t crc = ~0u;
+        for (std::size_t i = at + 4; i < at + 8 + length; ++i) {
+            crc ^= png[i];
+            for (int k = 0; k < 8; ++k) crc = crc & 1 ? 0xEDB88320u ^ (crc >> 1) : crc >> 1;
+        }
+        EXPECT_EQ(~crc, be32(at + 8 + length));
+        types.emplace_back(png.begin() + static_cast<std::ptrdiff_t>(at + 4), png.begin() + static_cast<std::ptrdiff_t>(at + 8));
+        if (types.back() == "IDAT") zlib.insert(zlib.end(), png.begin() + static_cast<std::ptrdiff_t>(at + 8),
+                                                png.begin() + static_cast<std::ptrdiff_t>(at + 8 + length));
+        at += 12 + length;
+    }
+    EXPECT_EQ(types, (std::vector<std::string>{"IHDR", "IDAT", "IEND"}));
+    ASSERT_GE(zlib.size(), 2u + 5u + 4u);
+    std::vector<std::uint8_t> raw;
+    std::size_t at = 2;
+    for (bool last = false; !last;) {
+        last = zlib[at] & 1;
+        const std::size_t length = zlib[at + 1] | zlib[at + 2] << 8;
+        raw.insert(raw.end(), zlib.begin() + static_cast<std::ptrdiff_t>(at + 5),
+                   zlib.begin() + static_cast<std::ptrdiff_t>(at + 5 + length));
+        at += 5 + length;
+    }
+    ASSERT_EQ(raw.size(), 3u * (1 + 70 * 3));
+    EXPECT_EQ(raw[0], 0); // filter byte
+    EXPECT_EQ(raw[1 + 70 * 3 + 1 + 3 * 4], 74); // row 1, pixel 4: red is its index
+    EXPECT_EQ(raw[1 + 3 * 9 + 1], 7);
+}
@@ -0,0 +1,101 @@
+#include <gtest/gtest.h>
+#include <filesystem>
+#include "include/BodySnapshot.h"
+#include "include/RigidBodies.h"
+
+using math::Vector3;
+using physics::BodyDesc;
+using physics::RigidBodies;
+
+class RigidBodiesTestFixture : public ::testing::Test {
+protected:
+    void SetUp() override {
+        for (int i = 0; i < 5; ++i) {
+            BodyDesc d;
+            d.position = {static_cast<float>(i), 0.0f, 0.0f};
+            d.mass = static_cast<float>(i + 1);
+            d.inertia = {2.0f, 4.0f, 8.0f};
+            bodies.add(d);
+        }
+    }
+
+    static constexpr float EPSILON = 1e-6f;
+    RigidBodies bodies;
+};
+
+TEST_F(RigidBodiesTestFixture, AddStoresInvertedMassAndInertia) {
+    EXPECT_EQ(bodies.size(), 5u);
+    EXPECT_NEAR(bodies.inverseMass[1], 0.5f, EPSILON);
+    const Vector3 inv = bodies.inverseInertia.get(0);
+    EXPECT_NEAR(inv.y, 0.25f, EPSILON);
+    EXPECT_EQ(bodies.orientation(0).w, 1.0f);
+}
+
+TEST_F(RigidBodiesTestFixture, StaticBodyHasZeroInversesAndVelocity) {
+    BodyDesc d;
+    d.mass = 0.0f;
+    d.linearVelocity = {1.0f, 2.0f, 3.0f};
+    const std::size_t i = bodies.add(d);
+    EXPECT_TRUE(bodies.isStatic(i));
+    EXPECT_EQ(bodies.linearVelocity.get(i).y, 0.0f);
+    EXPECT_EQ(bodies.inverseInertia.get(i).x, 0.0f);
+}
+
+TEST_F(RigidBodiesTestFixture, AddNormalizesOrientation) {
+    BodyDesc d;
+    d.orientation = {0.0f, 2.0f, 0.0f, 0.0f};
+    const std::size_t i = bodies.add(d);
+    EXPECT_NEAR(bodies.orientation(i).y, 1.0f, EPSILON);
+}
+
+TEST_F(RigidBodiesTestFixture, RemoveKeepsStreamsInSync) {
+    const std::size_t moved = bodies.remove(1);
+    EXPECT_EQ(moved, 4u);
+    EXPECT_EQ(bodies.size(), 4u);
+    EXPECT_EQ(bodies.position.size(), 4u);
+    EXPECT_EQ(bodies.qw.size(), 4u);
+    EXPECT_EQ(bodies.position.get(1).x, 4.0f);
+    EXPECT_NEAR(bodies.inverseMass[1], 0.2f, EPSILON);
+}
+
+TEST_F(RigidBodiesTestFixture, ForceAtPointProducesTorque) {
+    bodies.applyForceAt(2, {0.0f, 1.0f, 0.0f}, {3.0f, 0.0f, 0.0f});
+    EXPECT_EQ(bodies.force.get(2).y, 1.0f);
+    EXPECT_NEAR(bodies.torque.get(2).z, 1.0f, EPSILON);
+    bodies.clearForces();
+    EXPECT_EQ(bodies.torque.get(2).z, 0.0f);
+}
+
+TEST_F(RigidBodiesTestFixture, InertiaHelpers) {
+    const Vector3 box = physics::boxInertia(12.0f, {0.5f, 1.0f, 1.5f});
+    EXPECT_NEAR(box.x, 4.0f + 9.0f, 1e-5f);
+    EXPECT_NEAR(box.z, 1.0f + 4.0f, 1e-5f);
+    EXPECT_NEAR(physics::sphereInertia(5.0f, 2.0f).y, 8.0f, 1e-5f);
+}
+
+TEST_F(RigidBodiesTestFixture, SnapshotRestoresState) {
+    const std::string path = (std::filesystem::temp_directory_path() / "aurelion_bodies.snap").string();
+    bodies.linearVelocity.set(3, {1.0f, 2.0f, 3.0f});
+    bodies.setOrientation(2, {0.0f, 0.6f, 0.0f, 0.8f});
+    core::SnapshotWriter writer(4096);
+    physics::addToSnapshot(writer, bodies);
+    ASSERT_TRUE(writer.save(path));
+
+    RigidBodies restored;
+    for (int i = 0; i < 5; ++i) restored.add({});
+    core::SnapshotView view;
+    std::string error;
+    ASSERT_TRUE(view.open(path, error)) << error;
+    ASSERT_TRUE(physics::restoreFromSnapshot(view, restored));
+    EXPECT_EQ(restored.position.get(4).x, 4.0f);
+    EXPECT_EQ(restored.linearVelocity.get(3).z, 3.0f);
+    EXPECT_EQ(restored.orientation(2).y, 0.6f);
+    EXPECT_NEAR(restored.inverseMass[1], 0.5f, EPSILON);
+    EXPECT_EQ(restored.inverseInertia.get(0).z, 0.125f);
+
+    restored.add({});
+    EXPECT_FALSE(physics::restoreFromSnapshot(view, restored));
+    EXPECT_EQ(restored.position.get(4).x, 4.0f);
+    view.close();
+    std::filesystem::remove(path);
+}
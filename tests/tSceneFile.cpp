@@ -0,0 +1,126 @@
+#include <gtest/gtest.h>
+#include <cstring>
+#include <string>
+#include "include/JobSystem.h"
+#include "include/SceneFile.h"
+
+using scene::BodyGroup;
+using scene::SceneDescription;
+
+class SceneFileTestFixture : public ::testing::Test {
+protected:
+    static constexpr const char* SCENE = R"(
+# stacked spheres over a ground box
+seed 9
+dt 0.01
+gravity 0 -10 0
+iterations 6
+static box 20 1 20 at 0 -1 0
+body capsule 0.5 0.25 mass 2 at 0 8 0 velocity 1 0 0   # thrown
+grid sphere 0.5 mass 1 count 6 3 6 spacing 1.05 at -2.6 0.6 -2.6 jitter 0.02
+random box 0.2 0.2 0.2 mass 0.5 count 40 within -3 4 -3 3 7 3
+)";
+
+    static SceneDescription parse(const std::string& text) {
+        SceneDescription description;
+        std::string error;
+        EXPECT_TRUE(scene::parseScene(text, description, error)) << error;
+        return description;
+    }
+
+    static std::string parseError(const std::string& text) {
+        SceneDescription description;
+        std::string error;
+        EXPECT_FALSE(scene::parseScene(text, description, error));
+        return error;
+    }
+
+    static bool sameBytes(const float* a, const float* b, std::size_t count) {
+        return std::memcmp(a, b, count * sizeof(float)) == 0;
+    }
+
+    static bool sameState(const physics::RigidBodies& a, const physics::RigidBodies& b) {
+        if (a.size() != b.size()) return false;
+        const std::size_t n = a.size();
+        return sameBytes(a.position.x(), b.position.x(), n) && sameBytes(a.position.y(), b.position.y(), n) &&
+               sameBytes(a.position.z(), b.position.z(), n) &&
+               sameBytes(a.linearVelocity.x(), b.linearVelocity.x(), n) &&
+               sameBytes(a.linearVelocity.y(), b.linearVelocity.y(), n) &&
+               sameBytes(a.angularVelocity.z(), b.angularVelocity.z(), n) && sameBytes(a.qx.data(), b.qx.data(), n) &&
+               sameBytes(a.qw.data(), b.qw.data(), n);
+    }
+};
+
+TEST_F(SceneFileTestFixture, ParsesEveryStatement) {
+    const SceneDescription d = parse(SCENE);
+    EXPECT_EQ(d.seed, 9u);
+    EXPECT_FLOAT_EQ(d.fixedStep, 0.01f);
+    EXPECT_FLOAT_EQ(d.gravity.y, -10.0f);
+    EXPECT_EQ(d.velocityIterations, 6);
+    ASSERT_EQ(d.groups.size(), 4u);
+
+    EXPECT_EQ(d.groups[0].mass, 0.0f);
+    EXPECT_EQ(d.groups[0].shape.type, physics::ShapeType::Box);
+    EXPECT_FLOAT_EQ(d.groups[0].origin.y, -1.0f);
+
+    EXPECT_EQ(d.groups[1].shape.type, physics::ShapeType::Capsule);
+    EXPECT_FLOAT_EQ(d.groups[1].shape.radius, 0.25f);
+    EXPECT_FLOAT_EQ(d.groups[1].velocity.x, 1.0f);
+
+    EXPECT_EQ(d.groups[2].layout, BodyGroup::Layout::Grid);
+    EXPECT_EQ(d.groups[2].count[1], 3u);
+    EXPECT_FLOAT_EQ(d.groups[2].jitter, 0.02f);
+
+    EXPECT_EQ(d.groups[3].layout, BodyGroup::Layout::Random);
+    EXPECT_FLOAT_EQ(d.groups[3].extent.y, 7.0f);
+    EXPECT_EQ(d.bodyCount(), 1u + 1u + 108u + 40u);
+
+    const physics::WorldSettings settings = d.worldSettings();
+    EXPECT_FLOAT_EQ(settings.fixedStep, 0.01f);
+    EXPECT_EQ(settings.solver.velocityIterations, 6);
+}
+
+TEST_F(SceneFileTestFixture, ErrorsNameTheLine) {
+    EXPECT_EQ(parseError("seed 1\n\nteapot 3\n"), "line 3: unknown statement 'teapot'");
+    EXPECT_EQ(parseError("body sphere 1 mass 1 at 0 0\n"), "line 1: expected 'at x y z'");
+    EXPECT_EQ(parseError("# ok\nstatic sphere -1 at 0 0 0\n"), "line 2: expected a shape");
+    EXPECT_EQ(parseError("dt 0.01 0.02\n"), "line 1: unexpected '0.02'");
+
+    SceneDescription d;
+    std::string error;
+    EXPECT_FALSE(scene::loadScene("/nonexistent/scene.txt", d, error));
+    EXPECT_FALSE(error.empty());
+}
+
+TEST_F(SceneFileTestFixture, PopulatedWorldsAreBitIdentical) {
+    const SceneDescription d = parse(SCENE);
+    physics::World a(d.worldSettings()), b(d.worldSettings());
+    scene::populate(d, a);
+    scene::populate(d, b);
+    ASSERT_EQ(a.bodies().size(), d.bodyCount());
+    EXPECT_TRUE(sameState(a.bodies(), b.bodies()));
+    EXPECT_EQ(a.bodies().inverseMass[0], 0.0f);
+    EXPECT_FLOAT_EQ(a.bodies().linearVelocity.get(1).x, 1.0f);
+
+    SceneDescription reseeded = d;
+    reseeded.seed = 10;
+    physics::World c(reseeded.worldSettings());
+    scene::populate(reseeded, c);
+    EXPECT_FALSE(sameState(a.bodies(), c.bodies()));
+}
+
+TEST_F(SceneFileTestFixture, SteppingIsRepeatableWithAndWithoutJobs) {
+    const SceneDescription d = parse(SCENE);
+    physics::World serial(d.worldSettings()), again(d.worldSettings()), parallel(d.worldSettings());
+    for (physics::World* w : {&serial, &again, &parallel}) scene::populate(d, *w);
+    core::JobSystem jobs(4);
+    parallel.setJobSystem(&jobs);
+    for (int i = 0; i < 60; ++i) {
+        serial.step();
+        again.step();
+        parallel.step();
+    }
+    EXPECT_TRUE(sameState(serial.bodies(), again.bodies()));
+    EXPECT_TRUE(sameState(serial.bodies(), parallel.bodies()));
+    EXPECT_GE(serial.lastStepProfile().total(), 0.0);
+}
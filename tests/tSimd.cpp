@@ -0,0 +1,138 @@
+#include <gtest/gtest.h>
+#include <cstring>
+#include <random>
+#include "include/Mat4.h"
+#include "include/Simd.h"
+#include "include/SimdPack.h"
+#include "include/Vector3.h"
+#include "include/Vector4.h"
+
+using math::simd::Backend;
+
+class SimdTestFixture : public ::testing::Test {
+protected:
+    void SetUp() override {
+        original = math::simd::activeBackend();
+        std::mt19937 rng(1234);
+        std::uniform_real_distribution<float> dist(-10.0f, 10.0f);
+        for (auto& row : a.m) for (float& f : row) f = dist(rng);
+        for (auto& row : b.m) for (float& f : row) f = dist(rng);
+        v = math::Vector4(dist(rng), dist(rng), dist(rng), dist(rng));
+    }
+
+    void TearDown() override {
+        math::simd::setBackend(original);
+    }
+
+    static bool sameBits(const void* lhs, const void* rhs, std::size_t bytes) {
+        return std::memcmp(lhs, rhs, bytes) == 0;
+    }
+
+    Backend original = Backend::Scalar;
+    mat4 a, b;
+    math::Vector4 v;
+};
+
+TEST_F(SimdTestFixture, ScalarAlwaysSupported) {
+    EXPECT_TRUE(math::simd::isSupported(Backend::Scalar));
+    EXPECT_TRUE(math::simd::setBackend(Backend::Scalar));
+    EXPECT_EQ(math::simd::activeBackend(), Backend::Scalar);
+    EXPECT_STREQ(math::simd::backendName(Backend::Scalar), "scalar");
+}
+
+TEST_F(SimdTestFixture, Mat4MulIdentity) {
+    mat4 result = a * mat4();
+    EXPECT_TRUE(sameBits(&result, &a, sizeof(mat4)));
+}
+
+TEST_F(SimdTestFixture, BackendsAreBitCompatible) {
+    ASSERT_TRUE(math::simd::setBackend(Backend::Scalar));
+    const mat4 refProduct = a * b;
+    const math::Vector4 refVector = a * v;
+
+    for (Backend backend : {Backend::Sse, Backend::Avx}) {
+        if (!math::simd::setBackend(backend)) continue;
+        SCOPED_TRACE(math::simd::backendName(backend));
+        mat4 product = a * b;
+        math::Vector4 vector = a * v;
+        EXPECT_TRUE(sameBits(&product, &refProduct, sizeof(mat4)));
+        EXPECT_TRUE(sameBits(&vector, &refVector, sizeof(math::Vector4)));
+    }
+}
+
+TEST_F(SimdTestFixture, Mat4MulMatchesDefinition) {
+    mat4 product = a * b;
+    for (int i = 0; i < 4; ++i) {
+        for (int j = 0; j < 4; ++j) {
+            float expected = 0.0f;
+            for (int k = 0; k < 4; ++k) expected += a.m[i][k] * b.m[k][j];
+            EXPECT_NEAR(product.m[i][j], expected, 1e-3f);
+        }
+    }
+}
+
+TEST_F(SimdTestFixture, DotMatchesScalarOrder) {
+    const math::Vector4 w(0.3f, -1.7f, 2.2f, 9.1f);
+    const float scalar = math::simd::dot4Scalar(&v.x, &w.x);
+    EXPECT_EQ(v.dot(w), scalar);
+}
+
+#if AURELION_SIMD_SSE
+TEST_F(SimdTestFixture, CrossMatchesVector3) {
+    const math::Vector3 p(1.5f, -2.0f, 0.25f);
+    const math::Vector3 q(-3.0f, 0.5f, 4.0f);
+    alignas(16) float out[4];
+    _mm_store_ps(out, math::simd::cross3(_mm_setr_ps(p.x, p.y, p.z, 0.0f), _mm_setr_ps(q.x, q.y, q.z, 0.0f)));
+    const math::Vector3 expected = p.cross(q);
+    EXPECT_EQ(out[0], expected.x);
+    EXPECT_EQ(out[1], expected.y);
+    EXPECT_EQ(out[2], expected.z);
+    EXPECT_EQ(out[3], 0.0f);
+}
+#endif
+
+TEST_F(SimdTestFixture, NormalizeVector4) {
+    math::Vector4 n = v;
+    n.normalize();
+    EXPECT_NEAR(n.length(), 1.0f, 1e-6f);
+}
+
+TEST_F(SimdTestFixture, GatherScatterFollowIndices) {
+    const float source[8] = {0, 10, 20, 30, 40, 50, 60, 70};
+    const std::uint32_t index[7] = {7, 2, 5, 0, 3, 6, 1};
+    for (Backend backend : {Backend::Scalar, Backend::Sse}) {
+        if (!math::simd::setBackend(backend)) continue;
+        SCOPED_TRACE(math::simd::backendName(backend));
+        float target[8] = {};
+        math::simd::forEachPack(7, [&]<typename P>(std::size_t begin, std::size_t end) {
+            for (std::size_t i = begin; i < end; i += P::WIDTH) {
+                const auto lanes = P::gather(source, index + i);
+                P::scatter(target, index + i, P::add(lanes, P::set1(1.0f)));
+            }
+        });
+        for (std::size_t i = 0; i < 7; ++i) EXPECT_EQ(target[index[i]], source[index[i]] + 1.0f);
+        EXPECT_EQ(target[4], 0.0f); // not indexed
+    }
+}
+
+TEST_F(SimdTestFixture, CompareMasksSelectAndMove) {
+    const float a[8] = {0, 1, -2, 3, 4, -5, 6, 7};
+    const float b[8] = {1, 1, 1, 1, 1, 1, 1, 1};
+    for (Backend backend : {Backend::Scalar, Backend::Sse}) {
+        if (!math::simd::setBackend(backend)) continue;
+        SCOPED_TRACE(math::simd::backendName(backend));
+        int bits = 0;
+        float picked[8] = {};
+        math::simd::forEachPack(8, [&]<typename P>(std::size_t begin, std::size_t end) {
+            for (std::size_t i = begin; i < end; i += P::WIDTH) {
+                const auto below = P::lessThan(P::load(a + i), P::load(b + i));
+                const auto positive = P::lessThan(P::set1(-1.0f), P::load(a + i));
+                const auto both = P::maskAnd(below, positive);
+                bits |= P::moveMask(both) << i;
+                P::store(picked + i, P::selectNonZero(both, P::set1(1.0f), P::set1(0.0f)));
+            }
+        });
+        EXPECT_EQ(bits, 0b00000001); // only lane 0 is in [-1, 1)
+        for (std::size_t i = 0; i < 8; ++i) EXPECT_EQ(picked[i], i == 0 ? 1.0f : 0.0f);
+    }
+}
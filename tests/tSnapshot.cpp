@@ -0,0 +1,221 @@
+#include <gtest/gtest.h>
+#include <cstddef>
+#include <filesystem>
+#include <fstream>
+#include <vector>
+#include "include/JobSystem.h"
+#include "include/Mat4.h"
+#include "include/Snapshot.h"
+#include "include/Vector3SoA.h"
+
+using core::SnapshotType;
+using core::SnapshotView;
+using core::SnapshotWriter;
+
+class SnapshotTestFixture : public ::testing::Test {
+protected:
+    void TearDown() override {
+        std::filesystem::remove(path);
+        std::filesystem::remove(journal);
+    }
+
+    SnapshotView open() const {
+        SnapshotView view;
+        std::string error;
+        EXPECT_TRUE(view.open(path, error)) << error;
+        return view;
+    }
+
+    static bool aligned(const void* p, std::size_t alignment) {
+        return reinterpret_cast<std::uintptr_t>(p) % alignment == 0;
+    }
+
+    std::string path = (std::filesystem::temp_directory_path() / "aurelion_snapshot_test.snap").string();
+    std::string journal = path + ".journal";
+};
+
+TEST_F(SnapshotTestFixture, ArraysAreReadInPlace) {
+    math::Vector3SoA positions;
+    for (int i = 0; i < 1001; ++i) positions.pushBack({static_cast<float>(i), -static_cast<float>(i), 0.5f});
+    std::vector<float> mass(1001, 2.0f);
+    std::vector<std::uint32_t> ids(7);
+    for (std::uint32_t i = 0; i < ids.size(); ++i) ids[i] = 100 + i;
+    std::vector<mat4> world(3);
+    world[2].m[0][3] = 5.0f;
+
+    SnapshotWriter writer(4096);
+    writer.addVector3("position", positions);
+    writer.add("mass", SnapshotType::Float32, mass.size(), mass.data());
+    writer.add("id", SnapshotType::UInt32, ids.size(), ids.data());
+    writer.add("world", SnapshotType::Mat4, world.size(), world.data());
+    writer.add("empty", SnapshotType::Float64, 0, nullptr);
+    ASSERT_TRUE(writer.save(path));
+    EXPECT_FALSE(writer.lastSave().incremental);
+
+    const SnapshotView view = open();
+    EXPECT_EQ(view.header().version, core::SNAPSHOT_VERSION);
+    EXPECT_EQ(view.header().generation, 1u);
+    EXPECT_EQ(view.records().size(), 5u);
+    EXPECT_EQ(view.header().dataOffset % core::SNAPSHOT_DATA_ALIGNMENT, 0u);
+
+    const std::span<const float> y = view.array<float>("position", 1);
+    ASSERT_EQ(y.size(), 1001u);
+    EXPECT_TRUE(aligned(y.data(), core::SNAPSHOT_PLANE_ALIGNMENT));
+    EXPECT_EQ(y[1000], -1000.0f);
+    EXPECT_EQ(view.array<float>("position", 2)[3], 0.5f);
+    EXPECT_TRUE(view.array<float>("position", 3).empty());
+    EXPECT_EQ(view.array<float>("mass")[500], 2.0f);
+    EXPECT_EQ(view.array<std::uint32_t>("id")[6], 106u);
+    const std::span<const mat4> matrices = view.array<mat4>("world");
+    ASSERT_EQ(matrices.size(), 3u);
+    EXPECT_TRUE(aligned(matrices.data(), core::SNAPSHOT_PLANE_ALIGNMENT));
+    EXPECT_EQ(matrices[2].m[0][3], 5.0f);
+    EXPECT_EQ(matrices[1].m[1][1], 1.0f);
+    EXPECT_TRUE(view.array<double>("empty").empty());
+    EXPECT_TRUE(view.array<double>("mass").empty()); // element size differs
+    EXPECT_EQ(view.find("missing"), nullptr);
+    EXPECT_TRUE(view.verify());
+}
+
+TEST_F(SnapshotTestFixture, IncrementalSaveRewritesOnlyChangedChunks) {
+    std::vector<float> a(100000), b(3000);
+    for (std::size_t i = 0; i < a.size(); ++i) a[i] = static_cast<float>(i);
+    SnapshotWriter writer(4096);
+    writer.add("a", SnapshotType::Float32, a.size(), a.data());
+    writer.add("b", SnapshotType::Float32, b.size(), b.data());
+    ASSERT_TRUE(writer.saveIncremental(path)); // no file yet: full save
+    EXPECT_FALSE(writer.lastSave().incremental);
+    const std::size_t chunks = writer.lastSave().chunks;
+    EXPECT_EQ(chunks, (100000 * 4 + 3000 * 4 + 4095) / 4096);
+
+    core::JobSystem jobs(4);
+    ASSERT_TRUE(writer.saveIncremental(path, &jobs));
+    EXPECT_TRUE(writer.lastSave().incremental);
+    EXPECT_EQ(writer.lastSave().chunksWritten, 0u);
+    EXPECT_EQ(writer.lastSave().bytesWritten, 0u);
+    EXPECT_FALSE(std::filesystem::exists(journal));
+
+    a[5000] = -1.0f;     // chunk 4
+    a[99999] = -2.0f;    // shares the last chunk of a with the start of b
+    b[2999] = 7.0f;
+    ASSERT_TRUE(writer.saveIncremental(path, &jobs));
+    EXPECT_TRUE(writer.lastSave().incremental);
+    EXPECT_EQ(writer.lastSave().chunksWritten, 3u);
+    {
+        const SnapshotView view = open();
+        EXPECT_EQ(view.header().generation, 2u); // the unchanged save wrote nothing
+        EXPECT_EQ(view.array<float>("a")[5000], -1.0f);
+        EXPECT_EQ(view.array<float>("a")[99999], -2.0f);
+        EXPECT_EQ(view.array<float>("a")[5001], 5001.0f);
+        EXPECT_EQ(view.array<float>("b")[2999], 7.0f);
+        EXPECT_TRUE(view.verify());
+    }
+
+    writer.clear();
+    writer.add("a", SnapshotType::Float32, a.size() - 1, a.data()); // new layout
+    ASSERT_TRUE(writer.saveIncremental(path));
+    EXPECT_FALSE(writer.lastSave().incremental);
+    const SnapshotView view = open();
+    EXPECT_EQ(view.header().generation, 1u);
+    EXPECT_EQ(view.array<float>("a").size(), a.size() - 1);
+    EXPECT_EQ(view.find("b"), nullptr);
+}
+
+TEST_F(SnapshotTestFixture, InterruptedIncrementalSavesAreReplayedOrDropped) {
+    std::vector<float> a(20000);
+    for (std::size_t i = 0; i < a.size(); ++i) a[i] = static_cast<float>(i);
+    SnapshotWriter writer(4096);
+    writer.add("a", SnapshotType::Float32, a.size(), a.data());
+    ASSERT_TRUE(writer.save(path));
+
+    // Crash after staging: views refuse the file until the writer side replays the journal
+    a[100] = -1.0f;
+    ASSERT_TRUE(writer.stageIncremental(path));
+    EXPECT_EQ(writer.lastSave().chunksWritten, 1u);
+    ASSERT_TRUE(std::filesystem::exists(journal));
+    {
+        SnapshotView view;
+        std::string error;
+        EXPECT_FALSE(view.open(path, error));
+        EXPECT_NE(error.find("staged"), std::string::npos);
+        EXPECT_TRUE(std::filesystem::exists(journal));
+    }
+    ASSERT_TRUE(SnapshotWriter::commitIncremental(path));
+    {
+        const SnapshotView view = open();
+        EXPECT_EQ(view.header().generation, 2u);
+        EXPECT_EQ(view.array<float>("a")[100], -1.0f);
+        EXPECT_TRUE(view.verify());
+    }
+    EXPECT_FALSE(std::filesystem::exists(journal));
+
+    // Crash while staging (or a writer still streaming it): views read the
+    // untouched snapshot and leave the torn journal for the writer to drop
+    a[5000] = -2.0f;
+    ASSERT_TRUE(writer.stageIncremental(path));
+    std::filesystem::resize_file(journal, std::filesystem::file_size(journal) - 100);
+    {
+        const SnapshotView view = open();
+        EXPECT_EQ(view.header().generation, 2u);
+        EXPECT_EQ(view.array<float>("a")[5000], 5000.0f);
+        EXPECT_TRUE(view.verify());
+    }
+    EXPECT_TRUE(std::filesystem::exists(journal));
+    ASSERT_TRUE(SnapshotWriter::commitIncremental(path));
+    EXPECT_FALSE(std::filesystem::exists(journal));
+
+    // A journal staged against other contents is never applied
+    ASSERT_TRUE(writer.stageIncremental(path));
+    const std::string stale = path + ".stale";
+    std::filesystem::copy_file(journal, stale, std::filesystem::copy_options::overwrite_existing);
+    ASSERT_TRUE(writer.save(path)); // commits the journal, then replaces the file
+    EXPECT_FALSE(std::filesystem::exists(journal));
+    a[5000] = 5000.0f;
+    a[9000] = -3.0f;
+    ASSERT_TRUE(writer.saveIncremental(path));
+    std::filesystem::rename(stale, journal);
+    ASSERT_TRUE(SnapshotWriter::commitIncremental(path));
+    EXPECT_FALSE(std::filesystem::exists(journal));
+    const SnapshotView view = open();
+    EXPECT_EQ(view.header().generation, 2u);
+    EXPECT_EQ(view.array<float>("a")[5000], 5000.0f);
+    EXPECT_EQ(view.array<float>("a")[9000], -3.0f);
+    EXPECT_TRUE(view.verify());
+}
+
+TEST_F(SnapshotTestFixture, RejectsFilesThatAreNotSnapshots) {
+    SnapshotView view;
+    std::string error;
+    EXPECT_FALSE(view.open(path, error)); // missing
+    EXPECT_FALSE(error.empty());
+
+    std::vector<float> data(5000, 1.0f);
+    SnapshotWriter writer(4096);
+    writer.add("data", SnapshotType::Float32, data.size(), data.data());
+    ASSERT_TRUE(writer.save(path));
+    const auto patch = [&](std::streamoff offset, const void* bytes, std::size_t size) {
+        std::fstream file(path, std::ios::binary | std::ios::in | std::ios::out);
+        file.seekp(offset);
+        file.write(static_cast<const char*>(bytes), static_cast<std::streamsize>(size));
+    };
+
+    const float changed = 3.0f;
+    patch(static_cast<std::streamoff>(core::SNAPSHOT_DATA_ALIGNMENT + 40), &changed, sizeof(changed));
+    ASSERT_TRUE(view.open(path, error)) << error; // opening reads no data...
+    EXPECT_FALSE(view.verify());                  // ...verifying does
+    view.close();
+
+    const std::uint32_t future = core::SNAPSHOT_VERSION + 1;
+    patch(offsetof(core::SnapshotHeader, version), &future, sizeof(future));
+    EXPECT_FALSE(view.open(path, error));
+    EXPECT_NE(error.find("version"), std::string::npos);
+    EXPECT_FALSE(view.isOpen());
+
+    ASSERT_TRUE(writer.save(path));
+    std::filesystem::resize_file(path, core::SNAPSHOT_DATA_ALIGNMENT + 4096);
+    EXPECT_FALSE(view.open(path, error));
+
+    std::ofstream(path, std::ios::binary | std::ios::trunc) << std::string(200, 'x');
+    EXPECT_FALSE(view.open(path, error));
+    EXPECT_NE(error.find("not a snapshot"), std::string::npos);
+}
@@ -0,0 +1,163 @@
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <vector>
+#include "include/JobSystem.h"
+#include "include/Simd.h"
+#include "include/SoftBodies.h"
+
+using math::Vector3;
+using physics::SoftBodies;
+using physics::SoftBodyMaterial;
+
+class SoftBodiesTestFixture : public ::testing::Test {
+protected:
+    void SetUp() override {
+        original = math::simd::activeBackend();
+    }
+
+    void TearDown() override {
+        math::simd::setBackend(original);
+    }
+
+    // Square cloth hanging from its two top corners
+    static std::uint32_t hangingCloth(SoftBodies& cloth, std::uint32_t side) {
+        const std::uint32_t first = cloth.addClothGrid({-0.5f, 2.0f, 0.0f}, {1, 0, 0}, {0, 0, 1}, side, side, {});
+        cloth.pin(first);
+        cloth.pin(first + side - 1);
+        return first;
+    }
+
+    static float meanStrain(const SoftBodies& bodies) {
+        float sum = 0.0f;
+        for (const physics::DistanceConstraint& d : bodies.distanceConstraints()) {
+            const float length = (bodies.position.get(d.a) - bodies.position.get(d.b)).length();
+            sum += std::abs(length - d.restLength) / d.restLength;
+        }
+        return sum / static_cast<float>(bodies.distanceConstraints().size());
+    }
+
+    static float volume(const SoftBodies& bodies, const physics::VolumeConstraint& c) {
+        const Vector3 p0 = bodies.position.get(c.particles[0]);
+        return (bodies.position.get(c.particles[1]) - p0)
+                   .cross(bodies.position.get(c.particles[2]) - p0)
+                   .dot(bodies.position.get(c.particles[3]) - p0) / 6.0f;
+    }
+
+    static std::vector<float> positions(const SoftBodies& bodies) {
+        std::vector<float> out;
+        for (std::size_t i = 0; i < bodies.size(); ++i) {
+            const Vector3 p = bodies.position.get(i);
+            out.insert(out.end(), {p.x, p.y, p.z});
+        }
+        return out;
+    }
+
+    math::simd::Backend original = math::simd::Backend::Scalar;
+};
+
+TEST_F(SoftBodiesTestFixture, ClothGridBuildsEdgesAndBends) {
+    SoftBodies cloth;
+    cloth.addClothGrid({}, {1, 0, 0}, {0, 0, 1}, 3, 3, {});
+    EXPECT_EQ(cloth.size(), 9u);
+    // 6 horizontal + 6 vertical + 4 diagonal edges; 8 of them are shared by two triangles
+    EXPECT_EQ(cloth.distanceConstraints().size(), 16u);
+    EXPECT_EQ(cloth.bendingConstraints().size(), 8u);
+    for (const physics::DistanceConstraint& d : cloth.distanceConstraints()) {
+        EXPECT_NEAR(d.restLength, (cloth.position.get(d.a) - cloth.position.get(d.b)).length(), 1e-6f);
+    }
+}
+
+TEST_F(SoftBodiesTestFixture, RigidLinkKeepsLength) {
+    SoftBodies bodies;
+    const std::uint32_t anchor = bodies.addParticle({0, 0, 0}, 0.0f);
+    const std::uint32_t bob = bodies.addParticle({1, 0, 0}, 1.0f);
+    bodies.addDistance(anchor, bob, 0.0f);
+    float lowest = 0.0f;
+    for (int i = 0; i < 60; ++i) {
+        bodies.step(1.0f / 60.0f);
+        EXPECT_NEAR(bodies.position.get(bob).length(), 1.0f, 1e-3f);
+        lowest = std::min(lowest, bodies.position.get(bob).y);
+    }
+    EXPECT_LT(lowest, -0.99f); // swung through the bottom
+    EXPECT_EQ(bodies.position.get(anchor).length(), 0.0f);
+}
+
+TEST_F(SoftBodiesTestFixture, ComplianceGivesStaticStretch) {
+    physics::SoftBodySettings settings;
+    settings.damping = 5.0f;
+    SoftBodies bodies(settings);
+    const std::uint32_t anchor = bodies.addParticle({0, 0, 0}, 0.0f);
+    const std::uint32_t bob = bodies.addParticle({0, -1, 0}, 2.0f);
+    const float compliance = 0.01f;
+    bodies.addDistance(anchor, bob, compliance);
+    for (int i = 0; i < 600; ++i) bodies.step(1.0f / 60.0f);
+    // Hooke: extension = force * compliance, independent of the substep count
+    EXPECT_NEAR(bodies.position.get(bob).y, -1.0f - 2.0f * 9.81f * compliance, 1e-3f);
+}
+
+TEST_F(SoftBodiesTestFixture, HangingClothKeepsEdgeLengths) {
+    SoftBodies cloth;
+    const std::uint32_t first = hangingCloth(cloth, 16);
+    float lowest = 2.0f;
+    for (int i = 0; i < 120; ++i) {
+        cloth.step(1.0f / 60.0f);
+        lowest = std::min(lowest, cloth.position.get(first + 16 * 15).y);
+    }
+    EXPECT_LT(meanStrain(cloth), 0.01f);
+    EXPECT_LT(lowest, 1.1f);                      // free corner swung down about 1 m
+    EXPECT_EQ(cloth.position.get(first).y, 2.0f); // pinned corner did not move
+}
+
+TEST_F(SoftBodiesTestFixture, TetrahedronKeepsVolumeOnGround) {
+    physics::SoftBodySettings settings;
+    settings.groundHeight = 0.0f;
+    SoftBodies bodies(settings);
+    const Vector3 vertices[] = {{0, 1, 0}, {1, 1, 0}, {0, 2, 0}, {0, 1, 1}};
+    const std::uint32_t tetrahedra[] = {0, 1, 2, 3};
+    SoftBodyMaterial material;
+    material.stretchCompliance = 0.01f; // soft edges: only the volume constraint holds the shape
+    bodies.addTetMesh(vertices, tetrahedra, material);
+    ASSERT_EQ(bodies.volumeConstraints().size(), 1u);
+    EXPECT_EQ(bodies.distanceConstraints().size(), 6u);
+    const float rest = bodies.volumeConstraints()[0].restVolume;
+    EXPECT_NEAR(rest, 1.0f / 6.0f, 1e-6f);
+    for (int i = 0; i < 180; ++i) bodies.step(1.0f / 60.0f);
+    for (std::size_t i = 0; i < bodies.size(); ++i) EXPECT_GE(bodies.position.get(i).y, 0.0f);
+    EXPECT_NEAR(volume(bodies, bodies.volumeConstraints()[0]), rest, 0.01f * rest);
+}
+
+TEST_F(SoftBodiesTestFixture, OverflowColorSolvedSerially) {
+    SoftBodies bodies;
+    const std::uint32_t hub = bodies.addParticle({0, 0, 0}, 0.0f);
+    // 100 links sharing one particle: 64 colors, the rest in the overflow color
+    for (int i = 0; i < 100; ++i) {
+        const float a = static_cast<float>(i) * 0.0628f;
+        bodies.addDistance(hub, bodies.addParticle({std::cos(a), 0, std::sin(a)}, 1.0f), 0.0f);
+    }
+    bodies.step(1.0f / 60.0f);
+    EXPECT_EQ(bodies.colorCount(), static_cast<std::size_t>(SoftBodies::MAX_COLORS) + 1);
+    for (int i = 0; i < 30; ++i) bodies.step(1.0f / 60.0f);
+    for (std::uint32_t i = 1; i <= 100; ++i) EXPECT_NEAR(bodies.position.get(i).length(), 1.0f, 1e-3f);
+}
+
+TEST_F(SoftBodiesTestFixture, ThreadsAndBackendsGiveIdenticalResults) {
+    // Large enough for several jobs per color
+    SoftBodies serial;
+    hangingCloth(serial, 128);
+    for (int i = 0; i < 5; ++i) serial.step(1.0f / 60.0f);
+    const std::vector<float> expected = positions(serial);
+
+    core::JobSystem jobs(3);
+    SoftBodies parallel;
+    hangingCloth(parallel, 128);
+    for (int i = 0; i < 5; ++i) parallel.step(1.0f / 60.0f, &jobs);
+    EXPECT_EQ(std::memcmp(expected.data(), positions(parallel).data(), expected.size() * sizeof(float)), 0);
+
+    ASSERT_TRUE(math::simd::setBackend(math::simd::Backend::Scalar));
+    SoftBodies scalar;
+    hangingCloth(scalar, 128);
+    for (int i = 0; i < 5; ++i) scalar.step(1.0f / 60.0f);
+    EXPECT_EQ(std::memcmp(expected.data(), positions(scalar).data(), expected.size() * sizeof(float)), 0);
+}
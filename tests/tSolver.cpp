@@ -0,0 +1,275 @@
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <vector>
+#include "include/JobSystem.h"
+#include "include/Simd.h"
+#include "include/Solver.h"
+#include "include/World.h"
+
+using math::Vector3;
+using physics::BodyDesc;
+using physics::Shape;
+using physics::World;
+
+class SolverTestFixture : public ::testing::Test {
+protected:
+    void SetUp() override {
+        original = math::simd::activeBackend();
+    }
+
+    void TearDown() override {
+        math::simd::setBackend(original);
+    }
+
+    static BodyDesc box(const Vector3& position, const Vector3& halfExtents, float mass) {
+        BodyDesc d;
+        d.position = position;
+        d.mass = mass;
+        d.inertia = physics::boxInertia(mass, halfExtents);
+        d.shape = Shape::box(halfExtents);
+        return d;
+    }
+
+    static BodyDesc ground() { return box({0, -1, 0}, {50, 1, 50}, 0.0f); }
+
+    static BodyDesc point(const Vector3& position, float mass) {
+        BodyDesc d;
+        d.position = position;
+        d.mass = mass;
+        d.inertia = physics::sphereInertia(mass, 0.1f);
+        return d;
+    }
+
+    static void run(World& world, int steps) {
+        for (int i = 0; i < steps; ++i) world.step();
+    }
+
+    // Boxes in a grid on the ground, touching their neighbours
+    static void buildPile(World& world, int side) {
+        world.bodies().add(ground());
+        for (int layer = 0; layer < 2; ++layer) {
+            for (int i = 0; i < side * side; ++i) {
+                const float x = static_cast<float>(i % side), z = static_cast<float>(i / side);
+                world.bodies().add(box({x, 0.5f + static_cast<float>(layer), z}, {0.5f, 0.5f, 0.5f}, 1.0f));
+            }
+        }
+    }
+
+    static std::vector<float> positions(const World& world) {
+        const physics::RigidBodies& b = world.bodies();
+        std::vector<float> out;
+        for (std::size_t i = 0; i < b.size(); ++i) {
+            const Vector3 p = b.position.get(i);
+            out.insert(out.end(), {p.x, p.y, p.z, b.qx[i], b.qy[i], b.qz[i], b.qw[i]});
+        }
+        return out;
+    }
+
+    math::simd::Backend original = math::simd::Backend::Scalar;
+};
+
+TEST_F(SolverTestFixture, BoxRestsOnGround) {
+    World world;
+    world.bodies().add(ground());
+    world.bodies().add(box({0, 0.51f, 0}, {0.5f, 0.5f, 0.5f}, 2.0f));
+    run(world, 120);
+    const Vector3 p = world.bodies().position.get(1);
+    EXPECT_NEAR(p.y, 0.5f, 0.01f);
+    EXPECT_NEAR(p.x, 0.0f, 1e-3f);
+    EXPECT_LT(world.bodies().linearVelocity.get(1).length(), 0.02f);
+    EXPECT_LT(world.bodies().angularVelocity.get(1).length(), 0.02f);
+}
+
+TEST_F(SolverTestFixture, WarmStartImpulsesCarryTheWeight) {
+    World world;
+    world.bodies().add(ground());
+    world.bodies().add(box({0, 0.5f, 0}, {0.5f, 0.5f, 0.5f}, 2.0f));
+    run(world, 60);
+    ASSERT_EQ(world.contacts().manifolds().size(), 1u);
+    const physics::ContactManifold& m = world.contacts().manifolds()[0];
+    float total = 0.0f;
+    for (int i = 0; i < m.pointCount; ++i) total += m.points[i].normalImpulse;
+    // At rest the contact impulse per step equals the weight times dt
+    EXPECT_NEAR(total, 2.0f * 9.81f * world.fixedStep(), 0.01f);
+}
+
+TEST_F(SolverTestFixture, StackStaysUpright) {
+    World world;
+    world.bodies().add(ground());
+    const int height = 5;
+    for (int i = 0; i < height; ++i) {
+        world.bodies().add(box({0, 0.5f + static_cast<float>(i) * 1.001f, 0}, {0.5f, 0.5f, 0.5f}, 1.0f));
+    }
+    run(world, 300);
+    for (int i = 0; i < height; ++i) {
+        const Vector3 p = world.bodies().position.get(static_cast<std::size_t>(i) + 1);
+        EXPECT_NEAR(p.y, 0.5f + static_cast<float>(i), 0.05f) << "box " << i;
+        EXPECT_NEAR(p.x, 0.0f, 0.01f) << "box " << i;
+        EXPECT_NEAR(p.z, 0.0f, 0.01f) << "box " << i;
+    }
+}
+
+TEST_F(SolverTestFixture, FrictionStopsSlidingBox) {
+    for (float friction : {0.0f, 0.6f}) {
+        physics::WorldSettings settings;
+        settings.solver.friction = friction;
+        World world(settings);
+        world.bodies().add(ground());
+        BodyDesc d = box({0, 0.5f, 0}, {0.5f, 0.5f, 0.5f}, 1.0f);
+        d.linearVelocity = {2.0f, 0, 0};
+        world.bodies().add(d);
+        run(world, 60);
+        const float vx = world.bodies().linearVelocity.get(1).x;
+        if (friction == 0.0f) {
+            EXPECT_NEAR(vx, 2.0f, 1e-3f);
+        } else {
+            // mu g = 5.9 m/s^2 stops it in about 0.34 s
+            EXPECT_NEAR(vx, 0.0f, 1e-3f);
+        }
+    }
+}
+
+TEST_F(SolverTestFixture, DistanceJointKeepsLength) {
+    World world;
+    world.bodies().add(point({0, 0, 0}, 0.0f));
+    world.bodies().add(point({1, 0, 0}, 1.0f));
+    world.joints().addDistance(world.bodies(), 0, 1, {0, 0, 0}, {1, 0, 0});
+    float lowest = 0.0f;
+    for (int i = 0; i < 120; ++i) {
+        world.step();
+        // Velocity-level constraint: only Baumgarte feedback limits the drift
+        EXPECT_NEAR(world.bodies().position.get(1).length(), 1.0f, 0.02f);
+        lowest = std::min(lowest, world.bodies().position.get(1).y);
+    }
+    EXPECT_LT(lowest, -0.9f); // swung down through the bottom
+}
+
+TEST_F(SolverTestFixture, BallSocketChainHangsTogether) {
+    World world;
+    world.bodies().add(point({0, 0, 0}, 0.0f));
+    const int links = 5;
+    for (int i = 1; i <= links; ++i) {
+        world.bodies().add(point({static_cast<float>(i) * 0.5f, 0, 0}, 1.0f));
+        const auto a = static_cast<std::uint32_t>(i - 1), b = static_cast<std::uint32_t>(i);
+        world.joints().addBallSocket(world.bodies(), a, b, {(static_cast<float>(i) - 0.5f) * 0.5f, 0, 0});
+    }
+    run(world, 120);
+    for (const physics::BallSocketJoint& j : world.joints().ballSockets) {
+        const physics::RigidBodies& b = world.bodies();
+        const Vector3 anchorA = b.position.get(j.bodyA) + math::rotate(b.orientation(j.bodyA), j.localAnchorA);
+        const Vector3 anchorB = b.position.get(j.bodyB) + math::rotate(b.orientation(j.bodyB), j.localAnchorB);
+        EXPECT_LT((anchorB - anchorA).length(), 0.02f);
+    }
+}
+
+TEST_F(SolverTestFixture, HingeOnlyRotatesAboutItsAxis) {
+    World world;
+    world.bodies().add(point({0, 0, 0}, 0.0f));
+    world.bodies().add(box({1, 0, 0}, {0.5f, 0.1f, 0.1f}, 1.0f));
+    world.joints().addHinge(world.bodies(), 0, 1, {0, 0, 0}, {0, 0, 1});
+    float lowest = 0.0f;
+    for (int i = 0; i < 90; ++i) {
+        world.bodies().applyTorque(1, {0.5f, 0.5f, 0}); // off-axis torque must be resisted
+        world.step();
+        const Vector3 p = world.bodies().position.get(1);
+        EXPECT_NEAR(p.length(), 1.0f, 0.02f);
+        EXPECT_NEAR(p.z, 0.0f, 0.02f);
+        lowest = std::min(lowest, p.y);
+    }
+    EXPECT_LT(lowest, -0.9f); // swung down in the xy plane
+    const Vector3 w = world.bodies().angularVelocity.get(1);
+    EXPECT_NEAR(w.x, 0.0f, 0.05f);
+    EXPECT_NEAR(w.y, 0.0f, 0.05f);
+}
+
+TEST_F(SolverTestFixture, ColoringSeparatesSharedBodies) {
+    physics::RigidBodies bodies;
+    bodies.add(ground());
+    // A row of touching boxes: neighbours share a body, so at least two colors
+    for (int i = 0; i < 8; ++i) bodies.add(box({static_cast<float>(i), 0.5f, 0}, {0.5f, 0.5f, 0.5f}, 1.0f));
+    physics::ContactCache contacts;
+    std::vector<physics::BroadphasePair> pairs;
+    for (std::uint32_t i = 1; i <= 8; ++i) pairs.push_back({0, i});
+    for (std::uint32_t i = 1; i < 8; ++i) pairs.push_back({i, i + 1});
+    physics::sortAndDeduplicate(pairs);
+    contacts.update(bodies, pairs);
+    ASSERT_EQ(contacts.manifolds().size(), 15u);
+
+    physics::ConstraintSolver solver;
+    physics::Joints joints;
+    solver.solve(bodies, contacts.manifolds(), joints, 1.0f / 60.0f);
+    // Ground contacts share only the static ground: they fill one color
+    EXPECT_GE(solver.colorCount(), 2u);
+    EXPECT_LE(solver.colorCount(), 3u);
+    EXPECT_LE(solver.batchCount(), 6u);
+    EXPECT_EQ(solver.islandCount(), 1u);
+}
+
+TEST_F(SolverTestFixture, StacksApartAreSeparateIslands) {
+    World world;
+    world.bodies().add(ground());
+    // Three stacks of two boxes, resting on the shared static ground
+    for (int stack = 0; stack < 3; ++stack) {
+        for (int level = 0; level < 2; ++level) {
+            world.bodies().add(box({static_cast<float>(stack) * 3.0f, 0.5f + static_cast<float>(level), 0},
+                                   {0.5f, 0.5f, 0.5f}, 1.0f));
+        }
+    }
+    world.joints().addDistance(world.bodies(), 2, 3, {0, 1.5f, 0}, {3, 0.5f, 0}); // links the first two
+    run(world, 5);
+    physics::ConstraintSolver solver;
+    solver.solve(world.bodies(), world.contacts().manifolds(), world.joints(), world.fixedStep());
+    EXPECT_EQ(solver.islandCount(), 2u);
+
+    physics::Joints none;
+    solver.solve(world.bodies(), {}, none, world.fixedStep()); // nothing links any body
+    EXPECT_EQ(solver.islandCount(), 0u);
+    EXPECT_EQ(solver.batchCount(), 0u);
+}
+
+TEST_F(SolverTestFixture, ThreadsAndBackendsGiveIdenticalResults) {
+    // Big enough to split every phase: more bodies than BODIES_PER_JOB, a pile
+    // whose colors hold more than BATCHES_PER_JOB batches, and hundreds of
+    // one-box islands that are grouped into jobs
+    constexpr int SIDE = 46;
+    static_assert(2 * SIDE * SIDE > static_cast<int>(World::BODIES_PER_JOB));
+    auto build = [](World& world) {
+        buildPile(world, SIDE);
+        for (int row = 0; row < 10; ++row) {
+            for (int i = 0; i < 40; ++i) {
+                const float x = static_cast<float>(i) * 2.0f - 40.0f, z = -3.0f - 2.0f * static_cast<float>(row);
+                world.bodies().add(box({x, 0.5f, z}, {0.5f, 0.5f, 0.5f}, 1.0f));
+            }
+        }
+    };
+    constexpr int STEPS = 5;
+    World serial;
+    build(serial);
+    run(serial, STEPS);
+    const std::vector<float> expected = positions(serial);
+
+    core::JobSystem jobs(3);
+    World parallel;
+    build(parallel);
+    parallel.setJobSystem(&jobs);
+    run(parallel, STEPS);
+    EXPECT_EQ(std::memcmp(expected.data(), positions(parallel).data(), expected.size() * sizeof(float)), 0);
+    // Bounds and both integrations split every step
+    EXPECT_GE(jobs.splitLoops(), 3u * STEPS);
+
+    // The solver alone: preparing, the island groups and every color pass of the pile
+    physics::ConstraintSolver solver;
+    const std::uint64_t before = jobs.splitLoops();
+    solver.solve(parallel.bodies(), parallel.contacts().manifolds(), parallel.joints(), parallel.fixedStep(), &jobs);
+    EXPECT_GT(solver.islandCount(), 400u);
+    EXPECT_GT(solver.batchCount(), physics::ConstraintSolver::BATCHES_PER_JOB * 2);
+    EXPECT_GE(jobs.splitLoops() - before, 2u + static_cast<std::uint64_t>(solver.settings().velocityIterations));
+
+    ASSERT_TRUE(math::simd::setBackend(math::simd::Backend::Scalar));
+    World scalar;
+    build(scalar);
+    run(scalar, STEPS);
+    EXPECT_EQ(std::memcmp(expected.data(), positions(scalar).data(), expected.size() * sizeof(float)), 0);
+}
@@ -0,0 +1,153 @@
+#include <gtest/gtest.h>
+#include <cmath>
+#include <filesystem>
+#include <fstream>
+#include <thread>
+#include <vector>
+#include "include/SpscQueue.h"
+#include "include/Trajectory.h"
+#include "include/Vector3SoA.h"
+
+using core::TrajectoryReader;
+using core::TrajectoryWriter;
+
+class TrajectoryTestFixture : public ::testing::Test {
+protected:
+    void TearDown() override {
+        std::filesystem::remove(path);
+    }
+
+    // Bodies 0..count-1: the first half at rest, the rest on circles
+    static void move(math::Vector3SoA& position, std::vector<float>& angle, int step) {
+        for (std::size_t i = 0; i < position.size(); ++i) {
+            const float t = 0.01f * static_cast<float>(step) * static_cast<float>(i % 7 + 1);
+            const bool moving = i >= position.size() / 2;
+            position.set(i, {moving ? 10.0f * std::cos(t) : static_cast<float>(i), moving ? 10.0f * std::sin(t) : -3.0f,
+                             static_cast<float>(i) * 0.25f});
+            angle[i] = moving ? t : 1.0f;
+        }
+    }
+
+    std::string path = (std::filesystem::temp_directory_path() / "aurelion_trajectory_test.traj").string();
+};
+
+TEST_F(TrajectoryTestFixture, SpscQueueKeepsOrderAcrossThreads) {
+    core::SpscQueue<std::uint32_t> queue(100);
+    EXPECT_EQ(queue.capacity(), 128u);
+    constexpr std::uint32_t COUNT = 200000;
+    std::thread producer([&] {
+        for (std::uint32_t i = 0; i < COUNT; ++i) {
+            while (!queue.push(i)) std::this_thread::yield();
+        }
+    });
+    std::uint32_t expected = 0, value = 0;
+    while (expected < COUNT) {
+        if (queue.pop(value)) {
+            ASSERT_EQ(value, expected);
+            ++expected;
+        } else {
+            std::this_thread::yield();
+        }
+    }
+    producer.join();
+    EXPECT_FALSE(queue.pop(value));
+
+    core::SpscQueue<int> small(2);
+    EXPECT_TRUE(small.push(1));
+    EXPECT_TRUE(small.push(2));
+    EXPECT_FALSE(small.push(3));
+    EXPECT_EQ(small.size(), 2u);
+}
+
+TEST_F(TrajectoryTestFixture, FramesDecodeWithinPrecisionAndCompress) {
+    constexpr std::size_t BODIES = 1000;
+    constexpr int STEPS = 150;
+    constexpr float PRECISION = 1e-3f;
+    math::Vector3SoA position(BODIES);
+    std::vector<float> angle(BODIES);
+
+    TrajectoryWriter writer;
+    writer.addVector3("position", position, PRECISION);
+    writer.addChannel({"angle", BODIES, 1, 1e-4f}, {angle.data()});
+    ASSERT_TRUE(writer.open(path, {.queueFrames = 4, .framesPerChunk = 32}));
+    std::vector<math::Vector3SoA> expected;
+    std::vector<std::uint64_t> steps;
+    std::uint64_t refused = 0;
+    for (int step = 0; step < STEPS; ++step) {
+        move(position, angle, step);
+        if (step % 10 == 9) continue; // gaps in the step numbers
+        // A full queue drops the frame; retry so every frame lands
+        while (!writer.record(static_cast<std::uint64_t>(step))) {
+            ++refused;
+            std::this_thread::yield();
+        }
+        expected.push_back(position);
+        steps.push_back(static_cast<std::uint64_t>(step));
+    }
+    ASSERT_TRUE(writer.close());
+    const core::TrajectoryStats stats = writer.stats();
+    EXPECT_EQ(stats.framesRecorded, expected.size());
+    EXPECT_EQ(stats.framesDropped, refused);
+    EXPECT_EQ(stats.framesWritten, stats.framesRecorded);
+    EXPECT_EQ(stats.bytesWritten, std::filesystem::file_size(path));
+    EXPECT_LT(stats.bytesWritten * 3, stats.rawBytes); // half the bodies rest, the rest move slowly
+
+    TrajectoryReader reader;
+    std::string error;
+    ASSERT_TRUE(reader.open(path, error)) << error;
+    ASSERT_EQ(reader.frameCount(), expected.size());
+    ASSERT_EQ(reader.channels().size(), 2u);
+    EXPECT_EQ(reader.channels()[0].components, 3u);
+    const int channel = reader.findChannel("position");
+    ASSERT_EQ(channel, 0);
+    EXPECT_EQ(reader.findChannel("velocity"), -1);
+
+    std::size_t frame = 0;
+    while (reader.next()) {
+        ASSERT_LT(frame, expected.size());
+        EXPECT_EQ(reader.step(), steps[frame]);
+        for (std::uint32_t axis = 0; axis < 3; ++axis) {
+            const std::span<const float> decoded = reader.values(channel, axis);
+            ASSERT_EQ(decoded.size(), BODIES);
+            const float* original = axis == 0 ? expected[frame].x() : axis == 1 ? expected[frame].y() : expected[frame].z();
+            for (std::size_t i = 0; i < BODIES; ++i) ASSERT_NEAR(decoded[i], original[i], 0.5f * PRECISION + 1e-5f);
+        }
+        ++frame;
+    }
+    EXPECT_EQ(frame, expected.size());
+
+    const std::size_t target = expected.size() - 5; // inside a chunk, past its key frame
+    ASSERT_TRUE(reader.seek(target));
+    ASSERT_TRUE(reader.next());
+    EXPECT_EQ(reader.frame(), target);
+    EXPECT_EQ(reader.step(), steps[target]);
+    EXPECT_NEAR(reader.values(channel, 1)[BODIES - 1], expected[target].get(BODIES - 1).y, 0.5f * PRECISION + 1e-5f);
+    EXPECT_FALSE(reader.seek(expected.size()));
+}
+
+TEST_F(TrajectoryTestFixture, UnclosedFilesReadUpToTheLastChunk) {
+    std::vector<float> value(100, 0.0f);
+    TrajectoryWriter writer;
+    writer.addChannel({"value", value.size(), 1, 0.01f}, {value.data()});
+    ASSERT_TRUE(writer.open(path, {.queueFrames = 64, .framesPerChunk = 8}));
+    for (int step = 0; step < 20; ++step) {
+        std::fill(value.begin(), value.end(), static_cast<float>(step));
+        while (!writer.record(static_cast<std::uint64_t>(step))) std::this_thread::yield();
+    }
+    ASSERT_TRUE(writer.close());
+
+    // Cut the index off and the last (partial) chunk in half, as if the process died
+    const auto full = std::filesystem::file_size(path);
+    std::filesystem::resize_file(path, full - 24 * 3 - 32 - 10);
+    TrajectoryReader reader;
+    std::string error;
+    ASSERT_TRUE(reader.open(path, error)) << error;
+    EXPECT_EQ(reader.frameCount(), 16u);
+    ASSERT_TRUE(reader.seek(12));
+    ASSERT_TRUE(reader.next());
+    EXPECT_EQ(reader.values(0)[99], 12.0f);
+
+    std::ofstream(path, std::ios::binary | std::ios::trunc) << std::string(100, 'x');
+    EXPECT_FALSE(reader.open(path, error));
+    EXPECT_NE(error.find("not a trajectory"), std::string::npos);
+}
@@ -0,0 +1,92 @@
+#include <gtest/gtest.h>
+#include <random>
+#include <vector>
+#include "include/Simd.h"
+#include "include/TransformBatch.h"
+
+class TransformBatchTestFixture : public ::testing::Test {
+protected:
+    static constexpr std::size_t COUNT = 23;
+
+    void SetUp() override {
+        original = math::simd::activeBackend();
+        std::mt19937 rng(7);
+        std::uniform_real_distribution<float> dist(-3.0f, 3.0f);
+        for (auto& row : m.m) for (float& f : row) f = dist(rng);
+        m.m[3][0] = 0.1f; m.m[3][1] = -0.2f; m.m[3][2] = 0.05f; m.m[3][3] = 4.0f;
+        for (std::size_t i = 0; i < COUNT; ++i) {
+            points.emplace_back(dist(rng), dist(rng), dist(rng));
+            vectors.emplace_back(dist(rng), dist(rng), dist(rng), dist(rng));
+        }
+    }
+
+    void TearDown() override {
+        math::simd::setBackend(original);
+    }
+
+    static void expectSame(const math::Vector3& a, const math::Vector3& b) {
+        EXPECT_EQ(a.x, b.x);
+        EXPECT_EQ(a.y, b.y);
+        EXPECT_EQ(a.z, b.z);
+    }
+
+    math::simd::Backend original = math::simd::Backend::Scalar;
+    mat4 m;
+    std::vector<math::Vector3> points;
+    std::vector<math::Vector4> vectors;
+};
+
+TEST_F(TransformBatchTestFixture, SinglePointUsesTranslation) {
+    mat4 t;
+    t.m[0][3] = 1.0f; t.m[1][3] = 2.0f; t.m[2][3] = 3.0f;
+    expectSame(math::transformPoint(t, {1.0f, 1.0f, 1.0f}), {2.0f, 3.0f, 4.0f});
+    expectSame(math::transformDirection(t, {1.0f, 1.0f, 1.0f}), {1.0f, 1.0f, 1.0f});
+}
+
+TEST_F(TransformBatchTestFixture, PointsMatchSingle) {
+    std::vector<math::Vector3> out(COUNT);
+    math::transformPoints(m, points, out);
+    for (std::size_t i = 0; i < COUNT; ++i) expectSame(out[i], math::transformPoint(m, points[i]));
+
+    math::transformDirections(m, points, out);
+    for (std::size_t i = 0; i < COUNT; ++i) expectSame(out[i], math::transformDirection(m, points[i]));
+
+    math::transformPointsProjective(m, points, out);
+    for (std::size_t i = 0; i < COUNT; ++i) expectSame(out[i], math::transformPointProjective(m, points[i]));
+}
+
+TEST_F(TransformBatchTestFixture, InPlaceTransform) {
+    std::vector<math::Vector3> data = points;
+    math::transformPoints(m, data, data);
+    for (std::size_t i = 0; i < COUNT; ++i) expectSame(data[i], math::transformPoint(m, points[i]));
+}
+
+TEST_F(TransformBatchTestFixture, Vector4MatchesMat4Operator) {
+    std::vector<math::Vector4> out(COUNT);
+    math::transformVectors(m, vectors, out);
+    for (std::size_t i = 0; i < COUNT; ++i) EXPECT_EQ(out[i], m * vectors[i]);
+}
+
+TEST_F(TransformBatchTestFixture, SoAMatchesAoS) {
+    math::Vector3SoA in, out;
+    for (const auto& p : points) in.pushBack(p);
+    math::transformPoints(m, in, out);
+    ASSERT_EQ(out.size(), COUNT);
+    for (std::size_t i = 0; i < COUNT; ++i) expectSame(out.get(i), math::transformPoint(m, points[i]));
+    math::transformDirections(m, in, in);
+    for (std::size_t i = 0; i < COUNT; ++i) expectSame(in.get(i), math::transformDirection(m, points[i]));
+}
+
+TEST_F(TransformBatchTestFixture, ScalarBackendIsBitIdentical) {
+    std::vector<math::Vector3> simdOut(COUNT), scalarOut(COUNT);
+    math::transformPointsProjective(m, points, simdOut);
+    ASSERT_TRUE(math::simd::setBackend(math::simd::Backend::Scalar));
+    math::transformPointsProjective(m, points, scalarOut);
+    for (std::size_t i = 0; i < COUNT; ++i) expectSame(simdOut[i], scalarOut[i]);
+}
+
+TEST_F(TransformBatchTestFixture, EmptyInputIsNoOp) {
+    std::vector<math::Vector3> none;
+    math::transformPoints(m, none, none);
+    SUCCEED();
+}
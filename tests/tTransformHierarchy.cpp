@@ -0,0 +1,192 @@
+#include <gtest/gtest.h>
+#include <cstring>
+#include <vector>
+#include "include/JobSystem.h"
+#include "include/MatrixTransform.h"
+#include "include/Simd.h"
+#include "include/TransformHierarchy.h"
+
+using math::Affine3;
+using math::Quaternion;
+using math::Vector3;
+using scene::Transform;
+using scene::TransformHierarchy;
+
+class TransformHierarchyTestFixture : public ::testing::Test {
+protected:
+    void SetUp() override {
+        original = math::simd::activeBackend();
+    }
+
+    void TearDown() override {
+        math::simd::setBackend(original);
+    }
+
+    static Transform transform(float x, float angle, float s = 1.0f) {
+        Transform t;
+        t.position = {x, 1.0f, -0.5f * x};
+        t.rotation = Quaternion::axisAngle(Vector3{1.0f, 2.0f, 2.0f} / 3.0f, angle);
+        t.scale = {s, s, 2.0f * s};
+        return t;
+    }
+
+    static Affine3 compose(const Transform& t) {
+        return math::composeAffineTRS(t.position, t.rotation, t.scale);
+    }
+
+    // Reference: multiply Affine3s from the root down, parent world first
+    static Affine3 expectedWorld(const TransformHierarchy& h, std::uint32_t node) {
+        const std::uint32_t parent = h.parent(node);
+        const Affine3 local = compose(h.local(node));
+        return parent == TransformHierarchy::NONE ? local : expectedWorld(h, parent) * local;
+    }
+
+    static void expectWorld(const TransformHierarchy& h, std::uint32_t node) {
+        const Affine3 actual = h.world(node);
+        const Affine3 expected = expectedWorld(h, node);
+        EXPECT_EQ(std::memcmp(&actual, &expected, sizeof(Affine3)), 0) << "node " << node;
+    }
+
+    // Each node's parent is an earlier node; deterministic pseudo-random tree
+    static std::vector<std::uint32_t> randomTree(TransformHierarchy& h, std::size_t count) {
+        std::vector<std::uint32_t> nodes;
+        std::uint32_t state = 12345;
+        for (std::size_t i = 0; i < count; ++i) {
+            state = state * 1664525u + 1013904223u;
+            const std::uint32_t parent = i < 8 ? TransformHierarchy::NONE : nodes[(state >> 8) % i];
+            nodes.push_back(h.add(transform(static_cast<float>(i % 17), 0.01f * static_cast<float>(i), 1.0f + 0.001f * static_cast<float>(i % 5)), parent));
+        }
+        return nodes;
+    }
+
+    math::simd::Backend original = math::simd::Backend::Scalar;
+};
+
+TEST_F(TransformHierarchyTestFixture, ChainComposesParentTimesLocal) {
+    TransformHierarchy h;
+    const std::uint32_t root = h.add(transform(1.0f, 0.3f, 2.0f));
+    const std::uint32_t child = h.add(transform(2.0f, -0.7f), root);
+    const std::uint32_t grandchild = h.add(transform(-1.0f, 1.1f, 0.5f), child);
+    h.update();
+    EXPECT_EQ(h.levelCount(), 3u);
+    EXPECT_EQ(h.lastUpdateCount(), 3u);
+    expectWorld(h, root);
+    expectWorld(h, child);
+    expectWorld(h, grandchild);
+    // Child origin sits at the parent's transform of the child's position
+    const Vector3 origin = math::transformPoint(h.world(root), h.local(child).position);
+    EXPECT_EQ(h.world(child).m[0][3], origin.x);
+}
+
+TEST_F(TransformHierarchyTestFixture, OnlyDirtySubtreesAreRecomputed) {
+    TransformHierarchy h;
+    const std::uint32_t a = h.add(transform(1.0f, 0.1f));
+    const std::uint32_t b = h.add(transform(2.0f, 0.2f));
+    const std::uint32_t a1 = h.add(transform(3.0f, 0.3f), a);
+    const std::uint32_t a2 = h.add(transform(4.0f, 0.4f), a1);
+    const std::uint32_t b1 = h.add(transform(5.0f, 0.5f), b);
+    h.update();
+    EXPECT_EQ(h.lastUpdateCount(), 5u);
+    h.update();
+    EXPECT_EQ(h.lastUpdateCount(), 0u); // nothing moved
+
+    const Affine3 before = h.world(b1);
+    h.setLocal(a1, transform(6.0f, 0.6f));
+    h.update();
+    EXPECT_EQ(h.lastUpdateCount(), 2u); // a1 and a2
+    expectWorld(h, a1);
+    expectWorld(h, a2);
+    const Affine3 after = h.world(b1);
+    EXPECT_EQ(std::memcmp(&before, &after, sizeof(Affine3)), 0);
+
+    h.setLocal(a, transform(7.0f, 0.7f));
+    h.update();
+    EXPECT_EQ(h.lastUpdateCount(), 3u);
+    expectWorld(h, a2);
+}
+
+TEST_F(TransformHierarchyTestFixture, OrderIsBreadthFirstAfterReparenting) {
+    TransformHierarchy h;
+    const std::uint32_t leaf = h.add(transform(1.0f, 0.1f));
+    const std::uint32_t root = h.add(transform(2.0f, 0.2f));
+    const std::uint32_t mid = h.add(transform(3.0f, 0.3f), root);
+    h.setParent(leaf, mid); // leaf was added before its new ancestors
+    h.update();
+    EXPECT_EQ(h.levelCount(), 3u);
+    EXPECT_EQ(h.parent(leaf), mid);
+    expectWorld(h, leaf);
+
+    h.setParent(mid, TransformHierarchy::NONE);
+    h.update();
+    EXPECT_EQ(h.levelCount(), 2u);
+    expectWorld(h, mid);
+    expectWorld(h, leaf);
+}
+
+TEST_F(TransformHierarchyTestFixture, RemoveDropsWholeSubtree) {
+    TransformHierarchy h;
+    const std::uint32_t root = h.add(transform(1.0f, 0.1f));
+    const std::uint32_t branch = h.add(transform(2.0f, 0.2f), root);
+    const std::uint32_t twig = h.add(transform(3.0f, 0.3f), branch);
+    const std::uint32_t other = h.add(transform(4.0f, 0.4f), root);
+    h.update();
+    h.remove(branch);
+    EXPECT_EQ(h.size(), 3u);
+    h.update();
+    EXPECT_EQ(h.size(), 2u);
+    EXPECT_FALSE(h.contains(branch));
+    EXPECT_FALSE(h.contains(twig));
+    EXPECT_TRUE(h.contains(other));
+    expectWorld(h, other);
+
+    // Freed handles are reused
+    const std::uint32_t fresh = h.add(transform(5.0f, 0.5f), other);
+    EXPECT_TRUE(fresh == branch || fresh == twig);
+    h.update();
+    expectWorld(h, fresh);
+}
+
+TEST_F(TransformHierarchyTestFixture, LargeTreeMatchesReferenceAfterEdits) {
+    TransformHierarchy h;
+    const std::vector<std::uint32_t> nodes = randomTree(h, 3000);
+    h.update();
+    for (std::size_t i = 0; i < nodes.size(); i += 7) expectWorld(h, nodes[i]);
+    for (std::size_t i = 0; i < nodes.size(); i += 97) h.setLocal(nodes[i], transform(1.0f, 0.001f * static_cast<float>(i)));
+    h.update();
+    EXPECT_LT(h.lastUpdateCount(), nodes.size());
+    for (const std::uint32_t node : nodes) expectWorld(h, node);
+    // Enough dirty nodes to switch from sorting the dirty list to scanning the flags
+    for (std::size_t i = 0; i < nodes.size(); i += 5) h.setLocal(nodes[i], transform(2.0f, 0.002f * static_cast<float>(i)));
+    h.update();
+    for (const std::uint32_t node : nodes) expectWorld(h, node);
+}
+
+TEST_F(TransformHierarchyTestFixture, ThreadsAndBackendsGiveIdenticalResults) {
+    // Wide levels so several jobs run per level
+    auto run = [](core::JobSystem* jobs) {
+        TransformHierarchy h;
+        std::vector<std::uint32_t> roots;
+        for (int i = 0; i < 64; ++i) roots.push_back(h.add(transform(static_cast<float>(i), 0.05f * static_cast<float>(i))));
+        std::vector<std::uint32_t> all;
+        for (int i = 0; i < 20000; ++i) {
+            all.push_back(h.add(transform(0.1f * static_cast<float>(i % 9), 0.002f * static_cast<float>(i)), roots[i % 64]));
+            h.add(transform(1.0f, 0.3f), all.back());
+        }
+        h.update(jobs);
+        h.setLocal(roots[3], transform(9.0f, 0.9f));
+        h.update(jobs);
+        // Many scattered dirty nodes: jobs split across the merged ranges
+        for (std::size_t i = 0; i < all.size(); i += 3) h.setLocal(all[i], transform(2.0f, 0.2f));
+        h.update(jobs);
+        std::vector<Affine3> out;
+        for (std::uint32_t node = 0; node < h.size(); ++node) out.push_back(h.world(node));
+        return out;
+    };
+    const std::vector<Affine3> serial = run(nullptr);
+    core::JobSystem jobs(3);
+    const std::vector<Affine3> parallel = run(&jobs);
+    EXPECT_EQ(std::memcmp(serial.data(), parallel.data(), serial.size() * sizeof(Affine3)), 0);
+    ASSERT_TRUE(math::simd::setBackend(math::simd::Backend::Scalar));
+    const std::vector<Affine3> scalar = run(nullptr);
+    EXPECT_EQ(std::memcmp(serial.data(), scalar.data(), serial.size() * sizeof(Affine3)), 0);
+}
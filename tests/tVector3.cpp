@@ -1,5 +1,6 @@
 #include <gtest/gtest.h>
 #include <cmath>
+#include <type_traits>
 #include "include/Vector3.h"
 
 class Vector3TestFixture : public ::testing::Test {
@@ -218,4 +219,20 @@ TEST_F(Vector3TestFixture, CrossProduct) {
     EXPECT_FLOAT_EQ(result.x, -3.0f);
     EXPECT_FLOAT_EQ(result.y, 6.0f);
     EXPECT_FLOAT_EQ(result.z, -3.0f);
-}
\ No newline at end of file
+}
+
+// ============================================================================
+// HEADER-ONLY / TRIVIALITY TESTS
+// ============================================================================
+
+static_assert(std::is_trivially_copyable_v<math::Vector3>);
+static_assert(math::Vector3(1.0f, 0.0f, 0.0f).cross(math::Vector3(0.0f, 1.0f, 0.0f)).z == 1.0f,
+              "Vector3 arithmetic must be usable in constant expressions");
+
+TEST_F(Vector3TestFixture, ConstexprArithmetic) {
+    constexpr math::Vector3 a(1.0f, 2.0f, 3.0f);
+    constexpr math::Vector3 b = a + a * 2.0f;
+    EXPECT_FLOAT_EQ(b.x, 3.0f);
+    EXPECT_FLOAT_EQ(b.y, 6.0f);
+    EXPECT_FLOAT_EQ(b.z, 9.0f);
+}
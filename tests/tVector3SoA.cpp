@@ -0,0 +1,119 @@
+#include <gtest/gtest.h>
+#include <cstdint>
+#include <random>
+#include <vector>
+#include "include/Simd.h"
+#include "include/Vector3SoA.h"
+
+class Vector3SoATestFixture : public ::testing::Test {
+protected:
+    // Not a multiple of any lane width, so the scalar tail is exercised
+    static constexpr std::size_t COUNT = 37;
+
+    void SetUp() override {
+        original = math::simd::activeBackend();
+        std::mt19937 rng(42);
+        std::uniform_real_distribution<float> dist(-5.0f, 5.0f);
+        for (std::size_t i = 0; i < COUNT; ++i) {
+            aos1.emplace_back(dist(rng), dist(rng), dist(rng));
+            aos2.emplace_back(dist(rng), dist(rng), dist(rng));
+            soa1.pushBack(aos1.back());
+            soa2.pushBack(aos2.back());
+        }
+    }
+
+    void TearDown() override {
+        math::simd::setBackend(original);
+    }
+
+    math::simd::Backend original = math::simd::Backend::Scalar;
+    std::vector<math::Vector3> aos1, aos2;
+    math::Vector3SoA soa1, soa2;
+};
+
+TEST_F(Vector3SoATestFixture, StreamsAreAligned) {
+    for (const float* p : {soa1.x(), soa1.y(), soa1.z()}) {
+        EXPECT_EQ(reinterpret_cast<std::uintptr_t>(p) % math::Vector3SoA::ALIGNMENT, 0u);
+    }
+    EXPECT_EQ(soa1.capacity() % (math::Vector3SoA::ALIGNMENT / sizeof(float)), 0u);
+}
+
+TEST_F(Vector3SoATestFixture, ResizeZeroFillsAndCopyIsDeep) {
+    math::Vector3SoA v(3);
+    EXPECT_EQ(v.size(), 3u);
+    EXPECT_FLOAT_EQ(v.get(2).y, 0.0f);
+
+    math::Vector3SoA copy = soa1;
+    copy.set(0, {9.0f, 9.0f, 9.0f});
+    EXPECT_FLOAT_EQ(soa1.get(0).x, aos1[0].x);
+    EXPECT_EQ(copy.size(), soa1.size());
+}
+
+TEST_F(Vector3SoATestFixture, SwapRemoveMovesLastElement) {
+    soa1.swapRemove(0);
+    EXPECT_EQ(soa1.size(), COUNT - 1);
+    EXPECT_FLOAT_EQ(soa1.get(0).z, aos1.back().z);
+}
+
+TEST_F(Vector3SoATestFixture, AxpyMatchesAoS) {
+    const float dt = 1.0f / 60.0f;
+    math::axpy(dt, soa2, soa1);
+    for (std::size_t i = 0; i < COUNT; ++i) {
+        math::Vector3 expected = aos1[i] + aos2[i] * dt;
+        EXPECT_EQ(soa1.get(i).x, expected.x);
+        EXPECT_EQ(soa1.get(i).y, expected.y);
+        EXPECT_EQ(soa1.get(i).z, expected.z);
+    }
+}
+
+TEST_F(Vector3SoATestFixture, DotLengthCrossMatchAoS) {
+    std::vector<float> dots(COUNT), lengths(COUNT);
+    math::Vector3SoA crosses;
+    math::dot(soa1, soa2, dots);
+    math::length(soa1, lengths);
+    math::cross(soa1, soa2, crosses);
+    for (std::size_t i = 0; i < COUNT; ++i) {
+        EXPECT_EQ(dots[i], aos1[i].dot(aos2[i]));
+        EXPECT_EQ(lengths[i], aos1[i].length());
+        math::Vector3 c = aos1[i].cross(aos2[i]);
+        EXPECT_EQ(crosses.get(i).x, c.x);
+        EXPECT_EQ(crosses.get(i).y, c.y);
+        EXPECT_EQ(crosses.get(i).z, c.z);
+    }
+}
+
+TEST_F(Vector3SoATestFixture, NormalizeKeepsZeroVectors) {
+    soa1.set(5, {0.0f, 0.0f, 0.0f});
+    math::normalize(soa1);
+    EXPECT_FLOAT_EQ(soa1.get(5).x, 0.0f);
+    for (std::size_t i = 0; i < COUNT; ++i) {
+        if (i == 5) continue;
+        math::Vector3 n = aos1[i].normalized();
+        EXPECT_EQ(soa1.get(i).x, n.x);
+        EXPECT_EQ(soa1.get(i).z, n.z);
+    }
+}
+
+TEST_F(Vector3SoATestFixture, MinMax) {
+    math::Vector3 lo, hi;
+    math::minMax(soa1, lo, hi);
+    for (const auto& v : aos1) {
+        EXPECT_LE(lo.x, v.x); EXPECT_LE(lo.y, v.y); EXPECT_LE(lo.z, v.z);
+        EXPECT_GE(hi.x, v.x); EXPECT_GE(hi.y, v.y); EXPECT_GE(hi.z, v.z);
+    }
+    math::Vector3SoA empty;
+    math::minMax(empty, lo, hi);
+    EXPECT_GT(lo.x, hi.x);
+}
+
+TEST_F(Vector3SoATestFixture, ScalarBackendIsBitIdentical) {
+    math::Vector3SoA simdResult = soa1, scalarResult = soa1;
+    math::normalize(simdResult);
+    ASSERT_TRUE(math::simd::setBackend(math::simd::Backend::Scalar));
+    math::normalize(scalarResult);
+    for (std::size_t i = 0; i < COUNT; ++i) {
+        EXPECT_EQ(simdResult.get(i).x, scalarResult.get(i).x);
+        EXPECT_EQ(simdResult.get(i).y, scalarResult.get(i).y);
+        EXPECT_EQ(simdResult.get(i).z, scalarResult.get(i).z);
+    }
+}
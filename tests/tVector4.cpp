@@ -0,0 +1,50 @@
+#include <gtest/gtest.h>
+#include <cmath>
+#include <type_traits>
+#include "include/Vector4.h"
+
+static_assert(std::is_trivially_copyable_v<math::Vector4>);
+static_assert(math::Vector4(1.0f, 2.0f, 3.0f, 4.0f).dot(math::Vector4(1.0f, 1.0f, 1.0f, 1.0f)) == 10.0f,
+              "Vector4::dot must be usable in constant expressions");
+
+class Vector4TestFixture : public ::testing::Test {
+protected:
+    math::Vector4 v1{1.0f, 2.0f, 3.0f, 4.0f};
+    math::Vector4 v2{5.0f, 6.0f, 7.0f, 8.0f};
+    const float EPSILON = 1e-6f;
+};
+
+TEST_F(Vector4TestFixture, DefaultConstructor) {
+    math::Vector4 v;
+    EXPECT_EQ(v, math::Vector4(0.0f, 0.0f, 0.0f, 0.0f));
+}
+
+TEST_F(Vector4TestFixture, ComponentOrder) {
+    EXPECT_FLOAT_EQ(v1.x, 1.0f);
+    EXPECT_FLOAT_EQ(v1.y, 2.0f);
+    EXPECT_FLOAT_EQ(v1.z, 3.0f);
+    EXPECT_FLOAT_EQ(v1.w, 4.0f);
+}
+
+TEST_F(Vector4TestFixture, AssignmentCopiesValues) {
+    math::Vector4 v;
+    v = v2;
+    EXPECT_EQ(v, v2);
+}
+
+TEST_F(Vector4TestFixture, Arithmetic) {
+    EXPECT_EQ(v1 + v2, math::Vector4(6.0f, 8.0f, 10.0f, 12.0f));
+    EXPECT_EQ(v2 - v1, math::Vector4(4.0f, 4.0f, 4.0f, 4.0f));
+    EXPECT_EQ(v1 * 2.0f, math::Vector4(2.0f, 4.0f, 6.0f, 8.0f));
+    EXPECT_EQ(v1 / 2.0f, math::Vector4(0.5f, 1.0f, 1.5f, 2.0f));
+}
+
+TEST_F(Vector4TestFixture, DotAndLength) {
+    EXPECT_FLOAT_EQ(v1.dot(v2), 70.0f);
+    EXPECT_NEAR(v1.length(), std::sqrt(30.0f), EPSILON);
+}
+
+TEST_F(Vector4TestFixture, NormalizedZeroStaysZero) {
+    EXPECT_EQ(math::Vector4().normalized(), math::Vector4());
+    EXPECT_NEAR(v1.normalized().length(), 1.0f, EPSILON);
+}
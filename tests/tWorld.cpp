@@ -0,0 +1,101 @@
+#include <gtest/gtest.h>
+#include <cstdint>
+#include <memory>
+#include "include/World.h"
+
+using math::Vector3;
+using physics::BodyDesc;
+using physics::BroadphaseKind;
+using physics::Shape;
+using physics::World;
+
+class WorldTestFixture : public ::testing::Test {
+protected:
+    // Solid sphere or box with matching inertia; mass 0 makes it static
+    static BodyDesc solid(const Shape& shape, const Vector3& position, float mass = 1.0f) {
+        BodyDesc d;
+        d.position = position;
+        d.mass = mass;
+        d.inertia = shape.type == physics::ShapeType::Sphere ? physics::sphereInertia(mass, shape.radius)
+                                                              : physics::boxInertia(mass, shape.halfExtents);
+        d.shape = shape;
+        return d;
+    }
+};
+
+TEST_F(WorldTestFixture, StepScratchComesFromTheFrameArena) {
+    World world;
+    world.bodies().add(solid(Shape::box({4, 1, 4}), {0, 0, 0}, 0.0f));
+    world.bodies().add(solid(Shape::sphere(0.5f), {0, 1.51f, 0}));
+    BodyDesc shapeless;
+    shapeless.position = {0, 1.51f, 0};
+    world.bodies().add(shapeless);                                   // not collidable
+    world.bodies().add(solid(Shape::sphere(1.0f), {3, 0, 0}, 0.0f)); // static-static pair
+    world.step();
+    ASSERT_EQ(world.contacts().manifolds().size(), 1u);
+
+    // After the first step the arena holds a whole step: collidable indices,
+    // their bounds and the broadphase pairs at least, and nothing more from upstream
+    for (int step = 0; step < 3; ++step) {
+        world.step();
+        const core::memory::MemoryStats& stats = world.frameArena().frameStats();
+        EXPECT_GE(stats.bytes, 3 * (sizeof(std::uint32_t) + sizeof(physics::Aabb)) + sizeof(physics::BroadphasePair));
+        EXPECT_EQ(stats.upstreamAllocations, 0u);
+        if (step > 0) {
+            EXPECT_EQ(world.frameArena().lastFrameStats().upstreamAllocations, 0u);
+        }
+    }
+}
+
+TEST_F(WorldTestFixture, BroadphasesGiveIdenticalSteps) {
+    const auto pile = [](BroadphaseKind kind) {
+        physics::WorldSettings settings;
+        settings.broadphase = kind;
+        auto world = std::make_unique<World>(settings);
+        world->bodies().add(solid(Shape::box({10, 1, 10}), {0, -1, 0}, 0.0f));
+        for (int i = 0; i < 300; ++i) {
+            const Vector3 at(static_cast<float>(i % 7) * 1.1f - 3.0f, 0.6f + static_cast<float>(i / 49) * 1.05f,
+                             static_cast<float>(i / 7 % 7) * 1.1f - 3.0f + 0.01f * static_cast<float>(i % 3));
+            world->bodies().add(solid(i % 2 == 0 ? Shape::sphere(0.5f) : Shape::box({0.45f, 0.45f, 0.45f}), at));
+        }
+        for (int s = 0; s < 40; ++s) world->step();
+        return world;
+    };
+    const std::unique_ptr<World> sweep = pile(BroadphaseKind::SweepAndPrune);
+    const std::unique_ptr<World> tree = pile(BroadphaseKind::DynamicAabbTree);
+    EXPECT_EQ(tree->activeBroadphase(), BroadphaseKind::DynamicAabbTree);
+    ASSERT_EQ(sweep->contacts().manifolds().size(), tree->contacts().manifolds().size());
+    EXPECT_GT(sweep->contacts().manifolds().size(), 100u);
+    for (std::size_t i = 0; i < sweep->bodies().size(); ++i) {
+        const Vector3 a = sweep->bodies().position.get(i), b = tree->bodies().position.get(i);
+        ASSERT_TRUE(a.x == b.x && a.y == b.y && a.z == b.z) << "body " << i;
+    }
+}
+
+TEST_F(WorldTestFixture, AutomaticBroadphaseLeavesDegenerateSweeps) {
+    // Well apart, but x spreads most and every box of a 24 x 24 plane shares its x range
+    World lattice;
+    lattice.integratorSettings().gravity = {0, 0, 0};
+    for (int x = 0; x < 4; ++x) {
+        for (int y = 0; y < 24; ++y) {
+            for (int z = 0; z < 24; ++z) {
+                const Vector3 at(static_cast<float>(x) * 20.0f, static_cast<float>(y) * 2.2f, static_cast<float>(z) * 2.2f);
+                lattice.bodies().add(solid(Shape::sphere(0.5f), at));
+            }
+        }
+    }
+    EXPECT_EQ(lattice.activeBroadphase(), BroadphaseKind::SweepAndPrune);
+    lattice.step();
+    EXPECT_EQ(lattice.activeBroadphase(), BroadphaseKind::DynamicAabbTree);
+    lattice.step();
+    EXPECT_TRUE(lattice.contacts().manifolds().empty());
+
+    // A loose pile stays with sweep and prune
+    World pile;
+    for (int i = 0; i < 200; ++i) {
+        const Vector3 at(static_cast<float>(i % 10) * 1.2f, 0.0f, static_cast<float>(i / 10) * 1.2f);
+        pile.bodies().add(solid(Shape::sphere(0.5f), at));
+    }
+    pile.step();
+    EXPECT_EQ(pile.activeBroadphase(), BroadphaseKind::SweepAndPrune);
+}